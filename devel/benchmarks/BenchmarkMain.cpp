@@ -0,0 +1,32 @@
+#include "BenchmarkMain.h"
+
+#include "ColumnWriterBenchmark.h"
+#include "ComplexArrayBenchmark.h"
+#include "ConstantsGenerationBenchmark.h"
+#include "ConversionLookupBenchmark.h"
+#include "FilterBenchmark.h"
+#include "IntegrationBenchmark.h"
+#include "InterpolationBenchmark.h"
+#include "SolversBenchmark.h"
+#include "TrackedBenchmark.h"
+#include "UnitIdBenchmark.h"
+#include "UnitParsingBenchmark.h"
+
+namespace benchmarks {
+
+BenchmarkMain::BenchmarkMain()
+{
+    TrackedBenchmark{};
+    ComplexArrayBenchmark{};
+    ConversionLookupBenchmark{};
+    UnitParsingBenchmark{};
+    UnitIdBenchmark{};
+    ColumnWriterBenchmark{};
+    IntegrationBenchmark{};
+    FilterBenchmark{};
+    InterpolationBenchmark{};
+    SolversBenchmark{};
+    ConstantsGenerationBenchmark{};
+}
+
+}
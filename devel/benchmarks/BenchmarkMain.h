@@ -0,0 +1,11 @@
+#pragma once
+
+namespace benchmarks {
+
+class BenchmarkMain
+{
+public:
+    BenchmarkMain();
+};
+
+}
@@ -0,0 +1,64 @@
+#include "ColumnWriterBenchmark.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityWriting.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * dumping a result column, operator<< with full precision or round_trip against column_writer
+ */
+ColumnWriterBenchmark::ColumnWriterBenchmark()
+{
+    const std::size_t n = 200000;
+    std::vector<t::watt> values(n);
+    for (std::size_t i = 0; i < n; ++i) values[i] = t::watt{1e3 / (1.0 + static_cast<double>(i))};
+
+    std::size_t sink = 0;
+    const double tStream = seconds([&] {
+        std::ostringstream s;
+        s << std::setprecision(17);
+        for (auto const& v : values) s << v << '\n';
+        sink += s.str().size();
+    });
+    const double tRoundTrip = seconds([&] {
+        std::ostringstream s;
+        s << round_trip;
+        for (auto const& v : values) s << v << '\n';
+        sink += s.str().size();
+    });
+    const double tWriter = seconds([&] {
+        std::ostringstream s;
+        {
+            column_writer<u::watt> w{s};
+            w.write(values.begin(), values.end());
+        }
+        sink += s.str().size();
+    });
+
+    std::cout << "column writing: operator<< " << tStream / n * 1e9 << "ns/value, "
+              << "operator<< round_trip " << tRoundTrip / n * 1e9 << "ns/value, "
+              << "column_writer " << tWriter / n * 1e9 << "ns/value"
+              << " (checksum " << sink << ")\n";
+}
+}
@@ -0,0 +1,65 @@
+#include "ComplexArrayBenchmark.h"
+
+#include <src/numeric/numericComplexArray.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <chrono>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+using namespace unit::literals;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * admittance of a series rlc circuit over a frequency sweep, once as a vector of
+ * complex quantities and once with the split complex_array kernels
+ */
+ComplexArrayBenchmark::ComplexArrayBenchmark()
+{
+    const std::size_t n = 4096;
+    const int repetitions = 2000;
+
+    std::vector<Quantity<u::ohm, std::complex<double>>> interleaved(n);
+    complex_array<u::ohm> split(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::complex<double> z{50.0, -100.0 + 0.05 * static_cast<double>(i)};
+        interleaved[i] = Quantity<u::ohm, std::complex<double>>{z};
+        split.set(i, interleaved[i]);
+    }
+
+    double sink = 0;
+    std::vector<Quantity<u::siemens, std::complex<double>>> y(n);
+    const double tInterleaved = seconds([&] {
+        for (int r = 0; r < repetitions; ++r) {
+            for (std::size_t i = 0; i < n; ++i) y[i] = 1.0_n / interleaved[i];
+            sink += y[r % n].magnitude().real();
+        }
+    });
+    const double tSplit = seconds([&] {
+        for (int r = 0; r < repetitions; ++r) {
+            const auto ys = 1.0_n / split;
+            sink += ys[r % n].magnitude().real();
+        }
+    });
+
+    const double elements = static_cast<double>(n) * repetitions;
+    std::cout << "complex admittance: std::complex " << tInterleaved / elements * 1e9 << "ns/element, "
+              << "complex_array " << tSplit / elements * 1e9 << "ns/element"
+              << " (checksum " << sink << ")\n";
+}
+}
@@ -0,0 +1,116 @@
+#include "ConstantsGenerationBenchmark.h"
+
+#include <tools/pysConstsantsGeneration/NistConstantsGenerator.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// a line of allascii.txt, name, value, uncertainty and unit in fixed columns
+NistDefinition line(std::string const& name, std::string const& unit)
+{
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer), "%-60s%-25s%-25s%s", name.c_str(), "1.234 567 e-5", "0.000 012 e-5", unit.c_str());
+    return NistDefinition{buffer};
+}
+
+/**
+ * n constants in units of the electron volt, the atomic mass unit, the hartree and the speed of
+ * light, which are defined at the end of the table like in a listing sorted by name
+ */
+NistConstantsGenerator::PysDefinitions table(std::size_t n)
+{
+    const char* units[] = {"eV", "u", "E_h", "m s^-1", "eV K^-1", "c^-1 MeV", "kg m^2 s^-2", "u E_h^-1"};
+    NistConstantsGenerator::PysDefinitions d;
+    char name[64];
+    for (std::size_t i = 0; i < n; ++i) {
+        std::snprintf(name, sizeof(name), "synthetic constant %05u", static_cast<unsigned>(i));
+        d.push_back(line(name, units[i % 8]));
+    }
+    d.push_back(line("electron volt", "J"));
+    d.push_back(line("hartree-electron volt relationship", "eV"));
+    d.push_back(line("speed of light in vacuum", "m s^-1"));
+    d.push_back(line("unified atomic mass unit", "kg"));
+    return d;
+}
+
+// a definition as the replaced generation loop saw it, uses was a substring search in the unit expression
+struct Substring {
+    std::string name;
+    std::string unit;
+
+    bool uses(Substring const& other) const { return unit.find(other.name) != std::string::npos; }
+};
+
+// the replaced generation loop, restarting the search for an unused definition after every emit
+std::size_t restartingOrder(NistConstantsGenerator::PysDefinitions const& definitions)
+{
+    std::list<Substring> remaining;
+    for (auto const& d : definitions) {
+        std::string unit;
+        for (auto const& id : d.identifiers()) unit += (unit.empty() ? "" : "*") + id;
+        remaining.push_back(Substring{d.name(), unit});
+    }
+
+    std::size_t emitted = 0;
+    while (remaining.empty() == false) {
+        auto candidate = remaining.begin();
+        for (; candidate != remaining.end(); ++candidate)
+            if (std::none_of(remaining.begin(), remaining.end(), [&](Substring const& other) { return candidate->uses(other); })) break;
+        assert(candidate != remaining.end());
+        remaining.erase(candidate);
+        ++emitted;
+    }
+    return emitted;
+}
+
+bool isOrdered(NistConstantsGenerator::PysDefinitions const& d, std::vector<std::size_t> const& order)
+{
+    std::vector<std::size_t> position(d.size());
+    for (std::size_t i = 0; i < order.size(); ++i) position[order[i]] = i;
+    for (std::size_t i = 0; i < d.size(); ++i)
+        for (std::size_t j = d.size() - 4; j < d.size(); ++j)
+            if (d[i].uses(d[j]) && position[j] > position[i]) return false;
+    return order.size() == d.size();
+}
+}
+
+/**
+ * emission order of synthetic constant tables, dependency graph and kahn's algorithm against the
+ * restarting search it replaced
+ */
+ConstantsGenerationBenchmark::ConstantsGenerationBenchmark()
+{
+    const auto small = table(300);
+    const auto large = table(10000);
+
+    std::size_t sink = 0;
+    const double tRestarting = seconds([&] { sink += restartingOrder(small); });
+    std::vector<std::size_t> order;
+    const double tSmall = seconds([&] { order = NistConstantsGenerator::dependencyOrder(small); });
+    sink += order.size();
+    const double tLarge = seconds([&] { order = NistConstantsGenerator::dependencyOrder(large); });
+    sink += order.size();
+    assert(isOrdered(large, order));
+
+    std::cout << "constants order: 300 entries restarting search " << tRestarting * 1e3 << "ms, dependency graph " << tSmall * 1e3
+              << "ms, 10k entries dependency graph " << tLarge * 1e3 << "ms (" << sink << ")\n";
+}
+}
@@ -0,0 +1,55 @@
+#include "ConversionLookupBenchmark.h"
+
+#include <tools/unitCatalogGeneration/generated/unitConversionTable.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * unit string to factor lookups of all catalog keys, perfect hash table against std::unordered_map
+ */
+ConversionLookupBenchmark::ConversionLookupBenchmark()
+{
+    const int repetitions = 2000;
+
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, double> map;
+    for (auto const& e : conversion::table::Table<>::entries) {
+        keys.push_back(e.name);
+        map[e.name] = e.factor;
+    }
+
+    double sink = 0;
+    const double tTable = seconds([&] {
+        for (int r = 0; r < repetitions; ++r)
+            for (auto const& k : keys) sink += conversion::find(k)->factor;
+    });
+    const double tMap = seconds([&] {
+        for (int r = 0; r < repetitions; ++r)
+            for (auto const& k : keys) sink += map.find(k)->second;
+    });
+
+    const double lookups = static_cast<double>(keys.size()) * repetitions;
+    std::cout << "unit lookup: perfect hash " << tTable / lookups * 1e9 << "ns/lookup, "
+              << "std::unordered_map " << tMap / lookups * 1e9 << "ns/lookup"
+              << " (checksum " << sink << ")\n";
+}
+}
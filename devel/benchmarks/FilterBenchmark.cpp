@@ -0,0 +1,72 @@
+#include "FilterBenchmark.h"
+
+#include <src/numeric/numericFilter.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * 32 tap fir over 16 channels in blocks of 256 frames, fir_bank against the same loops on doubles
+ */
+FilterBenchmark::FilterBenchmark()
+{
+    const std::size_t channels = 16, frames = 256, taps = 32;
+    const int blocks = 2000;
+
+    std::vector<double> coefficients(taps);
+    for (std::size_t k = 0; k < taps; ++k) coefficients[k] = 1.0 / static_cast<double>(taps);
+    std::vector<double> in(frames * channels);
+    for (std::size_t i = 0; i < in.size(); ++i) in[i] = std::sin(static_cast<double>(i));
+
+    // delay line followed by the block, like fir_bank
+    std::vector<double> work((taps - 1 + frames) * channels, 0.0), out(frames * channels);
+    const double tRaw = seconds([&] {
+        for (int b = 0; b < blocks; ++b) {
+            const std::size_t history = (taps - 1) * channels;
+            std::copy(in.begin(), in.end(), work.begin() + static_cast<std::ptrdiff_t>(history));
+            std::fill(out.begin(), out.end(), 0.0);
+            for (std::size_t k = 0; k < taps; ++k) {
+                double const* x = work.data() + history - k * channels;
+                for (std::size_t i = 0; i < out.size(); ++i) out[i] += coefficients[k] * x[i];
+            }
+            std::copy(work.end() - static_cast<std::ptrdiff_t>(history), work.end(), work.begin());
+        }
+    });
+
+    using Acceleration = Quantity<u::meter_per_second_squared>;
+    std::vector<Quantity<u::unitless>> qCoefficients(taps);
+    for (std::size_t k = 0; k < taps; ++k) qCoefficients[k] = Quantity<u::unitless>{coefficients[k]};
+    std::vector<Acceleration> qIn(in.size()), qOut;
+    for (std::size_t i = 0; i < in.size(); ++i) qIn[i] = Acceleration{in[i]};
+    fir_bank<u::meter_per_second_squared> bank{channels, qCoefficients};
+    const double tQuantity = seconds([&] {
+        for (int b = 0; b < blocks; ++b) bank.process(qIn, qOut);
+    });
+
+    double sink = 0;
+    for (std::size_t i = 0; i < out.size(); ++i) sink += out[i] - qOut[i].magnitude();
+
+    const double samples = static_cast<double>(frames * channels) * blocks;
+    std::cout << "fir filtering: double " << tRaw / samples * 1e9 << "ns/sample, "
+              << "fir_bank " << tQuantity / samples * 1e9 << "ns/sample"
+              << " (difference " << sink << ")\n";
+}
+}
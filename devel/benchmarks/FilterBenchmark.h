@@ -0,0 +1,9 @@
+#pragma once
+
+namespace benchmarks {
+class FilterBenchmark
+{
+public:
+    FilterBenchmark();
+};
+}
@@ -0,0 +1,73 @@
+#include "IntegrationBenchmark.h"
+
+#include <src/numeric/numericIntegration.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * particles on springs, velocity verlet on quantity batches against the same loop on doubles
+ */
+IntegrationBenchmark::IntegrationBenchmark()
+{
+    const std::size_t n = 100000;
+    const int steps = 100;
+    const double dt = 1e-3;
+
+    std::vector<double> x(n), v(n, 0.0), a(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = static_cast<double>(i % 100) * 1e-2;
+        a[i] = -x[i];
+    }
+    const double tRaw = seconds([&] {
+        for (int s = 0; s < steps; ++s) {
+            for (std::size_t i = 0; i < n; ++i) v[i] += a[i] * (0.5 * dt);
+            for (std::size_t i = 0; i < n; ++i) x[i] += v[i] * dt;
+            for (std::size_t i = 0; i < n; ++i) a[i] = -1.0 * x[i];
+            for (std::size_t i = 0; i < n; ++i) v[i] += a[i] * (0.5 * dt);
+        }
+    });
+
+    using Acceleration = Quantity<u::meter_per_second_squared>;
+    std::vector<t::meter> qx(n);
+    std::vector<Quantity<u::meter_per_second>> qv(n, Quantity<u::meter_per_second>{0});
+    std::vector<Acceleration> qa(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        qx[i] = t::meter{static_cast<double>(i % 100) * 1e-2};
+        qa[i] = Acceleration{-qx[i].magnitude()};
+    }
+    const auto spring = [](std::vector<t::meter> const& p, std::vector<Acceleration>& out) {
+        for (std::size_t i = 0; i < p.size(); ++i) out[i] = -1.0_n / square(second) * p[i];
+    };
+    const double tQuantity = seconds([&] {
+        for (int s = 0; s < steps; ++s) verlet_step(qx, qv, qa, t::second{dt}, spring);
+    });
+
+    double sink = 0;
+    for (std::size_t i = 0; i < n; ++i) sink += x[i] - qx[i].magnitude();
+
+    const double updates = static_cast<double>(n) * steps;
+    std::cout << "verlet integration: double " << tRaw / updates * 1e9 << "ns/particle step, "
+              << "quantity batch " << tQuantity / updates * 1e9 << "ns/particle step"
+              << " (difference " << sink << ")\n";
+}
+}
@@ -0,0 +1,65 @@
+#include "InterpolationBenchmark.h"
+
+#include <src/numeric/numericInterpolation.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * batch lookups in a pressure over temperature table with a uniform and a non uniform axis
+ */
+InterpolationBenchmark::InterpolationBenchmark()
+{
+    const std::size_t points = 1000;
+    const std::size_t n = 1000000;
+
+    std::vector<t::kelvin> uniform, stretched;
+    std::vector<t::pascal> pressures;
+    for (std::size_t i = 0; i < points; ++i) {
+        const double f = static_cast<double>(i) / (points - 1);
+        uniform.push_back(t::kelvin{250 + 100 * f});
+        stretched.push_back(t::kelvin{250 + 100 * f * f});
+        pressures.push_back(t::pascal{std::exp(f)});
+    }
+    const table_1d<u::kelvin, u::pascal> uniformTable{uniform, pressures};
+    const table_1d<u::kelvin, u::pascal> stretchedTable{stretched, pressures};
+
+    std::vector<t::kelvin> queries(n);
+    double x = 0.3;
+    for (auto& q : queries) {
+        x = 3.99 * x * (1 - x);
+        q = t::kelvin{250 + 100 * x};
+    }
+    std::vector<t::pascal> out;
+    uniformTable.evaluate(queries, out);
+
+    double sink = 0;
+    const double tUniform = seconds([&] { uniformTable.evaluate(queries, out); });
+    sink += out[n / 2].magnitude();
+    const double tSearch = seconds([&] { stretchedTable.evaluate(queries, out); });
+    sink += out[n / 2].magnitude();
+
+    std::cout << "table_1d lookup: uniform axis " << tUniform / n * 1e9 << "ns/query, "
+              << "binary search " << tSearch / n * 1e9 << "ns/query (" << sink << ")\n";
+}
+}
@@ -0,0 +1,56 @@
+#include "SolversBenchmark.h"
+
+#include <src/numeric/numericSolvers.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * equilibrium temperatures of many bodies, one newton_root call per body against the lock step batch
+ */
+SolversBenchmark::SolversBenchmark()
+{
+    using Conductance = Quantity<quotient_unit<u::watt, sqare_unit<u::kelvin>>>;
+    const std::size_t n = 100000;
+    const Conductance c{0.01};
+    std::vector<t::watt> heating(n);
+    for (std::size_t i = 0; i < n; ++i) heating[i] = t::watt{10.0 + static_cast<double>(i % 1000)};
+    const t::kelvin tolerance = 1e-9_n * kelvin;
+
+    std::vector<t::kelvin> single(n, 1000.0_n * kelvin);
+    const double tSingle = seconds([&] {
+        for (std::size_t i = 0; i < n; ++i)
+            newton_root([&](t::kelvin T) { return c * T * T - heating[i]; }, [&](t::kelvin T) { return 2.0_n * c * T; }, single[i], tolerance);
+    });
+
+    std::vector<t::kelvin> batch(n, 1000.0_n * kelvin);
+    const double tBatch = seconds([&] {
+        newton_root([&](std::size_t i, t::kelvin T) { return c * T * T - heating[i]; }, [&](std::size_t, t::kelvin T) { return 2.0_n * c * T; },
+                    batch, tolerance);
+    });
+
+    double sink = 0;
+    for (std::size_t i = 0; i < n; ++i) sink += single[i].magnitude() - batch[i].magnitude();
+    std::cout << "newton_root: single " << tSingle / n * 1e9 << "ns/problem, batch " << tBatch / n * 1e9 << "ns/problem"
+              << " (difference " << sink << ")\n";
+}
+}
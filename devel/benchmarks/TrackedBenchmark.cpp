@@ -0,0 +1,85 @@
+#include "TrackedBenchmark.h"
+
+#include <src/magnitude/magnitudeTracked.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityPrinting.h>
+#include <tools/pysConstsantsGeneration/generated/physicalConstants.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace benchmarks {
+
+using namespace unit;
+using namespace unit::literals;
+using namespace unit::physicalConstant;
+
+namespace {
+
+double nominal(double v) { return v; }
+double nominal(tracked<double> const& v) { return v.value(); }
+
+/**
+ * thermal de Broglie wavelength chain lambda = h / sqrt(2 pi m k T) mixed with
+ * the stefan-boltzmann law, both sharing h and k, evaluated for many temperatures
+ */
+template <typename T, typename Constants>
+double run_chain(Constants const& c, int iterations)
+{
+    double checksum = 0;
+    for (int i = 0; i < iterations; ++i) {
+        const auto temperature = Quantity<u::kelvin, T>{T{250.0 + i % 100}};
+        const auto kT = c.k * temperature;
+        const auto lambda = c.h / sqrt(2.0_n * 3.14159265358979_n * c.m * kT);
+        const auto flux = c.sigma * square(square(temperature));
+        const auto photons = flux * lambda / (c.h * c.c);
+        checksum += static_cast<double>(nominal(photons.magnitude()));
+    }
+    return checksum;
+}
+
+template <typename T>
+struct Constants {
+    Quantity<decltype(Boltzmann_constant)::unit, T> k;
+    Quantity<decltype(Planck_constant)::unit, T> h;
+    Quantity<decltype(electron_mass)::unit, T> m;
+    Quantity<decltype(speed_of_light_in_vacuum)::unit, T> c;
+    Quantity<decltype(Stefan_Boltzmann_constant)::unit, T> sigma;
+};
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+TrackedBenchmark::TrackedBenchmark()
+{
+    const int iterations = 200000;
+
+    Constants<double> plain;
+    plain.k = Boltzmann_constant;
+    plain.h = Planck_constant;
+    plain.m = electron_mass;
+    plain.c = speed_of_light_in_vacuum;
+    plain.sigma = Stefan_Boltzmann_constant;
+
+    Constants<tracked<double>> withErrors;
+    withErrors.k = make_tracked("Boltzmann_constant", Boltzmann_constant, uncertaintiy::Boltzmann_constant);
+    withErrors.h = make_tracked("Planck_constant", Planck_constant, uncertaintiy::Planck_constant);
+    withErrors.m = make_tracked("electron_mass", electron_mass, uncertaintiy::electron_mass);
+    withErrors.c = make_tracked("speed_of_light_in_vacuum", speed_of_light_in_vacuum, uncertaintiy::speed_of_light_in_vacuum);
+    withErrors.sigma = make_tracked("Stefan_Boltzmann_constant", Stefan_Boltzmann_constant, uncertaintiy::Stefan_Boltzmann_constant);
+
+    double sink = 0;
+    const double tPlain = seconds([&] { sink += run_chain<double>(plain, iterations); });
+    const double tTracked = seconds([&] { sink += run_chain<tracked<double>>(withErrors, iterations); });
+
+    std::cout << "tracked chain: double " << tPlain / iterations * 1e9 << "ns/iteration, "
+              << "tracked<double> " << tTracked / iterations * 1e9 << "ns/iteration"
+              << " (checksum " << sink << ")\n";
+}
+}
@@ -0,0 +1,55 @@
+#include "UnitIdBenchmark.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/unit/UnitId.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <typeinfo>
+
+namespace benchmarks {
+
+using namespace unit;
+
+namespace {
+
+// the mangled signature of a function taking and returning quantities, as in symbol tables and debug info
+template <typename U>
+std::size_t signatureLength()
+{
+    using Product = product_unit<U, U>;
+    return std::string{typeid(Quantity<Product> (*)(Quantity<U>, Quantity<quotient_unit<Product, U>>)).name()}.size();
+}
+
+template <typename... Us>
+struct Signatures;
+
+template <>
+struct Signatures<> {
+    static std::size_t dense() { return 0; }
+    static std::size_t ids() { return 0; }
+};
+
+template <typename U, typename... Us>
+struct Signatures<U, Us...> {
+    static std::size_t dense() { return signatureLength<U>() + Signatures<Us...>::dense(); }
+    static std::size_t ids() { return signatureLength<unit_id<U>>() + Signatures<Us...>::ids(); }
+};
+}
+
+/**
+ * length of the mangled names of functions on the si units with Unit and with UnitId
+ */
+UnitIdBenchmark::UnitIdBenchmark()
+{
+    using All = Signatures<u::unitless, u::meter, u::kilogram, u::second, u::ampere, u::kelvin, u::mole, u::candela,
+                           u::hertz, u::newton, u::pascal, u::joule, u::watt, u::coulomb, u::volt, u::farad, u::ohm,
+                           u::siemens, u::weber, u::tesla, u::henry, u::lux, u::gray, u::katal>;
+
+    const std::size_t dense = All::dense();
+    const std::size_t ids = All::ids();
+    std::cout << "unit id: mangled signatures of 24 si units " << dense << " characters with Unit, " << ids
+              << " with UnitId (" << 100 * ids / dense << "%)\n";
+}
+}
@@ -0,0 +1,57 @@
+#include "UnitParsingBenchmark.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityParsing.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+
+using namespace unit;
+
+namespace {
+
+template <typename F>
+double seconds(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/**
+ * unit expressions as they appear in config files, parsed once and then from the cache
+ */
+UnitParsingBenchmark::UnitParsingBenchmark()
+{
+    const std::vector<std::string> expressions{
+        "kg*m^2/(s^2*A)", "km/h", "N.m", "kW*h", "mol/L", "MPa", "uA", "kg m s^-2", "1/s", "W/(m^2*K)"};
+    const int repetitions = 200000;
+
+    double sink = 0;
+    PackedUnit<7> p;
+    const double tUncached = seconds([&] {
+        for (int r = 0; r < repetitions / 100; ++r)
+            for (auto const& e : expressions) {
+                parse_unit_uncached(e.data(), e.data() + e.size(), p);
+                sink += p.scale;
+            }
+    });
+    const double tCached = seconds([&] {
+        for (int r = 0; r < repetitions; ++r)
+            for (auto const& e : expressions) {
+                parse_unit(e, p);
+                sink += p.scale;
+            }
+    });
+
+    const double n = static_cast<double>(expressions.size());
+    std::cout << "unit parsing: uncached " << tUncached / (n * (repetitions / 100)) * 1e9 << "ns/expression, "
+              << "cached " << n * repetitions / tCached * 1e-6 << "M expressions/s"
+              << " (checksum " << sink << ")\n";
+}
+}
@@ -0,0 +1,27 @@
+HEADERS += \
+    $$PWD/BenchmarkMain.h \
+    $$PWD/ColumnWriterBenchmark.h \
+    $$PWD/ComplexArrayBenchmark.h \
+    $$PWD/ConstantsGenerationBenchmark.h \
+    $$PWD/ConversionLookupBenchmark.h \
+    $$PWD/FilterBenchmark.h \
+    $$PWD/IntegrationBenchmark.h \
+    $$PWD/InterpolationBenchmark.h \
+    $$PWD/SolversBenchmark.h \
+    $$PWD/TrackedBenchmark.h \
+    $$PWD/UnitParsingBenchmark.h \
+    $$PWD/UnitIdBenchmark.h
+
+SOURCES += \
+    $$PWD/BenchmarkMain.cpp \
+    $$PWD/ColumnWriterBenchmark.cpp \
+    $$PWD/ComplexArrayBenchmark.cpp \
+    $$PWD/ConstantsGenerationBenchmark.cpp \
+    $$PWD/ConversionLookupBenchmark.cpp \
+    $$PWD/FilterBenchmark.cpp \
+    $$PWD/IntegrationBenchmark.cpp \
+    $$PWD/InterpolationBenchmark.cpp \
+    $$PWD/SolversBenchmark.cpp \
+    $$PWD/TrackedBenchmark.cpp \
+    $$PWD/UnitParsingBenchmark.cpp \
+    $$PWD/UnitIdBenchmark.cpp
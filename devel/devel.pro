@@ -8,6 +8,7 @@ CONFIG -= qt
 include($$PWD/src/src.pri)
 include($$PWD/tests/tests.pri)
 include($$PWD/tools/tools.pri)
+include($$PWD/benchmarks/benchmarks.pri)
 
 SOURCES += \
     main.cpp \
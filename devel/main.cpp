@@ -3,18 +3,25 @@
 #include "tmp.cpp"
 #include "tests/TestMain.h"
 #include "tools/SingleFileTester.h"
+#include "tools/SingleFileGenerator.h"
+#include "benchmarks/BenchmarkMain.h"
 
 #include <tools/pysConstsantsGeneration/NistConstantsGenerator.h>
+#include <tools/unitCatalogGeneration/UnitCatalogGenerator.h>
 
 int main()
 {
     //NistConstantsGenerator{};
+    //UnitCatalogGenerator{};
+    //SingleFileGenerator{};
 
     tests::TestMain{};
     tmp::run();
 
     SingleFileTester{};
 
+    //benchmarks::BenchmarkMain{};
+
     std::cout<<__FILE__<<" finished\n";
 
     return 0;
@@ -0,0 +1,4 @@
+HEADERS += \
+        $$PWD/magnitudeTracked.h \
+        $$PWD/magnitudeDual.h \
+        $$PWD/magnitudeInterval.h
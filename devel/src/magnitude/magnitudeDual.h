@@ -0,0 +1,160 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityMath.h>
+#include <src/unit/unitOperators.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+
+namespace unit {
+
+/**
+ * magnitude type for forward-mode automatic differentiation with N independent variables
+ *
+ * a dual carries its value and the partial derivatives with respect to the variables
+ * seeded by make_variable, so one evaluation of a function yields its full gradient:
+ *
+ *     auto m = make_variable<0, 2>(3.0_n * kilogram);
+ *     auto v = make_variable<1, 2>(2.0_n * meter / second);
+ *     auto e = 0.5_n * m * square(v);
+ *     auto dE_dv = partial<1, u::meter_per_second>(e);  // Quantity<quotient_unit<joule, meter_per_second>>
+ *
+ * comparison operators compare the values only.
+ */
+template <typename T, std::size_t N>
+class dual {
+   public:
+    using value_type = T;
+    using derivatives_type = std::array<T, N>;
+
+    constexpr dual() : m_value(0), m_derivatives() {}
+    constexpr dual(value_type const& v) : m_value(v), m_derivatives() {}
+    constexpr dual(value_type const& v, derivatives_type const& d) : m_value(v), m_derivatives(d) {}
+
+    static dual variable(value_type const& v, std::size_t index) {
+        dual r{v};
+        r.m_derivatives[index] = value_type(1);
+        return r;
+    }
+
+    constexpr value_type const& value() const { return m_value; }
+    constexpr derivatives_type const& derivatives() const { return m_derivatives; }
+    constexpr value_type const& derivative(std::size_t index) const { return m_derivatives[index]; }
+
+    // v with derivatives c * a'(x), used for unary functions with derivative c
+    static dual chain(value_type const& v, value_type const& c, dual const& a) {
+        dual r{v};
+        for (std::size_t i = 0; i < N; ++i) r.m_derivatives[i] = c * a.m_derivatives[i];
+        return r;
+    }
+
+    // v with derivatives ca * a'(x) + cb * b'(x)
+    static dual combine(value_type const& v, value_type const& ca, dual const& a, value_type const& cb, dual const& b) {
+        dual r{v};
+        for (std::size_t i = 0; i < N; ++i) r.m_derivatives[i] = ca * a.m_derivatives[i] + cb * b.m_derivatives[i];
+        return r;
+    }
+
+    dual& operator+=(dual const& r) {
+        m_value += r.m_value;
+        for (std::size_t i = 0; i < N; ++i) m_derivatives[i] += r.m_derivatives[i];
+        return *this;
+    }
+
+    dual& operator-=(dual const& r) {
+        m_value -= r.m_value;
+        for (std::size_t i = 0; i < N; ++i) m_derivatives[i] -= r.m_derivatives[i];
+        return *this;
+    }
+
+    dual& operator*=(dual const& r) { return *this = combine(m_value * r.m_value, r.m_value, *this, m_value, r); }
+    dual& operator/=(dual const& r) {
+        return *this = combine(m_value / r.m_value, 1 / r.m_value, *this, -m_value / (r.m_value * r.m_value), r);
+    }
+
+    dual& operator+=(value_type const& r) { return m_value += r, *this; }
+    dual& operator-=(value_type const& r) { return m_value -= r, *this; }
+    dual& operator*=(value_type const& r) { return *this = chain(m_value * r, r, *this); }
+    dual& operator/=(value_type const& r) { return *this = chain(m_value / r, 1 / r, *this); }
+
+   private:
+    value_type m_value;
+    derivatives_type m_derivatives;
+};
+
+template <typename T, std::size_t N> dual<T, N> operator+(dual<T, N> l, dual<T, N> const& r) { return l += r; }
+template <typename T, std::size_t N> dual<T, N> operator-(dual<T, N> l, dual<T, N> const& r) { return l -= r; }
+template <typename T, std::size_t N> dual<T, N> operator*(dual<T, N> const& l, dual<T, N> const& r) { return dual<T, N>::combine(l.value() * r.value(), r.value(), l, l.value(), r); }
+template <typename T, std::size_t N> dual<T, N> operator/(dual<T, N> const& l, dual<T, N> const& r) {
+    return dual<T, N>::combine(l.value() / r.value(), 1 / r.value(), l, -l.value() / (r.value() * r.value()), r);
+}
+
+template <typename T, std::size_t N> dual<T, N> operator+(dual<T, N> l, typename dual<T, N>::value_type const& r) { return l += r; }
+template <typename T, std::size_t N> dual<T, N> operator-(dual<T, N> l, typename dual<T, N>::value_type const& r) { return l -= r; }
+template <typename T, std::size_t N> dual<T, N> operator*(dual<T, N> const& l, typename dual<T, N>::value_type const& r) { return dual<T, N>::chain(l.value() * r, r, l); }
+template <typename T, std::size_t N> dual<T, N> operator/(dual<T, N> const& l, typename dual<T, N>::value_type const& r) { return dual<T, N>::chain(l.value() / r, 1 / r, l); }
+
+template <typename T, std::size_t N> dual<T, N> operator+(typename dual<T, N>::value_type const& l, dual<T, N> r) { return r += l; }
+template <typename T, std::size_t N> dual<T, N> operator-(typename dual<T, N>::value_type const& l, dual<T, N> const& r) { return dual<T, N>::chain(l - r.value(), -1, r); }
+template <typename T, std::size_t N> dual<T, N> operator*(typename dual<T, N>::value_type const& l, dual<T, N> const& r) { return dual<T, N>::chain(l * r.value(), l, r); }
+template <typename T, std::size_t N> dual<T, N> operator/(typename dual<T, N>::value_type const& l, dual<T, N> const& r) { return dual<T, N>::chain(l / r.value(), -l / (r.value() * r.value()), r); }
+
+template <typename T, std::size_t N> dual<T, N> operator-(dual<T, N> const& v) { return dual<T, N>::chain(-v.value(), -1, v); }
+
+template <typename T, std::size_t N> bool operator==(dual<T, N> const& l, dual<T, N> const& r) { return l.value() == r.value(); }
+template <typename T, std::size_t N> bool operator!=(dual<T, N> const& l, dual<T, N> const& r) { return l.value() != r.value(); }
+template <typename T, std::size_t N> bool operator< (dual<T, N> const& l, dual<T, N> const& r) { return l.value() <  r.value(); }
+template <typename T, std::size_t N> bool operator<=(dual<T, N> const& l, dual<T, N> const& r) { return l.value() <= r.value(); }
+template <typename T, std::size_t N> bool operator> (dual<T, N> const& l, dual<T, N> const& r) { return l.value() >  r.value(); }
+template <typename T, std::size_t N> bool operator>=(dual<T, N> const& l, dual<T, N> const& r) { return l.value() >= r.value(); }
+
+template <typename T, std::size_t N>
+dual<T, N> abs(dual<T, N> const& v) {
+    return v.value() < T(0) ? -v : v;
+}
+
+template <typename T, std::size_t N>
+dual<T, N> sqrt(dual<T, N> const& v) {
+    using std::sqrt;
+    const T r = sqrt(v.value());
+    return dual<T, N>::chain(r, T(1) / (T(2) * r), v);
+}
+
+template <typename T, std::size_t N>
+dual<T, N> pow(dual<T, N> const& v, typename dual<T, N>::value_type const& e) {
+    using std::pow;
+    return dual<T, N>::chain(pow(v.value(), e), e * pow(v.value(), e - T(1)), v);
+}
+
+template <typename T, std::size_t N>
+std::ostream& operator<<(std::ostream& s, dual<T, N> const& v) {
+    return s << v.value();
+}
+
+/**
+ * seeds x as the independent variable with the given index
+ */
+template <std::size_t index, std::size_t N, typename U, typename T>
+Quantity<U, dual<T, N>> make_variable(Quantity<U, T> const& x) {
+    static_assert(index < N, "variable index out of range");
+    return Quantity<U, dual<T, N>>{dual<T, N>::variable(x.magnitude(), index)};
+}
+
+template <typename U, typename T, std::size_t N>
+Quantity<U, T> nominal_value(Quantity<U, dual<T, N>> const& q) {
+    return Quantity<U, T>{q.magnitude().value()};
+}
+
+/**
+ * partial derivative of y with respect to the variable seeded with the given index, which has the
+ * unit UIn. Neither is recorded in y, the caller has to pass the index and unit of make_variable.
+ */
+template <std::size_t index, typename UIn, typename U, typename T, std::size_t N>
+Quantity<quotient_unit<U, UIn>, T> partial(Quantity<U, dual<T, N>> const& y) {
+    static_assert(index < N, "variable index out of range");
+    return Quantity<quotient_unit<U, UIn>, T>{y.magnitude().derivative(index)};
+}
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityMath.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace unit {
+
+namespace helper {
+
+namespace interval {
+
+/**
+ * directed rounding without touching the fpu rounding mode: a correctly rounded result
+ * is at most one ulp <= |x| * epsilon away from the exact one, so widening by that amount
+ * (plus the smallest denormal for results near zero) always encloses the exact value.
+ * The formulation is branch-free apart from the infinity check and vectorizes.
+ */
+template <typename T>
+T down(T const& x, int ulps = 1) {
+    using std::abs;
+    using std::isfinite;
+    return isfinite(x) ? x - ulps * (abs(x) * std::numeric_limits<T>::epsilon() + std::numeric_limits<T>::denorm_min()) : x;
+}
+
+template <typename T>
+T up(T const& x, int ulps = 1) {
+    using std::abs;
+    using std::isfinite;
+    return isfinite(x) ? x + ulps * (abs(x) * std::numeric_limits<T>::epsilon() + std::numeric_limits<T>::denorm_min()) : x;
+}
+
+// 0 * inf is 0 for bounds: zero times any value of an unbounded interval is zero
+template <typename T>
+T times(T const& a, T const& b) {
+    return a == T(0) || b == T(0) ? T(0) : a * b;
+}
+
+template <typename T>
+T min4(T const& a, T const& b, T const& c, T const& d) {
+    return std::min(std::min(a, b), std::min(c, d));
+}
+
+template <typename T>
+T max4(T const& a, T const& b, T const& c, T const& d) {
+    return std::max(std::max(a, b), std::max(c, d));
+}
+}
+}
+
+/**
+ * magnitude type for interval arithmetic with outward rounded bounds
+ *
+ * every operation returns an interval which certainly contains all results of the
+ * operation applied to values from its operands, so a single evaluation bounds an
+ * expression over the whole input range. Arrays of intervals are stored as aligned
+ * lo/hi pairs, which allows batch evaluation to be vectorized.
+ *
+ * comparisons are certain comparisons, eg a < b is true only if every value of a is
+ * smaller than every value of b. Equality means identical bounds.
+ */
+template <typename T>
+class alignas(2 * sizeof(T)) interval {
+   public:
+    using value_type = T;
+
+    constexpr interval() : m_lo(0), m_hi(0) {}
+    constexpr interval(value_type const& v) : m_lo(v), m_hi(v) {}
+    constexpr interval(value_type const& lo, value_type const& hi) : m_lo(lo), m_hi(hi) {}
+
+    static constexpr interval entire() {
+        return interval{-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity()};
+    }
+
+    // no value at all, eg the square root of negative numbers. Contains nothing, operations on it are undefined
+    static constexpr interval empty() {
+        return interval{std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity()};
+    }
+
+    constexpr bool is_empty() const { return m_lo > m_hi; }
+
+    constexpr value_type const& lo() const { return m_lo; }
+    constexpr value_type const& hi() const { return m_hi; }
+    constexpr value_type width() const { return m_hi - m_lo; }
+    constexpr value_type mid() const { return m_lo + (m_hi - m_lo) / 2; }
+    constexpr bool contains(value_type const& v) const { return m_lo <= v && v <= m_hi; }
+
+    interval& operator+=(interval const& r) { return *this = *this + r; }
+    interval& operator-=(interval const& r) { return *this = *this - r; }
+    interval& operator*=(interval const& r) { return *this = *this * r; }
+    interval& operator/=(interval const& r) { return *this = *this / r; }
+
+   private:
+    value_type m_lo;
+    value_type m_hi;
+};
+
+template <typename T>
+interval<T> operator+(interval<T> const& l, interval<T> const& r) {
+    return interval<T>{helper::interval::down(l.lo() + r.lo()), helper::interval::up(l.hi() + r.hi())};
+}
+
+template <typename T>
+interval<T> operator-(interval<T> const& l, interval<T> const& r) {
+    return interval<T>{helper::interval::down(l.lo() - r.hi()), helper::interval::up(l.hi() - r.lo())};
+}
+
+template <typename T>
+interval<T> operator*(interval<T> const& l, interval<T> const& r) {
+    using helper::interval::times;
+    const T a = times(l.lo(), r.lo());
+    const T b = times(l.lo(), r.hi());
+    const T c = times(l.hi(), r.lo());
+    const T d = times(l.hi(), r.hi());
+    return interval<T>{helper::interval::down(helper::interval::min4(a, b, c, d)),
+                       helper::interval::up(helper::interval::max4(a, b, c, d))};
+}
+
+template <typename T>
+interval<T> operator/(interval<T> const& l, interval<T> const& r) {
+    if (r.contains(T(0)))
+        return interval<T>::entire();
+    using std::isnan;
+    const T a = l.lo() / r.lo();
+    const T b = l.lo() / r.hi();
+    const T c = l.hi() / r.lo();
+    const T d = l.hi() / r.hi();
+    // inf / inf, the reciprocal of r is bounded and is multiplied with 0 * inf == 0
+    if (isnan(a) || isnan(b) || isnan(c) || isnan(d))
+        return l * interval<T>{helper::interval::down(T(1) / r.hi()), helper::interval::up(T(1) / r.lo())};
+    return interval<T>{helper::interval::down(helper::interval::min4(a, b, c, d)),
+                       helper::interval::up(helper::interval::max4(a, b, c, d))};
+}
+
+template <typename T> interval<T> operator+(interval<T> const& l, typename interval<T>::value_type const& r) { return l + interval<T>{r}; }
+template <typename T> interval<T> operator-(interval<T> const& l, typename interval<T>::value_type const& r) { return l - interval<T>{r}; }
+template <typename T> interval<T> operator*(interval<T> const& l, typename interval<T>::value_type const& r) { return l * interval<T>{r}; }
+template <typename T> interval<T> operator/(interval<T> const& l, typename interval<T>::value_type const& r) { return l / interval<T>{r}; }
+
+template <typename T> interval<T> operator+(typename interval<T>::value_type const& l, interval<T> const& r) { return interval<T>{l} + r; }
+template <typename T> interval<T> operator-(typename interval<T>::value_type const& l, interval<T> const& r) { return interval<T>{l} - r; }
+template <typename T> interval<T> operator*(typename interval<T>::value_type const& l, interval<T> const& r) { return interval<T>{l} * r; }
+template <typename T> interval<T> operator/(typename interval<T>::value_type const& l, interval<T> const& r) { return interval<T>{l} / r; }
+
+template <typename T> constexpr interval<T> operator-(interval<T> const& v) { return interval<T>{-v.hi(), -v.lo()}; }
+
+template <typename T> constexpr bool operator==(interval<T> const& l, interval<T> const& r) { return l.lo() == r.lo() && l.hi() == r.hi(); }
+template <typename T> constexpr bool operator!=(interval<T> const& l, interval<T> const& r) { return !(l == r); }
+template <typename T> constexpr bool operator< (interval<T> const& l, interval<T> const& r) { return l.hi() <  r.lo(); }
+template <typename T> constexpr bool operator<=(interval<T> const& l, interval<T> const& r) { return l.hi() <= r.lo(); }
+template <typename T> constexpr bool operator> (interval<T> const& l, interval<T> const& r) { return l.lo() >  r.hi(); }
+template <typename T> constexpr bool operator>=(interval<T> const& l, interval<T> const& r) { return l.lo() >= r.hi(); }
+
+template <typename T>
+interval<T> abs(interval<T> const& v) {
+    if (v.lo() >= T(0))
+        return v;
+    if (v.hi() <= T(0))
+        return -v;
+    return interval<T>{T(0), std::max(-v.lo(), v.hi())};
+}
+
+/**
+ * monotonic, the part of v below zero is outside of the domain and ignored, empty if all of v is
+ */
+template <typename T>
+interval<T> sqrt(interval<T> const& v) {
+    using std::sqrt;
+    if (v.hi() < T(0))
+        return interval<T>::empty();
+    return interval<T>{helper::interval::down(sqrt(std::max(v.lo(), T(0)))), helper::interval::up(sqrt(v.hi()))};
+}
+
+/**
+ * integer exponents are handled on the whole real line (even ones are not monotonic),
+ * other exponents only on the non-negative part of v, which may be empty. Since std::pow is not required
+ * to be correctly rounded, the bounds are widened by two ulps.
+ */
+template <typename T>
+interval<T> pow(interval<T> const& v, typename interval<T>::value_type const& e) {
+    using std::floor;
+    using std::fmod;
+    using std::pow;
+
+    if (e == T(0))
+        return interval<T>{T(1)};
+
+    const bool integral = floor(e) == e;
+    const bool even = integral && fmod(e, T(2)) == T(0);
+
+    interval<T> base = v;
+    if (even)
+        base = abs(v);
+    else if (!integral && v.hi() < T(0))
+        return interval<T>::empty();
+    else if (!integral)
+        base = interval<T>{std::max(v.lo(), T(0)), v.hi()};
+
+    if (e < T(0) && base.contains(T(0)))
+        return integral && !even ? interval<T>::entire() : interval<T>{T(0), std::numeric_limits<T>::infinity()};
+
+    const T a = pow(base.lo(), e);
+    const T b = pow(base.hi(), e);
+    return interval<T>{helper::interval::down(std::min(a, b), 2), helper::interval::up(std::max(a, b), 2)};
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& s, interval<T> const& v) {
+    return s << "[" << v.lo() << "," << v.hi() << "]";
+}
+
+template <typename U, typename T>
+constexpr Quantity<U, interval<T>> make_interval(Quantity<U, T> const& lo, Quantity<U, T> const& hi) {
+    return Quantity<U, interval<T>>{interval<T>{lo.magnitude(), hi.magnitude()}};
+}
+
+template <typename U, typename T>
+constexpr Quantity<U, T> lower(Quantity<U, interval<T>> const& q) {
+    return Quantity<U, T>{q.magnitude().lo()};
+}
+
+template <typename U, typename T>
+constexpr Quantity<U, T> upper(Quantity<U, interval<T>> const& q) {
+    return Quantity<U, T>{q.magnitude().hi()};
+}
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityMath.h>
+#include <src/unit/unitOperators.h>
+
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace tracking {
+
+using SourceId = unsigned;
+
+struct Source {
+    std::string name;
+    double uncertainty;
+};
+
+/**
+ * all named error sources, a SourceId is the index into this list
+ *
+ * sources are expected to be registered during setup, registration is not thread-safe
+ */
+inline std::vector<Source>& sources() {
+    static std::vector<Source> s;
+    return s;
+}
+
+template <typename T>
+struct Entry {
+    SourceId source;
+    T derivative;
+};
+
+/**
+ * size-class pool for gradient storage
+ *
+ * blocks are cut from large arena chunks and recycled through per-thread free lists,
+ * so steady-state arithmetic on tracked values does not touch the global heap. Chunks
+ * are never returned since blocks may be freed by another thread than the allocating one.
+ */
+template <std::size_t blockSize>
+class Pool {
+   public:
+    static constexpr std::size_t class_count = 32;
+    static constexpr std::size_t chunk_size = 1 << 16;
+
+    static void* allocate(std::size_t n) {
+        Pool& p = instance();
+        const std::size_t c = size_class(n);
+        if (FreeBlock* b = p.m_free[c]) {
+            p.m_free[c] = b->next;
+            return b;
+        }
+        return p.carve((std::size_t{1} << c) * blockSize);
+    }
+
+    static void deallocate(void* ptr, std::size_t n) {
+        Pool& p = instance();
+        const std::size_t c = size_class(n);
+        FreeBlock* b = static_cast<FreeBlock*>(ptr);
+        b->next = p.m_free[c];
+        p.m_free[c] = b;
+    }
+
+   private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static Pool& instance() {
+        static thread_local Pool p;
+        return p;
+    }
+
+    // smallest c with 2^c >= n, blocks of class 0 hold at least one FreeBlock
+    static std::size_t size_class(std::size_t n) {
+        std::size_t c = 0;
+        while ((std::size_t{1} << c) < n || (std::size_t{1} << c) * blockSize < sizeof(FreeBlock)) ++c;
+        return c;
+    }
+
+    void* carve(std::size_t bytes) {
+        bytes = (bytes + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        if (bytes > chunk_size)
+            return ::operator new(bytes);
+        if (m_left < bytes) {
+            m_next = static_cast<char*>(::operator new(chunk_size));
+            m_left = chunk_size;
+        }
+        void* r = m_next;
+        m_next += bytes;
+        m_left -= bytes;
+        return r;
+    }
+
+    FreeBlock* m_free[class_count] = {};
+    char* m_next = nullptr;
+    std::size_t m_left = 0;
+};
+
+template <typename T>
+struct PoolAllocator {
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename R>
+    PoolAllocator(PoolAllocator<R> const&) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(Pool<sizeof(T)>::allocate(n)); }
+    void deallocate(T* p, std::size_t n) { Pool<sizeof(T)>::deallocate(p, n); }
+};
+
+template <typename L, typename R>
+bool operator==(PoolAllocator<L> const&, PoolAllocator<R> const&) {
+    return true;
+}
+
+template <typename L, typename R>
+bool operator!=(PoolAllocator<L> const&, PoolAllocator<R> const&) {
+    return false;
+}
+}
+}
+
+/**
+ * magnitude type for linear error propagation with correlated sources
+ *
+ * Each value carries its sparse gradient with respect to the named sources it was
+ * computed from. Since the gradient is kept instead of a single error, using the same
+ * source (eg Boltzmann_constant) in several places yields correct correlations:
+ *
+ *     auto k = make_tracked("k", physicalConstant::Boltzmann_constant,
+ *                                physicalConstant::uncertaintiy::Boltzmann_constant);
+ *     auto r = (k * 300.0_n * kelvin) / (k * 200.0_n * kelvin);  // uncertainty(r) ~ 0
+ *
+ * comparison operators compare the values only.
+ */
+template <typename T>
+class tracked {
+   public:
+    using value_type = T;
+    using entry = helper::tracking::Entry<T>;
+    using gradient_type = std::vector<entry, helper::tracking::PoolAllocator<entry>>;
+
+    tracked() : m_value(0) {}
+    tracked(value_type const& v) : m_value(v) {}
+
+    /**
+     * creates a new named source with standard uncertainty u
+     */
+    static tracked source(std::string name, value_type const& v, value_type const& u) {
+        auto& s = helper::tracking::sources();
+        tracked r{v};
+        r.m_gradient.push_back(entry{static_cast<helper::tracking::SourceId>(s.size()), value_type(1)});
+        s.push_back(helper::tracking::Source{std::move(name), static_cast<double>(u)});
+        return r;
+    }
+
+    value_type const& value() const { return m_value; }
+    gradient_type const& gradient() const { return m_gradient; }
+
+    value_type variance() const { return covariance(*this, *this); }
+    value_type uncertainty() const {
+        using std::sqrt;
+        return sqrt(variance());
+    }
+
+    friend value_type covariance(tracked const& a, tracked const& b) {
+        auto& s = helper::tracking::sources();
+        value_type r(0);
+        auto i = a.m_gradient.begin();
+        auto j = b.m_gradient.begin();
+        while (i != a.m_gradient.end() && j != b.m_gradient.end()) {
+            if (i->source < j->source)
+                ++i;
+            else if (j->source < i->source)
+                ++j;
+            else {
+                const value_type u = s[i->source].uncertainty;
+                r += i->derivative * j->derivative * u * u;
+                ++i;
+                ++j;
+            }
+        }
+        return r;
+    }
+
+    // ca * a + cb * b, merging both sorted gradients in one pass
+    static tracked combine(value_type const& v, value_type const& ca, tracked const& a, value_type const& cb, tracked const& b) {
+        tracked r{v};
+        r.m_gradient.reserve(a.m_gradient.size() + b.m_gradient.size());
+        auto i = a.m_gradient.begin();
+        auto j = b.m_gradient.begin();
+        while (i != a.m_gradient.end() && j != b.m_gradient.end()) {
+            if (i->source < j->source)
+                r.push(i->source, ca * i->derivative), ++i;
+            else if (j->source < i->source)
+                r.push(j->source, cb * j->derivative), ++j;
+            else
+                r.push(i->source, ca * i->derivative + cb * j->derivative), ++i, ++j;
+        }
+        for (; i != a.m_gradient.end(); ++i) r.push(i->source, ca * i->derivative);
+        for (; j != b.m_gradient.end(); ++j) r.push(j->source, cb * j->derivative);
+        return r;
+    }
+
+    // c * a with value v, used for unary functions with derivative c
+    static tracked chain(value_type const& v, value_type const& c, tracked const& a) {
+        tracked r{v};
+        r.m_gradient.reserve(a.m_gradient.size());
+        for (auto const& e : a.m_gradient) r.push(e.source, c * e.derivative);
+        return r;
+    }
+
+    tracked& operator+=(tracked const& r) { return *this = *this + r; }
+    tracked& operator-=(tracked const& r) { return *this = *this - r; }
+    tracked& operator*=(tracked const& r) { return *this = *this * r; }
+    tracked& operator/=(tracked const& r) { return *this = *this / r; }
+
+    tracked& operator+=(value_type const& r) { return m_value += r, *this; }
+    tracked& operator-=(value_type const& r) { return m_value -= r, *this; }
+    tracked& operator*=(value_type const& r) { return *this = chain(m_value * r, r, *this); }
+    tracked& operator/=(value_type const& r) { return *this = chain(m_value / r, 1 / r, *this); }
+
+   private:
+    void push(helper::tracking::SourceId s, value_type const& d) {
+        if (d != value_type(0))
+            m_gradient.push_back(entry{s, d});
+    }
+
+    value_type m_value;
+    gradient_type m_gradient;  // sorted by source, no zero entries
+};
+
+template <typename T> tracked<T> operator+(tracked<T> const& l, tracked<T> const& r) { return tracked<T>::combine(l.value() + r.value(), 1, l, 1, r); }
+template <typename T> tracked<T> operator-(tracked<T> const& l, tracked<T> const& r) { return tracked<T>::combine(l.value() - r.value(), 1, l, -1, r); }
+template <typename T> tracked<T> operator*(tracked<T> const& l, tracked<T> const& r) { return tracked<T>::combine(l.value() * r.value(), r.value(), l, l.value(), r); }
+template <typename T> tracked<T> operator/(tracked<T> const& l, tracked<T> const& r) {
+    return tracked<T>::combine(l.value() / r.value(), 1 / r.value(), l, -l.value() / (r.value() * r.value()), r);
+}
+
+template <typename T> tracked<T> operator+(tracked<T> l, typename tracked<T>::value_type const& r) { return l += r; }
+template <typename T> tracked<T> operator-(tracked<T> l, typename tracked<T>::value_type const& r) { return l -= r; }
+template <typename T> tracked<T> operator*(tracked<T> const& l, typename tracked<T>::value_type const& r) { return tracked<T>::chain(l.value() * r, r, l); }
+template <typename T> tracked<T> operator/(tracked<T> const& l, typename tracked<T>::value_type const& r) { return tracked<T>::chain(l.value() / r, 1 / r, l); }
+
+template <typename T> tracked<T> operator+(typename tracked<T>::value_type const& l, tracked<T> r) { return r += l; }
+template <typename T> tracked<T> operator-(typename tracked<T>::value_type const& l, tracked<T> const& r) { return tracked<T>::chain(l - r.value(), -1, r); }
+template <typename T> tracked<T> operator*(typename tracked<T>::value_type const& l, tracked<T> const& r) { return tracked<T>::chain(l * r.value(), l, r); }
+template <typename T> tracked<T> operator/(typename tracked<T>::value_type const& l, tracked<T> const& r) { return tracked<T>::chain(l / r.value(), -l / (r.value() * r.value()), r); }
+
+template <typename T> tracked<T> operator-(tracked<T> const& v) { return tracked<T>::chain(-v.value(), -1, v); }
+
+template <typename T> bool operator==(tracked<T> const& l, tracked<T> const& r) { return l.value() == r.value(); }
+template <typename T> bool operator!=(tracked<T> const& l, tracked<T> const& r) { return l.value() != r.value(); }
+template <typename T> bool operator< (tracked<T> const& l, tracked<T> const& r) { return l.value() <  r.value(); }
+template <typename T> bool operator<=(tracked<T> const& l, tracked<T> const& r) { return l.value() <= r.value(); }
+template <typename T> bool operator> (tracked<T> const& l, tracked<T> const& r) { return l.value() >  r.value(); }
+template <typename T> bool operator>=(tracked<T> const& l, tracked<T> const& r) { return l.value() >= r.value(); }
+
+template <typename T>
+tracked<T> abs(tracked<T> const& v) {
+    return v.value() < T(0) ? -v : v;
+}
+
+template <typename T>
+tracked<T> sqrt(tracked<T> const& v) {
+    using std::sqrt;
+    const T r = sqrt(v.value());
+    return tracked<T>::chain(r, T(1) / (T(2) * r), v);
+}
+
+template <typename T>
+tracked<T> pow(tracked<T> const& v, typename tracked<T>::value_type const& e) {
+    using std::pow;
+    return tracked<T>::chain(pow(v.value(), e), e * pow(v.value(), e - T(1)), v);
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& s, tracked<T> const& v) {
+    return s << "(" << v.value() << "+-" << v.uncertainty() << ")";
+}
+
+/**
+ * turns a value and its standard uncertainty (eg a nist constant and its
+ * physicalConstant::uncertaintiy counterpart) into a new named source
+ */
+template <typename U, typename T>
+Quantity<U, tracked<T>> make_tracked(std::string name, Quantity<U, T> const& value, Quantity<U, T> const& uncertainty) {
+    return Quantity<U, tracked<T>>{tracked<T>::source(std::move(name), value.magnitude(), uncertainty.magnitude())};
+}
+
+template <typename U, typename T>
+Quantity<U, T> uncertainty(Quantity<U, tracked<T>> const& q) {
+    return Quantity<U, T>{q.magnitude().uncertainty()};
+}
+
+template <typename U, typename T>
+Quantity<U, T> nominal_value(Quantity<U, tracked<T>> const& q) {
+    return Quantity<U, T>{q.magnitude().value()};
+}
+
+template <typename LU, typename RU, typename T>
+Quantity<product_unit<LU, RU>, T> covariance(Quantity<LU, tracked<T>> const& l, Quantity<RU, tracked<T>> const& r) {
+    return Quantity<product_unit<LU, RU>, T>{covariance(l.magnitude(), r.magnitude())};
+}
+
+template <typename LU, typename RU, typename T>
+T correlation(Quantity<LU, tracked<T>> const& l, Quantity<RU, tracked<T>> const& r) {
+    return covariance(l.magnitude(), r.magnitude()) / (l.magnitude().uncertainty() * r.magnitude().uncertainty());
+}
+}
@@ -0,0 +1,10 @@
+HEADERS += \
+        $$PWD/numericHelper.h \
+        $$PWD/numericComplexArray.h \
+        $$PWD/numericQuantityRing.h \
+        $$PWD/numericIntegration.h \
+        $$PWD/numericFilter.h \
+        $$PWD/numericHistogram.h \
+        $$PWD/numericQuantileSketch.h \
+        $$PWD/numericInterpolation.h \
+        $$PWD/numericSolvers.h
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/unitOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace unit {
+
+/**
+ * array of complex quantities in split real/imaginary (structure of arrays) layout
+ *
+ * std::complex interleaves real and imaginary parts which prevents vectorization of
+ * complex multiplication and division. Storing both parts in separate arrays lets the
+ * compiler process several elements per instruction while the unit stays part of the type:
+ *
+ *     complex_array<u::ohm> z(n);
+ *     complex_array<u::siemens> y = 1.0_n / z;
+ */
+template <typename U, typename T = double>
+class complex_array {
+   public:
+    using unit = U;
+    using value_type = T;
+    using quantity_type = Quantity<U, std::complex<T>>;
+    using real_quantity_type = Quantity<U, T>;
+
+    complex_array() = default;
+    explicit complex_array(std::size_t n) : m_real(n), m_imag(n) {}
+
+    std::size_t size() const { return m_real.size(); }
+
+    void resize(std::size_t n) {
+        m_real.resize(n);
+        m_imag.resize(n);
+    }
+
+    quantity_type operator[](std::size_t i) const { return quantity_type{std::complex<T>{m_real[i], m_imag[i]}}; }
+
+    void set(std::size_t i, quantity_type const& q) {
+        m_real[i] = q.magnitude().real();
+        m_imag[i] = q.magnitude().imag();
+    }
+
+    void set(std::size_t i, real_quantity_type const& re, real_quantity_type const& im) {
+        m_real[i] = re.magnitude();
+        m_imag[i] = im.magnitude();
+    }
+
+    real_quantity_type real(std::size_t i) const { return real_quantity_type{m_real[i]}; }
+    real_quantity_type imag(std::size_t i) const { return real_quantity_type{m_imag[i]}; }
+
+    T* real_data() { return m_real.data(); }
+    T* imag_data() { return m_imag.data(); }
+    T const* real_data() const { return m_real.data(); }
+    T const* imag_data() const { return m_imag.data(); }
+
+   private:
+    std::vector<T> m_real;
+    std::vector<T> m_imag;
+};
+
+namespace helper {
+
+namespace complexArray {
+
+// the kernels work on plain pointers of the split arrays so that the loops vectorize
+
+template <typename T>
+void add(std::size_t n, T const* a, T const* b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        re[i] = a[i] + c[i];
+        im[i] = b[i] + d[i];
+    }
+}
+
+template <typename T>
+void subtract(std::size_t n, T const* a, T const* b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        re[i] = a[i] - c[i];
+        im[i] = b[i] - d[i];
+    }
+}
+
+// (a + bi) * (c + di)
+template <typename T>
+void multiply(std::size_t n, T const* a, T const* b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const T r = a[i] * c[i] - b[i] * d[i];
+        const T j = a[i] * d[i] + b[i] * c[i];
+        re[i] = r;
+        im[i] = j;
+    }
+}
+
+// (a + bi) / (c + di), without the rescaling of std::complex, so |c + di|^2 must not overflow
+template <typename T>
+void divide(std::size_t n, T const* a, T const* b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const T s = T(1) / (c[i] * c[i] + d[i] * d[i]);
+        const T r = (a[i] * c[i] + b[i] * d[i]) * s;
+        const T j = (b[i] * c[i] - a[i] * d[i]) * s;
+        re[i] = r;
+        im[i] = j;
+    }
+}
+
+template <typename T>
+void multiply(std::size_t n, T a, T b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const T r = a * c[i] - b * d[i];
+        const T j = a * d[i] + b * c[i];
+        re[i] = r;
+        im[i] = j;
+    }
+}
+
+template <typename T>
+void divide(std::size_t n, T a, T b, T const* c, T const* d, T* re, T* im) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const T s = T(1) / (c[i] * c[i] + d[i] * d[i]);
+        const T r = (a * c[i] + b * d[i]) * s;
+        const T j = (b * c[i] - a * d[i]) * s;
+        re[i] = r;
+        im[i] = j;
+    }
+}
+}
+}
+
+template <typename U, typename T>
+complex_array<U, T> operator+(complex_array<U, T> const& l, complex_array<U, T> const& r) {
+    assert(l.size() == r.size());
+    complex_array<U, T> out(l.size());
+    helper::complexArray::add(l.size(), l.real_data(), l.imag_data(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename U, typename T>
+complex_array<U, T> operator-(complex_array<U, T> const& l, complex_array<U, T> const& r) {
+    assert(l.size() == r.size());
+    complex_array<U, T> out(l.size());
+    helper::complexArray::subtract(l.size(), l.real_data(), l.imag_data(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<product_unit<LU, RU>, T> operator*(complex_array<LU, T> const& l, complex_array<RU, T> const& r) {
+    assert(l.size() == r.size());
+    complex_array<product_unit<LU, RU>, T> out(l.size());
+    helper::complexArray::multiply(l.size(), l.real_data(), l.imag_data(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<quotient_unit<LU, RU>, T> operator/(complex_array<LU, T> const& l, complex_array<RU, T> const& r) {
+    assert(l.size() == r.size());
+    complex_array<quotient_unit<LU, RU>, T> out(l.size());
+    helper::complexArray::divide(l.size(), l.real_data(), l.imag_data(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<product_unit<LU, RU>, T> operator*(Quantity<LU, std::complex<T>> const& l, complex_array<RU, T> const& r) {
+    complex_array<product_unit<LU, RU>, T> out(r.size());
+    helper::complexArray::multiply(r.size(), l.magnitude().real(), l.magnitude().imag(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<product_unit<LU, RU>, T> operator*(Quantity<LU, T> const& l, complex_array<RU, T> const& r) {
+    return Quantity<LU, std::complex<T>>{l} * r;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<quotient_unit<LU, RU>, T> operator/(Quantity<LU, std::complex<T>> const& l, complex_array<RU, T> const& r) {
+    complex_array<quotient_unit<LU, RU>, T> out(r.size());
+    helper::complexArray::divide(r.size(), l.magnitude().real(), l.magnitude().imag(), r.real_data(), r.imag_data(), out.real_data(), out.imag_data());
+    return out;
+}
+
+template <typename LU, typename RU, typename T>
+complex_array<quotient_unit<LU, RU>, T> operator/(Quantity<LU, T> const& l, complex_array<RU, T> const& r) {
+    return Quantity<LU, std::complex<T>>{l} / r;
+}
+
+template <typename U, typename T>
+std::vector<Quantity<U, T>> abs(complex_array<U, T> const& v) {
+    using std::sqrt;
+    std::vector<Quantity<U, T>> out(v.size());
+    T const* a = v.real_data();
+    T const* b = v.imag_data();
+    for (std::size_t i = 0; i < v.size(); ++i) out[i] = Quantity<U, T>{sqrt(a[i] * a[i] + b[i] * b[i])};
+    return out;
+}
+}
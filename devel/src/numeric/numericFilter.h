@@ -0,0 +1,162 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/unit/unitOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace filter {
+
+// the kernels are free functions on plain pointers so that the loops vectorize
+
+template <typename O, typename C, typename X>
+void multiply(std::size_t n, O* out, C c, X const* x) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = c * x[i];
+}
+
+template <typename O, typename C, typename X>
+void multiplyAdd(std::size_t n, O* out, C c, X const* x) {
+    for (std::size_t i = 0; i < n; ++i) out[i] += c * x[i];
+}
+}
+}
+
+/**
+ * bank of identical fir filters over many channels
+ *
+ * Blocks are channel interleaved, sample c of frame f is at f * channels() + c. The loops run over
+ * the channels innermost so that they vectorize. The output unit is the input unit times the
+ * coefficient unit: unitless coefficients keep U, coefficients in 1/s give derivative filters:
+ *
+ *     fir_bank<u::meter_per_second_squared> smooth{3, {0.25_n, 0.5_n, 0.25_n}};
+ *     fir_bank<u::meter, u::hertz> velocity{3, {1.0_n / dt, -1.0_n / dt}};
+ *
+ * The delay line of every channel is kept between blocks, so a stream can be cut into blocks anywhere.
+ */
+template <typename U, typename CU = quotient_unit<U, U>, typename T = double>
+class fir_bank {
+   public:
+    using input_type = Quantity<U, T>;
+    using coefficient_type = Quantity<CU, T>;
+    using output_type = Quantity<product_unit<U, CU>, T>;
+
+    fir_bank(std::size_t channels, std::vector<coefficient_type> coefficients)
+        : m_channels(channels), m_coefficients(std::move(coefficients)) {
+        assert(!m_coefficients.empty());
+        reset();
+    }
+
+    std::size_t channels() const { return m_channels; }
+    std::size_t taps() const { return m_coefficients.size(); }
+
+    // zero history
+    void reset() { m_work.assign((taps() - 1) * m_channels, input_type{T(0)}); }
+
+    void process(input_type const* in, std::size_t frames, output_type* out) {
+        const std::size_t history = (taps() - 1) * m_channels;
+        const std::size_t samples = frames * m_channels;
+
+        // the history is followed by the block, so every output reads one contiguous range.
+        // The work buffer only grows, blocks of the same size do not allocate.
+        if (m_work.size() < history + samples) m_work.resize(history + samples);
+        std::copy(in, in + samples, m_work.begin() + static_cast<std::ptrdiff_t>(history));
+
+        // chunks of the output stay in the l1 cache over all taps
+        input_type const* x = m_work.data() + history;
+        const std::size_t chunk = 64;
+        for (std::size_t begin = 0; begin < samples; begin += chunk) {
+            const std::size_t n = samples - begin < chunk ? samples - begin : chunk;
+            helper::filter::multiply(n, out + begin, m_coefficients[0], x + begin);
+            for (std::size_t k = 1; k < taps(); ++k) helper::filter::multiplyAdd(n, out + begin, m_coefficients[k], x + begin - k * m_channels);
+        }
+
+        std::copy(m_work.begin() + static_cast<std::ptrdiff_t>(samples), m_work.begin() + static_cast<std::ptrdiff_t>(samples + history),
+                  m_work.begin());
+    }
+
+    void process(std::vector<input_type> const& in, std::vector<output_type>& out) {
+        assert(in.size() % m_channels == 0);
+        out.resize(in.size());
+        process(in.data(), in.size() / m_channels, out.data());
+    }
+
+   private:
+    std::size_t m_channels;
+    std::vector<coefficient_type> m_coefficients;
+    std::vector<input_type> m_work;
+};
+
+/**
+ * second order section of an iir filter, normalized to a0 == 1:
+ *
+ *     y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ */
+template <typename U, typename T = double>
+struct biquad {
+    using coefficient_type = Quantity<quotient_unit<U, U>, T>;
+    coefficient_type b0, b1, b2, a1, a2;
+};
+
+/**
+ * bank of identical iir filters (cascaded biquads, transposed direct form II) over many channels,
+ * blocks are channel interleaved like for fir_bank and the output keeps the unit U
+ */
+template <typename U, typename T = double>
+class iir_bank {
+   public:
+    using value_type = Quantity<U, T>;
+    using section_type = biquad<U, T>;
+
+    iir_bank(std::size_t channels, std::vector<section_type> sections) : m_channels(channels), m_sections(std::move(sections)) {
+        reset();
+    }
+
+    std::size_t channels() const { return m_channels; }
+
+    void reset() {
+        m_z1.assign(m_sections.size() * m_channels, value_type{T(0)});
+        m_z2.assign(m_sections.size() * m_channels, value_type{T(0)});
+    }
+
+    // in and out may be the same block
+    void process(value_type const* in, std::size_t frames, value_type* out) {
+        if (in != out) std::copy(in, in + frames * m_channels, out);
+        for (std::size_t s = 0; s < m_sections.size(); ++s) {
+            section_type const c = m_sections[s];
+            value_type* z1 = m_z1.data() + s * m_channels;
+            value_type* z2 = m_z2.data() + s * m_channels;
+            for (std::size_t f = 0; f < frames; ++f) {
+                value_type* y = out + f * m_channels;
+                for (std::size_t ch = 0; ch < m_channels; ++ch) {
+                    const value_type x = y[ch];
+                    const value_type r = c.b0 * x + z1[ch];
+                    z1[ch] = c.b1 * x - c.a1 * r + z2[ch];
+                    z2[ch] = c.b2 * x - c.a2 * r;
+                    y[ch] = r;
+                }
+            }
+        }
+    }
+
+    void process(std::vector<value_type> const& in, std::vector<value_type>& out) {
+        assert(in.size() % m_channels == 0);
+        out.resize(in.size());
+        process(in.data(), in.size() / m_channels, out.data());
+    }
+
+   private:
+    std::size_t m_channels;
+    std::vector<section_type> m_sections;
+    std::vector<value_type> m_z1;
+    std::vector<value_type> m_z2;
+};
+}
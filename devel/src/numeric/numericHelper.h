@@ -0,0 +1,21 @@
+#pragma once
+
+#include <src/unit/unitOperators.h>
+
+#include <type_traits>
+
+namespace unit {
+
+namespace helper {
+
+namespace numeric {
+
+// checks the unit of dy/dx where a deduction would fail unreadably, eg in the integrators and solvers
+template <typename YU, typename DU, typename XU>
+struct CheckDerivative {
+    static_assert(std::is_same<DU, quotient_unit<YU, XU>>::value, "the derivative unit has to be the function unit per argument unit");
+    static constexpr bool value = true;
+};
+}
+}
+}
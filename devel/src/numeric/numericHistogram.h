@@ -0,0 +1,124 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace unit {
+
+/**
+ * histogram of quantities with unit typed bin edges
+ *
+ *     histogram<u::second> latency{0.0_n * second, 0.01_n * second, 100};
+ *     latency.add(t);
+ *     t::second p99 = latency.quantile(0.99);
+ *
+ * Bins are [lower_edge(i), upper_edge(i)), values outside of all bins are counted as underflow or
+ * overflow. Equal width bins are found by a multiplication, arbitrary edges by binary search.
+ * Histograms with the same edges can be merged, eg after filling one per thread.
+ */
+template <typename U, typename T = double>
+class histogram {
+   public:
+    using value_type = Quantity<U, T>;
+
+    // bins of equal width
+    histogram(value_type const& lower, value_type const& upper, std::size_t bins) : m_uniform(true), m_counts(bins, 0) {
+        assert(bins > 0 && lower < upper);
+        m_edges.reserve(bins + 1);
+        for (std::size_t i = 0; i <= bins; ++i)
+            m_edges.push_back(lower.magnitude() + (upper.magnitude() - lower.magnitude()) * static_cast<T>(i) / static_cast<T>(bins));
+        m_scale = static_cast<T>(bins) / (upper.magnitude() - lower.magnitude());
+        clear();
+    }
+
+    // increasing edges, n edges make n - 1 bins
+    explicit histogram(std::vector<value_type> const& edges) : m_uniform(false), m_scale(0) {
+        assert(edges.size() >= 2);
+        for (auto const& e : edges) m_edges.push_back(e.magnitude());
+        assert(std::is_sorted(m_edges.begin(), m_edges.end()));
+        m_counts.resize(edges.size() - 1);
+        clear();
+    }
+
+    void clear() {
+        std::fill(m_counts.begin(), m_counts.end(), 0);
+        m_underflow = m_overflow = 0;
+    }
+
+    void add(value_type const& q, std::uint64_t n = 1) {
+        const T x = q.magnitude();
+        if (!(x >= m_edges.front())) {
+            m_underflow += n;  // and nan
+        } else if (x >= m_edges.back()) {
+            m_overflow += n;
+        } else {
+            m_counts[bin(x)] += n;
+        }
+    }
+
+    void merge(histogram const& other) {
+        assert(other.m_edges == m_edges);
+        for (std::size_t i = 0; i < m_counts.size(); ++i) m_counts[i] += other.m_counts[i];
+        m_underflow += other.m_underflow;
+        m_overflow += other.m_overflow;
+    }
+
+    std::size_t bins() const { return m_counts.size(); }
+    value_type lower_edge(std::size_t i) const { return value_type{m_edges[i]}; }
+    value_type upper_edge(std::size_t i) const { return value_type{m_edges[i + 1]}; }
+    std::uint64_t count(std::size_t i) const { return m_counts[i]; }
+    std::uint64_t underflow() const { return m_underflow; }
+    std::uint64_t overflow() const { return m_overflow; }
+
+    std::uint64_t total() const {
+        std::uint64_t sum = m_underflow + m_overflow;
+        for (auto c : m_counts) sum += c;
+        return sum;
+    }
+
+    /**
+     * value below which the fraction p of all counts lies, interpolated linearly inside the bin.
+     * Quantiles in the underflow or overflow are clamped to the outer edges.
+     */
+    value_type quantile(double p) const {
+        const double target = p * static_cast<double>(total());
+        double below = static_cast<double>(m_underflow);
+        if (target <= below) return value_type{m_edges.front()};
+        for (std::size_t i = 0; i < m_counts.size(); ++i) {
+            const double c = static_cast<double>(m_counts[i]);
+            if (c > 0 && target <= below + c) {
+                const T f = static_cast<T>((target - below) / c);
+                return value_type{m_edges[i] + (m_edges[i + 1] - m_edges[i]) * f};
+            }
+            below += c;
+        }
+        return value_type{m_edges.back()};
+    }
+
+   private:
+    std::size_t bin(T x) const {
+        if (m_uniform) {
+            // rounding may put values next to an edge into the neighbour bin
+            std::size_t i = static_cast<std::size_t>((x - m_edges.front()) * m_scale);
+            if (i >= m_counts.size()) i = m_counts.size() - 1;
+            if (x < m_edges[i]) --i;
+            else if (x >= m_edges[i + 1]) ++i;
+            return i;
+        }
+        return static_cast<std::size_t>(std::upper_bound(m_edges.begin(), m_edges.end(), x) - m_edges.begin()) - 1;
+    }
+
+    bool m_uniform;
+    T m_scale;
+    std::vector<T> m_edges;
+    std::vector<std::uint64_t> m_counts;
+    std::uint64_t m_underflow;
+    std::uint64_t m_overflow;
+};
+}
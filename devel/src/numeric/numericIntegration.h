@@ -0,0 +1,165 @@
+#pragma once
+
+#include <src/numeric/numericHelper.h>
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/unit/unitOperators.h>
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace integration {
+
+// unitless value in the unit system of U
+template <typename U, typename T>
+constexpr Quantity<quotient_unit<U, U>, T> scalar(T v) {
+    return Quantity<quotient_unit<U, U>, T>{v};
+}
+
+// x[i] += d[i] * dt, the loops work on plain arrays of quantities so that they vectorize
+template <typename X, typename D, typename TT>
+void axpy(std::size_t n, X* x, D const* d, TT dt) {
+    for (std::size_t i = 0; i < n; ++i) x[i] += d[i] * dt;
+}
+
+// out[i] = x[i] + d[i] * dt
+template <typename X, typename D, typename TT>
+void axpyTo(std::size_t n, X* out, X const* x, D const* d, TT dt) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = x[i] + d[i] * dt;
+}
+}
+}
+
+/**
+ * explicit euler step x + dxdt * dt
+ *
+ * The unit of the derivative is checked at compile time to be the one of x per unit of dt,
+ * so integrating a velocity into a temperature does not compile.
+ */
+template <typename XU, typename DU, typename TU, typename T>
+Quantity<XU, T> euler_step(Quantity<XU, T> const& x, Quantity<DU, T> const& dxdt, Quantity<TU, T> const& dt) {
+    static_assert(helper::numeric::CheckDerivative<XU, DU, TU>::value, "");
+    return x + dxdt * dt;
+}
+
+/**
+ * classical fourth order runge kutta step of dx/dt = f(t, x)
+ *
+ *     auto x1 = rk4_step([](t::second, t::kelvin x) { return -x / (60.0_n * second); }, t, x, dt);
+ */
+template <typename XU, typename TU, typename T, typename F>
+Quantity<XU, T> rk4_step(F f, Quantity<TU, T> const& t, Quantity<XU, T> const& x, Quantity<TU, T> const& dt) {
+    using D = decltype(f(t, x));
+    static_assert(helper::numeric::CheckDerivative<XU, typename D::unit, TU>::value, "");
+
+    const auto halfStep = helper::integration::scalar<TU>(T(0.5)) * dt;
+    const D k1 = f(t, x);
+    const D k2 = f(t + halfStep, x + k1 * halfStep);
+    const D k3 = f(t + halfStep, x + k2 * halfStep);
+    const D k4 = f(t + dt, x + k3 * dt);
+    return x + (k1 + helper::integration::scalar<XU>(T(2)) * (k2 + k3) + k4) * (dt / helper::integration::scalar<TU>(T(6)));
+}
+
+/**
+ * velocity verlet step (kick, drift, kick) for dx/dt = v and dv/dt = acceleration(x)
+ *
+ * a is the acceleration at x on entry and is updated to the one at the new x, so every step
+ * evaluates the acceleration once.
+ */
+template <typename XU, typename VU, typename AU, typename TU, typename T, typename A>
+void verlet_step(Quantity<XU, T>& x, Quantity<VU, T>& v, Quantity<AU, T>& a, Quantity<TU, T> const& dt, A acceleration) {
+    static_assert(helper::numeric::CheckDerivative<XU, VU, TU>::value, "");
+    static_assert(helper::numeric::CheckDerivative<VU, AU, TU>::value, "");
+
+    const auto halfStep = helper::integration::scalar<TU>(T(0.5)) * dt;
+    v += a * halfStep;
+    x += v * dt;
+    a = acceleration(x);
+    v += a * halfStep;
+}
+
+/**
+ * euler step of a batch of states in structure of arrays layout, one vector per state quantity
+ */
+template <typename XU, typename DU, typename TU, typename T>
+void euler_step(std::vector<Quantity<XU, T>>& x, std::vector<Quantity<DU, T>> const& dxdt, Quantity<TU, T> const& dt) {
+    static_assert(helper::numeric::CheckDerivative<XU, DU, TU>::value, "");
+    assert(dxdt.size() == x.size());
+    helper::integration::axpy(x.size(), x.data(), dxdt.data(), dt);
+}
+
+/**
+ * velocity verlet step of a batch, acceleration(x, a) writes the accelerations at the positions x into a
+ */
+template <typename XU, typename VU, typename AU, typename TU, typename T, typename A>
+void verlet_step(std::vector<Quantity<XU, T>>& x, std::vector<Quantity<VU, T>>& v, std::vector<Quantity<AU, T>>& a,
+                 Quantity<TU, T> const& dt, A acceleration) {
+    static_assert(helper::numeric::CheckDerivative<XU, VU, TU>::value, "");
+    static_assert(helper::numeric::CheckDerivative<VU, AU, TU>::value, "");
+    assert(v.size() == x.size() && a.size() == x.size());
+
+    const auto halfStep = helper::integration::scalar<TU>(T(0.5)) * dt;
+    helper::integration::axpy(v.size(), v.data(), a.data(), halfStep);
+    helper::integration::axpy(x.size(), x.data(), v.data(), dt);
+    acceleration(static_cast<std::vector<Quantity<XU, T>> const&>(x), a);
+    assert(a.size() == x.size());
+    helper::integration::axpy(v.size(), v.data(), a.data(), halfStep);
+}
+
+/**
+ * runge kutta integrator of a batch, keeps the intermediate stages so that steps do not allocate
+ *
+ * derivative(t, x, dxdt) writes the derivatives of the states x at time t into dxdt:
+ *
+ *     rk4_integrator<u::kelvin, u::second> integrator{n};
+ *     integrator.step(cooling, t, temperatures, dt);
+ */
+template <typename XU, typename TU, typename T = double>
+class rk4_integrator {
+   public:
+    using state_type = Quantity<XU, T>;
+    using derivative_type = Quantity<quotient_unit<XU, TU>, T>;
+    using time_type = Quantity<TU, T>;
+
+    explicit rk4_integrator(std::size_t n = 0) { resize(n); }
+
+    void resize(std::size_t n) {
+        m_x.resize(n);
+        for (auto& k : m_k) k.resize(n);
+    }
+
+    template <typename F>
+    void step(F derivative, time_type const& t, std::vector<state_type>& x, time_type const& dt) {
+        using namespace helper::integration;
+        if (x.size() != m_x.size()) resize(x.size());
+        const std::size_t n = x.size();
+        const time_type halfStep = scalar<TU>(T(0.5)) * dt;
+
+        derivative(t, static_cast<std::vector<state_type> const&>(x), m_k[0]);
+        axpyTo(n, m_x.data(), x.data(), m_k[0].data(), halfStep);
+        derivative(t + halfStep, static_cast<std::vector<state_type> const&>(m_x), m_k[1]);
+        axpyTo(n, m_x.data(), x.data(), m_k[1].data(), halfStep);
+        derivative(t + halfStep, static_cast<std::vector<state_type> const&>(m_x), m_k[2]);
+        axpyTo(n, m_x.data(), x.data(), m_k[2].data(), dt);
+        derivative(t + dt, static_cast<std::vector<state_type> const&>(m_x), m_k[3]);
+
+        const time_type sixth = dt / scalar<TU>(T(6));
+        const auto two = scalar<XU>(T(2));
+        derivative_type const* k1 = m_k[0].data();
+        derivative_type const* k2 = m_k[1].data();
+        derivative_type const* k3 = m_k[2].data();
+        derivative_type const* k4 = m_k[3].data();
+        state_type* out = x.data();
+        for (std::size_t i = 0; i < n; ++i) out[i] += (k1[i] + two * (k2[i] + k3[i]) + k4[i]) * sixth;
+    }
+
+   private:
+    std::vector<state_type> m_x;
+    std::vector<derivative_type> m_k[4];
+};
+}
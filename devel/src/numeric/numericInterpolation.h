@@ -0,0 +1,285 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/unit/unitOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace interpolation {
+
+// grid point i and the position x = points[i] + f * (points[i + 1] - points[i])
+template <typename T>
+struct Cell {
+    std::size_t i;
+    T f;
+    T width;
+};
+
+/**
+ * strictly increasing grid points of one axis. Equally spaced points are found by a multiplication,
+ * others by binary search.
+ */
+template <typename T>
+class Axis {
+   public:
+    template <typename Q>
+    explicit Axis(std::vector<Q> const& points) {
+        assert(points.size() >= 2);
+        m_points.reserve(points.size());
+        for (auto const& p : points) m_points.push_back(p.magnitude());
+        for (std::size_t i = 1; i < m_points.size(); ++i) assert(m_points[i - 1] < m_points[i]);
+
+        const T span = m_points.back() - m_points.front();
+        const T step = span / static_cast<T>(m_points.size() - 1);
+        m_uniform = true;
+        for (std::size_t i = 0; i < m_points.size() && m_uniform; ++i)
+            m_uniform = std::abs(m_points[i] - (m_points.front() + step * static_cast<T>(i))) <= span * T(1e-12);
+        m_scale = T(1) / step;
+    }
+
+    std::size_t size() const { return m_points.size(); }
+    T operator[](std::size_t i) const { return m_points[i]; }
+
+    // queries outside of the axis are clamped to it
+    Cell<T> locate(T x) const {
+        const std::size_t last = m_points.size() - 2;
+        if (!(x > m_points.front())) return Cell<T>{0, T(0), m_points[1] - m_points[0]};
+        if (x >= m_points.back()) return Cell<T>{last, T(1), m_points[last + 1] - m_points[last]};
+
+        std::size_t i;
+        if (m_uniform) {
+            // rounding may put values next to a point into the neighbour cell
+            i = static_cast<std::size_t>((x - m_points.front()) * m_scale);
+            if (i > last) i = last;
+            if (x < m_points[i]) --i;
+            else if (i < last && x >= m_points[i + 1]) ++i;
+        } else {
+            i = static_cast<std::size_t>(std::upper_bound(m_points.begin(), m_points.end(), x) - m_points.begin()) - 1;
+        }
+        const T width = m_points[i + 1] - m_points[i];
+        return Cell<T>{i, (x - m_points[i]) / width, width};
+    }
+
+   private:
+    std::vector<T> m_points;
+    bool m_uniform;
+    T m_scale;
+};
+
+template <typename T>
+T lerp(T a, T b, T f) {
+    return a + (b - a) * f;
+}
+}
+}
+
+/**
+ * piecewise linear table v(x)
+ *
+ *     table_1d<u::kelvin, u::pascal> vapour{temperatures, pressures};
+ *     t::pascal p = vapour(t);
+ *     Quantity<quotient_unit<u::pascal, u::kelvin>> dpdt = vapour.derivative(t);
+ *
+ * Queries outside of the axis are clamped to it, derivatives there are those of the outer cells.
+ */
+template <typename XU, typename VU, typename T = double>
+class table_1d {
+   public:
+    using x_type = Quantity<XU, T>;
+    using value_type = Quantity<VU, T>;
+    using derivative_type = Quantity<quotient_unit<VU, XU>, T>;
+
+    table_1d(std::vector<x_type> const& x, std::vector<value_type> const& values) : m_x(x) {
+        assert(values.size() == m_x.size());
+        m_values.reserve(values.size());
+        for (auto const& v : values) m_values.push_back(v.magnitude());
+    }
+
+    value_type operator()(x_type const& x) const {
+        const auto c = m_x.locate(x.magnitude());
+        return value_type{helper::interpolation::lerp(m_values[c.i], m_values[c.i + 1], c.f)};
+    }
+
+    derivative_type derivative(x_type const& x) const {
+        const auto c = m_x.locate(x.magnitude());
+        return derivative_type{(m_values[c.i + 1] - m_values[c.i]) / c.width};
+    }
+
+    // n queries at once
+    void evaluate(x_type const* x, std::size_t n, value_type* out) const {
+        for (std::size_t k = 0; k < n; ++k) out[k] = (*this)(x[k]);
+    }
+
+    void evaluate(std::vector<x_type> const& x, std::vector<value_type>& out) const {
+        out.resize(x.size());
+        evaluate(x.data(), x.size(), out.data());
+    }
+
+   private:
+    helper::interpolation::Axis<T> m_x;
+    std::vector<T> m_values;
+};
+
+/**
+ * bilinear table v(x, y), the values are given row by row with y running fastest: v[i * ny + j]
+ */
+template <typename XU, typename YU, typename VU, typename T = double>
+class table_2d {
+   public:
+    using x_type = Quantity<XU, T>;
+    using y_type = Quantity<YU, T>;
+    using value_type = Quantity<VU, T>;
+    using x_derivative_type = Quantity<quotient_unit<VU, XU>, T>;
+    using y_derivative_type = Quantity<quotient_unit<VU, YU>, T>;
+
+    table_2d(std::vector<x_type> const& x, std::vector<y_type> const& y, std::vector<value_type> const& values) : m_x(x), m_y(y) {
+        assert(values.size() == m_x.size() * m_y.size());
+        m_values.reserve(values.size());
+        for (auto const& v : values) m_values.push_back(v.magnitude());
+    }
+
+    value_type operator()(x_type const& x, y_type const& y) const {
+        using helper::interpolation::lerp;
+        const auto cx = m_x.locate(x.magnitude());
+        const auto cy = m_y.locate(y.magnitude());
+        T const* v0 = &m_values[cx.i * m_y.size() + cy.i];
+        T const* v1 = v0 + m_y.size();
+        return value_type{lerp(lerp(v0[0], v0[1], cy.f), lerp(v1[0], v1[1], cy.f), cx.f)};
+    }
+
+    x_derivative_type derivative_x(x_type const& x, y_type const& y) const {
+        using helper::interpolation::lerp;
+        const auto cx = m_x.locate(x.magnitude());
+        const auto cy = m_y.locate(y.magnitude());
+        T const* v0 = &m_values[cx.i * m_y.size() + cy.i];
+        T const* v1 = v0 + m_y.size();
+        return x_derivative_type{(lerp(v1[0], v1[1], cy.f) - lerp(v0[0], v0[1], cy.f)) / cx.width};
+    }
+
+    y_derivative_type derivative_y(x_type const& x, y_type const& y) const {
+        using helper::interpolation::lerp;
+        const auto cx = m_x.locate(x.magnitude());
+        const auto cy = m_y.locate(y.magnitude());
+        T const* v0 = &m_values[cx.i * m_y.size() + cy.i];
+        T const* v1 = v0 + m_y.size();
+        return y_derivative_type{lerp(v0[1] - v0[0], v1[1] - v1[0], cx.f) / cy.width};
+    }
+
+    void evaluate(x_type const* x, y_type const* y, std::size_t n, value_type* out) const {
+        for (std::size_t k = 0; k < n; ++k) out[k] = (*this)(x[k], y[k]);
+    }
+
+    void evaluate(std::vector<x_type> const& x, std::vector<y_type> const& y, std::vector<value_type>& out) const {
+        assert(x.size() == y.size());
+        out.resize(x.size());
+        evaluate(x.data(), y.data(), x.size(), out.data());
+    }
+
+   private:
+    helper::interpolation::Axis<T> m_x;
+    helper::interpolation::Axis<T> m_y;
+    std::vector<T> m_values;
+};
+
+/**
+ * trilinear table v(x, y, z), the values are given with z running fastest: v[(i * ny + j) * nz + k]
+ */
+template <typename XU, typename YU, typename ZU, typename VU, typename T = double>
+class table_3d {
+   public:
+    using x_type = Quantity<XU, T>;
+    using y_type = Quantity<YU, T>;
+    using z_type = Quantity<ZU, T>;
+    using value_type = Quantity<VU, T>;
+    using x_derivative_type = Quantity<quotient_unit<VU, XU>, T>;
+    using y_derivative_type = Quantity<quotient_unit<VU, YU>, T>;
+    using z_derivative_type = Quantity<quotient_unit<VU, ZU>, T>;
+
+    table_3d(std::vector<x_type> const& x, std::vector<y_type> const& y, std::vector<z_type> const& z,
+             std::vector<value_type> const& values)
+        : m_x(x), m_y(y), m_z(z) {
+        assert(values.size() == m_x.size() * m_y.size() * m_z.size());
+        m_values.reserve(values.size());
+        for (auto const& v : values) m_values.push_back(v.magnitude());
+    }
+
+    value_type operator()(x_type const& x, y_type const& y, z_type const& z) const {
+        const Corners c = corners(x, y, z);
+        return value_type{c.value()};
+    }
+
+    x_derivative_type derivative_x(x_type const& x, y_type const& y, z_type const& z) const {
+        const Corners c = corners(x, y, z);
+        return x_derivative_type{(c.plane(1) - c.plane(0)) / c.x.width};
+    }
+
+    y_derivative_type derivative_y(x_type const& x, y_type const& y, z_type const& z) const {
+        using helper::interpolation::lerp;
+        const Corners c = corners(x, y, z);
+        return y_derivative_type{lerp(c.line(0, 1) - c.line(0, 0), c.line(1, 1) - c.line(1, 0), c.x.f) / c.y.width};
+    }
+
+    z_derivative_type derivative_z(x_type const& x, y_type const& y, z_type const& z) const {
+        using helper::interpolation::lerp;
+        const Corners c = corners(x, y, z);
+        const T dz00 = c.v[0][0][1] - c.v[0][0][0];
+        const T dz01 = c.v[0][1][1] - c.v[0][1][0];
+        const T dz10 = c.v[1][0][1] - c.v[1][0][0];
+        const T dz11 = c.v[1][1][1] - c.v[1][1][0];
+        return z_derivative_type{lerp(lerp(dz00, dz01, c.y.f), lerp(dz10, dz11, c.y.f), c.x.f) / c.z.width};
+    }
+
+    void evaluate(x_type const* x, y_type const* y, z_type const* z, std::size_t n, value_type* out) const {
+        for (std::size_t k = 0; k < n; ++k) out[k] = (*this)(x[k], y[k], z[k]);
+    }
+
+    void evaluate(std::vector<x_type> const& x, std::vector<y_type> const& y, std::vector<z_type> const& z,
+                  std::vector<value_type>& out) const {
+        assert(x.size() == y.size() && x.size() == z.size());
+        out.resize(x.size());
+        evaluate(x.data(), y.data(), z.data(), x.size(), out.data());
+    }
+
+   private:
+    // the eight values around a query, v[x][y][z]
+    struct Corners {
+        helper::interpolation::Cell<T> x, y, z;
+        T v[2][2][2];
+
+        // interpolated along z
+        T line(std::size_t i, std::size_t j) const { return helper::interpolation::lerp(v[i][j][0], v[i][j][1], z.f); }
+        // interpolated along y and z
+        T plane(std::size_t i) const { return helper::interpolation::lerp(line(i, 0), line(i, 1), y.f); }
+        T value() const { return helper::interpolation::lerp(plane(0), plane(1), x.f); }
+    };
+
+    Corners corners(x_type const& x, y_type const& y, z_type const& z) const {
+        Corners c;
+        c.x = m_x.locate(x.magnitude());
+        c.y = m_y.locate(y.magnitude());
+        c.z = m_z.locate(z.magnitude());
+        const std::size_t ny = m_y.size(), nz = m_z.size();
+        for (std::size_t i = 0; i < 2; ++i)
+            for (std::size_t j = 0; j < 2; ++j) {
+                T const* p = &m_values[((c.x.i + i) * ny + c.y.i + j) * nz + c.z.i];
+                c.v[i][j][0] = p[0];
+                c.v[i][j][1] = p[1];
+            }
+        return c;
+    }
+
+    helper::interpolation::Axis<T> m_x;
+    helper::interpolation::Axis<T> m_y;
+    helper::interpolation::Axis<T> m_z;
+    std::vector<T> m_values;
+};
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace unit {
+
+/**
+ * mergeable quantile sketch of a stream of quantities (KLL, Karnin, Lang and Liberty, "Optimal
+ * quantile approximation in streams")
+ *
+ *     quantile_sketch<u::joule> energy;
+ *     energy.add(e);
+ *     t::joule median = energy.quantile(0.5);
+ *
+ * Values are kept in compactors of increasing weight, a full compactor is sorted and every other
+ * value moves on to the next one. Memory is about 3 * k values however long the stream is and the
+ * rank error is about 1.7 / k. Sketches filled by different threads are combined with merge.
+ */
+template <typename U, typename T = double>
+class quantile_sketch {
+   public:
+    using value_type = Quantity<U, T>;
+
+    explicit quantile_sketch(std::size_t k = 200) : m_k(k < 8 ? 8 : k), m_count(0), m_size(0), m_random(0x9e3779b97f4a7c15ull) {
+        grow();
+    }
+
+    void add(value_type const& q) {
+        const T x = q.magnitude();
+        if (m_count == 0 || x < m_min) m_min = x;
+        if (m_count == 0 || x > m_max) m_max = x;
+        ++m_count;
+        m_compactors[0].push_back(x);
+        if (++m_size >= m_capacity) compress();
+    }
+
+    void merge(quantile_sketch const& other) {
+        if (other.m_count == 0) return;
+        while (m_compactors.size() < other.m_compactors.size()) grow();
+        for (std::size_t h = 0; h < other.m_compactors.size(); ++h)
+            m_compactors[h].insert(m_compactors[h].end(), other.m_compactors[h].begin(), other.m_compactors[h].end());
+        if (m_count == 0 || other.m_min < m_min) m_min = other.m_min;
+        if (m_count == 0 || other.m_max > m_max) m_max = other.m_max;
+        m_count += other.m_count;
+        m_size += other.m_size;
+        while (m_size >= m_capacity) compress();
+    }
+
+    // number of added values
+    std::uint64_t count() const { return m_count; }
+
+    // number of kept values
+    std::size_t retained() const { return m_size; }
+
+    value_type min() const { return value_type{m_min}; }
+    value_type max() const { return value_type{m_max}; }
+
+    // approximate fraction of the values <= q
+    double rank(value_type const& q) const {
+        if (m_count == 0) return 0;
+        std::uint64_t below = 0;
+        for (std::size_t h = 0; h < m_compactors.size(); ++h)
+            for (T x : m_compactors[h])
+                if (x <= q.magnitude()) below += std::uint64_t{1} << h;
+        return static_cast<double>(below) / static_cast<double>(weight());
+    }
+
+    // approximate value with the fraction p of all values below it, the extremes for p == 0 and p == 1
+    value_type quantile(double p) const {
+        assert(m_count > 0);
+        if (p <= 0) return min();
+        if (p >= 1) return max();
+
+        std::vector<std::pair<T, std::uint64_t>> weighted;
+        weighted.reserve(m_size);
+        for (std::size_t h = 0; h < m_compactors.size(); ++h)
+            for (T x : m_compactors[h]) weighted.emplace_back(x, std::uint64_t{1} << h);
+        std::sort(weighted.begin(), weighted.end());
+
+        const double target = p * static_cast<double>(weight());
+        std::uint64_t cumulative = 0;
+        for (auto const& w : weighted) {
+            cumulative += w.second;
+            if (static_cast<double>(cumulative) >= target) return value_type{w.first};
+        }
+        return max();
+    }
+
+   private:
+    // capacities shrink by 2/3 per level below the top one
+    std::size_t capacity(std::size_t h) const {
+        const std::size_t depth = m_compactors.size() - h - 1;
+        return static_cast<std::size_t>(std::ceil(std::pow(2.0 / 3.0, static_cast<double>(depth)) * static_cast<double>(m_k))) + 1;
+    }
+
+    void grow() {
+        m_compactors.emplace_back();
+        m_capacity = 0;
+        for (std::size_t h = 0; h < m_compactors.size(); ++h) m_capacity += capacity(h);
+    }
+
+    // compacts the lowest full level
+    void compress() {
+        for (std::size_t h = 0; h < m_compactors.size(); ++h) {
+            if (m_compactors[h].size() < capacity(h)) continue;
+            if (h + 1 == m_compactors.size()) grow();
+
+            std::vector<T>& level = m_compactors[h];
+            std::vector<T>& next = m_compactors[h + 1];
+            std::sort(level.begin(), level.end());
+            // an odd value stays, the random offset keeps the ranks unbiased
+            const std::size_t pairs = level.size() / 2;
+            const std::size_t offset = static_cast<std::size_t>(randomBit());
+            for (std::size_t i = 0; i < pairs; ++i) next.push_back(level[2 * i + offset]);
+            const bool odd = level.size() % 2 == 1;
+            const T last = level.back();
+            level.clear();
+            if (odd) level.push_back(last);
+
+            m_size = 0;
+            for (auto const& c : m_compactors) m_size += c.size();
+            return;
+        }
+    }
+
+    // the total weight of the kept values
+    std::uint64_t weight() const {
+        std::uint64_t w = 0;
+        for (std::size_t h = 0; h < m_compactors.size(); ++h) w += static_cast<std::uint64_t>(m_compactors[h].size()) << h;
+        return w;
+    }
+
+    // xorshift, sketches do not need good random numbers
+    unsigned randomBit() {
+        m_random ^= m_random << 13;
+        m_random ^= m_random >> 7;
+        m_random ^= m_random << 17;
+        return static_cast<unsigned>(m_random >> 63);
+    }
+
+    std::size_t m_k;
+    std::uint64_t m_count;
+    std::size_t m_size;
+    std::size_t m_capacity;
+    std::uint64_t m_random;
+    T m_min = std::numeric_limits<T>::quiet_NaN();
+    T m_max = std::numeric_limits<T>::quiet_NaN();
+    std::vector<std::vector<T>> m_compactors;
+};
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/unit/unitOperators.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace unit {
+
+namespace helper {
+
+namespace ring {
+
+/**
+ * indices of the window in a monotonic order, the front is the extremum. Every index is pushed
+ * and popped once, so keeping the window extremum costs O(1) amortized per sample.
+ */
+template <std::size_t N>
+class MonotonicQueue {
+   public:
+    MonotonicQueue() : m_head(0), m_tail(0) {}
+
+    void clear() { m_head = m_tail = 0; }
+
+    // before(i) is true if the sample at index i stays in front of the new one
+    template <typename Before>
+    void push(std::uint64_t index, Before before) {
+        // the sample which leaves the window
+        if (m_tail != m_head && m_indices[m_head % N] + N <= index) ++m_head;
+        while (m_tail != m_head && !before(m_indices[(m_tail - 1) % N])) --m_tail;
+        m_indices[m_tail++ % N] = index;
+    }
+
+    std::uint64_t front() const { return m_indices[m_head % N]; }
+
+   private:
+    std::array<std::uint64_t, N> m_indices;
+    std::uint64_t m_head;
+    std::uint64_t m_tail;
+};
+}
+}
+
+/**
+ * fixed capacity ring buffer of quantities with statistics over the window of the last N samples
+ *
+ * push is amortized O(1), sum, mean, variance, rms, min and max are O(1) and nothing is allocated:
+ *
+ *     quantity_ring<u::watt, double, 600> power;
+ *     power.push(p);
+ *     t::watt average = power.mean();
+ *     Quantity<sqare_unit<u::watt>> spread = power.variance();
+ *
+ * Sum and variance are updated incrementally (variance with the sliding window form of Welford's
+ * algorithm) and recomputed from the window once per N samples, so rounding errors cannot accumulate.
+ * A single push takes O(N) when it recomputes or drops many samples from the min and max queues.
+ */
+template <typename U, typename T, std::size_t N>
+class quantity_ring {
+    static_assert(N > 0, "empty window");
+
+   public:
+    using unit = U;
+    using value_type = Quantity<U, T>;
+    using square_type = Quantity<sqare_unit<U>, T>;
+
+    quantity_ring() { clear(); }
+
+    static constexpr std::size_t capacity() { return N; }
+    std::size_t size() const { return m_pushed < N ? static_cast<std::size_t>(m_pushed) : N; }
+    bool empty() const { return m_pushed == 0; }
+    bool full() const { return m_pushed >= N; }
+
+    // i == 0 is the oldest sample of the window
+    value_type const& operator[](std::size_t i) const { return m_values[(m_pushed - size() + i) % N]; }
+    value_type const& front() const { return (*this)[0]; }
+    value_type const& back() const { return m_values[(m_pushed - 1) % N]; }
+
+    void clear() {
+        m_pushed = 0;
+        m_sum = value_type{T(0)};
+        m_mean = value_type{T(0)};
+        m_m2 = square_type{T(0)};
+        m_min.clear();
+        m_max.clear();
+    }
+
+    void push(value_type const& x) {
+        value_type& slot = m_values[m_pushed % N];
+        const std::uint64_t index = m_pushed;
+
+        if (m_pushed < N) {
+            const value_type d = x - m_mean;
+            m_sum += x;
+            m_mean += d / count(m_pushed + 1);
+            m_m2 += d * (x - m_mean);
+            slot = x;
+        } else {
+            const value_type y = slot;
+            const value_type oldMean = m_mean;
+            slot = x;
+            m_sum += x;
+            m_sum -= y;
+            m_mean += (x - y) / count(N);
+            m_m2 += (x - y) * (x - m_mean + y - oldMean);
+        }
+        ++m_pushed;
+        if (m_pushed > N && m_pushed % N == 0) recompute();
+
+        m_min.push(index, [&](std::uint64_t i) { return m_values[i % N] < x; });
+        m_max.push(index, [&](std::uint64_t i) { return m_values[i % N] > x; });
+    }
+
+    value_type sum() const { return m_sum; }
+
+    value_type mean() const { return m_mean; }
+
+    // population variance of the window
+    square_type variance() const {
+        return empty() || m_m2 < square_type{T(0)} ? square_type{T(0)} : m_m2 / count(size());
+    }
+
+    // sqrt(mean(x^2))
+    value_type rms() const { return value_type{sqrt(variance() + m_mean * m_mean).magnitude()}; }
+
+    // min and max of an empty ring are undefined
+    value_type min() const { return m_values[m_min.front() % N]; }
+    value_type max() const { return m_values[m_max.front() % N]; }
+
+   private:
+    using count_type = Quantity<quotient_unit<U, U>, T>;
+
+    static count_type count(std::uint64_t n) { return count_type{static_cast<T>(n)}; }
+
+    // the window is the whole array
+    void recompute() {
+        m_sum = value_type{T(0)};
+        for (auto const& v : m_values) m_sum += v;
+        m_mean = m_sum / count(N);
+        m_m2 = square_type{T(0)};
+        for (auto const& v : m_values) m_m2 += (v - m_mean) * (v - m_mean);
+    }
+
+    std::array<value_type, N> m_values;
+    std::uint64_t m_pushed;
+    value_type m_sum;
+    value_type m_mean;
+    square_type m_m2;
+    helper::ring::MonotonicQueue<N> m_min;
+    helper::ring::MonotonicQueue<N> m_max;
+};
+}
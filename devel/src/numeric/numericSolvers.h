@@ -0,0 +1,336 @@
+#pragma once
+
+#include <src/numeric/numericHelper.h>
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/unit/unitOperators.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace solvers {
+
+// true if a and b do not have opposite signs, zero counts as positive
+template <typename T>
+bool sameSign(T a, T b) {
+    return (a < T(0)) == (b < T(0));
+}
+
+template <typename T>
+T copySign(T magnitude, T sign) {
+    return sign < T(0) ? -std::abs(magnitude) : std::abs(magnitude);
+}
+}
+}
+
+/**
+ * bisection of f on [lower, upper], f(lower) and f(upper) must have opposite signs.
+ * Always converges, one bit per iteration.
+ *
+ *     t::kelvin T;
+ *     bool found = bisect_root(netPower, 200.0_n * kelvin, 400.0_n * kelvin, 1e-6_n * kelvin, T);
+ */
+template <typename XU, typename T, typename F>
+bool bisect_root(F f, Quantity<XU, T> lower, Quantity<XU, T> upper, Quantity<XU, T> const& tolerance, Quantity<XU, T>& root,
+                 int maxIterations = 200) {
+    using X = Quantity<XU, T>;
+    T a = lower.magnitude(), b = upper.magnitude();
+    T fa = f(X{a}).magnitude();
+    const T fb = f(X{b}).magnitude();
+    if (fa != T(0) && fb != T(0) && helper::solvers::sameSign(fa, fb)) return false;
+
+    // sameSign counts zero as positive, exact roots must not be bisected away from
+    if (fa == T(0) || fb == T(0)) {
+        root = fa == T(0) ? lower : upper;
+        return true;
+    }
+
+    for (int i = 0; i < maxIterations; ++i) {
+        const T m = a + (b - a) / T(2);
+        if (std::abs(b - a) <= tolerance.magnitude() * T(2)) {
+            root = X{m};
+            return true;
+        }
+        const T fm = f(X{m}).magnitude();
+        if (fm == T(0)) {
+            root = X{m};
+            return true;
+        }
+        if (helper::solvers::sameSign(fm, fa)) {
+            a = m;
+            fa = fm;
+        } else {
+            b = m;
+        }
+    }
+    return false;
+}
+
+/**
+ * brent's method (bisection, secant and inverse quadratic interpolation) on [lower, upper],
+ * f(lower) and f(upper) must have opposite signs. Converges like bisection in the worst case and
+ * superlinearly for smooth f.
+ */
+template <typename XU, typename T, typename F>
+bool brent_root(F f, Quantity<XU, T> lower, Quantity<XU, T> upper, Quantity<XU, T> const& tolerance, Quantity<XU, T>& root,
+                int maxIterations = 200) {
+    using X = Quantity<XU, T>;
+    using helper::solvers::sameSign;
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    T a = lower.magnitude(), b = upper.magnitude(), c = b;
+    T fa = f(X{a}).magnitude(), fb = f(X{b}).magnitude(), fc = fb;
+    if (fa != T(0) && fb != T(0) && sameSign(fa, fb)) return false;
+    T d = b - a, e = d;
+
+    for (int i = 0; i < maxIterations; ++i) {
+        // c is on the other side of the root than b
+        if (fb != T(0) && fc != T(0) && sameSign(fb, fc)) {
+            c = a;
+            fc = fa;
+            e = d = b - a;
+        }
+        // b is the best guess
+        if (std::abs(fc) < std::abs(fb)) {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+        const T tol = T(2) * eps * std::abs(b) + tolerance.magnitude() / T(2);
+        const T m = (c - b) / T(2);
+        if (std::abs(m) <= tol || fb == T(0)) {
+            root = X{b};
+            return true;
+        }
+
+        if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+            T p, q;
+            const T s = fb / fa;
+            if (a == c) {
+                // secant
+                p = T(2) * m * s;
+                q = T(1) - s;
+            } else {
+                // inverse quadratic
+                const T qa = fa / fc, r = fb / fc;
+                p = s * (T(2) * m * qa * (qa - r) - (b - a) * (r - T(1)));
+                q = (qa - T(1)) * (r - T(1)) * (s - T(1));
+            }
+            if (p > T(0)) q = -q;
+            p = std::abs(p);
+            const T limit1 = T(3) * m * q - std::abs(tol * q);
+            const T limit2 = std::abs(e * q);
+            if (T(2) * p < (limit1 < limit2 ? limit1 : limit2)) {
+                e = d;
+                d = p / q;
+            } else {
+                d = m;
+                e = d;
+            }
+        } else {
+            d = m;
+            e = d;
+        }
+
+        a = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : helper::solvers::copySign(tol, m);
+        fb = f(X{b}).magnitude();
+    }
+    return false;
+}
+
+/**
+ * newton's method from the guess x. The derivative has to return the unit of f per unit of x,
+ * so a mixed up derivative does not compile:
+ *
+ *     newton_root(netPower, [](t::kelvin T) { return 4.0_n * c * T * T * T; }, T, 1e-9_n * kelvin);
+ *
+ * Fails if the derivative becomes zero or the iteration does not settle.
+ */
+template <typename XU, typename T, typename F, typename D>
+bool newton_root(F f, D derivative, Quantity<XU, T>& x, Quantity<XU, T> const& tolerance, int maxIterations = 50) {
+    using Y = decltype(f(x));
+    using DY = decltype(derivative(x));
+    static_assert(helper::numeric::CheckDerivative<typename Y::unit, typename DY::unit, XU>::value, "");
+
+    for (int i = 0; i < maxIterations; ++i) {
+        const DY slope = derivative(x);
+        if (slope.magnitude() == T(0)) return false;
+        const Quantity<XU, T> step = f(x) / slope;
+        if (!std::isfinite(step.magnitude())) return false;
+        x -= step;
+        if (std::abs(step.magnitude()) <= tolerance.magnitude()) return true;
+    }
+    return false;
+}
+
+/**
+ * brent's minimization (golden section and parabolic interpolation) of f on [lower, upper],
+ * finds a local minimum
+ */
+template <typename XU, typename T, typename F>
+bool brent_minimize(F f, Quantity<XU, T> lower, Quantity<XU, T> upper, Quantity<XU, T> const& tolerance, Quantity<XU, T>& x,
+                    int maxIterations = 100) {
+    using X = Quantity<XU, T>;
+    using helper::solvers::copySign;
+    const T golden = T(0.3819660112501051);
+    const T eps = std::sqrt(std::numeric_limits<T>::epsilon());
+
+    T a = lower.magnitude(), b = upper.magnitude();
+    // x is the best point, w the second best and v the previous w
+    T u = 0, v, w, xm = a + golden * (b - a);
+    v = w = xm;
+    T fu = 0, fv, fw, fx = f(X{xm}).magnitude();
+    fv = fw = fx;
+    T d = 0, e = 0;
+
+    for (int i = 0; i < maxIterations; ++i) {
+        const T middle = (a + b) / T(2);
+        const T tol = tolerance.magnitude() + eps * std::abs(xm);
+        if (std::abs(xm - middle) <= T(2) * tol - (b - a) / T(2)) {
+            x = X{xm};
+            return true;
+        }
+
+        bool golden_step = true;
+        if (std::abs(e) > tol) {
+            // parabola through x, w and v
+            const T r = (xm - w) * (fx - fv);
+            T q = (xm - v) * (fx - fw);
+            T p = (xm - v) * q - (xm - w) * r;
+            q = T(2) * (q - r);
+            if (q > T(0)) p = -p;
+            q = std::abs(q);
+            const T previous = e;
+            e = d;
+            if (std::abs(p) < std::abs(q * previous / T(2)) && p > q * (a - xm) && p < q * (b - xm)) {
+                d = p / q;
+                u = xm + d;
+                if (u - a < T(2) * tol || b - u < T(2) * tol) d = copySign(tol, middle - xm);
+                golden_step = false;
+            }
+        }
+        if (golden_step) {
+            e = xm >= middle ? a - xm : b - xm;
+            d = golden * e;
+        }
+
+        u = std::abs(d) >= tol ? xm + d : xm + copySign(tol, d);
+        fu = f(X{u}).magnitude();
+        if (fu <= fx) {
+            if (u >= xm) a = xm;
+            else b = xm;
+            v = w;
+            w = xm;
+            xm = u;
+            fv = fw;
+            fw = fx;
+            fx = fu;
+        } else {
+            if (u < xm) a = u;
+            else b = u;
+            if (fu <= fw || w == xm) {
+                v = w;
+                w = u;
+                fv = fw;
+                fw = fu;
+            } else if (fu <= fv || v == xm || v == w) {
+                v = u;
+                fv = fu;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * bisection of many independent problems, f(i, x) is problem i. All problems take the same number
+ * of steps and the loops are free of branches, so the batch runs in lock step and vectorizes
+ * when f inlines.
+ *
+ * Returns false if a bracket does not contain a sign change, roots are written for all others.
+ */
+template <typename XU, typename T, typename F>
+bool bisect_root(F f, std::vector<Quantity<XU, T>> const& lower, std::vector<Quantity<XU, T>> const& upper, Quantity<XU, T> const& tolerance,
+                 std::vector<Quantity<XU, T>>& roots) {
+    using X = Quantity<XU, T>;
+    using Y = decltype(f(std::size_t{0}, lower[0]));
+    const std::size_t n = lower.size();
+
+    std::vector<X> a(lower), b(upper);
+    std::vector<Y> fa(n);
+    bool bracketed = true;
+    T width = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        fa[i] = f(i, a[i]);
+        const T fb = f(i, b[i]).magnitude();
+        if (fa[i].magnitude() != T(0) && fb != T(0) && helper::solvers::sameSign(fa[i].magnitude(), fb)) bracketed = false;
+        // exact roots collapse the bracket and freeze the problem, see below
+        if (fa[i].magnitude() == T(0)) b[i] = a[i];
+        else if (fb == T(0)) {
+            a[i] = b[i];
+            fa[i] = Y{T(0)};
+        }
+        const T w = std::abs((b[i] - a[i]).magnitude());
+        if (w > width) width = w;
+    }
+
+    const int steps = width > tolerance.magnitude() * T(2) ? static_cast<int>(std::ceil(std::log2(width / (tolerance.magnitude() * T(2))))) : 0;
+    for (int s = 0; s < steps; ++s) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const X m = X{a[i].magnitude() + (b[i].magnitude() - a[i].magnitude()) / T(2)};
+            const Y fm = f(i, m);
+            // a zero keeps a == b == m, sameSign counts it as positive and would leave the root
+            const bool hit = fm.magnitude() == T(0);
+            const bool left = helper::solvers::sameSign(fm.magnitude(), fa[i].magnitude());
+            a[i] = left || hit ? m : a[i];
+            fa[i] = left || hit ? fm : fa[i];
+            b[i] = left && !hit ? b[i] : m;
+        }
+    }
+
+    roots.resize(n);
+    for (std::size_t i = 0; i < n; ++i) roots[i] = X{a[i].magnitude() + (b[i].magnitude() - a[i].magnitude()) / T(2)};
+    return bracketed;
+}
+
+/**
+ * newton's method for many independent problems from the guesses x, f(i, x) and derivative(i, x)
+ * are problem i. Every sweep steps all problems, converged ones take zero steps, so the sweeps
+ * vectorize when f and derivative inline.
+ *
+ * Returns true if all problems converged.
+ */
+template <typename XU, typename T, typename F, typename D>
+bool newton_root(F f, D derivative, std::vector<Quantity<XU, T>>& x, Quantity<XU, T> const& tolerance, int maxIterations = 50) {
+    using X = Quantity<XU, T>;
+    using Y = decltype(f(std::size_t{0}, x[0]));
+    using DY = decltype(derivative(std::size_t{0}, x[0]));
+    static_assert(helper::numeric::CheckDerivative<typename Y::unit, typename DY::unit, XU>::value, "");
+
+    const std::size_t n = x.size();
+    std::vector<unsigned char> done(n, 0);
+    for (int s = 0; s < maxIterations; ++s) {
+        std::size_t converged = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const T step = (f(i, x[i]) / derivative(i, x[i])).magnitude();
+            const T applied = done[i] ? T(0) : step;
+            x[i] = X{x[i].magnitude() - applied};
+            done[i] = done[i] | static_cast<unsigned char>(std::abs(step) <= tolerance.magnitude());
+            converged += done[i];
+        }
+        if (converged == n) return true;
+    }
+    return false;
+}
+}
@@ -1,8 +1,24 @@
 #pragma once
 
+#include <src/unit/unitHelper.h>
+
+#include <type_traits>
+
+// the default magnitude type, can be defined before the first include
+#ifndef UNIT_BASETYPE
+#define UNIT_BASETYPE double
+#endif
+
+// namespace scope constants, inline since c++17 so that they have external linkage and modules can export them
+#if __cplusplus >= 201703L
+#define UNIT_CONSTANT inline constexpr
+#else
+#define UNIT_CONSTANT constexpr
+#endif
+
 namespace unit {
 
-template <typename Unit, typename MagnitudeRepresentation = double>
+template <typename Unit, typename MagnitudeRepresentation = UNIT_BASETYPE>
 class Quantity {
     template <typename, typename>
     friend class Quantity;
@@ -21,6 +37,10 @@ class Quantity {
     template <typename R>
     constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
 
+    // the same unit in another representation, eg a SparseUnit or a UnitId
+    template <typename U, typename R, typename = typename std::enable_if<helper::EquivalentUnits<U, unit>::value()>::type>
+    constexpr Quantity(Quantity<U, R> const& v) : m_magnitude(v.m_magnitude) {}
+
     classtype& operator=(classtype const& v) = default;
 
     constexpr magnitude_type const& magnitude() const { return m_magnitude; }
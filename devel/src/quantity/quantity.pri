@@ -5,4 +5,12 @@ HEADERS += \
         $$PWD/quantityPrinting.h \
         $$PWD/quantityReading.h \
     $$PWD/quantityDefinitionsSI.h \
-    $$PWD/quantityDefinitionsMinimalExample.h
+    $$PWD/quantityDefinitionsMinimalExample.h \
+    $$PWD/quantityConversion.h \
+    $$PWD/quantityParsing.h \
+    $$PWD/quantityFormatting.h \
+    $$PWD/quantityWriting.h \
+    $$PWD/quantityInstantiationsSI.h
+
+SOURCES += \
+    $$PWD/quantityInstantiationsSI.cpp
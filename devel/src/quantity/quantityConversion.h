@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Quantity.h"
+#include <src/unit/unitSymbols.h>
+
+#include <cstddef>
+
+namespace unit {
+
+/**
+ * converts value given in the unit of entry to out, false if there is no entry or its dimension is not the one of U
+ */
+template <typename U, typename T, std::size_t dimensions>
+bool to_quantity(ConversionEntry<dimensions> const* entry, T const& value, Quantity<U, T>& out) {
+    static_assert(U::exponent_count() == dimensions, "conversion table of another unit system");
+    if (entry == nullptr || !helper::conversion::Exponents<U>::equal(entry->exponents)) return false;
+    out = Quantity<U, T>{value * static_cast<T>(entry->factor)};
+    return true;
+}
+}
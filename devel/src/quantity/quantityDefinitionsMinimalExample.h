@@ -26,9 +26,9 @@ using foo = Quantity<u::foo>;
 using foo_inv = Quantity<u::foo_inv>;
 }
 
-constexpr t::unitless number{1};
-constexpr      t::foo foo{1};
-constexpr  t::foo_inv foo_inv{1};
+UNIT_CONSTANT t::unitless number{1};
+UNIT_CONSTANT      t::foo foo{1};
+UNIT_CONSTANT  t::foo_inv foo_inv{1};
 
 namespace literals {
 
@@ -6,7 +6,10 @@
 #include <src/unit/unitScaling.h>
 #include "quantityOperators.h"
 #include "quantityMath.h"
+#include "quantityConversion.h"
 
+#include <cstddef>
+#include <cstring>
 #include <ratio>
 #include <ostream>
 
@@ -36,7 +39,7 @@ using steradian = unitless;
 using     hertz = quotient_unit< unitless, second>;
 using    newton = quotient_unit< product_unit<kilogram, meter>, sqare_unit<second>>;
 using    pascal = quotient_unit< newton,  sqare_unit<meter>>;
-using     joule = quotient_unit< newton,  meter>;
+using     joule = product_unit<  newton,  meter>;
 using      watt = quotient_unit< joule,   second>;
 using   coulomb = product_unit<  second,  ampere>;
 using      volt = quotient_unit< watt,    ampere>;
@@ -65,7 +68,7 @@ using mol_inv   = quotient_unit< unitless, mole>;
 
 namespace t { //quantity types
 
-    using def = double; //default representation
+    using def = UNIT_BASETYPE; //default representation
 
     //base units
     using unitless = Quantity<u::unitless, def>;
@@ -105,72 +108,72 @@ namespace t { //quantity types
 }
 
 
-constexpr t::unitless unitless{1};
-constexpr t::unitless number{1};
-constexpr    t::meter meter{1};
-constexpr t::kilogram kilogram{1};
-constexpr   t::second second{1};
-constexpr   t::ampere ampere{1};
-constexpr   t::kelvin kelvin{1};
-constexpr     t::mole mole{1};
-constexpr  t::candela candela{1};
+UNIT_CONSTANT t::unitless unitless{1};
+UNIT_CONSTANT t::unitless number{1};
+UNIT_CONSTANT    t::meter meter{1};
+UNIT_CONSTANT t::kilogram kilogram{1};
+UNIT_CONSTANT   t::second second{1};
+UNIT_CONSTANT   t::ampere ampere{1};
+UNIT_CONSTANT   t::kelvin kelvin{1};
+UNIT_CONSTANT     t::mole mole{1};
+UNIT_CONSTANT  t::candela candela{1};
 
 //derived units
-constexpr    t::radian radian{1};
-constexpr t::steradian steradian{1};
-constexpr     t::hertz hertz{1};
-constexpr    t::newton newton{1};
-constexpr    t::pascal pascal{1};
-constexpr     t::joule joule{1};
-constexpr      t::watt watt{1};
-constexpr   t::coulomb coulomb{1};
-constexpr      t::volt volt{1};
-constexpr     t::farad farad{1};
-constexpr       t::ohm ohm{1};
-constexpr   t::siemens siemens{1};
-constexpr     t::weber weber{1};
-constexpr     t::tesla tesla{1};
-constexpr     t::henry henry{1};
-constexpr     t::lumen lumen{1};
-constexpr       t::lux lux{1};
-constexpr t::becquerel becquerel{1};
-constexpr      t::gray gray{1};
-constexpr   t::sievert sievert{1};
-constexpr     t::katal katal{1};
+UNIT_CONSTANT    t::radian radian{1};
+UNIT_CONSTANT t::steradian steradian{1};
+UNIT_CONSTANT     t::hertz hertz{1};
+UNIT_CONSTANT    t::newton newton{1};
+UNIT_CONSTANT    t::pascal pascal{1};
+UNIT_CONSTANT     t::joule joule{1};
+UNIT_CONSTANT      t::watt watt{1};
+UNIT_CONSTANT   t::coulomb coulomb{1};
+UNIT_CONSTANT      t::volt volt{1};
+UNIT_CONSTANT     t::farad farad{1};
+UNIT_CONSTANT       t::ohm ohm{1};
+UNIT_CONSTANT   t::siemens siemens{1};
+UNIT_CONSTANT     t::weber weber{1};
+UNIT_CONSTANT     t::tesla tesla{1};
+UNIT_CONSTANT     t::henry henry{1};
+UNIT_CONSTANT     t::lumen lumen{1};
+UNIT_CONSTANT       t::lux lux{1};
+UNIT_CONSTANT t::becquerel becquerel{1};
+UNIT_CONSTANT      t::gray gray{1};
+UNIT_CONSTANT   t::sievert sievert{1};
+UNIT_CONSTANT     t::katal katal{1};
 
 //according to https://www.nist.gov/sites/default/files/documents/pml/wmd/metric/SP1038.pdf
-constexpr       t::meter inch{centi(2.54)}; //(ft)
-constexpr       t::meter food{0.3048}; //(ft)
-constexpr       t::meter mile{1609.344}; //international (5280 ft)(mi)
-constexpr       t::meter yard{0.9144}; //(yd)
-constexpr    t::kilogram pound{0.45359237}; //avoirdupois
-constexpr    t::kilogram ounce{0.02834952}; //avoirdupois
-constexpr    t::kilogram gram{helper::rescale<std::ratio<1>,std::kilo>(1.0)};
-constexpr      t::second minute{60};
-constexpr      t::second hour{60*60};
-constexpr      t::second day{60*60*24};
-constexpr       t::joule calorie{4.184}; //pyhsical unit!
-constexpr       t::joule watt_hour{3600};
-constexpr t::meter_cubed liter{0.001};
-constexpr t::meter_cubed gallon{3.785412 * 0.001};
-constexpr      t::pascal bar{kilo(100)};
-constexpr    t::unitless parts_per_million{micro(1.0)};
-constexpr    t::unitless percent{centi(1.0)};
+UNIT_CONSTANT       t::meter inch{centi(2.54)}; //(ft)
+UNIT_CONSTANT       t::meter food{0.3048}; //(ft)
+UNIT_CONSTANT       t::meter mile{1609.344}; //international (5280 ft)(mi)
+UNIT_CONSTANT       t::meter yard{0.9144}; //(yd)
+UNIT_CONSTANT    t::kilogram pound{0.45359237}; //avoirdupois
+UNIT_CONSTANT    t::kilogram ounce{0.02834952}; //avoirdupois
+UNIT_CONSTANT    t::kilogram gram{helper::rescale<std::ratio<1>,std::kilo>(1.0)};
+UNIT_CONSTANT      t::second minute{60};
+UNIT_CONSTANT      t::second hour{60*60};
+UNIT_CONSTANT      t::second day{60*60*24};
+UNIT_CONSTANT       t::joule calorie{4.184}; //pyhsical unit!
+UNIT_CONSTANT       t::joule watt_hour{3600};
+UNIT_CONSTANT t::meter_cubed liter{0.001};
+UNIT_CONSTANT t::meter_cubed gallon{3.785412 * 0.001};
+UNIT_CONSTANT      t::pascal bar{kilo(100)};
+UNIT_CONSTANT    t::unitless parts_per_million{micro(1.0)};
+UNIT_CONSTANT    t::unitless percent{centi(1.0)};
 
 
 
 
 //temperature
-constexpr    t::kelvin     celsius ( double v ){ return t::kelvin {static_cast<double>(v+273.15)};}
-constexpr    t::kelvin  fahrenheit ( double v ){ return t::kelvin {static_cast<double>((v+459.67)*5.0/9.0)};}
+constexpr    t::kelvin     celsius ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>(v+273.15)};}
+constexpr    t::kelvin  fahrenheit ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>((v+459.67)*5.0/9.0)};}
 
 
 namespace literals {
 
-constexpr   t::unitless operator"" _unitless ( long double v )  {return t::unitless {static_cast<double>(v)};}
-constexpr   t::unitless operator""   _number ( long double v )  {return t::unitless {static_cast<double>(v)};}
-constexpr   t::unitless operator""        _n ( long double v )  {return t::unitless {static_cast<double>(v)};}
-constexpr   t::newton   operator""   _newton ( long double v )  {return   t::newton {static_cast<double>(v)};}
+constexpr   t::unitless operator"" _unitless ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""   _number ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""        _n ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::newton   operator""   _newton ( long double v )  {return   t::newton {static_cast<UNIT_BASETYPE>(v)};}
 
 }
 
@@ -209,5 +212,42 @@ template<> inline void print_unit<     u::gray>(std::ostream& s){ s<<"Gy"; }
 //template<> inline void print_unit<  sievert>(std::ostream& s){ s<<"Sv"; }
 template<> inline void print_unit<    u::katal>(std::ostream& s){ s<<"ka"; }
 
+//symbols for parsing, the printed ones and some common spellings
+namespace helper {
+namespace si {
+
+// class template so that the header only table has a single definition
+template <typename = void>
+struct Spellings {
+    static constexpr ConversionEntry<7> entries[] = {
+        conversion_entry< u::candela>("cd"), //printed as lm, the steradian has no dimension
+        conversion_entry<u::kilogram>("g", 1, 1000),
+        conversion_entry<     u::ohm>("\xce\xa9"), //Ω
+        conversion_entry<     u::lux>("lx"),
+        conversion_entry<   u::katal>("kat"),
+        //non-si units accepted for use with the si
+        conversion_entry<      u::second>("min", 60),
+        conversion_entry<      u::second>("h", 3600),
+        conversion_entry<      u::second>("d", 86400),
+        conversion_entry<u::meter_cubed>("L", 1, 1000),
+        conversion_entry<u::meter_cubed>("l", 1, 1000),
+        conversion_entry<    u::kilogram>("t", 1000),
+        conversion_entry<sqare_unit<u::meter>>("ha", 10000),
+    };
+};
+
+template <typename T>
+constexpr ConversionEntry<7> Spellings<T>::entries[];
+}
+}
+
+template<> struct UnitSymbols<7> {
+    using printed = helper::symbols::Printed<u::meter, u::kilogram, u::second, u::ampere, u::kelvin, u::mole,
+        u::hertz, u::newton, u::pascal, u::joule, u::watt, u::coulomb, u::volt, u::farad, u::ohm,
+        u::siemens, u::weber, u::tesla, u::henry, u::lumen, u::lux, u::gray, u::katal>;
+    static ConversionEntry<7> const* spellings() { return helper::si::Spellings<>::entries; }
+    static std::size_t spelling_count() { return sizeof(helper::si::Spellings<>::entries) / sizeof(helper::si::Spellings<>::entries[0]); }
+};
+
 }
 
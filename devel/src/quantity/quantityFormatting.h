@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace unit {
+
+namespace helper {
+
+namespace formatting {
+
+/**
+ * shortest round trip formatting of floating point magnitudes with Grisu2 (Loitsch, "Printing
+ * floating-point numbers quickly and accurately with integers"). The digits always read back to
+ * the same value, they are the shortest ones for almost all inputs.
+ */
+
+// f * 2^e
+struct DiyFp {
+    std::uint64_t f;
+    int e;
+};
+
+inline DiyFp subtract(DiyFp x, DiyFp y) { return DiyFp{x.f - y.f, x.e}; }
+
+// upper 64 bits of the 128 bit product, rounded
+inline DiyFp multiply(DiyFp x, DiyFp y) {
+    const std::uint64_t lowMask = 0xFFFFFFFFu;
+    const std::uint64_t a = x.f >> 32, b = x.f & lowMask, c = y.f >> 32, d = y.f & lowMask;
+    const std::uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    const std::uint64_t middle = (bd >> 32) + (ad & lowMask) + (bc & lowMask) + (std::uint64_t{1} << 31);
+    return DiyFp{ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64};
+}
+
+inline DiyFp normalize(DiyFp x) {
+    while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        --x.e;
+    }
+    return x;
+}
+
+inline DiyFp normalizeTo(DiyFp x, int e) { return DiyFp{x.f << (x.e - e), e}; }
+
+// v and the boundaries of its rounding interval, v has to be positive and finite
+struct Boundaries {
+    DiyFp v;
+    DiyFp minus;
+    DiyFp plus;
+};
+
+template <typename T>
+Boundaries boundaries(T value) {
+    static_assert(std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8), "ieee single or double precision");
+    using Bits = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    constexpr int precision = std::numeric_limits<T>::digits;
+    constexpr int bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    constexpr std::uint64_t hiddenBit = std::uint64_t{1} << (precision - 1);
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const std::uint64_t exponent = static_cast<std::uint64_t>(bits) >> (precision - 1);
+    const std::uint64_t fraction = static_cast<std::uint64_t>(bits) & (hiddenBit - 1);
+
+    const DiyFp v = exponent == 0 ? DiyFp{fraction, 1 - bias} : DiyFp{fraction + hiddenBit, static_cast<int>(exponent) - bias};
+    // the next smaller value is closer at powers of two
+    const bool lowerCloser = fraction == 0 && exponent > 1;
+    const DiyFp plus = normalize(DiyFp{2 * v.f + 1, v.e - 1});
+    const DiyFp minus = lowerCloser ? DiyFp{4 * v.f - 1, v.e - 2} : DiyFp{2 * v.f - 1, v.e - 1};
+    return Boundaries{normalize(v), normalizeTo(minus, plus.e), plus};
+}
+
+// f * 2^e ~ 10^k
+struct CachedPower {
+    std::uint64_t f;
+    int e;
+    int k;
+};
+
+// the scaled value has a binary exponent in [alpha, gamma]
+constexpr int alpha = -60;
+constexpr int gamma = -32;
+
+inline CachedPower cachedPower(int e) {
+    static constexpr CachedPower powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300}, {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284}, {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268}, {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252}, {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236}, {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220}, {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204}, {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188}, {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172}, {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156}, {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140}, {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124}, {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108}, {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92}, {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76}, {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60}, {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44}, {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28}, {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12}, {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4}, {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20}, {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36}, {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52}, {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68}, {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84}, {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100}, {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116}, {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132}, {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148}, {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164}, {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180}, {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196}, {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212}, {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228}, {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244}, {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260}, {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276}, {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292}, {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308}, {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324}, {0xEB96BF6EBADF77D9, 1039, 332},
+        {0xAF87023B9BF0EE6B, 1066, 340},
+    };
+    constexpr int firstK = -300;
+    constexpr int kStep = 8;
+
+    // ceil(log10(2) * (alpha - e - 1)), rounded up to the next cached power
+    const int f = alpha - e - 1;
+    const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+    return powers[(-firstK + k + (kStep - 1)) / kStep];
+}
+
+inline int largestPow10(std::uint32_t n, std::uint32_t& pow10) {
+    int digits = 10;
+    pow10 = 1000000000;
+    while (digits > 1 && n < pow10) {
+        pow10 /= 10;
+        --digits;
+    }
+    return digits;
+}
+
+// moves the last digit towards w while the result stays inside the interval
+inline void round(char* digits, int length, std::uint64_t distance, std::uint64_t delta, std::uint64_t rest, std::uint64_t tenK) {
+    while (rest < distance && delta - rest >= tenK && (rest + tenK < distance || distance - rest > rest + tenK - distance)) {
+        --digits[length - 1];
+        rest += tenK;
+    }
+}
+
+inline void generateDigits(char* digits, int& length, int& decimalExponent, DiyFp minus, DiyFp w, DiyFp plus) {
+    std::uint64_t delta = subtract(plus, minus).f;
+    std::uint64_t distance = subtract(plus, w).f;
+
+    const DiyFp one{std::uint64_t{1} << -plus.e, plus.e};
+    std::uint32_t integral = static_cast<std::uint32_t>(plus.f >> -one.e);
+    std::uint64_t fractional = plus.f & (one.f - 1);
+
+    std::uint32_t pow10 = 0;
+    for (int n = largestPow10(integral, pow10); n > 0;) {
+        digits[length++] = static_cast<char>('0' + integral / pow10);
+        integral %= pow10;
+        --n;
+        const std::uint64_t rest = (std::uint64_t{integral} << -one.e) + fractional;
+        if (rest <= delta) {
+            decimalExponent += n;
+            round(digits, length, distance, delta, rest, std::uint64_t{pow10} << -one.e);
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;) {
+        fractional *= 10;
+        digits[length++] = static_cast<char>('0' + (fractional >> -one.e));
+        fractional &= one.f - 1;
+        ++m;
+        delta *= 10;
+        distance *= 10;
+        if (fractional <= delta) break;
+    }
+    decimalExponent -= m;
+    round(digits, length, distance, delta, fractional, one.f);
+}
+
+// digits * 10^decimalExponent == value, value positive and finite
+template <typename T>
+void grisu2(T value, char* digits, int& length, int& decimalExponent) {
+    const Boundaries b = boundaries(value);
+    const CachedPower c = cachedPower(b.plus.e);
+    const DiyFp power{c.f, c.e};
+
+    const DiyFp w = multiply(b.v, power);
+    const DiyFp minus = multiply(b.minus, power);
+    const DiyFp plus = multiply(b.plus, power);
+
+    // stay inside the interval despite the rounding of the products
+    length = 0;
+    decimalExponent = -c.k;
+    generateDigits(digits, length, decimalExponent, DiyFp{minus.f + 1, minus.e}, w, DiyFp{plus.f - 1, plus.e});
+}
+
+inline char* writeExponent(char* out, int e) {
+    *out++ = 'e';
+    if (e < 0) {
+        *out++ = '-';
+        e = -e;
+    } else {
+        *out++ = '+';
+    }
+    if (e >= 100) *out++ = static_cast<char>('0' + e / 100);
+    if (e >= 10) *out++ = static_cast<char>('0' + e / 10 % 10);
+    *out++ = static_cast<char>('0' + e % 10);
+    return out;
+}
+
+// enough for sign, 17 digits, point and exponent
+constexpr std::size_t maxLength = 32;
+
+/**
+ * writes the shortest digits that read back to value, without terminating zero, and returns the length.
+ * Fixed notation for decimal exponents in [-5, 21), like "0.001" or "1500", scientific otherwise.
+ */
+template <typename T>
+std::size_t shortest(T value, char* out) {
+    char* begin = out;
+    if (value != value) {
+        std::memcpy(out, "nan", 3);
+        return 3;
+    }
+    if (std::signbit(value)) {
+        *out++ = '-';
+        value = -value;
+    }
+    if (value == std::numeric_limits<T>::infinity()) {
+        std::memcpy(out, "inf", 3);
+        return static_cast<std::size_t>(out - begin) + 3;
+    }
+    if (value == 0) {
+        *out++ = '0';
+        return static_cast<std::size_t>(out - begin);
+    }
+
+    char digits[20];
+    int length = 0;
+    int exponent = 0;
+    grisu2(value, digits, length, exponent);
+    // position of the decimal point relative to the first digit
+    const int point = length + exponent;
+
+    if (length <= point && point <= 21) {
+        // 1500
+        std::memcpy(out, digits, static_cast<std::size_t>(length));
+        out += length;
+        for (int i = length; i < point; ++i) *out++ = '0';
+    } else if (0 < point && point <= 21) {
+        // 1.5
+        std::memcpy(out, digits, static_cast<std::size_t>(point));
+        out += point;
+        *out++ = '.';
+        std::memcpy(out, digits + point, static_cast<std::size_t>(length - point));
+        out += length - point;
+    } else if (-5 < point && point <= 0) {
+        // 0.0015
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = point; i < 0; ++i) *out++ = '0';
+        std::memcpy(out, digits, static_cast<std::size_t>(length));
+        out += length;
+    } else {
+        // 1.5e-20
+        *out++ = digits[0];
+        if (length > 1) {
+            *out++ = '.';
+            std::memcpy(out, digits + 1, static_cast<std::size_t>(length - 1));
+            out += length - 1;
+        }
+        out = writeExponent(out, point - 1);
+    }
+    return static_cast<std::size_t>(out - begin);
+}
+}
+}
+}
@@ -0,0 +1,3 @@
+// the explicit instantiations declared in quantityInstantiationsSI.h, compile once with the same UNIT_BASETYPE
+#define UNIT_INSTANTIATE_SI
+#include "quantityInstantiationsSI.h"
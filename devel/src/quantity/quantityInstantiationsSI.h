@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Quantity.h"
+#include "quantityDefinitionsSI.h"
+#include "quantityPrinting.h"
+#include "quantityReading.h"
+#include <src/unit/unitPrinting.h>
+#include <src/unit/unitReading.h>
+
+#include <istream>
+#include <ostream>
+
+/**
+ * opt-in explicit instantiations of the si quantity types, include this header instead of
+ * quantityDefinitionsSI.h, quantityPrinting.h and quantityReading.h and compile
+ * quantityInstantiationsSI.cpp once, then printing and reading of eg t::newton are compiled
+ * there and not again in every translation unit
+ *
+ * The arithmetic operators are constexpr and therefore inline, an extern template does not
+ * keep them from being instantiated, they are compiled to a few instructions anyway.
+ */
+
+// every unit once, radian and steradian are unitless, lumen is candela, becquerel is hertz and sievert is gray
+#define UNIT_SI_UNITS(X) \
+    X(unitless) X(meter) X(kilogram) X(second) X(ampere) X(kelvin) X(mole) X(candela) \
+    X(hertz) X(newton) X(pascal) X(joule) X(watt) X(coulomb) X(volt) X(farad) X(ohm) X(siemens) \
+    X(weber) X(tesla) X(henry) X(lux) X(gray) X(katal) \
+    X(meter_cubed) X(meter_per_second) X(meter_per_second_squared) X(mol_inv)
+
+#ifdef UNIT_INSTANTIATE_SI
+#define UNIT_INSTANTIATION template
+#else
+#define UNIT_INSTANTIATION extern template
+#endif
+
+#define UNIT_INSTANTIATE_SI_UNIT(U) \
+    UNIT_INSTANTIATION class Quantity<u::U, t::def>; \
+    UNIT_INSTANTIATION void print_unit<u::U>(std::ostream&); \
+    UNIT_INSTANTIATION std::istream& read_unit<u::U>(std::istream&); \
+    UNIT_INSTANTIATION std::ostream& operator<< <u::U, t::def>(std::ostream&, Quantity<u::U, t::def> const&); \
+    UNIT_INSTANTIATION std::istream& operator>> <u::U, t::def>(std::istream&, Quantity<u::U, t::def>&);
+
+namespace unit {
+UNIT_SI_UNITS(UNIT_INSTANTIATE_SI_UNIT)
+}
+
+#undef UNIT_INSTANTIATE_SI_UNIT
+#undef UNIT_INSTANTIATION
+#undef UNIT_SI_UNITS
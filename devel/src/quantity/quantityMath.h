@@ -3,31 +3,120 @@
 #include "Quantity.h"
 #include <src/unit/unitOperators.h>
 
+#include <complex>
 #include <ctgmath>
 #include <ratio>
+#include <utility>
 
 
 namespace unit {
 
+namespace helper {
+
+namespace math {
+
+// brings the std overloads in scope of the unqualified calls below. Without them the
+// trailing return types would pick up eg ::abs(int) for double arguments. Magnitude types
+// from other namespaces are still found by adl.
+using std::abs;
+using std::sqrt;
+using std::pow;
+
+template <typename T>
+constexpr auto abs_impl(T const& v) -> decltype(abs(v)) {
+    return abs(v);
+}
+
+template <typename T>
+constexpr auto sqrt_impl(T const& v) -> decltype(sqrt(v)) {
+    return sqrt(v);
+}
+
+template <typename power, typename T>
+struct Pow {
+    using result_type = decltype(pow(std::declval<T const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static constexpr result_type apply(T const& v) {
+        return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    }
+};
+
+// complex fast paths: std::pow(complex, double) goes through exp and log,
+// small integer and half powers are done by multiplication and sqrt instead.
+// v is already converted to the result type, eg complex<float> to complex<double>
+template <typename C, std::intmax_t num, std::intmax_t den>
+struct ComplexPow {
+    static C apply(C const& v) { return pow(v, static_cast<double>(num) / static_cast<double>(den)); }
+};
+
+template <typename C>
+struct ComplexPow<C, 0, 1> {
+    static C apply(C const&) { return C{1}; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 1> {
+    static C apply(C const& v) { return v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 2, 1> {
+    static C apply(C const& v) { return v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 1> {
+    static C apply(C const& v) { return v * v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 4, 1> {
+    static C apply(C const& v) { return (v * v) * (v * v); }
+};
+
+template <typename C>
+struct ComplexPow<C, -1, 1> {
+    static C apply(C const& v) { return C{1} / v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 2> {
+    static C apply(C const& v) { return sqrt(v); }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 2> {
+    static C apply(C const& v) { return v * sqrt(v); }
+};
+
+template <typename power, typename T>
+struct Pow<power, std::complex<T>> {
+    using result_type = decltype(pow(std::declval<std::complex<T> const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static result_type apply(std::complex<T> const& v) {
+        return ComplexPow<result_type, power::num, power::den>::apply(result_type{v});
+    }
+};
+}
+
+}
 
 template <typename U, typename T>
 constexpr auto
 abs(Quantity<U, T> const& q)
-        -> Quantity<U, decltype(abs(q.magnitude()))>
+        -> Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>
 {
-    using std::abs;
-    return Quantity<U, decltype(abs(q.magnitude()))>{
-                                abs(q.magnitude())};
+    return Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>{
+                                helper::math::abs_impl(q.magnitude())};
 }
 
 template <typename U, typename T>
 constexpr auto
 sqrt(Quantity<U, T> const& q)
-        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>
+        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>
 {
-    using std::sqrt;
-    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>{
-                                                               sqrt(q.magnitude())};
+    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>{
+                                                               helper::math::sqrt_impl(q.magnitude())};
 }
 
 namespace helper {
@@ -35,11 +124,10 @@ namespace helper {
 template <typename power, typename T>
 constexpr auto
 pow_impl(T const& v)
- -> decltype(pow(v, static_cast<double>(power::num) / static_cast<double>(power::den)))
+ -> typename math::Pow<power, T>::result_type
 
 {
-    using std::pow;
-    return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    return math::Pow<power, T>::apply(v);
 }
 
 }
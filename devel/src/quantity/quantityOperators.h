@@ -3,6 +3,8 @@
 #include "Quantity.h"
 #include <src/unit/unitOperators.h>
 
+#include <type_traits>
+
 namespace unit {
 
 /**
@@ -91,4 +93,64 @@ template <typename LU, typename LT>
 constexpr Quantity<LU, LT> operator-(Quantity<LU, LT> const& l) {
     return Quantity<LU, LT>{-l.magnitude()};
 }
+
+namespace helper {
+
+template <typename LU, typename RU>
+using IfEquivalent = typename std::enable_if<EquivalentUnits<LU, RU>::value()>::type;
+}
+
+// the same unit in different representations, results have the representation of the left operand
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator+=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l += Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator-=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l -= Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator+(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() + r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() + r.magnitude())>{l.magnitude() + r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator-(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() - r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() - r.magnitude())>{l.magnitude() - r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() < r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() <= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() > r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() >= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator==(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() == r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator!=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() != r.magnitude();
+}
 }
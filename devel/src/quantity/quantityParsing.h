@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Quantity.h"
+#include <src/unit/unitParsing.h>
+
+#include <string>
+
+namespace unit {
+
+/**
+ * one unit of expression as quantity q, false if it cannot be parsed or its dimension is not the one of q
+ *
+ *     t::joule e;
+ *     parse_as("kW*h", e); // e == 3.6e6 J
+ */
+template <typename Q>
+bool parse_as(std::string const& expression, Q& q) {
+    using U = typename Q::unit;
+    using T = typename Q::magnitude_type;
+
+    PackedUnit<U::exponent_count()> p;
+    if (!parse_unit(expression, p) || !helper::conversion::Exponents<U>::equal(p.exponents.data(), p.denominator)) return false;
+
+    q = Q{static_cast<T>(p.scale)};
+    return true;
+}
+}
@@ -1,13 +1,85 @@
 #pragma once
 
 #include "Quantity.h"
+#include "quantityFormatting.h"
 #include <src/unit/unitPrinting.h>
 
+#include <complex>
+#include <ios>
+#include <ostream>
+#include <string>
+
 namespace unit {
 
+namespace helper {
+
+namespace printing {
+
+inline int roundTripIndex() {
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
+template <typename T>
+void printMagnitude(std::ostream& s, T const& v) {
+    s << v;
+}
+
+template <typename T>
+void printShortest(std::ostream& s, T v) {
+    if (!s.iword(roundTripIndex())) {
+        s << v;
+        return;
+    }
+    char buffer[formatting::maxLength];
+    const std::size_t n = formatting::shortest(v, buffer);
+    if (s.width() == 0)
+        s.write(buffer, static_cast<std::streamsize>(n));
+    else
+        s << std::string(buffer, n);
+}
+
+inline void printMagnitude(std::ostream& s, double v) { printShortest(s, v); }
+inline void printMagnitude(std::ostream& s, float v) { printShortest(s, v); }
+
+// the format of operator<< for std::complex
+template <typename T>
+void printMagnitude(std::ostream& s, std::complex<T> const& v) {
+    if (!s.iword(roundTripIndex())) {
+        s << v;
+        return;
+    }
+    s << '(';
+    printMagnitude(s, v.real());
+    s << ',';
+    printMagnitude(s, v.imag());
+    s << ')';
+}
+}
+}
+
+/**
+ * stream manipulator for printing float and double magnitudes with the shortest digits that read
+ * back to the same value, independent of the precision of the stream:
+ *
+ *     s << round_trip << q;  // "0.1N" or "0.30000000000000004N"
+ *     s >> r;                // r == q
+ *
+ * stream_precision switches back to the formatting of the stream.
+ */
+inline std::ios_base& round_trip(std::ios_base& s) {
+    s.iword(helper::printing::roundTripIndex()) = 1;
+    return s;
+}
+
+inline std::ios_base& stream_precision(std::ios_base& s) {
+    s.iword(helper::printing::roundTripIndex()) = 0;
+    return s;
+}
+
 template <typename Unit, typename TValue>
 std::ostream& operator<<(std::ostream& s, Quantity<Unit, TValue> const& v) {
-    s << v.magnitude();
+    helper::printing::printMagnitude(s, v.magnitude());
     print_unit<Unit>(s);
     return s;
 }
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Quantity.h"
+#include "quantityFormatting.h"
+#include <src/unit/unitPrinting.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace writing {
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::size_t>::type format(T v, char* out) {
+    return formatting::shortest(v, out);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::size_t>::type format(T v, char* out) {
+    char digits[24];
+    std::size_t n = 0;
+    const bool negative = v < 0;
+    // no negation, it overflows for the smallest value
+    do {
+        const T digit = v % 10;
+        digits[n++] = static_cast<char>('0' + (digit < 0 ? -digit : digit));
+        v /= 10;
+    } while (v != 0);
+
+    std::size_t length = 0;
+    if (negative) out[length++] = '-';
+    while (n > 0) out[length++] = digits[--n];
+    return length;
+}
+}
+}
+
+/**
+ * writes a column of quantities of one unit with a single large write per buffer
+ *
+ * operator<< prints the unit for every value and formats through the locale machinery of the
+ * stream. The column writer prints the unit symbol once, either into a header line or as
+ * cached bytes after each value, and formats the magnitudes with the shortest digits that
+ * read back exactly:
+ *
+ *     column_writer<u::watt> w{file, "power"}; // "power [W]" and then one magnitude per line
+ *     for (auto const& p : samples) w << p;
+ *
+ *     column_writer<u::watt> w{file};          // "1.5W" per line, readable with operator>>
+ *
+ * The buffer is flushed when full, by flush() and on destruction.
+ */
+template <typename U, typename T = double>
+class column_writer {
+    static_assert(std::is_floating_point<T>::value || std::is_integral<T>::value, "column_writer formats arithmetic magnitudes");
+
+   public:
+    using unit = U;
+    using quantity_type = Quantity<U, T>;
+
+    // the unit follows every value
+    explicit column_writer(std::ostream& s, std::size_t bufferSize = 1 << 16)
+        : m_stream(s), m_symbol(symbol()), m_buffer(bufferSize < minimumBuffer() ? minimumBuffer() : bufferSize), m_used(0) {}
+
+    // header line "name [unit]", then plain magnitudes
+    column_writer(std::ostream& s, std::string const& name, std::size_t bufferSize = 1 << 16)
+        : column_writer(s, bufferSize) {
+        append(name.data(), name.size());
+        append(" [", 2);
+        append(m_symbol.data(), m_symbol.size());
+        append("]\n", 2);
+        m_symbol.clear();
+    }
+
+    column_writer(column_writer const&) = delete;
+    column_writer& operator=(column_writer const&) = delete;
+
+    ~column_writer() { flush(); }
+
+    column_writer& operator<<(quantity_type const& q) {
+        write(q);
+        return *this;
+    }
+
+    void write(quantity_type const& q) {
+        if (m_buffer.size() - m_used < helper::formatting::maxLength + m_symbol.size() + 1) flush();
+        char* out = m_buffer.data() + m_used;
+        std::size_t n = helper::writing::format(q.magnitude(), out);
+        for (char c : m_symbol) out[n++] = c;
+        out[n++] = '\n';
+        m_used += n;
+    }
+
+    template <typename It>
+    void write(It begin, It end) {
+        for (; begin != end; ++begin) write(*begin);
+    }
+
+    void flush() {
+        if (m_used != 0) m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_used));
+        m_used = 0;
+    }
+
+   private:
+    std::size_t minimumBuffer() const { return 8 * helper::formatting::maxLength + m_symbol.size(); }
+
+    static std::string symbol() {
+        std::ostringstream s;
+        print_unit<U>(s);
+        return s.str();
+    }
+
+    void append(char const* s, std::size_t n) {
+        if (m_buffer.size() - m_used < n) flush();
+        if (m_buffer.size() < n) {
+            m_stream.write(s, static_cast<std::streamsize>(n));
+            return;
+        }
+        std::copy(s, s + n, m_buffer.data() + m_used);
+        m_used += n;
+    }
+
+    std::ostream& m_stream;
+    std::string m_symbol;
+    std::vector<char> m_buffer;
+    std::size_t m_used;
+};
+}
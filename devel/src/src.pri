@@ -1,2 +1,4 @@
 include($$PWD/quantity/quantity.pri)
 include($$PWD/unit/unit.pri)
+include($$PWD/magnitude/magnitude.pri)
+include($$PWD/numeric/numeric.pri)
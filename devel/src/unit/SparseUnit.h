@@ -0,0 +1,275 @@
+#pragma once
+
+#include "Unit.h"
+#include "unitHelper.h"
+#include "unitOperators.h"
+#include "unitTypes.h"
+
+#include <ratio>
+#include <type_traits>
+
+namespace unit {
+
+// a dimension of a SparseUnit with its non-zero exponent
+template <DimensionIndex index, TExponent exponent>
+struct Dimension {};
+
+namespace helper {
+
+namespace sparse {
+
+template <typename... Dimensions>
+struct List {};
+
+template <DimensionIndex i, typename... Dimensions>
+struct Lookup {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <DimensionIndex i, DimensionIndex d, TExponent e, typename... Dimensions>
+struct Lookup<i, Dimension<d, e>, Dimensions...> {
+    static constexpr TExponent value() { return i == d ? e : Lookup<i, Dimensions...>::value(); }
+};
+
+// sorted by index, unique, non-zero and within the unit system
+template <unsigned count, typename... Dimensions>
+struct Canonical {
+    static constexpr bool value() { return true; }
+};
+
+template <unsigned count, DimensionIndex d, TExponent e>
+struct Canonical<count, Dimension<d, e>> {
+    static constexpr bool value() { return d >= 0 && d < static_cast<DimensionIndex>(count) && e != 0; }
+};
+
+template <unsigned count, DimensionIndex d1, TExponent e1, DimensionIndex d2, TExponent e2, typename... Dimensions>
+struct Canonical<count, Dimension<d1, e1>, Dimension<d2, e2>, Dimensions...> {
+    static constexpr bool value() {
+        return d1 >= 0 && d1 < d2 && e1 != 0 && Canonical<count, Dimension<d2, e2>, Dimensions...>::value();
+    }
+};
+
+// appends the dimension unless its exponent is zero
+template <typename L, DimensionIndex d, TExponent e>
+struct Append;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Append<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimensions..., Dimension<d, e>>>::type;
+};
+
+// merges two sorted lists in a single pass, exponents of the same dimension are added
+template <typename L, typename R, typename Result = List<>>
+struct Merge;
+
+template <typename... Rs, typename... Result>
+struct Merge<List<>, List<Rs...>, List<Result...>> {
+    using type = List<Result..., Rs...>;
+};
+
+template <typename L, typename... Ls, typename... Result>
+struct Merge<List<L, Ls...>, List<>, List<Result...>> {
+    using type = List<Result..., L, Ls...>;
+};
+
+template <DimensionIndex a, TExponent x, typename... Ls, DimensionIndex b, TExponent y, typename... Rs, typename Result>
+struct Merge<List<Dimension<a, x>, Ls...>, List<Dimension<b, y>, Rs...>, Result> {
+    using type = typename std::conditional<
+        (a < b), Merge<List<Ls...>, List<Dimension<b, y>, Rs...>, typename Append<Result, a, x>::type>,
+        typename std::conditional<
+            (b < a), Merge<List<Dimension<a, x>, Ls...>, List<Rs...>, typename Append<Result, b, y>::type>,
+            Merge<List<Ls...>, List<Rs...>, typename Append<Result, a, x + y>::type>>::type>::type::type;
+};
+
+template <typename L>
+struct Negate;
+
+template <DimensionIndex... d, TExponent... e>
+struct Negate<List<Dimension<d, e>...>> {
+    using type = List<Dimension<d, -e>...>;
+};
+
+template <typename fract, typename L, typename Result = List<>>
+struct Raise {
+    using type = Result;
+};
+
+template <typename fract, DimensionIndex d, TExponent e, typename... Ls, typename Result>
+struct Raise<fract, List<Dimension<d, e>, Ls...>, Result> {
+    static_assert(e * fract::num % fract::den == 0, "rasing a unit to a fractional-power is not allowed");
+    using type = typename Raise<fract, List<Ls...>, typename Append<Result, d, e * fract::num / fract::den>::type>::type;
+};
+
+template <typename L, DimensionIndex d, TExponent e>
+struct Prepend;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Prepend<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimension<d, e>, Dimensions...>>::type;
+};
+
+template <typename U, ExponentIndex it = U::exponent_count() - 1, typename Result = List<>>
+struct ListOf {
+    using type = typename ListOf<U, it - 1, typename Prepend<Result, it, U::template exponent_value<it>()>::type>::type;
+};
+
+template <typename U, typename Result>
+struct ListOf<U, -1, Result> {
+    using type = Result;
+};
+
+// the non-zero dimensions of any unit representation
+template <typename U>
+struct DimensionsOf {
+    using type = typename ListOf<U>::type;
+};
+
+template <unsigned count, typename L>
+struct ToUnit;
+
+template <typename L>
+struct Canonicalize;
+
+template <typename U1, typename U2>
+struct SameSystem {
+    static_assert(U1::exponent_count() == U2::exponent_count(), "units of different unit systems");
+    static constexpr unsigned count() { return U1::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which stores only the non-zero exponents, eg
+ *
+ *     SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>  // == Unit<1,0,0,0,0,0,0,0,-1,0>
+ *
+ * The dimensions are sorted by index so that equal units are the same type, sparse_unit sorts
+ * them. product_unit, quotient_unit and raised_unit of SparseUnits merge the lists and cost the
+ * number of non-zero exponents instead of the number of dimensions, units with many dimensions
+ * therefore compile faster and have short type names. Everything else reads the exponents
+ * through exponent_value and works with both representations. Quantities of a SparseUnit and of
+ * the equal Unit convert into each other, add and compare.
+ */
+template <unsigned dimensions, typename... Dimensions>
+struct SparseUnit {
+    static_assert(helper::sparse::Canonical<dimensions, Dimensions...>::value(),
+                  "dimensions must be sorted, unique, non-zero and below the dimension count, see sparse_unit");
+
+    using classtype = SparseUnit<dimensions, Dimensions...>;
+
+    static constexpr unsigned exponent_count() { return dimensions; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::sparse::Lookup<i, Dimensions...>::value(); }
+};
+
+namespace helper {
+
+namespace sparse {
+
+template <unsigned count, typename... Dimensions>
+struct ToUnit<count, List<Dimensions...>> {
+    using type = SparseUnit<count, Dimensions...>;
+};
+
+template <unsigned count, typename... Dimensions>
+struct DimensionsOf<SparseUnit<count, Dimensions...>> {
+    using type = List<Dimensions...>;
+};
+
+template <>
+struct Canonicalize<List<>> {
+    using type = List<>;
+};
+
+// sorts by inserting one dimension after the other
+template <DimensionIndex d, TExponent e, typename... Dimensions>
+struct Canonicalize<List<Dimension<d, e>, Dimensions...>> {
+    using type = typename Merge<typename Append<List<>, d, e>::type, typename Canonicalize<List<Dimensions...>>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseProduct {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename DimensionsOf<U2>::type>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseQuotient {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename Negate<typename DimensionsOf<U2>::type>::type>::type>::type;
+};
+}
+
+namespace op {
+
+// a SparseUnit with a Unit gives a SparseUnit
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Product<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseProduct<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Product<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseProduct<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Product<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseProduct<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseQuotient<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Quotient<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseQuotient<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Quotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseQuotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+// and with a RationalUnit a RationalUnit
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Product<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Product<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, 1> {};
+
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Quotient<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, -1> {};
+
+template <unsigned dimensions, typename... Dimensions, typename fract>
+struct Raised<SparseUnit<dimensions, Dimensions...>, fract> {
+    using type = typename sparse::ToUnit<dimensions, typename sparse::Raise<fract, sparse::List<Dimensions...>>::type>::type;
+};
+}
+
+namespace baseunit {
+
+template <unsigned dimensions, typename... Dimensions, DimensionIndex index>
+struct BaseUnitOf<SparseUnit<dimensions, Dimensions...>, index> {
+    using type = SparseUnit<dimensions, Dimension<index, 1>>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <unsigned dimensions, typename... Dimensions>
+struct DenseUnit<SparseUnit<dimensions, Dimensions...>> {
+    using type = typename op::UnitOperator<dimensions - 1, SparseUnit<dimensions, Dimensions...>, std::ratio<1>, op::multiply>::type;
+};
+}
+
+/**
+ * the SparseUnit of the given dimensions in any order, dimensions given twice are added
+ *
+ *     sparse_unit<10, Dimension<8, -1>, Dimension<0, 1>>  // SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>
+ */
+template <unsigned dimensions, typename... Dimensions>
+using sparse_unit = typename helper::sparse::ToUnit<
+    dimensions, typename helper::sparse::Canonicalize<helper::sparse::List<Dimensions...>>::type>::type;
+
+// like BaseUnit, dimension -1 gives the unit without dimensions
+template <int dimension, int lastDimension>
+using SparseBaseUnit = sparse_unit<lastDimension + 1, Dimension<dimension, dimension < 0 ? 0 : 1>>;
+}
@@ -16,4 +16,28 @@ struct Unit{
     static constexpr TExponent exponent_value() { return helper::nthElement::NthElement<i,dimensionExponents...>::value(); }
 };
 
+/**
+ * unit with the rational exponents numerators / denominator, the result of raising a Unit to a
+ * fractional power, eg sqrt of a hertz:
+ *
+ *     raised_unit<Unit<0,0,-1,0,0,0,0>, std::ratio<1, 2>>  // RationalUnit<2, 0,0,-1,0,0,0,0>
+ *
+ * The fraction is reduced and the denominator at least 2, results with integer exponents are
+ * Units again. There is no exponent_value, code that expects integer exponents does not compile.
+ */
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit {
+    static_assert(denominator > 1, "a unit with integer exponents is a Unit");
+    static_assert(helper::rational::Gcd<denominator, numerators...>::value() == 1, "the exponents must be reduced");
+
+    using classtype = RationalUnit<denominator, numerators...>;
+
+    static constexpr unsigned exponent_count() { return sizeof...(numerators); }
+
+    static constexpr TExponent exponent_denominator() { return denominator; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_numerator() { return helper::nthElement::NthElement<i, numerators...>::value(); }
+};
+
 }
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "SparseUnit.h"
+#include "Unit.h"
+#include "unitHelper.h"
+#include "unitOperators.h"
+#include "unitTypes.h"
+
+#include <cstdint>
+#include <ratio>
+
+namespace unit {
+
+namespace helper {
+
+namespace id {
+
+using TPacked = std::uint64_t;
+
+/**
+ * the dimension count in the lowest 3 bits, then 6 bits per exponent, zigzag encoded so that
+ * small exponents of either sign give small numbers (0, -1, 1, -2 ... as 0, 1, 2, 3 ...) and
+ * the ids of common units have few digits
+ */
+constexpr unsigned maxDimensions() { return 7; }
+constexpr unsigned countBits() { return 3; }
+constexpr unsigned exponentBits() { return 6; }
+
+constexpr unsigned count(TPacked p) { return static_cast<unsigned>(p & ((TPacked{1} << countBits()) - 1)); }
+
+constexpr unsigned shift(unsigned i) { return countBits() + exponentBits() * i; }
+
+constexpr TExponent decode(TExponent z) { return z % 2 == 0 ? z / 2 : -(z + 1) / 2; }
+
+constexpr TExponent exponent(TPacked p, unsigned i) {
+    return decode(static_cast<TExponent>((p >> shift(i)) & ((TPacked{1} << exponentBits()) - 1)));
+}
+
+constexpr TPacked field(TExponent e, unsigned i) { return static_cast<TPacked>(e >= 0 ? 2 * e : -2 * e - 1) << shift(i); }
+
+constexpr bool fits(TExponent e) { return e >= -32 && e <= 31; }
+
+// nothing but exponents below the dimension count
+constexpr bool valid(TPacked p) { return count(p) <= maxDimensions() && p >> shift(count(p)) == 0; }
+
+constexpr TPacked sum(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(exponent(a, i) + sign * exponent(b, i), i) | sum(a, b, sign, i + 1);
+}
+
+constexpr bool sumFits(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) || (fits(exponent(a, i) + sign * exponent(b, i)) && sumFits(a, b, sign, i + 1));
+}
+
+constexpr TPacked raise(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(static_cast<TExponent>(exponent(a, i) * num / den), i) | raise(a, num, den, i + 1);
+}
+
+constexpr bool divisible(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num % den == 0 && divisible(a, num, den, i + 1));
+}
+
+constexpr bool raiseFits(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num / den >= -32 && exponent(a, i) * num / den <= 31 && raiseFits(a, num, den, i + 1));
+}
+
+template <typename U, unsigned i = 0, bool = (i < U::exponent_count())>
+struct Pack {
+    static_assert(fits(U::template exponent_value<i>()), "exponents of a UnitId are within [-32, 31]");
+    static constexpr TPacked value() { return field(U::template exponent_value<i>(), i) | Pack<U, i + 1>::value(); }
+};
+
+template <typename U, unsigned i>
+struct Pack<U, i, false> {
+    static_assert(U::exponent_count() <= maxDimensions(), "a UnitId has seven dimensions at most");
+    static constexpr TPacked value() { return U::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which is a single integer, for short symbol names and debug info:
+ *
+ *     Quantity<unit_id<u::newton>>  // Quantity<UnitId<99351ull>>
+ *
+ * instead of Quantity<Unit<1, 1, -2, 0, 0, 0, 0>> for seven dimensions. Equal units have the same
+ * id. product_unit, quotient_unit and raised_unit of UnitIds are UnitIds, as well as the result of
+ * combining a UnitId with another representation except RationalUnit, which stays rational.
+ * Quantities of a UnitId and of its Unit convert into each other, add and compare. UnitIds print
+ * like their Unit, eg "N".
+ */
+template <std::uint64_t packed>
+struct UnitId {
+    static_assert(helper::id::valid(packed), "not a packed unit, see unit_id");
+
+    using classtype = UnitId<packed>;
+
+    static constexpr unsigned exponent_count() { return helper::id::count(packed); }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::id::exponent(packed, i); }
+};
+
+// the UnitId of any unit representation of up to seven dimensions
+template <typename U>
+using unit_id = UnitId<helper::id::Pack<U>::value()>;
+
+namespace helper {
+
+namespace id {
+
+template <typename U1, typename U2, int sign>
+struct Combined {
+    static constexpr TPacked l = Pack<U1>::value();
+    static constexpr TPacked r = Pack<U2>::value();
+    static_assert(count(l) == count(r), "units of different unit systems");
+    static_assert(sumFits(l, r, sign), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<sum(l, r, sign)>;
+};
+
+template <typename U1, typename U2>
+struct IdProduct : Combined<U1, U2, 1> {};
+
+template <typename U1, typename U2>
+struct IdQuotient : Combined<U1, U2, -1> {};
+}
+
+namespace op {
+
+template <std::uint64_t packed, typename U2>
+struct Product<UnitId<packed>, U2> : id::IdProduct<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Product<U1, UnitId<packed>> : id::IdProduct<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Product<UnitId<l>, UnitId<r>> : id::IdProduct<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Product<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdProduct<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Product<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdProduct<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, typename U2>
+struct Quotient<UnitId<packed>, U2> : id::IdQuotient<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Quotient<U1, UnitId<packed>> : id::IdQuotient<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Quotient<UnitId<l>, UnitId<r>> : id::IdQuotient<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdQuotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Quotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdQuotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Product<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Product<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, 1> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Quotient<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Quotient<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, -1> {};
+
+template <std::uint64_t packed, typename fract>
+struct Raised<UnitId<packed>, fract> {
+    static_assert(id::divisible(packed, fract::num, fract::den), "rasing a unit to a fractional-power is not allowed");
+    static_assert(id::raiseFits(packed, fract::num, fract::den), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<id::raise(packed, fract::num, fract::den)>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <std::uint64_t packed>
+struct DenseUnit<UnitId<packed>> {
+    using type = typename op::UnitOperator<id::count(packed) - 1, UnitId<packed>, std::ratio<1>, op::multiply>::type;
+};
+
+template <std::uint64_t packed>
+struct PrintedAs<UnitId<packed>> {
+    using type = typename DenseUnit<UnitId<packed>>::type;
+};
+}
+}
@@ -3,6 +3,12 @@ HEADERS += \
         $$PWD/unitHelper.h \
         $$PWD/unitOperators.h \
         $$PWD/unitPrinting.h \
-        $$PWD/UnitReading.h \
+        $$PWD/unitReading.h \
     $$PWD/unitTypes.h \
-    $$PWD/unitScaling.h
+    $$PWD/unitScaling.h \
+    $$PWD/unitHash.h \
+    $$PWD/unitSymbols.h \
+    $$PWD/unitSymbolTable.h \
+    $$PWD/unitParsing.h \
+    $$PWD/SparseUnit.h \
+    $$PWD/UnitId.h
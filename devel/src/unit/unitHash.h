@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace unit {
+namespace helper {
+namespace hash {
+
+using THash = std::uint32_t;
+
+constexpr THash rotl(THash x, unsigned r) { return static_cast<THash>((x << r) | (x >> (32 - r))); }
+
+constexpr THash xorShift(THash h, unsigned shift) { return h ^ (h >> shift); }
+
+// murmur3 finalizer
+constexpr THash mix(THash h) {
+    return xorShift(static_cast<THash>(xorShift(static_cast<THash>(xorShift(h, 16) * 0x85ebca6bu), 13) * 0xc2b2ae35u), 16);
+}
+
+namespace murmur {
+
+// up to four characters as little endian word, compilers merge this into a single load
+constexpr THash block(char const* s, std::size_t n) {
+    return n == 0 ? 0 : static_cast<THash>(static_cast<unsigned char>(s[0]) | (block(s + 1, n - 1) << 8));
+}
+
+constexpr THash scramble(THash k) { return static_cast<THash>(rotl(static_cast<THash>(k * 0xcc9e2d51u), 15) * 0x1b873593u); }
+
+constexpr THash body(char const* s, std::size_t n, THash h) {
+    return n < 4 ? (n == 0 ? h : h ^ scramble(block(s, n)))
+                 : body(s + 4, n - 4, static_cast<THash>(rotl(h ^ scramble(block(s, 4)), 13) * 5u + 0xe6546b64u));
+}
+}
+
+/**
+ * murmur3 (32 bit) of the first n characters of s, constexpr so that generated tables can be
+ * checked at compile time. Four characters are consumed per step, which keeps short keys cheap.
+ */
+constexpr THash murmur3(char const* s, std::size_t n, THash seed = 0) {
+    return mix(murmur::body(s, n, seed) ^ static_cast<THash>(n));
+}
+
+constexpr std::size_t length(char const* s) { return *s == '\0' ? 0 : 1 + length(s + 1); }
+
+// rehash of the key hash h, distinct seeds give independent slots for the same key
+constexpr THash seeded(THash h, THash seed) {
+    return mix(h ^ static_cast<THash>(seed * 0x9e3779b9u));
+}
+
+/**
+ * slot of a key hash in a minimal perfect hash table (hash and displace): the bucket of the
+ * key selects a seed which was chosen by the generator of the table such that all keys land
+ * on distinct slots. The string is hashed once only, the seeds just remix its hash.
+ */
+constexpr std::size_t slot(THash h, THash const* displacements, std::size_t buckets, std::size_t size) {
+    return seeded(h, displacements[h % buckets]) % size;
+}
+
+/**
+ * O(1) lookup in a perfect hash table of entries with a member name, unknown keys end up on
+ * some slot and are rejected by a single string comparison
+ */
+template <typename Entry>
+Entry const* find(Entry const* table, std::size_t size, THash const* displacements, std::size_t buckets, char const* key, std::size_t n) {
+    if (size == 0) return nullptr;
+    Entry const& e = table[slot(murmur3(key, n), displacements, buckets, size)];
+    return std::strncmp(e.name, key, n) == 0 && e.name[n] == '\0' ? &e : nullptr;
+}
+
+template <typename Entry, std::size_t size, std::size_t buckets>
+Entry const* find(Entry const (&table)[size], THash const (&displacements)[buckets], char const* key, std::size_t n) {
+    return find(table, size, displacements, buckets, key, n);
+}
+}
+}
+}
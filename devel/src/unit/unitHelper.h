@@ -2,11 +2,16 @@
 
 #include "unitTypes.h"
 
+#include <type_traits>
+
 namespace unit {
 
 template <TExponent... dimensionExponents>
 struct Unit;
 
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit;
+
 namespace helper {
 
 // helper to shorten access
@@ -15,6 +20,10 @@ constexpr TExponent exponent() {
     return Unit::template exponent_value<i>();
 }
 
+constexpr TExponent gcd(TExponent a, TExponent b) {
+    return b == 0 ? (a < 0 ? -a : a) : gcd(b, a % b);
+}
+
 namespace nthElement {
 
 using Index = unsigned int;
@@ -30,6 +39,19 @@ struct NthElement<0, Arg, Args...> {
 };
 }
 
+namespace rational {
+
+template <TExponent... values>
+struct Gcd {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <TExponent v, TExponent... values>
+struct Gcd<v, values...> {
+    static constexpr TExponent value() { return gcd(v, Gcd<values...>::value()); }
+};
+}
+
 namespace baseunit {
 
 template <DimensionIndex it, DimensionIndex index, TExponent... exponents>
@@ -41,7 +63,45 @@ template <DimensionIndex index, TExponent... exponents>
 struct BaseUnitGen<-1, index, exponents...> {
     using type = Unit<exponents...>;
 };
+
+// the base unit of dimension index in the unit system of U, specialized by other unit representations
+template <typename U, DimensionIndex index>
+struct BaseUnitOf {
+    using type = typename BaseUnitGen<U::exponent_count() - 1, index>::type;
+};
 }
+
+// U as Unit<exponents...>, specialized by other unit representations
+template <typename U>
+struct DenseUnit;
+
+template <TExponent... exponents>
+struct DenseUnit<Unit<exponents...>> {
+    using type = Unit<exponents...>;
+};
+
+// whether U1 and U2 are different representations of the same unit, eg a SparseUnit and a Unit
+template <typename U1, typename U2>
+struct EquivalentUnits {
+    template <typename A, typename B>
+    static constexpr bool dense(typename DenseUnit<A>::type*, typename DenseUnit<B>::type*) {
+        return std::is_same<typename DenseUnit<A>::type, typename DenseUnit<B>::type>::value;
+    }
+
+    // representations without a DenseUnit, like RationalUnit
+    template <typename A, typename B>
+    static constexpr bool dense(...) {
+        return false;
+    }
+
+    static constexpr bool value() { return !std::is_same<U1, U2>::value && dense<U1, U2>(nullptr, nullptr); }
+};
+
+// the unit whose print_unit prints U, specialized by representations printed like another one
+template <typename U>
+struct PrintedAs {
+    using type = U;
+};
 }
 
 template <int dimension, int lastDimension>
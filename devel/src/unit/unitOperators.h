@@ -3,6 +3,7 @@
 #include "Unit.h"
 #include "unitHelper.h"
 
+#include <type_traits>
 
 namespace unit {
 
@@ -36,17 +37,128 @@ template <typename U1, typename U2, template <class, class, int> class Op, TExpo
 struct UnitOperator<-1, U1, U2, Op, exponents...> {
     using type = Unit<exponents...>;
 };
+
+template <bool... values>
+struct AllOf {
+    static constexpr bool value() { return std::is_same<AllOf<values...>, AllOf<(values || true)...>>::value; }
+};
+}
+
+namespace rational {
+
+// Unit<numerators / denominator...> for integer exponents, the reduced RationalUnit otherwise
+template <TExponent denominator, TExponent... numerators>
+struct Reduced {
+    static constexpr TExponent g() { return Gcd<denominator, numerators...>::value(); }
+    using type = typename std::conditional<denominator == g(), Unit<numerators / g()...>,
+                                           RationalUnit<denominator / g(), numerators / g()...>>::type;
+};
+
+// the exponents of U as numerators, a Unit used as list, over a common denominator
+template <typename U>
+struct Fraction : Fraction<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct Fraction<Unit<exponents...>> {
+    static constexpr TExponent denominator() { return 1; }
+    using numerators = Unit<exponents...>;
+};
+
+template <TExponent d, TExponent... n>
+struct Fraction<RationalUnit<d, n...>> {
+    static constexpr TExponent denominator() { return d; }
+    using numerators = Unit<n...>;
+};
+
+template <TExponent d1, typename N1, TExponent d2, typename N2, int sign>
+struct Sum;
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2, int sign>
+struct Sum<d1, Unit<n1...>, d2, Unit<n2...>, sign> {
+    static_assert(sizeof...(n1) == sizeof...(n2), "units of different unit systems");
+    using type = typename Reduced<d1 / gcd(d1, d2) * d2, (n1 * (d2 / gcd(d1, d2)) + sign * n2 * (d1 / gcd(d1, d2)))...>::type;
+};
+
+template <typename U1, typename U2, int sign>
+struct Combined : Sum<Fraction<U1>::denominator(), typename Fraction<U1>::numerators,
+                      Fraction<U2>::denominator(), typename Fraction<U2>::numerators, sign> {};
+
+template <TExponent d, typename N, typename fract>
+struct Raise;
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raise<d, Unit<n...>, fract> {
+    using type = typename Reduced<static_cast<TExponent>(d * fract::den), static_cast<TExponent>(n * fract::num)...>::type;
+};
+
+template <typename U, typename fract>
+struct Power : Raise<Fraction<U>::denominator(), typename Fraction<U>::numerators, fract> {};
+
+// whether the primary Raised stays with integer exponents, other representations raise themselves
+template <typename U, typename fract>
+struct IntegerPower {
+    static constexpr bool value() { return true; }
+};
+
+template <TExponent... exponents, typename fract>
+struct IntegerPower<Unit<exponents...>, fract> {
+    static constexpr bool value() { return op::AllOf<(exponents * fract::num % fract::den == 0)...>::value(); }
+};
+}
+
+namespace op {
+
+// the operations on Unit<exponents...>, specialized by other unit representations
+template <typename U1, typename U2>
+struct Product {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, sum>::type;
+};
+
+template <typename U1, typename U2>
+struct Quotient {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, difference>::type;
+};
+
+// fractional powers give a RationalUnit
+template <typename U1, typename fract>
+struct Raised {
+    using type = typename std::conditional<rational::IntegerPower<U1, fract>::value(),
+                                           UnitOperator<U1::exponent_count() - 1, U1, fract, multiply>,
+                                           rational::Power<U1, fract>>::type::type;
+};
+
+// a RationalUnit with a Unit gives a RationalUnit or, for integer exponents, a Unit
+template <TExponent d, TExponent... n, typename U2>
+struct Product<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, 1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Product<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Product<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, 1> {};
+
+template <TExponent d, TExponent... n, typename U2>
+struct Quotient<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, -1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Quotient<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Quotient<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, -1> {};
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raised<RationalUnit<d, n...>, fract> : rational::Power<RationalUnit<d, n...>, fract> {};
 }
 }
 
 template <typename U1, typename U2>
-using product_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::sum>::type;
+using product_unit = typename helper::op::Product<U1, U2>::type;
 
 template <typename U1, typename U2>
-using quotient_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::difference>::type;
+using quotient_unit = typename helper::op::Quotient<U1, U2>::type;
 
 template <typename U1, typename fract>
-using raised_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, fract, helper::op::multiply>::type;
+using raised_unit = typename helper::op::Raised<U1, fract>::type;
 
 template <typename U>
 using sqare_unit = product_unit<U, U>;
@@ -0,0 +1,349 @@
+#pragma once
+
+#include "unitSymbolTable.h"
+#include "unitTypes.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace unit {
+
+/**
+ * unit of a parsed expression: one of it is scale in the coherent unit with the given exponents.
+ * The exponents are numerators over denominator, which is 1 unless there are fractional powers like "Hz^(1/2)".
+ */
+template <std::size_t dimensions>
+struct PackedUnit {
+    std::array<TExponent, dimensions> exponents;
+    double scale;
+    TExponent denominator;
+};
+
+namespace helper {
+
+namespace parsing {
+
+struct Prefix {
+    char const* symbol;
+    std::size_t length;
+    double scale;
+};
+
+// the prefixes of unitScaling.h, "da" has to be tried before "d"
+inline Prefix const* prefixes(std::size_t& count) {
+    static constexpr Prefix p[] = {
+        {"da", 2, 1e1},  {"f", 1, 1e-15},          {"p", 1, 1e-12},          {"n", 1, 1e-9},
+        {"u", 1, 1e-6},  {"\xc2\xb5", 2, 1e-6},    {"\xce\xbc", 2, 1e-6},    {"m", 1, 1e-3},
+        {"c", 1, 1e-2},  {"d", 1, 1e-1},           {"h", 1, 1e2},            {"k", 1, 1e3},
+        {"M", 1, 1e6},   {"G", 1, 1e9},            {"T", 1, 1e12},           {"P", 1, 1e15},
+    };
+    count = sizeof(p) / sizeof(p[0]);
+    return p;
+}
+
+template <std::size_t dimensions>
+PackedUnit<dimensions> one() {
+    PackedUnit<dimensions> r;
+    r.exponents.fill(0);
+    r.scale = 1.0;
+    r.denominator = 1;
+    return r;
+}
+
+template <std::size_t dimensions>
+void reduce(PackedUnit<dimensions>& u) {
+    TExponent g = u.denominator;
+    for (std::size_t i = 0; i < dimensions; ++i) g = gcd(g, u.exponents[i]);
+    for (std::size_t i = 0; i < dimensions; ++i) u.exponents[i] /= g;
+    u.denominator /= g;
+}
+
+// exponents of untrusted input must not overflow
+inline bool fits(long long v) {
+    return v >= std::numeric_limits<TExponent>::min() && v <= std::numeric_limits<TExponent>::max();
+}
+
+// false if an exponent leaves the range of TExponent
+template <std::size_t dimensions>
+bool multiply(PackedUnit<dimensions>& l, PackedUnit<dimensions> const& r, int sign) {
+    const TExponent g = gcd(l.denominator, r.denominator);
+    const long long ls = r.denominator / g;
+    const long long rs = l.denominator / g;
+    for (std::size_t i = 0; i < dimensions; ++i) {
+        const long long e = ls * l.exponents[i] + sign * rs * r.exponents[i];
+        if (!fits(e)) return false;
+        l.exponents[i] = static_cast<TExponent>(e);
+    }
+    if (!fits(ls * l.denominator)) return false;
+    l.denominator = static_cast<TExponent>(ls * l.denominator);
+    if (l.denominator != 1) reduce(l);
+    l.scale = sign > 0 ? l.scale * r.scale : l.scale / r.scale;
+    return true;
+}
+
+// by squaring, the cost is logarithmic in e
+inline double power(double scale, TExponent e) {
+    double r = 1.0;
+    for (unsigned long long n = e < 0 ? 0ull - static_cast<unsigned long long>(e) : static_cast<unsigned long long>(e); n != 0; n /= 2) {
+        if (n % 2 == 1) r *= scale;
+        scale *= scale;
+    }
+    return e < 0 ? 1.0 / r : r;
+}
+
+/**
+ * recursive descent parser for unit expressions like "kg*m^2/(s^2*A)", "km/h", "N.m", "kg m s^-2", "1/s" or "V/Hz^(1/2)"
+ *
+ *     expression := term (('*' | '.' | '·' | '/' | ' ') term)*
+ *     term       := factor (('^' | '**') exponent)?
+ *     exponent   := integer | '(' integer ('/' integer)? ')'
+ *     factor     := symbol | number | '(' expression ')'
+ *
+ * symbols are looked up in UnitSymbols<dimensions>, with an optional si prefix.
+ * Concatenated parsing reads the output of print_unit instead, like "m^2kgs^-2" or "Nm":
+ * symbols may follow each other without operator and are matched longest first, without prefixes.
+ */
+template <std::size_t dimensions>
+class Parser {
+   public:
+    using result_type = PackedUnit<dimensions>;
+
+    Parser(char const* begin, char const* end, bool concatenated = false)
+        : m_it(begin), m_end(end), m_concatenated(concatenated) {}
+
+    bool parse(result_type& out) {
+        skipSpace();
+        return expression(out) && (skipSpace(), m_it == m_end);
+    }
+
+   private:
+    bool expression(result_type& out) {
+        if (!term(out)) return false;
+        for (;;) {
+            const bool space = skipSpace();
+            int sign = 1;
+            if (m_it == m_end || *m_it == ')') return true;
+            if (*m_it == '*' || *m_it == '.') {
+                ++m_it;
+            } else if (*m_it == '/') {
+                ++m_it;
+                sign = -1;
+            } else if (startsWith("\xc2\xb7")) {
+                m_it += 2;
+            } else if (!space && *m_it != '(' && !(m_concatenated && isSymbolChar())) {
+                return false;
+            }
+            skipSpace();
+            result_type r;
+            if (!term(r) || !multiply(out, r, sign)) return false;
+        }
+    }
+
+    bool term(result_type& out) {
+        if (!factor(out)) return false;
+        char const* afterFactor = m_it;
+        skipSpace();
+        if (startsWith("**")) {
+            m_it += 2;
+        } else if (m_it != m_end && *m_it == '^') {
+            ++m_it;
+        } else {
+            m_it = afterFactor;  // the space may be a multiplication
+            return true;
+        }
+        TExponent e = 0;
+        TExponent d = 1;
+        if (!exponent(e, d)) return false;
+
+        const result_type base = out;
+        for (std::size_t i = 0; i < dimensions; ++i) {
+            const long long n = static_cast<long long>(base.exponents[i]) * e;
+            if (!fits(n)) return false;
+            out.exponents[i] = static_cast<TExponent>(n);
+        }
+        if (!fits(static_cast<long long>(base.denominator) * d)) return false;
+        out.denominator = base.denominator * d;
+        if (out.denominator != 1) reduce(out);
+        out.scale = d == 1 ? power(base.scale, e) : std::pow(base.scale, static_cast<double>(e) / d);
+        return true;
+    }
+
+    // false for numbers outside of TExponent
+    bool digits(TExponent& v) {
+        if (m_it == m_end || !isDigit(*m_it)) return false;
+        long long n = 0;
+        while (m_it != m_end && isDigit(*m_it)) {
+            n = n * 10 + (*m_it++ - '0');
+            if (!fits(n)) return false;
+        }
+        v = static_cast<TExponent>(n);
+        return true;
+    }
+
+    bool exponent(TExponent& e, TExponent& d) {
+        skipSpace();
+        const bool bracket = m_it != m_end && *m_it == '(';
+        if (bracket) ++m_it;
+
+        int sign = 1;
+        if (m_it != m_end && (*m_it == '-' || *m_it == '+')) sign = *m_it++ == '-' ? -1 : 1;
+        if (!digits(e)) return false;
+        e *= sign;
+
+        // "m^2.5" is no decimal exponent but neither m^2 times 5
+        if (!bracket && m_it != m_end && *m_it == '.' && m_it + 1 != m_end && isDigit(m_it[1])) return false;
+
+        if (bracket) {
+            if (m_it != m_end && *m_it == '/') {
+                ++m_it;
+                if (!digits(d) || d == 0) return false;
+            }
+            if (m_it == m_end || *m_it != ')') return false;
+            ++m_it;
+        }
+        return true;
+    }
+
+    bool factor(result_type& out) {
+        if (m_it == m_end) return false;
+        if (*m_it == '(') {
+            ++m_it;
+            skipSpace();
+            if (!expression(out) || m_it == m_end || *m_it != ')') return false;
+            ++m_it;
+            return true;
+        }
+        if (isDigit(*m_it) || *m_it == '.') return number(out);
+        return symbol(out);
+    }
+
+    bool number(result_type& out) {
+        // strtod needs a terminated string, numbers in unit expressions are short
+        char buffer[32];
+        std::size_t n = 0;
+        while (m_it + n != m_end && n + 1 < sizeof(buffer) && (isDigit(m_it[n]) || std::strchr(".eE+-", m_it[n]) != nullptr)) {
+            buffer[n] = m_it[n];
+            ++n;
+        }
+        buffer[n] = '\0';
+        char* parsedEnd = nullptr;
+        out = one<dimensions>();
+        out.scale = std::strtod(buffer, &parsedEnd);
+        if (parsedEnd == buffer) return false;
+        m_it += parsedEnd - buffer;
+        return true;
+    }
+
+    bool symbol(result_type& out) {
+        char const* begin = m_it;
+        while (m_it != m_end && isSymbolChar()) ++m_it;
+        const std::size_t length = static_cast<std::size_t>(m_it - begin);
+        if (length == 0) return false;
+
+        if (m_concatenated) {
+            const std::size_t maxLength = symbol_table<dimensions>().max_length();
+            const std::size_t longest = length < maxLength ? length : maxLength;
+            for (std::size_t n = longest; n > 0; --n) {
+                if (assign(out, begin, n, 1.0)) {
+                    m_it = begin + n;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        if (assign(out, begin, length, 1.0)) return true;
+
+        std::size_t count = 0;
+        Prefix const* p = prefixes(count);
+        for (std::size_t i = 0; i < count; ++i)
+            if (length > p[i].length && std::strncmp(begin, p[i].symbol, p[i].length) == 0 &&
+                assign(out, begin + p[i].length, length - p[i].length, p[i].scale))
+                return true;
+        return false;
+    }
+
+    static bool assign(result_type& out, char const* symbol, std::size_t length, double scale) {
+        ConversionEntry<dimensions> const* e = symbol_table<dimensions>().find(symbol, length);
+        if (e == nullptr) return false;
+        for (std::size_t i = 0; i < dimensions; ++i) out.exponents[i] = e->exponents[i];
+        out.scale = scale * e->factor;
+        out.denominator = 1;
+        return true;
+    }
+
+    bool skipSpace() {
+        char const* begin = m_it;
+        while (m_it != m_end && (*m_it == ' ' || *m_it == '\t')) ++m_it;
+        return m_it != begin;
+    }
+
+    bool startsWith(char const* s) const {
+        const std::size_t n = std::strlen(s);
+        return static_cast<std::size_t>(m_end - m_it) >= n && std::strncmp(m_it, s, n) == 0;
+    }
+
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+    // letters, % and multibyte characters like Ω or µ, but not the operator ·
+    bool isSymbolChar() const {
+        const unsigned char u = static_cast<unsigned char>(*m_it);
+        return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || u == '%' || u == '_' || (u >= 0x80 && !startsWith("\xc2\xb7"));
+    }
+
+    char const* m_it;
+    char const* m_end;
+    bool m_concatenated;
+};
+}
+}
+
+/**
+ * parses a unit expression without caching, false if it is malformed or contains unknown symbols
+ */
+template <std::size_t dimensions>
+bool parse_unit_uncached(char const* begin, char const* end, PackedUnit<dimensions>& out) {
+    out = helper::parsing::one<dimensions>();
+    return helper::parsing::Parser<dimensions>{begin, end}.parse(out);
+}
+
+/**
+ * parses a unit in the concatenated form of print_unit, eg "N", "mkgs^-2" or "Nm", false for unknown symbols
+ */
+template <std::size_t dimensions>
+bool parse_printed_unit(char const* begin, char const* end, PackedUnit<dimensions>& out) {
+    out = helper::parsing::one<dimensions>();
+    return helper::parsing::Parser<dimensions>{begin, end, true}.parse(out);
+}
+
+/**
+ * parses a unit expression, eg "kg*m^2/(s^2*A)" or "mN.km"
+ *
+ * valid expressions are cached per thread, so repeated expressions only cost a hash lookup.
+ * The cache is meant for the limited set of units of configs and file headers, it is cleared
+ * when it reaches parse_unit_cache_size entries so that arbitrary input cannot grow it.
+ */
+constexpr std::size_t parse_unit_cache_size() { return 1024; }
+
+template <std::size_t dimensions>
+bool parse_unit(std::string const& expression, PackedUnit<dimensions>& out) {
+    using Cache = std::unordered_map<std::string, PackedUnit<dimensions>>;
+    static thread_local Cache cache;
+
+    auto it = cache.find(expression);
+    if (it != cache.end()) {
+        out = it->second;
+        return true;
+    }
+    if (!parse_unit_uncached(expression.data(), expression.data() + expression.size(), out)) return false;
+    if (cache.size() >= parse_unit_cache_size()) cache.clear();
+    cache.emplace(expression, out);
+    return true;
+}
+}
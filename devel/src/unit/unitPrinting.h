@@ -2,12 +2,17 @@
 
 #include "unitHelper.h"
 #include <ostream>
+#include <sstream>
+#include <string>
 
 namespace unit {
 
 template <typename U>
 constexpr const char* unitSymbol();
 
+template <typename U>
+void print_unit(std::ostream& s);
+
 namespace helper {
 
 namespace print {
@@ -17,7 +22,7 @@ void print_unit_symbol_and_exponent(std::ostream& s) {
     static constexpr TExponent e = helper::exponent<U, pos>();
     if (e == 0)
         return;
-    s << unitSymbol<typename baseunit::BaseUnitGen<U::exponent_count() - 1, pos>::type>();
+    s << unitSymbol<typename baseunit::BaseUnitOf<U, pos>::type>();
     if (e != 1) {
         s << "^" << e;
     }
@@ -35,6 +40,50 @@ template <typename U>
 struct DimensionsPrinter<U, 0> {
     static void print_unit(std::ostream& s) { print_unit_symbol_and_exponent<U, 0>(s); }
 };
+
+// fractional exponents in brackets, eg "s^(-1/2)"
+template <typename U, DimensionIndex pos>
+void print_rational_symbol_and_exponent(std::ostream& s) {
+    static constexpr TExponent g = gcd(U::template exponent_numerator<pos>(), U::exponent_denominator());
+    static constexpr TExponent n = g == 0 ? 0 : U::template exponent_numerator<pos>() / g;
+    static constexpr TExponent d = g == 0 ? 1 : U::exponent_denominator() / g;
+    if (n == 0)
+        return;
+    s << unitSymbol<typename baseunit::BaseUnitOf<U, pos>::type>();
+    if (d != 1) {
+        s << "^(" << n << "/" << d << ")";
+    } else if (n != 1) {
+        s << "^" << n;
+    }
+}
+
+template <typename U, DimensionIndex pos>
+struct RationalDimensionsPrinter {
+    static void print_unit(std::ostream& s) {
+        RationalDimensionsPrinter<U, pos - 1>::print_unit(s);
+        print_rational_symbol_and_exponent<U, pos>(s);
+    }
+};
+
+template <typename U>
+struct RationalDimensionsPrinter<U, 0> {
+    static void print_unit(std::ostream& s) { print_rational_symbol_and_exponent<U, 0>(s); }
+};
+
+template <typename U, typename Printed = typename PrintedAs<U>::type>
+struct UnitPrinter {
+    static void print(std::ostream& s) { unit::print_unit<Printed>(s); }
+};
+
+template <typename U>
+struct UnitPrinter<U, U> {
+    static void print(std::ostream& s) { DimensionsPrinter<U, U::exponent_count() - 1>::print_unit(s); }
+};
+
+template <TExponent d, TExponent... n>
+struct UnitPrinter<RationalUnit<d, n...>, RationalUnit<d, n...>> {
+    static void print(std::ostream& s) { RationalDimensionsPrinter<RationalUnit<d, n...>, sizeof...(n) - 1>::print_unit(s); }
+};
 }
 }
 
@@ -47,9 +96,28 @@ struct DimensionsPrinter<U, 0> {
  *     for calling print_unit<Unit<10,11,12,13,14,-15,16>>(cout)
  * - "mkg"
  *     for calling print_unit<Unit<1,1,0,0,0,0,0>>(cout);
+ * - "m^2kgs^(-5/2)A^-1"
+ *     for calling print_unit<RationalUnit<2,4,2,-5,-2,0,0,0>>(cout);
  */
 template <typename U>
 void print_unit(std::ostream& s) {
-    helper::print::DimensionsPrinter<U, U::exponent_count() - 1>::print_unit(s);
+    helper::print::UnitPrinter<U>::print(s);
+}
+
+namespace helper {
+
+namespace print {
+
+// output of print_unit<U>, printed once
+template <typename U>
+std::string const& printed() {
+    static const std::string symbol = [] {
+        std::ostringstream s;
+        unit::print_unit<U>(s);
+        return s.str();
+    }();
+    return symbol;
+}
+}
 }
 }
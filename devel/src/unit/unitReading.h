@@ -0,0 +1,80 @@
+#pragma once
+
+#include "unitParsing.h"
+#include "unitPrinting.h"
+#include <cstddef>
+#include <istream>
+#include <string>
+namespace unit {
+
+namespace helper {
+
+namespace reading {
+
+// characters after which a completely read printed spelling goes on, eg "m" of "mol" or of "m^2"
+inline bool extendsSymbol(int c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80 || c == '%' || c == '^';
+}
+
+/**
+ * characters of the spellings parse_printed_unit accepts, up to the first one that cannot belong
+ * to the unit: a closing bracket without an open one or a sign not following '^' or '('
+ */
+inline bool continuesUnit(int c, char previous, int& depth) {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c >= 0x80) return true;
+    switch (c) {
+        case '^': case '%': case '_': case '*': case '/':
+            return true;
+        case '(':
+            ++depth;
+            return true;
+        case ')':
+            if (depth == 0) return false;
+            --depth;
+            return true;
+        case '-': case '+':
+            return previous == '^' || previous == '(';
+        default:
+            return false;
+    }
+}
+}
+}
+
+/**
+ * reads the unit U from s, the failbit is set if another unit is found
+ *
+ * Besides the output of print_unit<U> every equivalent spelling made of the symbols of the unit
+ * system is accepted, eg "N", "mkgs^-2" or "kg*m/s^2" for a newton. Symbols with a scale other
+ * than one (like "g" or "h") are rejected, reading never converts. The printed spelling ends the
+ * unit unless a symbol or exponent follows, so "1m)" or "1m*2" read a meter and leave the rest.
+ */
+template <typename Unit>
+std::istream& read_unit(std::istream& s) {
+    static constexpr std::size_t dimensions = Unit::exponent_count();
+
+    // a unit printed as nothing must not swallow the next word
+    std::string const& expected = helper::print::printed<Unit>();
+    if (expected.empty()) return s;
+
+    s >> std::ws;
+    char buffer[64];
+    std::size_t n = 0;
+
+    // the printed spelling needs no look-ahead, what follows it stays in the stream
+    while (n < expected.size() && n < sizeof(buffer) && s.peek() == static_cast<unsigned char>(expected[n]))
+        buffer[n++] = static_cast<char>(s.get());
+    if (n == expected.size() && !helper::reading::extendsSymbol(s.peek())) return s;
+
+    int depth = 0;
+    for (std::size_t i = 0; i < n; ++i) helper::reading::continuesUnit(static_cast<unsigned char>(buffer[i]), i == 0 ? '\0' : buffer[i - 1], depth);
+    while (n < sizeof(buffer) && helper::reading::continuesUnit(s.peek(), n == 0 ? '\0' : buffer[n - 1], depth))
+        buffer[n++] = static_cast<char>(s.get());
+
+    PackedUnit<dimensions> p;
+    if (n == sizeof(buffer) || !parse_printed_unit(buffer, buffer + n, p) || p.scale != 1.0 ||
+        !helper::conversion::Exponents<Unit>::equal(p.exponents.data(), p.denominator))
+        s.setstate(std::ios::failbit);
+    return s;
+}
+}
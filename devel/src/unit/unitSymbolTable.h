@@ -0,0 +1,132 @@
+#pragma once
+
+#include "unitHash.h"
+#include "unitPrinting.h"
+#include "unitSymbols.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace unit {
+
+namespace helper {
+
+namespace hash {
+
+/**
+ * displacements of size / 2 + 1 buckets that put the keys with the given hashes on distinct slots,
+ * slots[i] is the key on slot i. The largest buckets are placed first while most slots are free.
+ * Returns false if two hashes are equal, such keys cannot be separated.
+ */
+inline bool displace(std::vector<THash> const& hashes, std::vector<THash>& displacements, std::vector<std::size_t>& slots) {
+    const std::size_t size = hashes.size();
+    const std::size_t bucketCount = size / 2 + 1;
+
+    std::vector<std::vector<std::size_t>> buckets(bucketCount);
+    std::size_t largest = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        std::vector<std::size_t>& b = buckets[hashes[i] % bucketCount];
+        for (auto k : b)
+            if (hashes[k] == hashes[i]) return false;
+        b.push_back(i);
+        if (b.size() > largest) largest = b.size();
+    }
+
+    displacements.assign(bucketCount, 0);
+    slots.assign(size, size);
+    std::vector<std::size_t> candidate;
+    for (std::size_t n = largest; n > 0; --n) {
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            if (buckets[b].size() != n) continue;
+
+            for (THash d = 1;; ++d) {
+                if (d == 0) return false;  // no displacement found
+                candidate.clear();
+                for (auto k : buckets[b]) {
+                    const std::size_t s = seeded(hashes[k], d) % size;
+                    bool taken = slots[s] != size;
+                    for (auto c : candidate) taken = taken || c == s;
+                    if (taken) break;
+                    candidate.push_back(s);
+                }
+                if (candidate.size() != n) continue;
+
+                displacements[b] = d;
+                for (std::size_t i = 0; i < n; ++i) slots[candidate[i]] = buckets[b][i];
+                break;
+            }
+        }
+    }
+    return true;
+}
+}
+
+namespace symbols {
+
+/**
+ * perfect hash lookup of unit symbols, built at runtime so that including a unit system costs no
+ * compile time search. The names of the entries must outlive the table.
+ */
+template <std::size_t dimensions>
+class SymbolTable {
+   public:
+    using Entry = ConversionEntry<dimensions>;
+
+    explicit SymbolTable(std::vector<Entry> const& entries) : m_maxLength(0) {
+        std::vector<hash::THash> hashes;
+        for (auto const& e : entries) {
+            const std::size_t length = std::strlen(e.name);
+            hashes.push_back(hash::murmur3(e.name, length));
+            if (length > m_maxLength) m_maxLength = length;
+        }
+        std::vector<std::size_t> slots;
+        const bool separated = hash::displace(hashes, m_displacements, slots);
+        assert(separated);  // a symbol is listed twice
+        (void)separated;
+        for (auto i : slots) m_entries.push_back(entries[i]);
+    }
+
+    // nullptr for unknown symbols
+    Entry const* find(char const* symbol, std::size_t length) const {
+        return hash::find(m_entries.data(), m_entries.size(), m_displacements.data(), m_displacements.size(), symbol, length);
+    }
+
+    std::size_t max_length() const { return m_maxLength; }
+
+   private:
+    std::vector<Entry> m_entries;
+    std::vector<hash::THash> m_displacements;
+    std::size_t m_maxLength;
+};
+
+template <std::size_t dimensions>
+void addPrinted(std::vector<ConversionEntry<dimensions>>&, Printed<>) {}
+
+template <std::size_t dimensions, typename U, typename... Rest>
+void addPrinted(std::vector<ConversionEntry<dimensions>>& entries, Printed<U, Rest...>) {
+    entries.push_back(conversion_entry<U>(print::printed<U>().c_str()));
+    addPrinted(entries, Printed<Rest...>{});
+}
+
+template <std::size_t dimensions>
+std::vector<ConversionEntry<dimensions>> symbolEntries() {
+    std::vector<ConversionEntry<dimensions>> entries;
+    addPrinted(entries, typename UnitSymbols<dimensions>::printed{});
+    ConversionEntry<dimensions> const* spellings = UnitSymbols<dimensions>::spellings();
+    entries.insert(entries.end(), spellings, spellings + UnitSymbols<dimensions>::spelling_count());
+    return entries;
+}
+}
+}
+
+/**
+ * the symbols of UnitSymbols<dimensions>, built on first use
+ */
+template <std::size_t dimensions>
+helper::symbols::SymbolTable<dimensions> const& symbol_table() {
+    static const helper::symbols::SymbolTable<dimensions> table{helper::symbols::symbolEntries<dimensions>()};
+    return table;
+}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Unit.h"
+#include "unitHash.h"
+#include "unitTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+
+namespace unit {
+
+namespace helper {
+
+namespace conversion {
+
+constexpr double pow10(int e) { return e == 0 ? 1.0 : 10.0 * pow10(e - 1); }
+
+// rounds once only if exp10 is 0 and num and den are exactly representable, otherwise the result can
+// miss the nearest double by an ulp, the generated conversions use correctly rounded literals instead
+constexpr double factor(std::intmax_t num, std::intmax_t den, int exp10) {
+    return exp10 >= 0 ? static_cast<double>(num) * pow10(exp10) / static_cast<double>(den)
+                      : static_cast<double>(num) / (static_cast<double>(den) * pow10(-exp10));
+}
+
+// other unit representations compare as Unit<exponents...>
+template <typename U>
+struct Exponents : Exponents<typename DenseUnit<U>::type> {};
+
+// other are the numerators of exponents over a common denominator
+template <TExponent... exponents>
+struct Exponents<Unit<exponents...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {exponents...};
+        for (std::size_t i = 0; i < sizeof...(exponents); ++i)
+            if (own[i] * denominator != other[i]) return false;
+        return true;
+    }
+};
+
+template <TExponent d, TExponent... numerators>
+struct Exponents<RationalUnit<d, numerators...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {numerators...};
+        for (std::size_t i = 0; i < sizeof...(numerators); ++i)
+            if (own[i] * denominator != other[i] * d) return false;
+        return true;
+    }
+};
+}
+}
+
+/**
+ * exact conversion factor ratio * 10^exp10, the decimal exponent keeps factors like
+ * 1.602176634e-19 exact whose denominator does not fit into std::ratio
+ */
+template <typename ratio, int exp10 = 0>
+struct exact_factor {
+    using type = ratio;
+    static constexpr int decimal_exponent() { return exp10; }
+    static constexpr double value() { return helper::conversion::factor(ratio::num, ratio::den, exp10); }
+};
+
+/**
+ * entry of a runtime conversion table: value in unit name == value * factor in the coherent unit with the given exponents
+ */
+template <std::size_t dimensions>
+struct ConversionEntry {
+    char const* name;
+    double factor;
+    std::intmax_t num;
+    std::intmax_t den;
+    int exp10;
+    TExponent exponents[dimensions];
+};
+
+namespace helper {
+
+namespace conversion {
+
+template <typename U>
+struct EntryOf : EntryOf<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct EntryOf<Unit<exponents...>> {
+    static constexpr ConversionEntry<sizeof...(exponents)> make(char const* name, std::intmax_t num, std::intmax_t den) {
+        return ConversionEntry<sizeof...(exponents)>{name, factor(num, den, 0), num, den, 0, {exponents...}};
+    }
+};
+}
+}
+
+/**
+ * entry of a unit symbol, eg conversion_entry<u::newton>("N") or conversion_entry<u::kilogram>("g", 1, 1000)
+ */
+template <typename U>
+constexpr ConversionEntry<U::exponent_count()> conversion_entry(char const* name, std::intmax_t num = 1, std::intmax_t den = 1) {
+    return helper::conversion::EntryOf<U>::make(name, num, den);
+}
+
+namespace helper {
+
+namespace symbols {
+
+// units named by their print_unit output
+template <typename... U>
+struct Printed {};
+}
+}
+
+/**
+ * symbols of the unit system with the given number of dimensions, used by parsing and reading.
+ * Specialized by the system definition (eg quantityDefinitionsSI.h) with
+ *
+ *     using printed = helper::symbols::Printed<units...>;
+ *     static ConversionEntry<dimensions> const* spellings();
+ *     static std::size_t spelling_count();
+ *
+ * printed lists the units whose print_unit output is a symbol, spellings are further symbols and
+ * scaled units. Systems without symbols only read their printed units.
+ */
+template <std::size_t dimensions>
+struct UnitSymbols {
+    using printed = helper::symbols::Printed<>;
+    static ConversionEntry<dimensions> const* spellings() { return nullptr; }
+    static std::size_t spelling_count() { return 0; }
+};
+}
@@ -2,6 +2,17 @@
 
 #include "quantity_test/QuantityTestMain.h"
 #include "unit_test/UnitTestMain.h"
+#include "magnitude_test/TrackedTest.h"
+#include "magnitude_test/DualTest.h"
+#include "magnitude_test/IntervalTest.h"
+#include "numeric_test/ComplexArrayTest.h"
+#include "numeric_test/QuantityRingTest.h"
+#include "numeric_test/IntegrationTest.h"
+#include "numeric_test/FilterTest.h"
+#include "numeric_test/HistogramTest.h"
+#include "numeric_test/QuantileSketchTest.h"
+#include "numeric_test/InterpolationTest.h"
+#include "numeric_test/SolversTest.h"
 
 namespace tests {
 
@@ -9,6 +20,17 @@ TestMain::TestMain()
 {
     QuantityTestMain{};
     UnitTestMain{};
+    TrackedTest{};
+    DualTest{};
+    IntervalTest{};
+    ComplexArrayTest{};
+    QuantityRingTest{};
+    IntegrationTest{};
+    FilterTest{};
+    HistogramTest{};
+    QuantileSketchTest{};
+    InterpolationTest{};
+    SolversTest{};
 }
 
 }
@@ -0,0 +1,66 @@
+#include "DualTest.h"
+
+#include <src/magnitude/magnitudeDual.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+bool near(double l, double r) { return std::abs(l - r) <= 1e-12 * std::abs(r); }
+
+void gradient_test()
+{
+    auto m = make_variable<0, 2>(3.0_n * kilogram);
+    auto v = make_variable<1, 2>(2.0_n * meter / second);
+
+    auto e = 0.5_n * m * square(v);
+    static_assert(std::is_same<decltype(e)::unit, u::joule>::value, "");
+    assert(nominal_value(e) == 6.0_n * joule);
+
+    auto dE_dm = partial<0, u::kilogram>(e);
+    auto dE_dv = partial<1, u::meter_per_second>(e);
+    static_assert(std::is_same<decltype(dE_dm)::unit, quotient_unit<u::joule, u::kilogram>>::value, "");
+    static_assert(std::is_same<decltype(dE_dv)::unit, quotient_unit<u::joule, u::meter_per_second>>::value, "");
+    assert(dE_dm.magnitude() == 2.0);
+    assert(dE_dv.magnitude() == 6.0);
+
+    auto p = m * v / (m + 1.0_n * kilogram);
+    assert(near(partial<0, u::kilogram>(p).magnitude(), 2.0 / 16.0));
+    assert(near(partial<1, u::meter_per_second>(p).magnitude(), 0.75));
+}
+
+void math_test()
+{
+    using Area = sqare_unit<u::meter>;
+    auto x = make_variable<0, 1>(4.0_n * square(meter));
+
+    assert(near(partial<0, Area>(sqrt(x)).magnitude(), 0.25));
+    assert(near(partial<0, Area>(pow<std::ratio<3, 2>>(x)).magnitude(), 3.0));
+    assert(near(partial<0, Area>(cube(x)).magnitude(), 48.0));
+    assert(near(partial<0, Area>(square(x)).magnitude(), 8.0));
+    assert((partial<0, Area>(abs(-x)).magnitude() == 1.0));
+    assert((partial<0, Area>(abs(x - 5.0_n * square(meter))).magnitude() == -1.0));
+
+    static_assert(std::is_same<decltype(partial<0, Area>(sqrt(x)))::unit, quotient_unit<u::meter, sqare_unit<u::meter>>>::value, "");
+}
+}
+
+DualTest::DualTest()
+{
+    gradient_test();
+    math_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
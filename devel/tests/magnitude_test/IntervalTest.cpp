@@ -0,0 +1,120 @@
+#include "IntervalTest.h"
+
+#include <src/magnitude/magnitudeInterval.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/quantity/quantityPrinting.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename Q, typename R>
+bool encloses(Q const& i, R const& v) { return lower(i) <= v && v <= upper(i); }
+
+static_assert(sizeof(interval<double>) == 2 * sizeof(double), "");
+static_assert(alignof(interval<double>) == 2 * sizeof(double), "");
+
+void arithmetic_test()
+{
+    auto r = make_interval(9.0_n * ohm, 11.0_n * ohm);
+    auto i = make_interval(1.0_n * ampere, 2.0_n * ampere);
+
+    auto v = r * i;
+    static_assert(std::is_same<decltype(v)::unit, u::volt>::value, "");
+    assert(encloses(v, 9.0_n * volt) && encloses(v, 22.0_n * volt));
+    assert(lower(v) > 8.99999_n * volt && upper(v) < 22.00001_n * volt);
+
+    auto diff = i - i;  // dependency problem, not zero
+    assert(encloses(diff, -1.0_n * ampere) && encloses(diff, 1.0_n * ampere));
+
+    auto g = 1.0_n / make_interval(-1.0_n * ohm, 1.0_n * ohm);
+    assert(std::isinf(lower(g).magnitude()) && std::isinf(upper(g).magnitude()));
+
+    assert(make_interval(1.0_n * meter, 2.0_n * meter) < make_interval(3.0_n * meter, 4.0_n * meter));
+    assert(!(make_interval(1.0_n * meter, 3.0_n * meter) < make_interval(2.0_n * meter, 4.0_n * meter)));
+
+    // 0 * inf is 0 for bounds
+    using I = interval<double>;
+    const I z = I::entire() * I{0.0};
+    assert(z.contains(0.0) && z.width() < 1e-300);
+    const I h = I{0.0, 2.0} * I{1.0, std::numeric_limits<double>::infinity()};
+    assert(h.contains(0.0) && h.lo() > -1e-300 && std::isinf(h.hi()));
+    const I q = I::entire() / I{1.0, std::numeric_limits<double>::infinity()};
+    assert(std::isinf(q.lo()) && std::isinf(q.hi()) && q.contains(0.0));
+    const I t = I{2.0} / I{1.0, std::numeric_limits<double>::infinity()};
+    assert(t.contains(0.0) && t.contains(2.0) && t.hi() < 2.0001);
+}
+
+void math_test()
+{
+    auto x = make_interval(-1.0_n * meter, 2.0_n * meter);
+
+    auto x2 = pow<std::ratio<2>>(x);
+    assert(encloses(x2, 0.0_n * square(meter)) && encloses(x2, 4.0_n * square(meter)));
+    assert(lower(x2) <= 0.0_n * square(meter) && lower(x2) > -1e-300_n * square(meter));
+
+    auto x3 = pow<std::ratio<3>>(x);
+    assert(encloses(x3, -1.0_n * cube(meter)) && encloses(x3, 8.0_n * cube(meter)));
+
+    auto s = sqrt(make_interval(4.0_n * square(meter), 9.0_n * square(meter)));
+    static_assert(std::is_same<decltype(s)::unit, u::meter>::value, "");
+    assert(encloses(s, 2.0_n * meter) && encloses(s, 3.0_n * meter));
+
+    auto p = pow<std::ratio<3, 2>>(make_interval(4.0_n * square(meter), 9.0_n * square(meter)));
+    assert(encloses(p, 8.0_n * cube(meter)) && encloses(p, 27.0_n * cube(meter)));
+
+    auto a = abs(x);
+    assert(lower(a) == 0.0_n * meter && encloses(a, 2.0_n * meter));
+
+    // nothing of the domain left
+    assert(sqrt(interval<double>{-4.0, -1.0}).is_empty());
+    assert(!sqrt(interval<double>{-4.0, 0.0}).is_empty() && sqrt(interval<double>{-4.0, 0.0}).contains(0.0));
+    assert(pow(interval<double>{-4.0, -1.0}, 0.5).is_empty());
+}
+
+void enclosure_test()
+{
+    // every sampled evaluation must lie inside the single interval evaluation
+    auto m = make_interval(1.0_n * kilogram, 3.0_n * kilogram);
+    auto v = make_interval(-2.0_n * meter / second, 5.0_n * meter / second);
+    auto e = 0.5_n * m * square(v) + m * abs(v) * sqrt(square(v));
+
+    for (int i = 0; i <= 20; ++i)
+        for (int j = 0; j <= 20; ++j) {
+            const auto ms = (1.0_n + 0.1_n * t::unitless{static_cast<double>(i)}) * kilogram;
+            const auto vs = (-2.0_n + 0.35_n * t::unitless{static_cast<double>(j)}) * meter / second;
+            const auto es = 0.5_n * ms * square(vs) + ms * abs(vs) * sqrt(square(vs));
+            assert(encloses(e, es));
+        }
+}
+
+void print_test()
+{
+    std::ostringstream s;
+    s << Quantity<u::meter, interval<double>>{interval<double>{1.0, 2.0}};
+    assert(s.str() == "[1,2]m");
+}
+}
+
+IntervalTest::IntervalTest()
+{
+    arithmetic_test();
+    math_test();
+    enclosure_test();
+    print_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,92 @@
+#include "TrackedTest.h"
+
+#include <src/magnitude/magnitudeTracked.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/quantity/quantityPrinting.h>
+#include <tools/pysConstsantsGeneration/generated/physicalConstants.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+bool near(double l, double r) { return std::abs(l - r) <= 1e-12 * std::abs(r); }
+
+void independent_sources_test()
+{
+    auto a = make_tracked("a", 3.0_n * meter, 0.3_n * meter);
+    auto b = make_tracked("b", 4.0_n * meter, 0.4_n * meter);
+
+    auto sum = a + b;
+    assert(nominal_value(sum) == 7.0_n * meter);
+    assert(near(uncertainty(sum).magnitude(), 0.5));
+
+    auto area = a * b;
+    static_assert(std::is_same<decltype(area)::unit, sqare_unit<u::meter>>::value, "");
+    assert(near(uncertainty(area).magnitude(), std::sqrt(2.0) * 0.1 * 12.0));
+
+    assert(covariance(a, b).magnitude() == 0.0);
+    assert(near(correlation(a, sum), 0.6));
+}
+
+void correlated_sources_test()
+{
+    using namespace physicalConstant;
+    auto k = make_tracked("Boltzmann_constant", Boltzmann_constant, uncertaintiy::Boltzmann_constant);
+
+    auto e1 = k * 300.0_n * kelvin;
+    auto e2 = k * 200.0_n * kelvin;
+
+    assert(uncertainty(e1 / e2).magnitude() < 1e-15);
+    assert((e1 - e1).magnitude().gradient().empty());
+    assert(near(uncertainty(e1 - e2).magnitude(), 100.0 * uncertaintiy::Boltzmann_constant.magnitude()));
+    assert(near(correlation(e1, e2), 1.0));
+}
+
+void math_test()
+{
+    auto a = make_tracked("area", 16.0_n * square(meter), 0.8_n * square(meter));
+
+    auto side = sqrt(a);
+    static_assert(std::is_same<decltype(side)::unit, u::meter>::value, "");
+    assert(nominal_value(side) == 4.0_n * meter);
+    assert(near(uncertainty(side).magnitude(), 0.1));
+
+    auto v = pow<std::ratio<3, 2>>(a);
+    assert(near(nominal_value(v).magnitude(), 64.0));
+    assert(near(uncertainty(v).magnitude(), 1.5 * 4.0 * 0.8));
+
+    assert(abs(-a) == a);
+    assert(uncertainty(abs(-a)) == uncertainty(a));
+
+    auto scaled = milli(a);
+    assert(near(uncertainty(scaled).magnitude(), 0.0008));
+}
+
+void print_test()
+{
+    std::ostringstream s;
+    s << make_tracked("l", 2.0_n * meter, 0.5_n * meter);
+    assert(s.str() == "(2+-0.5)m");
+}
+}
+
+TrackedTest::TrackedTest()
+{
+    independent_sources_test();
+    correlated_sources_test();
+    math_test();
+    print_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,9 @@
+HEADERS += \
+    $$PWD/TrackedTest.h \
+    $$PWD/DualTest.h \
+    $$PWD/IntervalTest.h
+
+SOURCES += \
+    $$PWD/TrackedTest.cpp \
+    $$PWD/DualTest.cpp \
+    $$PWD/IntervalTest.cpp
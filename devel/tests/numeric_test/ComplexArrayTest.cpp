@@ -0,0 +1,88 @@
+#include "ComplexArrayTest.h"
+
+#include <src/numeric/numericComplexArray.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+using TComplex = std::complex<double>;
+
+bool near(TComplex l, TComplex r) { return std::abs(l - r) <= 1e-12 * std::abs(r); }
+
+void impedance_test()
+{
+    // series rlc circuit over a frequency sweep
+    const auto r = 50.0_n * ohm;
+    const auto l = 10.0_n * milli(henry);
+    const auto c = 1.0_n * micro(farad);
+
+    const std::size_t n = 1000;
+    complex_array<u::ohm> z(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto omega = t::unitless{10.0 + 100.0 * static_cast<double>(i)} / second;
+        z.set(i, r, omega * l - 1.0_n / (omega * c));
+    }
+
+    const auto y = 1.0_n / z;
+    static_assert(std::is_same<decltype(y)::unit, u::siemens>::value, "");
+
+    const auto zz = z * z;
+    static_assert(std::is_same<decltype(zz)::unit, sqare_unit<u::ohm>>::value, "");
+
+    const auto one = z * y;
+    const auto zy = zz / z;
+    const auto magnitude = abs(z);
+    static_assert(std::is_same<decltype(magnitude)::value_type, t::ohm>::value, "");
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const TComplex zi = z[i].magnitude();
+        assert(near(y[i].magnitude(), 1.0 / zi));
+        assert(near(zz[i].magnitude(), zi * zi));
+        assert(near(one[i].magnitude(), 1.0));
+        assert(near(zy[i].magnitude(), zi));
+        assert(std::abs(magnitude[i].magnitude() - std::abs(zi)) <= 1e-12 * std::abs(zi));
+    }
+
+    const auto sum = z + z - z;
+    assert(near(sum[7].magnitude(), z[7].magnitude()));
+}
+
+void complex_math_test()
+{
+    using cohm = Quantity<u::ohm, TComplex>;
+    const cohm z{TComplex{3, 4}};
+
+    static_assert(std::is_same<decltype(abs(z)), t::ohm>::value, "");
+    static_assert(std::is_same<decltype(abs(1.5_n * ohm)), t::ohm>::value, "");
+
+    assert(abs(z) == 5.0_n * ohm);
+    assert((pow<std::ratio<2>>(z).magnitude() == TComplex(-7, 24)));
+    assert((pow<std::ratio<3>>(z).magnitude() == TComplex(-117, 44)));
+    assert((pow<std::ratio<-1>>(z).magnitude() == TComplex(1) / TComplex(3, 4)));
+    assert((pow<std::ratio<1, 2>>(pow<std::ratio<2>>(z)) == z));
+    assert((pow<std::ratio<0>>(z).magnitude() == TComplex(1)));
+    assert((near(pow<std::ratio<1, 3>>(cube(z)).magnitude(), TComplex(3, 4))));
+}
+}
+
+ComplexArrayTest::ComplexArrayTest()
+{
+    impedance_test();
+    complex_math_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
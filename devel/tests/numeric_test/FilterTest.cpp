@@ -0,0 +1,109 @@
+#include "FilterTest.h"
+
+#include <src/numeric/numericFilter.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+using Acceleration = Quantity<u::meter_per_second_squared>;
+
+bool near(double l, double r) { return std::abs(l - r) <= 1e-12 * (1 + std::abs(r)); }
+
+// channel c of frame f
+double signal(std::size_t f, std::size_t c) { return std::sin(0.1 * static_cast<double>(f) * static_cast<double>(c + 1)) + static_cast<double>(c); }
+
+std::vector<Acceleration> block(std::size_t frames, std::size_t channels)
+{
+    std::vector<Acceleration> b(frames * channels);
+    for (std::size_t f = 0; f < frames; ++f)
+        for (std::size_t c = 0; c < channels; ++c) b[f * channels + c] = Acceleration{signal(f, c)};
+    return b;
+}
+
+void fir_test()
+{
+    const std::size_t channels = 3, frames = 50;
+    fir_bank<u::meter_per_second_squared> smooth{channels, {0.25_n, 0.5_n, 0.25_n}};
+    static_assert(std::is_same<decltype(smooth)::output_type, Acceleration>::value, "");
+
+    std::vector<Acceleration> out;
+    smooth.process(block(frames, channels), out);
+    for (std::size_t f = 0; f < frames; ++f)
+        for (std::size_t c = 0; c < channels; ++c) {
+            const double expected = 0.25 * signal(f, c) + (f >= 1 ? 0.5 * signal(f - 1, c) : 0) + (f >= 2 ? 0.25 * signal(f - 2, c) : 0);
+            assert(near(out[f * channels + c].magnitude(), expected));
+        }
+
+    // the same stream in blocks of any size
+    const std::vector<Acceleration> in = block(frames, channels);
+    smooth.reset();
+    std::vector<Acceleration> split(in.size());
+    std::size_t done = 0;
+    for (std::size_t size : {1, 7, 2, 40}) {
+        smooth.process(in.data() + done * channels, size, split.data() + done * channels);
+        done += size;
+    }
+    for (std::size_t i = 0; i < in.size(); ++i) assert(split[i] == out[i]);
+}
+
+void derivative_test()
+{
+    const auto dt = 0.5_n * second;
+    fir_bank<u::meter, u::hertz> velocity{2, {1.0_n / dt, -1.0_n / dt}};
+    static_assert(std::is_same<decltype(velocity)::output_type, Quantity<quotient_unit<u::meter, u::second>>>::value, "");
+
+    std::vector<t::meter> positions{1.0_n * meter, 0.0_n * meter, 2.0_n * meter, -1.0_n * meter};
+    std::vector<Quantity<quotient_unit<u::meter, u::second>>> v;
+    velocity.process(positions, v);
+    assert(v[2] == 2.0_n * meter / second);
+    assert(v[3] == -2.0_n * meter / second);
+}
+
+// single pole lowpass y = 0.1 x + 0.9 y[n-1] as biquad, cascaded twice
+void iir_test()
+{
+    const std::size_t channels = 4, frames = 100;
+    const biquad<u::meter_per_second_squared> lowpass{0.1_n, 0.0_n, 0.0_n, -0.9_n, 0.0_n};
+    iir_bank<u::meter_per_second_squared> bank{channels, {lowpass, lowpass}};
+
+    std::vector<Acceleration> out;
+    bank.process(block(frames, channels), out);
+
+    for (std::size_t c = 0; c < channels; ++c) {
+        double y1 = 0, y2 = 0;
+        for (std::size_t f = 0; f < frames; ++f) {
+            y1 = 0.1 * signal(f, c) + 0.9 * y1;
+            y2 = 0.1 * y1 + 0.9 * y2;
+            assert(near(out[f * channels + c].magnitude(), y2));
+        }
+    }
+
+    // in place, continuing from the state
+    std::vector<Acceleration> more = block(frames, channels);
+    bank.reset();
+    bank.process(more.data(), frames, more.data());
+    for (std::size_t i = 0; i < more.size(); ++i) assert(more[i] == out[i]);
+}
+}
+
+FilterTest::FilterTest()
+{
+    fir_test();
+    derivative_test();
+    iir_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,88 @@
+#include "HistogramTest.h"
+
+#include <src/numeric/numericHistogram.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+void uniform_test()
+{
+    histogram<u::second> h{0.0_n * second, 1.0_n * second, 10};
+    assert(h.bins() == 10);
+    assert(h.lower_edge(3) == 0.3_n * second && h.upper_edge(9) == 1.0_n * second);
+
+    h.add(0.0_n * second);
+    h.add(0.05_n * second);
+    h.add(0.3_n * second); // edges belong to the upper bin
+    h.add(0.99_n * second, 3);
+    h.add(1.0_n * second);
+    h.add(-0.1_n * second);
+    h.add(t::second{std::numeric_limits<double>::quiet_NaN()});
+    assert(h.count(0) == 2 && h.count(3) == 1 && h.count(9) == 3);
+    assert(h.underflow() == 2 && h.overflow() == 1);
+    assert(h.total() == 9);
+
+    static_assert(std::is_same<decltype(h.quantile(0.5)), t::second>::value, "");
+
+    // every value next to an edge ends in the bin the edges say
+    histogram<u::meter> fine{-1.0_n * meter, 2.0_n * meter, 300};
+    for (std::size_t i = 0; i < fine.bins(); ++i) {
+        const double e = fine.lower_edge(i).magnitude();
+        fine.add(t::meter{e});
+        fine.add(t::meter{std::nextafter(e, -10.0)});
+    }
+    for (std::size_t i = 0; i + 1 < fine.bins(); ++i) assert(fine.count(i) == 2);
+    assert(fine.count(fine.bins() - 1) == 1 && fine.underflow() == 1);
+
+    h.clear();
+    assert(h.total() == 0);
+}
+
+void edges_test()
+{
+    histogram<u::kelvin> h{std::vector<t::kelvin>{1.0_n * kelvin, 2.0_n * kelvin, 10.0_n * kelvin, 100.0_n * kelvin}};
+    assert(h.bins() == 3);
+    h.add(1.0_n * kelvin);
+    h.add(5.0_n * kelvin);
+    h.add(9.99_n * kelvin);
+    h.add(10.0_n * kelvin);
+    h.add(100.0_n * kelvin);
+    assert(h.count(0) == 1 && h.count(1) == 2 && h.count(2) == 1 && h.overflow() == 1);
+}
+
+void quantile_test()
+{
+    histogram<u::second> a{0.0_n * second, 1.0_n * second, 100};
+    histogram<u::second> b{0.0_n * second, 1.0_n * second, 100};
+    for (int i = 0; i < 1000; ++i) {
+        a.add(t::second{(i + 0.5) / 2000.0});
+        b.add(t::second{0.5 + (i + 0.5) / 2000.0});
+    }
+    a.merge(b);
+    assert(a.total() == 2000);
+    for (double p : {0.01, 0.25, 0.5, 0.9, 0.99}) assert(std::abs(a.quantile(p).magnitude() - p) <= 0.01);
+    assert(a.quantile(0.0) == 0.0_n * second && a.quantile(1.0) == 1.0_n * second);
+}
+}
+
+HistogramTest::HistogramTest()
+{
+    uniform_test();
+    edges_test();
+    quantile_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,117 @@
+#include "IntegrationTest.h"
+
+#include <src/numeric/numericIntegration.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+bool near(double l, double r, double tolerance) { return std::abs(l - r) <= tolerance * std::abs(r); }
+
+// newton cooling dT/dt = -(T - 300K) / tau
+const auto tau = 60.0_n * second;
+const auto ambient = 300.0_n * kelvin;
+
+Quantity<quotient_unit<u::kelvin, u::second>> cooling(t::second, t::kelvin x) { return (ambient - x) / tau; }
+
+double cooled(double t) { return 300.0 + 100.0 * std::exp(-t / 60.0); }
+
+void single_test()
+{
+    const auto dt = 1.0_n * second;
+
+    t::kelvin euler = 400.0_n * kelvin;
+    t::kelvin rk4 = 400.0_n * kelvin;
+    t::second t = 0.0_n * second;
+    for (int i = 0; i < 120; ++i) {
+        euler = euler_step(euler, cooling(t, euler), dt);
+        rk4 = rk4_step(cooling, t, rk4, dt);
+        t += dt;
+    }
+    assert(near(euler.magnitude(), cooled(120), 1e-3));
+    assert(near(rk4.magnitude(), cooled(120), 1e-10));
+
+    static_assert(std::is_same<decltype(euler_step(euler, cooling(t, euler), dt)), t::kelvin>::value, "");
+}
+
+// harmonic oscillator x'' = -omega^2 x, verlet keeps the energy bounded
+void verlet_test()
+{
+    const auto omegaSquared = 4.0_n / square(second);
+    auto spring = [&](t::meter x) { return -omegaSquared * x; };
+
+    t::meter x = 1.0_n * meter;
+    Quantity<u::meter_per_second> v = 0.0_n * meter / second;
+    auto a = spring(x);
+    const auto dt = 1e-3_n * second;
+    for (int i = 0; i < 1000; ++i) verlet_step(x, v, a, dt, spring);
+
+    assert(near(x.magnitude(), std::cos(2.0), 1e-6));
+    assert(near(v.magnitude(), -2.0 * std::sin(2.0), 1e-6));
+}
+
+void batch_test()
+{
+    const std::size_t n = 100;
+    const auto dt = 1e-3_n * second;
+
+    std::vector<t::meter> x(n), xSingle(n);
+    std::vector<Quantity<u::meter_per_second>> v(n), vSingle(n);
+    std::vector<Quantity<u::meter_per_second_squared>> a(n), aSingle(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = xSingle[i] = t::meter{static_cast<double>(i)};
+        a[i] = aSingle[i] = -1.0_n / square(second) * x[i];
+    }
+    auto spring = [](std::vector<t::meter> const& positions, std::vector<Quantity<u::meter_per_second_squared>>& out) {
+        for (std::size_t i = 0; i < positions.size(); ++i) out[i] = -1.0_n / square(second) * positions[i];
+    };
+    auto springSingle = [](t::meter p) { return -1.0_n / square(second) * p; };
+    for (int s = 0; s < 100; ++s) {
+        verlet_step(x, v, a, dt, spring);
+        for (std::size_t i = 0; i < n; ++i) verlet_step(xSingle[i], vSingle[i], aSingle[i], dt, springSingle);
+    }
+    for (std::size_t i = 0; i < n; ++i) assert(x[i] == xSingle[i] && v[i] == vSingle[i]);
+
+    std::vector<t::kelvin> temperatures(n), single(n);
+    std::vector<Quantity<quotient_unit<u::kelvin, u::second>>> rates(n);
+    for (std::size_t i = 0; i < n; ++i) temperatures[i] = single[i] = t::kelvin{300.0 + static_cast<double>(i)};
+
+    rk4_integrator<u::kelvin, u::second> integrator{n};
+    auto coolingBatch = [](t::second t, std::vector<t::kelvin> const& in, std::vector<Quantity<quotient_unit<u::kelvin, u::second>>>& out) {
+        for (std::size_t i = 0; i < in.size(); ++i) out[i] = cooling(t, in[i]);
+    };
+    t::second t = 0.0_n * second;
+    for (int s = 0; s < 10; ++s) {
+        integrator.step(coolingBatch, t, temperatures, 1.0_n * second);
+        for (std::size_t i = 0; i < n; ++i) single[i] = rk4_step(cooling, t, single[i], 1.0_n * second);
+        t += 1.0_n * second;
+    }
+    for (std::size_t i = 0; i < n; ++i) assert(near(temperatures[i].magnitude(), single[i].magnitude(), 1e-14));
+
+    for (std::size_t i = 0; i < n; ++i) rates[i] = cooling(t, temperatures[i]);
+    euler_step(temperatures, rates, dt);
+    assert(near(temperatures[0].magnitude(), single[0].magnitude() + 1e-3 * rates[0].magnitude(), 1e-14));
+}
+}
+
+IntegrationTest::IntegrationTest()
+{
+    single_test();
+    verlet_test();
+    batch_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
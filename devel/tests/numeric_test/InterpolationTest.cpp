@@ -0,0 +1,131 @@
+#include "InterpolationTest.h"
+
+#include <src/numeric/numericInterpolation.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+bool near(double l, double r) { return std::abs(l - r) <= 1e-9 * std::max(1.0, std::abs(r)); }
+
+void table_1d_test()
+{
+    // uniform and non uniform axes, linear tables are reproduced exactly
+    for (auto const& points : {std::vector<double>{250, 275, 300, 325, 350}, std::vector<double>{250, 251, 260, 300, 350}}) {
+        std::vector<t::kelvin> temperatures;
+        std::vector<t::pascal> pressures;
+        for (double p : points) {
+            temperatures.push_back(t::kelvin{p});
+            pressures.push_back(t::pascal{1e3 + 40 * p});
+        }
+        table_1d<u::kelvin, u::pascal> table{temperatures, pressures};
+        for (double x = 250; x <= 350; x += 0.7) {
+            assert(near(table(t::kelvin{x}).magnitude(), 1e3 + 40 * x));
+            assert(near(table.derivative(t::kelvin{x}).magnitude(), 40));
+        }
+        for (double p : points) assert(table(t::kelvin{p}) == t::pascal{1e3 + 40 * p});
+
+        // clamped outside
+        assert(table(200.0_n * kelvin) == pressures.front());
+        assert(table(400.0_n * kelvin) == pressures.back());
+        assert(near(table.derivative(400.0_n * kelvin).magnitude(), 40));
+    }
+
+    table_1d<u::kelvin, u::pascal> table{{0.0_n * kelvin, 1.0_n * kelvin, 3.0_n * kelvin}, {0.0_n * pascal, 2.0_n * pascal, 0.0_n * pascal}};
+    assert(table(0.5_n * kelvin) == 1.0_n * pascal);
+    assert(table(2.0_n * kelvin) == 1.0_n * pascal);
+    assert(table.derivative(2.0_n * kelvin) == -1.0_n * pascal / kelvin);
+
+    static_assert(std::is_same<decltype(table(1.0_n * kelvin)), t::pascal>::value, "");
+    static_assert(std::is_same<decltype(table.derivative(1.0_n * kelvin))::unit, quotient_unit<u::pascal, u::kelvin>>::value, "");
+
+    std::vector<t::kelvin> queries{-1.0_n * kelvin, 0.25_n * kelvin, 1.5_n * kelvin, 5.0_n * kelvin};
+    std::vector<t::pascal> out;
+    table.evaluate(queries, out);
+    assert(out.size() == queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) assert(out[i] == table(queries[i]));
+}
+
+// v = 1 + 2x + 3y + 4xy is bilinear
+double bilinear(double x, double y) { return 1 + 2 * x + 3 * y + 4 * x * y; }
+
+void table_2d_test()
+{
+    std::vector<t::kelvin> x;
+    std::vector<t::pascal> y;
+    std::vector<t::joule> v;
+    for (double xi : {0.0, 1.0, 2.0, 4.0}) x.push_back(t::kelvin{xi});
+    for (double yi = 0; yi <= 5; ++yi) y.push_back(t::pascal{yi});
+    for (auto const& xi : x)
+        for (auto const& yi : y) v.push_back(t::joule{bilinear(xi.magnitude(), yi.magnitude())});
+
+    table_2d<u::kelvin, u::pascal, u::joule> table{x, y, v};
+    for (double xi = 0; xi <= 4; xi += 0.3)
+        for (double yi = 0; yi <= 5; yi += 0.45) {
+            assert(near(table(t::kelvin{xi}, t::pascal{yi}).magnitude(), bilinear(xi, yi)));
+            assert(near(table.derivative_x(t::kelvin{xi}, t::pascal{yi}).magnitude(), 2 + 4 * yi));
+            assert(near(table.derivative_y(t::kelvin{xi}, t::pascal{yi}).magnitude(), 3 + 4 * xi));
+        }
+
+    static_assert(std::is_same<decltype(table.derivative_x(x[0], y[0]))::unit, quotient_unit<u::joule, u::kelvin>>::value, "");
+    static_assert(std::is_same<decltype(table.derivative_y(x[0], y[0]))::unit, quotient_unit<u::joule, u::pascal>>::value, "");
+
+    std::vector<t::joule> out;
+    table.evaluate(x, std::vector<t::pascal>(x.size(), 2.5_n * pascal), out);
+    for (std::size_t i = 0; i < x.size(); ++i) assert(out[i] == table(x[i], 2.5_n * pascal));
+}
+
+double trilinear(double x, double y, double z) { return 1 + x - 2 * y + 3 * z + x * y - y * z + 0.5 * x * z + 0.25 * x * y * z; }
+
+void table_3d_test()
+{
+    std::vector<t::meter> x;
+    std::vector<t::second> y;
+    std::vector<t::kelvin> z;
+    std::vector<t::watt> v;
+    for (double i = 0; i < 4; ++i) x.push_back(t::meter{i * 0.5});
+    for (double i : {0.0, 0.1, 1.0}) y.push_back(t::second{i});
+    for (double i = 0; i < 5; ++i) z.push_back(t::kelvin{i});
+    for (auto const& xi : x)
+        for (auto const& yi : y)
+            for (auto const& zi : z) v.push_back(t::watt{trilinear(xi.magnitude(), yi.magnitude(), zi.magnitude())});
+
+    table_3d<u::meter, u::second, u::kelvin, u::watt> table{x, y, z, v};
+    for (double xi = 0; xi <= 1.5; xi += 0.2)
+        for (double yi = 0; yi <= 1; yi += 0.15)
+            for (double zi = 0; zi <= 4; zi += 0.55) {
+                const t::meter qx{xi};
+                const t::second qy{yi};
+                const t::kelvin qz{zi};
+                assert(near(table(qx, qy, qz).magnitude(), trilinear(xi, yi, zi)));
+                assert(near(table.derivative_x(qx, qy, qz).magnitude(), 1 + yi + 0.5 * zi + 0.25 * yi * zi));
+                assert(near(table.derivative_y(qx, qy, qz).magnitude(), -2 + xi - zi + 0.25 * xi * zi));
+                assert(near(table.derivative_z(qx, qy, qz).magnitude(), 3 - yi + 0.5 * xi + 0.25 * xi * yi));
+            }
+
+    static_assert(std::is_same<decltype(table(x[0], y[0], z[0])), t::watt>::value, "");
+    static_assert(std::is_same<decltype(table.derivative_z(x[0], y[0], z[0]))::unit, quotient_unit<u::watt, u::kelvin>>::value, "");
+}
+}
+
+InterpolationTest::InterpolationTest()
+{
+    table_1d_test();
+    table_2d_test();
+    table_3d_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
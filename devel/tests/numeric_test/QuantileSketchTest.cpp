@@ -0,0 +1,110 @@
+#include "QuantileSketchTest.h"
+
+#include <src/numeric/numericQuantileSketch.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+// deterministic values in [0, 1)
+struct Values {
+    std::uint64_t state = 88172645463325252ull;
+    double operator()()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<double>(state >> 11) / 9007199254740992.0;
+    }
+};
+
+void small_test()
+{
+    quantile_sketch<u::joule> s;
+    for (int i = 1; i <= 100; ++i) s.add(t::joule{static_cast<double>(i)});
+    // nothing compacted yet, the quantiles are exact
+    assert(s.count() == 100 && s.retained() == 100);
+    assert(s.quantile(0.5) == 50.0_n * joule);
+    assert(s.quantile(0.0) == 1.0_n * joule && s.quantile(1.0) == 100.0_n * joule);
+    assert(s.rank(25.0_n * joule) == 0.25);
+
+    static_assert(std::is_same<decltype(s.quantile(0.5)), t::joule>::value, "");
+}
+
+// ranks against the sorted stream, and the memory stays bounded
+void stream_test()
+{
+    const std::size_t n = 1000000;
+    quantile_sketch<u::second> s;
+    std::vector<double> all;
+    all.reserve(n);
+    Values v;
+    std::size_t maxRetained = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = v() * v(); // skewed
+        all.push_back(x);
+        s.add(t::second{x});
+        maxRetained = std::max(maxRetained, s.retained());
+    }
+    std::sort(all.begin(), all.end());
+    assert(s.count() == n);
+    assert(maxRetained < 1000);
+    assert(s.min().magnitude() == all.front() && s.max().magnitude() == all.back());
+
+    for (double p : {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999}) {
+        const double q = s.quantile(p).magnitude();
+        const double r = static_cast<double>(std::upper_bound(all.begin(), all.end(), q) - all.begin()) / n;
+        assert(std::abs(r - p) < 0.01);
+        assert(std::abs(s.rank(t::second{all[static_cast<std::size_t>(p * n)]}) - p) < 0.01);
+    }
+}
+
+// four sketches filled separately, eg by four threads
+void merge_test()
+{
+    const std::size_t n = 200000;
+    std::vector<quantile_sketch<u::meter>> parts(4);
+    std::vector<double> all;
+    Values v;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = 10 * v() + static_cast<double>(i % 4);
+        all.push_back(x);
+        parts[i % 4].add(t::meter{x});
+    }
+    quantile_sketch<u::meter> merged;
+    for (auto const& p : parts) merged.merge(p);
+    std::sort(all.begin(), all.end());
+    assert(merged.count() == n);
+    assert(merged.retained() < 1000);
+    assert(merged.min().magnitude() == all.front() && merged.max().magnitude() == all.back());
+
+    for (double p : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        const double q = merged.quantile(p).magnitude();
+        const double r = static_cast<double>(std::upper_bound(all.begin(), all.end(), q) - all.begin()) / n;
+        assert(std::abs(r - p) < 0.01);
+    }
+}
+}
+
+QuantileSketchTest::QuantileSketchTest()
+{
+    small_test();
+    stream_test();
+    merge_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
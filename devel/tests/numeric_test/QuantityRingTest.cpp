@@ -0,0 +1,90 @@
+#include "QuantityRingTest.h"
+
+#include <src/numeric/numericQuantityRing.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+bool near(double l, double r) { return std::abs(l - r) <= 1e-9 * std::max(1.0, std::abs(r)); }
+
+void window_test()
+{
+    quantity_ring<u::kelvin, double, 3> r;
+    assert(r.empty() && r.size() == 0 && r.capacity() == 3);
+    assert(r.mean() == 0.0_n * kelvin && r.variance() == Quantity<sqare_unit<u::kelvin>>{0});
+
+    r.push(1.0_n * kelvin);
+    r.push(3.0_n * kelvin);
+    assert(r.size() == 2 && !r.full());
+    assert(r.sum() == 4.0_n * kelvin);
+    assert(r.mean() == 2.0_n * kelvin);
+    assert(r.variance() == 1.0_n * square(kelvin));
+    assert(r.min() == 1.0_n * kelvin && r.max() == 3.0_n * kelvin);
+
+    r.push(2.0_n * kelvin);
+    r.push(8.0_n * kelvin); // 1 leaves
+    assert(r.full() && r.size() == 3);
+    assert(r.front() == 3.0_n * kelvin && r[1] == 2.0_n * kelvin && r.back() == 8.0_n * kelvin);
+    assert(r.sum() == 13.0_n * kelvin);
+    assert(r.min() == 2.0_n * kelvin && r.max() == 8.0_n * kelvin);
+    assert(near(r.rms().magnitude(), std::sqrt((9.0 + 4.0 + 64.0) / 3.0)));
+
+    static_assert(std::is_same<decltype(r.variance())::unit, sqare_unit<u::kelvin>>::value, "");
+    static_assert(std::is_same<decltype(r.rms()), t::kelvin>::value, "");
+
+    r.clear();
+    assert(r.empty() && r.sum() == 0.0_n * kelvin);
+    r.push(-5.0_n * kelvin);
+    assert(r.min() == -5.0_n * kelvin && r.max() == -5.0_n * kelvin);
+}
+
+// against a recomputation of every window
+void sliding_test()
+{
+    quantity_ring<u::watt, double, 16> r;
+    std::deque<double> window;
+    double x = 0.3;
+    for (int i = 0; i < 1000; ++i) {
+        x = 3.99 * x * (1 - x);
+        const double p = 1e3 + 100 * x;
+        r.push(t::watt{p});
+        window.push_back(p);
+        if (window.size() > 16) window.pop_front();
+
+        double sum = 0;
+        for (double v : window) sum += v;
+        const double mean = sum / window.size();
+        double m2 = 0;
+        for (double v : window) m2 += (v - mean) * (v - mean);
+
+        assert(near(r.sum().magnitude(), sum));
+        assert(near(r.mean().magnitude(), mean));
+        assert(std::abs(r.variance().magnitude() - m2 / window.size()) <= 1e-6);
+        assert(r.min().magnitude() == *std::min_element(window.begin(), window.end()));
+        assert(r.max().magnitude() == *std::max_element(window.begin(), window.end()));
+    }
+}
+}
+
+QuantityRingTest::QuantityRingTest()
+{
+    window_test();
+    sliding_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,124 @@
+#include "SolversTest.h"
+
+#include <src/numeric/numericSolvers.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+using Conductance = Quantity<quotient_unit<u::watt, sqare_unit<u::kelvin>>>;
+
+// a body at T loses c * T^2 and gains 1 kW, balanced at T = sqrt(1000 / c)
+const Conductance c{0.01};
+t::watt netPower(t::kelvin T) { return c * T * T - 1000.0_n * watt; }
+
+bool near(double l, double r, double tolerance) { return std::abs(l - r) <= tolerance; }
+
+void root_test()
+{
+    const double exact = std::sqrt(1000 / 0.01);
+    const t::kelvin tolerance = 1e-9_n * kelvin;
+    t::kelvin T;
+
+    assert(bisect_root(netPower, 100.0_n * kelvin, 1000.0_n * kelvin, tolerance, T));
+    assert(near(T.magnitude(), exact, 1e-9));
+
+    T = 0.0_n * kelvin;
+    assert(brent_root(netPower, 100.0_n * kelvin, 1000.0_n * kelvin, tolerance, T));
+    assert(near(T.magnitude(), exact, 1e-9));
+
+    T = 1000.0_n * kelvin;
+    assert(newton_root(netPower, [](t::kelvin x) { return 2.0_n * c * x; }, T, tolerance));
+    assert(near(T.magnitude(), exact, 1e-9));
+
+    // no sign change
+    assert(!bisect_root(netPower, 400.0_n * kelvin, 1000.0_n * kelvin, tolerance, T));
+    assert(!brent_root(netPower, 400.0_n * kelvin, 1000.0_n * kelvin, tolerance, T));
+    // flat start
+    T = 0.0_n * kelvin;
+    assert(!newton_root(netPower, [](t::kelvin x) { return 2.0_n * c * x; }, T, tolerance));
+
+    // roots on the bracket and a steep function
+    assert(brent_root(netPower, 100.0_n * kelvin, t::kelvin{exact}, tolerance, T) && T.magnitude() == exact);
+    t::meter r;
+    assert(brent_root([](t::meter x) { return x * x * x * x * x; }, -1.0_n * meter, 2.0_n * meter, 1e-12_n * meter, r));
+    assert(near(r.magnitude(), 0, 1e-11));
+
+    // exact roots on either end and in the middle are kept
+    const auto identity = [](t::meter x) { return x; };
+    assert(bisect_root(identity, 0.0_n * meter, 1.0_n * meter, 1e-12_n * meter, r) && r.magnitude() == 0.0);
+    assert(bisect_root(identity, -1.0_n * meter, 0.0_n * meter, 1e-12_n * meter, r) && r.magnitude() == 0.0);
+    assert(bisect_root(identity, -1.0_n * meter, 1.0_n * meter, 1e-12_n * meter, r) && r.magnitude() == 0.0);
+    assert(brent_root(identity, 0.0_n * meter, 1.0_n * meter, 1e-12_n * meter, r) && r.magnitude() == 0.0);
+}
+
+void minimize_test()
+{
+    t::meter x;
+    assert(brent_minimize([](t::meter p) { return (p - 2.0_n * meter) * (p - 2.0_n * meter) + 1.0_n * square(meter); }, -10.0_n * meter,
+                    10.0_n * meter, 1e-8_n * meter, x));
+    assert(near(x.magnitude(), 2, 1e-7));
+
+    // minimum at the boundary
+    t::second edge;
+    assert(brent_minimize([](t::second s) { return s * 3.0_n * meter / second; }, 1.0_n * second, 5.0_n * second, 1e-8_n * second, edge));
+    assert(near(edge.magnitude(), 1, 1e-7));
+
+    t::second t;
+    assert(brent_minimize([](t::second s) { return t::meter{std::cos(s.magnitude())}; }, 2.0_n * second, 4.0_n * second, 1e-8_n * second, t));
+    assert(near(t.magnitude(), std::acos(-1.0), 1e-7));
+}
+
+void batch_test()
+{
+    const std::size_t n = 1000;
+    std::vector<t::watt> heating(n);
+    for (std::size_t i = 0; i < n; ++i) heating[i] = t::watt{10.0 + static_cast<double>(i)};
+    const auto f = [&](std::size_t i, t::kelvin T) { return c * T * T - heating[i]; };
+
+    std::vector<t::kelvin> roots;
+    assert(bisect_root(f, std::vector<t::kelvin>(n, 1.0_n * kelvin), std::vector<t::kelvin>(n, 1000.0_n * kelvin), 1e-9_n * kelvin, roots));
+    for (std::size_t i = 0; i < n; ++i) assert(near(roots[i].magnitude(), std::sqrt(heating[i].magnitude() / 0.01), 1e-9));
+
+    std::vector<t::kelvin> guesses(n, 1000.0_n * kelvin);
+    assert(newton_root(f, [](std::size_t, t::kelvin T) { return 2.0_n * c * T; }, guesses, 1e-10_n * kelvin));
+    for (std::size_t i = 0; i < n; ++i) assert(near(guesses[i].magnitude(), std::sqrt(heating[i].magnitude() / 0.01), 1e-9));
+
+    std::vector<t::kelvin> upper(n, 1000.0_n * kelvin);
+    upper[7] = 2.0_n * kelvin;
+    assert(!bisect_root(f, std::vector<t::kelvin>(n, 1.0_n * kelvin), upper, 1e-9_n * kelvin, roots));
+    assert(near(roots[8].magnitude(), std::sqrt(heating[8].magnitude() / 0.01), 1e-9));
+
+    // exact roots on the bracket or hit in between freeze their problem
+    const auto g = [](std::size_t i, t::meter x) { return x - t::meter{static_cast<double>(i)}; };
+    const std::vector<t::meter> lower{0.0_n * meter, -1.0_n * meter, 0.0_n * meter, -3.0_n * meter};
+    const std::vector<t::meter> higher{1.0_n * meter, 1.0_n * meter, 2.0_n * meter, 5.0_n * meter};
+    std::vector<t::meter> exact;
+    assert(bisect_root(g, lower, higher, 1e-12_n * meter, exact));
+    assert(exact[0].magnitude() == 0.0);
+    assert(exact[1].magnitude() == 1.0);
+    assert(exact[2].magnitude() == 2.0);
+    assert(exact[3].magnitude() == 3.0);
+}
+}
+
+SolversTest::SolversTest()
+{
+    root_test();
+    minimize_test();
+    batch_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
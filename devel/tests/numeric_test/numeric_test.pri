@@ -0,0 +1,19 @@
+HEADERS += \
+    $$PWD/ComplexArrayTest.h \
+    $$PWD/QuantityRingTest.h \
+    $$PWD/IntegrationTest.h \
+    $$PWD/FilterTest.h \
+    $$PWD/HistogramTest.h \
+    $$PWD/QuantileSketchTest.h \
+    $$PWD/InterpolationTest.h \
+    $$PWD/SolversTest.h
+
+SOURCES += \
+    $$PWD/ComplexArrayTest.cpp \
+    $$PWD/QuantityRingTest.cpp \
+    $$PWD/IntegrationTest.cpp \
+    $$PWD/FilterTest.cpp \
+    $$PWD/HistogramTest.cpp \
+    $$PWD/QuantileSketchTest.cpp \
+    $$PWD/InterpolationTest.cpp \
+    $$PWD/SolversTest.cpp
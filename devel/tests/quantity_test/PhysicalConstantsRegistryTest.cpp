@@ -0,0 +1,73 @@
+#include "PhysicalConstantsRegistryTest.h"
+
+#include <tools/pysConstsantsGeneration/generated/physicalConstants.h>
+#include <tools/pysConstsantsGeneration/generated/physicalConstantsRegistry.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace tests {
+
+using namespace unit;
+
+PhysicalConstantsRegistryTest::PhysicalConstantsRegistryTest()
+{
+    namespace registry = physicalConstant::registry;
+
+    {
+        // sorted, and every name is found at its own entry
+        assert(registry::size() > 300);
+        assert(registry::end() - registry::begin() == static_cast<std::ptrdiff_t>(registry::size()));
+        for (auto e = registry::begin(); e != registry::end(); ++e) {
+            if (e != registry::begin()) assert(std::strcmp((e - 1)->name, e->name) < 0);
+            assert(registry::find(e->name) == e);
+        }
+    }
+    {
+        // the same as the typed constants
+        registry::entry const* c = registry::find("speed_of_light_in_vacuum");
+        assert(c != nullptr);
+        assert(c->magnitude == physicalConstant::speed_of_light_in_vacuum.magnitude());
+        assert(c->uncertainty == 0.0);
+        assert(c->exponents == registry::pack<decltype(physicalConstant::speed_of_light_in_vacuum)::unit>());
+        assert(c->exponent(0) == 1 && c->exponent(1) == 0 && c->exponent(2) == -1);
+
+        registry::entry const* g = registry::find(std::string{"Newtonian_constant_of_gravitation"});
+        assert(g != nullptr);
+        assert(g->magnitude == physicalConstant::Newtonian_constant_of_gravitation.magnitude());
+        assert(g->uncertainty == physicalConstant::uncertaintiy::Newtonian_constant_of_gravitation.magnitude());
+        assert(g->exponent(0) == 3 && g->exponent(1) == -1 && g->exponent(2) == -2);
+    }
+    {
+        // unknown names, prefixes and extensions of known ones
+        assert(registry::find("") == nullptr);
+        assert(registry::find("speed_of_light") == nullptr);
+        assert(registry::find("speed_of_light_in_vacuumm") == nullptr);
+        assert(registry::find("Speed_of_light_in_vacuum") == nullptr);
+        assert(registry::find("speed_of_light_in_vacuum", 14) == nullptr);
+    }
+    {
+        // typed access checks the unit
+        Quantity<Unit<1, 0, -1, 0, 0, 0, 0>> c{-1};
+        assert(registry::get("speed_of_light_in_vacuum", c));
+        assert(c == physicalConstant::speed_of_light_in_vacuum);
+
+        Quantity<Unit<1, 0, -1>> shortUnit{-1};
+        assert(registry::get("speed_of_light_in_vacuum", shortUnit));
+        assert(shortUnit.magnitude() == c.magnitude());
+
+        Quantity<Unit<1, 0, -2, 0, 0, 0, 0>> wrongUnit{-1};
+        assert(registry::get("speed_of_light_in_vacuum", wrongUnit) == false);
+        assert(wrongUnit.magnitude() == -1);
+        assert(registry::get("speed_of_sound", c) == false);
+
+        Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>, float> p{-1};
+        assert(registry::get("standard_atmosphere", p));
+        assert(p.magnitude() == 101325.0f);
+    }
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,112 @@
+#include "QuantityConversionTest.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <tools/pysConstsantsGeneration/ExactNumber.h>
+#include <tools/unitCatalogGeneration/generated/unitConversionTable.h>
+#include <tools/unitCatalogGeneration/generated/unitConversions.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <ratio>
+#include <string>
+#include <type_traits>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename T>
+constexpr bool near(T const& l, T const& r) { return abs(l - r).magnitude() <= 1e-15 * abs(r).magnitude(); }
+
+// exact factors
+static_assert(std::is_same<conversion::exact::foot::type, std::ratio<381, 1250>>::value, "");
+static_assert(std::is_same<conversion::exact::gallon::type, std::ratio<473176473, 125000000000>>::value, "");
+static_assert(std::is_same<conversion::exact::torr::type, std::ratio<20265, 152>>::value, "");
+static_assert(conversion::exact::electronvolt::decimal_exponent() != 0, "");
+
+// dimensions of derived catalog units
+static_assert(std::is_same<decltype(conversion::pound_force), const t::newton>::value, "");
+static_assert(std::is_same<decltype(conversion::slug), const t::kilogram>::value, "");
+static_assert(std::is_same<decltype(conversion::horsepower), const t::watt>::value, "");
+static_assert(std::is_same<decltype(conversion::kilometer_per_hour)::unit, u::meter_per_second>::value, "");
+
+// catalog against the hand written constants of quantityDefinitionsSI.h
+static_assert(conversion::inch == inch, "");
+static_assert(conversion::mile == mile, "");
+static_assert(conversion::yard == yard, "");
+static_assert(conversion::pound == pound, "");
+static_assert(conversion::hour == hour, "");
+static_assert(conversion::bar == bar, "");
+static_assert(near(conversion::calorie, calorie), "");
+static_assert(near(conversion::liter, liter), "");
+
+static_assert(near(conversion::kilowatt_hour, 3.6e6_n * joule), "");
+static_assert(near(conversion::pound_force, 4.4482216152605_n * newton), "");
+static_assert(near(conversion::electronvolt, 1.602176634e-19_n * joule), "");
+static_assert(near(conversion::standard_gravity * conversion::pound, conversion::pound_force), "");
+
+// factors are the nearest doubles, num * 10^exp10 / den in doubles is an ulp off for these
+static_assert(conversion::electronvolt.magnitude() == 1.602176634e-19, "");
+static_assert(conversion::gigaelectronvolt.magnitude() == 1.602176634e-10, "");
+static_assert(conversion::barn.magnitude() == 1e-28, "");
+
+void lookup_test()
+{
+    using conversion::find;
+
+    // every key lands on its own slot
+    for (auto const& e : conversion::table::Table<>::entries) assert(find(e.name) == &e);
+
+    assert(find("ft")->factor == 0.3048);
+    assert(find("foot") != find("ft"));
+    assert(find("foot")->factor == find("ft")->factor);
+    assert(find("km")->factor == 1000.0);
+    assert(find("kilogram")->factor == 1.0);
+    assert(find("m")->exponents[0] == 1);
+
+    // every factor is the exact num / den * 10^exp10 rounded once
+    for (auto const& e : conversion::table::Table<>::entries) {
+        const ExactNumber exact = ExactNumber::parse(std::to_string(e.num)) * ExactNumber::parse(std::to_string(e.den)).inverse() * ExactNumber::pow10(e.exp10);
+        assert(e.factor == exact.toDouble());
+    }
+    assert(find("eV")->factor == 1.602176634e-19);
+    assert(find("b")->factor == 1e-28);
+
+    assert(find("") == nullptr);
+    assert(find("fo") == nullptr);
+    assert(find("foot ") == nullptr);
+    assert(find("parsecs") == nullptr);
+    assert(find(std::string("ftUS", 2)) == find("ft"));
+
+    t::meter length{0};
+    assert(conversion::to_quantity(3.0, "mi", length));
+    assert(length == 3.0_n * mile);
+    assert(conversion::to_quantity(2.0, "nmi", length));
+    assert(length == 3704.0_n * meter);
+
+    t::pascal pressure{1};
+    assert(conversion::to_quantity(1.0, "atm", pressure));
+    assert(pressure == 101325.0_n * pascal);
+    assert(conversion::to_quantity(1.0, "psi", pressure));
+    assert(near(pressure, 6894.757293168361_n * pascal));
+
+    // unknown units and wrong dimensions leave the target untouched
+    assert(!conversion::to_quantity(1.0, "kg", pressure));
+    assert(!conversion::to_quantity(1.0, "furlongs", pressure));
+    assert(near(pressure, 6894.757293168361_n * pascal));
+}
+}
+
+QuantityConversionTest::QuantityConversionTest()
+{
+    lookup_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
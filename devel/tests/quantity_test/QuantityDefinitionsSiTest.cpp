@@ -15,6 +15,22 @@ using namespace literals;
 template<typename T, typename R = std::ratio<1,100000>>
 constexpr bool near(T const& l, T const& r){ return abs(l-r).magnitude()<(double(R::num)/double(R::den)); }
 
+//the joule is a newton times a meter, every unit derived from it depends on that
+static_assert(std::is_same<u::joule,   Unit< 2, 1,-2, 0,0,0,0>>::value, "");
+static_assert(std::is_same<u::watt,    Unit< 2, 1,-3, 0,0,0,0>>::value, "");
+static_assert(std::is_same<u::volt,    Unit< 2, 1,-3,-1,0,0,0>>::value, "");
+static_assert(std::is_same<u::ohm,     Unit< 2, 1,-3,-2,0,0,0>>::value, "");
+static_assert(std::is_same<u::siemens, Unit<-2,-1, 3, 2,0,0,0>>::value, "");
+static_assert(std::is_same<u::farad,   Unit<-2,-1, 4, 2,0,0,0>>::value, "");
+static_assert(std::is_same<u::weber,   Unit< 2, 1,-2,-1,0,0,0>>::value, "");
+static_assert(std::is_same<u::tesla,   Unit< 0, 1,-2,-1,0,0,0>>::value, "");
+static_assert(std::is_same<u::henry,   Unit< 2, 1,-2,-2,0,0,0>>::value, "");
+static_assert(std::is_same<u::gray,    Unit< 2, 0,-2, 0,0,0,0>>::value, "");
+static_assert(2.0_n * newton * 3.0_n * meter == 6.0_n * joule, "");
+static_assert(6.0_n * joule / (2.0_n * second) == 3.0_n * watt, "");
+static_assert(2.0_n * volt * 3.0_n * ampere == 6.0_n * watt, "");
+static_assert(6.0_n * volt / (2.0_n * ampere) == 3.0_n * ohm, "");
+
 //celsius
 static_assert(273.15_n * kelvin == celsius(0.0), "");
 static_assert(0.0_n * kelvin == celsius(-273.15), "");
@@ -0,0 +1,60 @@
+#include "QuantityInstantiationsSiTest.h"
+
+#include <src/quantity/quantityInstantiationsSI.h>
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+namespace tests {
+
+using namespace unit;
+using namespace unit::literals;
+
+namespace {
+
+template <typename Q>
+void roundTrip(Q q, char const* printed) {
+    std::ostringstream s;
+    s << round_trip << q;
+    assert(s.str() == printed);
+
+    std::istringstream r{s.str()};
+    Q read{0};
+    r >> read;
+    assert(r && read == q);
+}
+}
+
+QuantityInstantiationsSiTest::QuantityInstantiationsSiTest()
+{
+    // the extern templates link to the instantiations of quantityInstantiationsSI.cpp
+    roundTrip(-4.5_n * newton, "-4.5N");
+    roundTrip(0.1_n * joule, "0.1J");
+    roundTrip(3.0_n * meter, "3m");
+    roundTrip(2.0_n * kilogram, "2kg");
+    roundTrip(7.0_n * ohm, "7Ohm");
+    roundTrip(1.5_n * gray, "1.5Gy");
+    roundTrip(t::meter_cubed{0.25}, "0.25m^3");
+
+    {
+        std::istringstream s{"4.5Hz"};
+        t::newton n{1};
+        s >> n;
+        assert(!s && n == 1.0_n * newton);
+    }
+    {
+        std::istringstream s{"2kg*m/s^2"};
+        t::newton n{1};
+        s >> n;
+        assert(s && n == 2.0_n * newton);
+    }
+    {
+        std::ostringstream s;
+        print_unit<u::meter_per_second>(s);
+        assert(s.str() == "ms^-1");
+    }
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,257 @@
+#include "QuantityParsingTest.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/quantity/quantityParsing.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityReading.h>
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+template <typename T>
+bool near(T const& l, T const& r) { return abs(l - r).magnitude() <= 1e-15 * abs(r).magnitude(); }
+
+template <typename Q>
+Q parsed(std::string const& expression)
+{
+    Q q{-1};
+    const bool valid = parse_as(expression, q);
+    assert(valid);
+    return q;
+}
+
+template <typename Q>
+bool fails(std::string const& expression)
+{
+    Q q{-1};
+    return !parse_as(expression, q) && q == Q{-1};
+}
+
+void grammar_test()
+{
+    assert(parsed<t::joule>("J") == joule);
+    assert(parsed<t::joule>("N*m") == joule);
+    assert(parsed<t::joule>("N.m") == joule);
+    assert(parsed<t::joule>("N m") == joule);
+    assert(parsed<t::joule>("N\xc2\xb7m") == joule);
+    assert(parsed<t::joule>("kg*m^2/s^2") == joule);
+    assert(parsed<t::joule>("kg*m**2*s^-2") == joule);
+    assert(parsed<t::joule>(" kg * m^2 / ( s^2 ) ") == joule);
+    assert(parsed<t::joule>("kg m^(2) s^(-2)") == joule);
+    assert(parsed<t::joule>("W/Hz") == joule);
+
+    assert(parsed<t::volt>("kg*m^2/(s^3*A)") == volt);
+    assert(parsed<t::hertz>("1/s") == hertz);
+    assert(parsed<t::meter_cubed>("(m)^3") == cube(meter));
+    assert(parsed<t::unitless>("m/m") == unitless);
+
+    // left associative: m/s/s is an acceleration
+    assert((parsed<Quantity<u::meter_per_second_squared>>("m/s/s") == meter / square(second)));
+
+    assert(fails<t::joule>(""));
+    assert(fails<t::joule>("N*"));
+    assert(fails<t::joule>("N*m)"));
+    assert(fails<t::joule>("(N*m"));
+    assert(fails<t::joule>("N^"));
+    assert(fails<t::joule>("N^x"));
+    assert(fails<t::joule>("Nm"));
+    assert(fails<t::joule>("foo"));
+}
+
+void prefix_test()
+{
+    assert(parsed<t::meter>("km") == kilo(meter));
+    assert(parsed<t::meter>("dam") == deca(meter));
+    assert(parsed<t::meter>("dm") == deci(meter));
+    assert(parsed<t::second>("d") == day);
+    assert(parsed<t::second>("min") == minute);
+    assert(parsed<t::meter_cubed>("mL") == milli(liter));
+    assert(parsed<t::meter>("um") == micro(meter));
+    assert(parsed<t::meter>("\xc2\xb5m") == micro(meter));
+    assert(parsed<t::kilogram>("mg") == micro(kilogram));
+    assert(parsed<t::kilogram>("g") == gram);
+    assert(parsed<t::pascal>("MPa") == mega(pascal));
+    assert(parsed<t::ohm>("kOhm") == kilo(ohm));
+    assert(parsed<t::ohm>("k\xce\xa9") == kilo(ohm));
+    assert(near(parsed<t::joule>("kW*h"), 3.6e6_n * joule));
+    assert(near(parsed<t::meter_cubed>("cm^3"), 1e-6_n * cube(meter)));
+    assert(near(parsed<t::meter_cubed>("1e-3 m^3"), liter));
+
+    // symbols take precedence over prefixed symbols
+    assert(parsed<t::tesla>("T") == tesla);
+    assert(parsed<t::candela>("cd") == candela);
+    assert(parsed<t::mole>("mol") == mole);
+
+    assert(fails<t::meter>("xm"));
+    assert(fails<t::meter>("kkm"));
+}
+
+void dimension_test()
+{
+    assert(fails<t::joule>("N"));
+    assert(fails<t::joule>("kg*m^2/s^3"));
+    assert(fails<t::volt>("W/A^2"));
+
+    PackedUnit<7> p;
+    assert(parse_unit(std::string("kg*m^2/(s^2*A)"), p));
+    assert((p.exponents == std::array<TExponent, 7>{{2, 1, -2, -1, 0, 0, 0}}));
+    assert(p.scale == 1.0);
+
+    assert(!parse_unit(std::string("kg*"), p));
+}
+
+template <typename Q>
+bool reads(std::string const& text, Q const& expected)
+{
+    std::istringstream s{text};
+    Q q{-1};
+    s >> q;
+    return s && q == expected;
+}
+
+template <typename Q>
+bool reads_back(Q const& q)
+{
+    std::ostringstream s;
+    s << q;
+    PackedUnit<7> p;
+    const std::string printed = s.str().substr(s.str().find_first_not_of("-.0123456789"));
+    return reads(s.str(), q) && parse_printed_unit(printed.data(), printed.data() + printed.size(), p);
+}
+
+// the symbol of U in the table is its print_unit output
+template <typename U>
+bool finds_printed()
+{
+    std::string const& printed = helper::print::printed<U>();
+    ConversionEntry<7> const* e = symbol_table<7>().find(printed.data(), printed.size());
+    return e != nullptr && e->factor == 1.0 && helper::conversion::Exponents<U>::equal(e->exponents);
+}
+
+void symbol_table_test()
+{
+    assert(finds_printed<u::meter>() && finds_printed<u::kilogram>() && finds_printed<u::mole>());
+    assert(finds_printed<u::newton>() && finds_printed<u::ohm>() && finds_printed<u::lux>() && finds_printed<u::katal>());
+    assert(symbol_table<7>().find("\xce\xa9", 2) != nullptr && helper::conversion::Exponents<u::ohm>::equal(symbol_table<7>().find("\xce\xa9", 2)->exponents));
+    assert(symbol_table<7>().find("h", 1)->factor == 3600.0);
+    assert(symbol_table<7>().find("Nm", 2) == nullptr && symbol_table<7>().find("", 0) == nullptr);
+    assert(symbol_table<7>().max_length() == 3);
+}
+
+void reading_test()
+{
+    assert(reads("2N", 2.0_n * newton));
+    assert(reads("2 mkgs^-2", 2.0_n * newton));
+    assert(reads("2kgm/s^2", 2.0_n * newton));
+    assert(reads("2Nm", 2.0_n * joule));
+    assert(reads("2m^2kgs^-2", 2.0_n * joule));
+    assert(reads("2Ws", 2.0_n * joule));
+    assert(reads("2VA", 2.0_n * watt));
+    assert(reads("2\xce\xa9", 2.0_n * ohm));
+    assert(reads("2mol", 2.0_n * mole));
+    assert(reads("2kat", 2.0_n * katal));
+
+    // no conversions and no prefixes
+    assert(!reads("2kWh", 2.0_n * joule));
+    assert(!reads("2g", 2.0_n * kilogram));
+    assert(!reads("2km", 2.0_n * meter));
+    assert(!reads("2Hz", 2.0_n * newton));
+
+    // reading stops at the unit
+    std::istringstream s{"2N, 3N"};
+    t::newton n;
+    char comma;
+    s >> n >> comma;
+    assert(s && n == 2.0_n * newton && comma == ',');
+
+    // what cannot belong to the unit stays in the stream
+    for (auto const& text : {"1m)", "1m-2", "1m*2", "1m_x", "1m2"}) {
+        std::istringstream r{text};
+        t::meter m{0};
+        r >> m;
+        std::string rest;
+        r >> rest;
+        assert(r && m == 1.0_n * meter && rest == std::string{text}.substr(2));
+    }
+    std::istringstream bracketed{"(2kg*m/s^2) (1s^(-1/2))"};
+    Quantity<raised_unit<u::second, std::ratio<-1, 2>>> root{0};
+    char open, close;
+    bracketed >> open >> n >> close >> open >> root >> close;
+    assert(bracketed && n == 2.0_n * newton && root.magnitude() == 1.0 && close == ')');
+    assert(!reads("1mkg", 1.0_n * meter));
+    assert(!reads("1m^2", 1.0_n * meter));
+
+    // every printed symbol is in the table
+    assert(reads_back(newton));
+    assert(reads_back(hertz));
+    assert(reads_back(pascal));
+    assert(reads_back(joule));
+    assert(reads_back(watt));
+    assert(reads_back(coulomb));
+    assert(reads_back(volt));
+    assert(reads_back(farad));
+    assert(reads_back(ohm));
+    assert(reads_back(siemens));
+    assert(reads_back(weber));
+    assert(reads_back(tesla));
+    assert(reads_back(henry));
+    assert(reads_back(lumen));
+    assert(reads_back(lux));
+    assert(reads_back(gray));
+    assert(reads_back(katal));
+    assert(reads_back(meter * kilogram * ampere * kelvin * mole * candela / second));
+    assert(reads_back(square(meter) / cube(second)));
+}
+
+void cache_test()
+{
+    for (int i = 0; i < 3; ++i) {
+        assert(parsed<t::pascal>("kN/m^2") == kilo(pascal));
+        assert(fails<t::pascal>("kN/m^"));
+    }
+}
+
+void untrusted_input_test()
+{
+    assert(fails<t::meter>("m^99999999999"));
+    assert(fails<t::meter>("m^(1/99999999999)"));
+    assert(fails<t::meter>("(m^2000000000)^2"));
+    assert(fails<t::meter>("m^2000000000*m^2000000000"));
+    assert(fails<t::meter>("m^2000000000"));  // a logarithmic number of multiplications
+    assert(fails<Quantity<sqare_unit<u::meter>>>("m^2.5"));
+    using SquareMeterSecond = Quantity<product_unit<sqare_unit<u::meter>, u::second>>;
+    using PerCubicMeter = Quantity<raised_unit<u::meter, std::ratio<-3>>>;
+    assert(parsed<SquareMeterSecond>("m^2.s").magnitude() == 1.0);
+    assert(parsed<PerCubicMeter>("km^-3").magnitude() == 1e-9);
+
+    // distinct expressions do not grow the cache beyond its size
+    for (std::size_t i = 0; i < 2 * parse_unit_cache_size(); ++i)
+        assert(parsed<t::meter>(std::to_string(i + 1) + " m").magnitude() == static_cast<double>(i + 1));
+    assert(parsed<t::pascal>("kN/m^2") == kilo(pascal));
+}
+}
+
+QuantityParsingTest::QuantityParsingTest()
+{
+    grammar_test();
+    prefix_test();
+    dimension_test();
+    cache_test();
+    untrusted_input_test();
+    symbol_table_test();
+    reading_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
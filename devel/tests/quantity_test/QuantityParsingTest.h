@@ -0,0 +1,10 @@
+#pragma once
+
+namespace tests {
+class QuantityParsingTest
+{
+public:
+    QuantityParsingTest();
+};
+}
+
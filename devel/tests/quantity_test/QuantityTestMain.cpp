@@ -1,4 +1,9 @@
 #include "QuantityDefinitionsSiTest.h"
+#include "QuantityConversionTest.h"
+#include "QuantityParsingTest.h"
+#include "QuantityWritingTest.h"
+#include "PhysicalConstantsRegistryTest.h"
+#include "QuantityInstantiationsSiTest.h"
 #include "QuantityTestMain.h"
 
 #include "odr_test/QDummyTranslationUnit1.h"
@@ -153,6 +158,17 @@ void complex_math_test() //complex functions are not constexpr, therefore non-st
         assert(b);
     }
 
+    {
+        // the fast paths compute in the promoted type like std::pow
+        using fnewton = Quantity<u::newton, std::complex<float>>;
+        const auto inverse = pow<std::ratio<-1>>(fnewton{std::complex<float>{3,4}});
+        static_assert(std::is_same<decltype(inverse)::magnitude_type, TComplex>::value, "");
+        assert(abs(inverse.magnitude() - TComplex{0.12,-0.16}) < 1e-15);
+        assert((pow<std::ratio<2>>(fnewton{std::complex<float>{3,4}}).magnitude() == TComplex{-7,24}));
+        assert((pow<std::ratio<1,2>>(fnewton{std::complex<float>{-7,24}}).magnitude() == TComplex{3,4}));
+        assert((pow<std::ratio<0>>(fnewton{std::complex<float>{3,4}}).magnitude() == TComplex{1}));
+    }
+
 
 }
 
@@ -259,6 +275,11 @@ QuantityTestMain::QuantityTestMain()
     q::QDummyTranslationUnit1{};
     q::QDummyTranslationUnit2{};
     QuantityDefinitionsSiTest{};
+    QuantityConversionTest{};
+    QuantityParsingTest{};
+    QuantityWritingTest{};
+    PhysicalConstantsRegistryTest{};
+    QuantityInstantiationsSiTest{};
 
     read_unit_test_v();
     print_derived_unit_test_v();
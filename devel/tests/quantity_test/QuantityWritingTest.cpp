@@ -0,0 +1,166 @@
+#include "QuantityWritingTest.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityReading.h>
+#include <src/quantity/quantityWriting.h>
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tests {
+
+using namespace unit;
+using namespace literals;
+
+namespace {
+
+std::string shortest(double v)
+{
+    char out[helper::formatting::maxLength];
+    return std::string(out, helper::formatting::shortest(v, out));
+}
+
+void format_test()
+{
+    assert(shortest(0.0) == "0");
+    assert(shortest(-0.0) == "-0");
+    assert(shortest(1.0) == "1");
+    assert(shortest(-1500.0) == "-1500");
+    assert(shortest(0.1) == "0.1");
+    assert(shortest(0.3) == "0.3");
+    assert(shortest(0.0015) == "0.0015");
+    assert(shortest(1.0 / 3.0) == "0.3333333333333333");
+    assert(shortest(1e21) == "1e+21");
+    assert(shortest(1.5e-20) == "1.5e-20");
+    assert(shortest(5e-324) == "5e-324");
+    assert(shortest(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+    assert(shortest(std::numeric_limits<double>::infinity()) == "inf");
+    assert(shortest(-std::numeric_limits<double>::infinity()) == "-inf");
+    assert(shortest(std::nan("")) == "nan");
+
+    char out[helper::formatting::maxLength];
+    assert(std::string(out, helper::formatting::shortest(0.1f, out)) == "0.1");
+    assert(std::string(out, helper::formatting::shortest(16777216.0f, out)) == "16777216");
+
+    // random bit patterns read back exactly
+    std::uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 100000; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double d;
+        std::memcpy(&d, &state, sizeof(d));
+        if (!std::isfinite(d)) continue;
+        assert(std::strtod(shortest(d).c_str(), nullptr) == d);
+
+        float f;
+        const std::uint32_t low = static_cast<std::uint32_t>(state);
+        std::memcpy(&f, &low, sizeof(f));
+        if (!std::isfinite(f)) continue;
+        const std::string s(out, helper::formatting::shortest(f, out));
+        assert(std::strtof(s.c_str(), nullptr) == f);
+    }
+}
+
+void header_test()
+{
+    std::ostringstream s;
+    {
+        column_writer<u::watt> w{s, "power"};
+        w << 1.5_n * watt << -2.0_n * watt << 0.1_n * watt;
+    }
+    assert(s.str() == "power [W]\n1.5\n-2\n0.1\n");
+}
+
+void symbol_test()
+{
+    std::ostringstream s;
+    {
+        column_writer<u::meter_per_second> w{s};
+        w << 3.0_n * meter / second;
+        w.flush();
+        assert(s.str() == "3ms^-1\n");
+        w << 0.25_n * meter / second;
+    }
+    assert(s.str() == "3ms^-1\n0.25ms^-1\n");
+
+    std::ostringstream i;
+    {
+        column_writer<u::second, int> w{i, "t"};
+        w << Quantity<u::second, int>{-7};
+    }
+    assert(i.str() == "t [s]\n-7\n");
+}
+
+// more values than fit into the buffer, every one reads back exactly
+void round_trip_test()
+{
+    std::vector<t::newton> values;
+    double x = 1.0;
+    for (int i = 0; i < 5000; ++i) {
+        x = std::fmod(x * 1103515245.0 + 12345.0, 2147483648.0);
+        values.push_back(t::newton{(x - 1e9) * std::pow(10.0, i % 40 - 20) / 3.0});
+    }
+
+    std::stringstream s;
+    {
+        column_writer<u::newton> w{s, 0};
+        w.write(values.begin(), values.end());
+    }
+    for (auto const& expected : values) {
+        t::newton n;
+        s >> n;
+        assert(s && n == expected);
+    }
+}
+
+void manipulator_test()
+{
+    std::ostringstream s;
+    s << 0.1_n * newton + 0.2_n * newton << ' ';
+    s << round_trip << 0.1_n * newton + 0.2_n * newton << ' ' << std::setw(6) << 0.5_n * newton << ' ';
+    s << Quantity<u::ohm, std::complex<double>>{std::complex<double>{0.1, -1.0 / 3.0}} << ' ';
+    s << Quantity<u::meter, float>{0.1f} << ' ' << Quantity<u::meter, int>{3} << ' ';
+    s << stream_precision << 1.0_n / 3.0_n;
+    assert(s.str() == "0.3N 0.30000000000000004N    0.5N (0.1,-0.3333333333333333)Ohm 0.1m 3m 0.333333");
+
+    // text checkpoints restore the exact values
+    std::stringstream io;
+    io << round_trip;
+    double x = 0.7;
+    for (int i = 0; i < 1000; ++i) {
+        x = 3.9 * x * (1 - x);
+        io << Quantity<u::joule>{x * std::pow(10.0, i % 600 - 300)} << '\n';
+    }
+    x = 0.7;
+    for (int i = 0; i < 1000; ++i) {
+        x = 3.9 * x * (1 - x);
+        t::joule e;
+        io >> e;
+        assert(io && e == Quantity<u::joule>{x * std::pow(10.0, i % 600 - 300)});
+    }
+}
+}
+
+QuantityWritingTest::QuantityWritingTest()
+{
+    format_test();
+    header_test();
+    symbol_test();
+    round_trip_test();
+    manipulator_test();
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -3,9 +3,19 @@ include($$PWD/odr_test/odr_test.pri)
 HEADERS += \
     $$PWD/QuantityTestMain.h \
     $$PWD/QuantityDefinitionsSiTest.h \
-    $$PWD/QuantityDefinitionsMinExampleTest.h
+    $$PWD/QuantityDefinitionsMinExampleTest.h \
+    $$PWD/QuantityConversionTest.h \
+    $$PWD/QuantityParsingTest.h \
+    $$PWD/QuantityWritingTest.h \
+    $$PWD/PhysicalConstantsRegistryTest.h \
+    $$PWD/QuantityInstantiationsSiTest.h
 
 SOURCES += \
     $$PWD/QuantityTestMain.cpp \
     $$PWD/QuantityDefinitionsSiTest.cpp \
-    $$PWD/QuantityDefinitionsMinExampleTest.cpp
+    $$PWD/QuantityDefinitionsMinExampleTest.cpp \
+    $$PWD/QuantityConversionTest.cpp \
+    $$PWD/QuantityParsingTest.cpp \
+    $$PWD/QuantityWritingTest.cpp \
+    $$PWD/PhysicalConstantsRegistryTest.cpp \
+    $$PWD/QuantityInstantiationsSiTest.cpp
@@ -1,5 +1,7 @@
 include($$PWD/unit_test/unit_test.pri)
 include($$PWD/quantity_test/quantity_test.pri)
+include($$PWD/magnitude_test/magnitude_test.pri)
+include($$PWD/numeric_test/numeric_test.pri)
 
 HEADERS += \
     $$PWD/TestMain.h
@@ -0,0 +1,112 @@
+#include "RationalUnitTest.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityParsing.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityReading.h>
+#include <src/unit/SparseUnit.h>
+#include <src/unit/UnitId.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <ratio>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace unit;
+
+namespace tests {
+
+namespace {
+
+using RootHz = raised_unit<u::hertz,std::ratio<1,2>>;
+using VoltPerRootHz = quotient_unit<u::volt,RootHz>;
+
+static_assert(std::is_same<RootHz,RationalUnit<2,0,0,-1,0,0,0,0>>::value,"");
+static_assert(std::is_same<VoltPerRootHz,RationalUnit<2,4,2,-5,-2,0,0,0>>::value,"");
+static_assert(RootHz::exponent_count()==7,"");
+static_assert(RootHz::exponent_denominator()==2,"");
+static_assert(RootHz::exponent_numerator<2>()==-1,"");
+
+// integer exponents give a Unit again
+static_assert(std::is_same<product_unit<RootHz,RootHz>,u::hertz>::value,"");
+static_assert(std::is_same<raised_unit<RootHz,std::ratio<2>>,u::hertz>::value,"");
+static_assert(std::is_same<product_unit<VoltPerRootHz,RootHz>,u::volt>::value,"");
+static_assert(std::is_same<raised_unit<u::meter,std::ratio<2,4>>,RationalUnit<2,1,0,0,0,0,0,0>>::value,"");
+static_assert(std::is_same<raised_unit<sqare_unit<u::meter>,std::ratio<1,2>>,u::meter>::value,"");
+
+// common denominators
+static_assert(std::is_same<product_unit<RootHz,raised_unit<u::second,std::ratio<1,3>>>,
+                           RationalUnit<6,0,0,-1,0,0,0,0>>::value,"");
+static_assert(std::is_same<raised_unit<RootHz,std::ratio<2,3>>,raised_unit<u::hertz,std::ratio<1,3>>>::value,"");
+static_assert(std::is_same<quotient_unit<u::unitless,RootHz>,raised_unit<u::second,std::ratio<1,2>>>::value,"");
+
+// combined with other representations
+static_assert(std::is_same<product_unit<RootHz,SparseBaseUnit<2,6>>,raised_unit<u::second,std::ratio<1,2>>>::value,"");
+static_assert(std::is_same<quotient_unit<unit_id<u::volt>,RootHz>,VoltPerRootHz>::value,"");
+
+template <typename U>
+std::string printed()
+{
+    std::ostringstream s;
+    print_unit<U>(s);
+    return s.str();
+}
+
+}
+
+RationalUnitTest::RationalUnitTest()
+{
+    {
+        // noise density of an amplifier
+        const Quantity<u::volt> noise{2e-6};
+        const Quantity<u::hertz> bandwidth{10000.0};
+        const auto density = noise / sqrt(bandwidth);
+        static_assert(std::is_same<decltype(density)::unit,VoltPerRootHz>::value,"");
+        assert(std::abs(density.magnitude() - 2e-8) < 1e-20);
+        assert(std::abs((density * sqrt(bandwidth)).magnitude() - 2e-6) < 1e-18);
+        assert(pow<std::ratio<2>>(sqrt(bandwidth)) == bandwidth);
+    }
+    {
+        assert(printed<RootHz>()=="s^(-1/2)");
+        assert(printed<VoltPerRootHz>()=="m^2kgs^(-5/2)A^-1");
+        assert((printed<RationalUnit<6,0,0,-1,0,0,0,0>>()=="s^(-1/6)"));
+        assert((printed<raised_unit<u::newton,std::ratio<1,2>>>()=="m^(1/2)kg^(1/2)s^-1"));
+    }
+    {
+        std::ostringstream s;
+        s << Quantity<VoltPerRootHz>{3.0};
+        assert(s.str()=="3m^2kgs^(-5/2)A^-1");
+        std::istringstream r{s.str() + " 2s^(-1/2)"};
+        Quantity<VoltPerRootHz> q{0};
+        r >> q;
+        assert(r && q.magnitude()==3.0);
+        Quantity<VoltPerRootHz> wrong{0};
+        r >> wrong;
+        assert(!r && wrong.magnitude()==0.0);
+    }
+    {
+        PackedUnit<7> p;
+        assert(parse_unit(std::string("V/Hz^(1/2)"), p));
+        assert((p.exponents == std::array<TExponent, 7>{{4, 2, -5, -2, 0, 0, 0}}));
+        assert(p.denominator == 2);
+        assert(parse_unit(std::string("Hz^(1/2)*Hz^(1/2)"), p));
+        assert((p.exponents == std::array<TExponent, 7>{{0, 0, -1, 0, 0, 0, 0}}));
+        assert(p.denominator == 1);
+        assert(parse_unit(std::string("km^(1/2)"), p));
+        assert(std::abs(p.scale - std::sqrt(1000.0)) < 1e-12);
+        assert(!parse_unit(std::string("Hz^(1/0)"), p));
+        assert(!parse_unit(std::string("Hz^(1/)"), p));
+
+        Quantity<VoltPerRootHz> q{0};
+        assert(parse_as(std::string("uV/kHz^(1/2)"), q));
+        assert(std::abs(q.magnitude() - 1e-6 / std::sqrt(1000.0)) < 1e-18);
+        assert(!parse_as(std::string("V/Hz"), q));
+    }
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,156 @@
+#include "SparseUnitTest.h"
+
+#include <src/quantity/Quantity.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityOperators.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityReading.h>
+#include <src/unit/SparseUnit.h>
+#include <src/unit/Unit.h>
+#include <src/unit/unitOperators.h>
+#include <src/unit/unitPrinting.h>
+#include <src/unit/unitReading.h>
+
+#include <cassert>
+#include <iostream>
+#include <ratio>
+#include <sstream>
+#include <type_traits>
+
+namespace unit {
+
+// a unit system of ten dimensions
+template<typename U> constexpr const char* unitSymbol();
+template<> constexpr const char* unitSymbol<SparseBaseUnit<0,9>>(){ return "m";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<1,9>>(){ return "kg";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<2,9>>(){ return "s";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<3,9>>(){ return "A";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<4,9>>(){ return "K";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<5,9>>(){ return "mol";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<6,9>>(){ return "cd";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<7,9>>(){ return "EUR";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<8,9>>(){ return "bit";}
+template<> constexpr const char* unitSymbol<SparseBaseUnit<9,9>>(){ return "rad";}
+
+}
+
+using namespace unit;
+using namespace unit::literals;
+
+namespace tests {
+
+namespace {
+
+using D1 = Dimension<0,1>;
+using M  = SparseBaseUnit<0,9>;
+using S  = SparseBaseUnit<2,9>;
+using E  = SparseBaseUnit<7,9>;
+using B  = SparseBaseUnit<8,9>;
+using None = SparseBaseUnit<-1,9>;
+
+static_assert(std::is_same<M,SparseUnit<10,D1>>::value,"");
+static_assert(std::is_same<None,SparseUnit<10>>::value,"");
+static_assert(M::exponent_count()==10,"");
+static_assert(helper::exponent<SparseUnit<10,Dimension<3,-2>,Dimension<8,5>>,8>()==5,"");
+static_assert(helper::exponent<SparseUnit<10,Dimension<3,-2>,Dimension<8,5>>,4>()==0,"");
+
+// canonicalization: sorted, merged, no zeros
+static_assert(std::is_same<sparse_unit<10,Dimension<8,1>,Dimension<0,1>>,SparseUnit<10,Dimension<0,1>,Dimension<8,1>>>::value,"");
+static_assert(std::is_same<sparse_unit<10,Dimension<8,1>,Dimension<2,3>,Dimension<8,-1>>,SparseUnit<10,Dimension<2,3>>>::value,"");
+static_assert(std::is_same<sparse_unit<10,Dimension<4,0>>,None>::value,"");
+
+using BitRate = quotient_unit<B,S>;
+using Price = quotient_unit<E,B>;
+
+static_assert(std::is_same<BitRate,SparseUnit<10,Dimension<2,-1>,Dimension<8,1>>>::value,"");
+static_assert(std::is_same<product_unit<BitRate,Price>,SparseUnit<10,Dimension<2,-1>,Dimension<7,1>>>::value,"");
+static_assert(std::is_same<product_unit<BitRate,S>,B>::value,"");
+static_assert(std::is_same<quotient_unit<B,B>,None>::value,"");
+static_assert(std::is_same<product_unit<None,None>,None>::value,"");
+
+static_assert(std::is_same<raised_unit<BitRate,std::ratio<3>>,SparseUnit<10,Dimension<2,-3>,Dimension<8,3>>>::value,"");
+static_assert(std::is_same<raised_unit<raised_unit<BitRate,std::ratio<4>>,std::ratio<1,2>>,sqare_unit<BitRate>>::value,"");
+static_assert(std::is_same<raised_unit<BitRate,std::ratio<0>>,None>::value,"");
+
+// the same exponents as the dense representation, mixing both gives a SparseUnit, quantities of
+// both convert into each other
+using Dense = Unit<0,0,-1,0,0,0,0,0,1,0>;
+static_assert(std::is_same<helper::DenseUnit<BitRate>::type,Dense>::value,"");
+static_assert(std::is_same<product_unit<Dense,S>,B>::value,"");
+static_assert(std::is_same<quotient_unit<B,Dense>,S>::value,"");
+static_assert(std::is_same<product_unit<Unit<0,0,0,0,0,0,0,0,0,0>,Unit<0,0,0,0,0,0,0,0,0,0>>,Unit<0,0,0,0,0,0,0,0,0,0>>::value,"");
+
+// short type names for many dimensions
+using Wide = SparseUnit<64,Dimension<63,1>>;
+static_assert(std::is_same<quotient_unit<sqare_unit<Wide>,Wide>,Wide>::value,"");
+static_assert(helper::exponent<product_unit<Wide,Wide>,63>()==2,"");
+
+}
+
+SparseUnitTest::SparseUnitTest()
+{
+    {
+        const Quantity<BitRate> r{8e6};
+        const Quantity<Price> p{0.5};
+        const auto cost = r * p * Quantity<S>{2.0};
+        static_assert(std::is_same<decltype(cost)::unit,E>::value,"");
+        assert(cost.magnitude()==8e6);
+
+        const auto root = sqrt(Quantity<sqare_unit<BitRate>>{16.0});
+        static_assert(std::is_same<decltype(root)::unit,BitRate>::value,"");
+        assert(root.magnitude()==4.0);
+    }
+    {
+        std::ostringstream s;
+        print_unit<product_unit<sqare_unit<M>,BitRate>>(s);
+        assert(s.str()=="m^2s^-1bit");
+    }
+    {
+        std::ostringstream s;
+        s << Quantity<Price>{0.25};
+        assert(s.str()=="0.25EURbit^-1");
+    }
+    {
+        std::istringstream s{"3s^-1bit"};
+        Quantity<BitRate> r{0};
+        s >> r;
+        assert(s && r.magnitude()==3.0);
+    }
+    {
+        std::istringstream s{"3EUR"};
+        Quantity<BitRate> r{0};
+        s >> r;
+        assert(!s);
+    }
+    {
+        // quantities of both representations convert, add and compare
+        const Quantity<Dense> dense{2.0};
+        const Quantity<BitRate> sparse = dense;
+        assert(sparse.magnitude()==2.0);
+        Quantity<Dense> back{0.0};
+        back = sparse;
+        assert(back == dense && sparse == dense && dense == sparse && !(sparse != dense));
+        assert(sparse < dense + dense && dense + sparse == Quantity<Dense>{4.0});
+        static_assert(std::is_same<decltype(sparse - dense)::unit,BitRate>::value,"");
+        back += sparse;
+        back -= Quantity<BitRate>{1.0};
+        assert(back.magnitude()==3.0);
+        assert((Quantity<S>{2.0} * sparse == Quantity<B>{4.0}));
+        assert((Quantity<Dense>{1.0} * Quantity<S>{2.0} == Quantity<Unit<0,0,0,0,0,0,0,0,1,0>>{2.0}));
+        static_assert(!std::is_convertible<Quantity<BitRate>,Quantity<Price>>::value,"");
+        static_assert(!std::is_convertible<Quantity<BitRate>,Quantity<M>>::value,"");
+    }
+    {
+        // with the si quantities
+        const Quantity<sparse_unit<7,Dimension<0,1>>> a{2};
+        t::meter m = a;
+        assert(m.magnitude()==2.0);
+        assert(a + meter == 3.0_n * meter && a == 2.0_n * meter && meter < a);
+        m -= a;
+        assert(m == 0.0_n * meter);
+    }
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
@@ -0,0 +1,107 @@
+#include "UnitIdTest.h"
+
+#include <src/quantity/quantityDefinitionsSI.h>
+#include <src/quantity/quantityMath.h>
+#include <src/quantity/quantityPrinting.h>
+#include <src/quantity/quantityReading.h>
+#include <src/unit/SparseUnit.h>
+#include <src/unit/UnitId.h>
+
+#include <cassert>
+#include <iostream>
+#include <ratio>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+using namespace unit;
+using namespace unit::literals;
+
+namespace tests {
+
+namespace {
+
+using N = unit_id<u::newton>;
+using J = unit_id<u::joule>;
+using M = unit_id<u::meter>;
+
+static_assert(std::is_same<N,UnitId<99351>>::value,"");
+static_assert(std::is_same<unit_id<u::unitless>,UnitId<7>>::value,"");
+static_assert(helper::exponent<UnitId<(1 << 3) | 7>,0>()==-1,"");
+static_assert(N::exponent_count()==7,"");
+static_assert(helper::exponent<N,2>()==-2,"");
+static_assert(std::is_same<unit_id<N>,N>::value,"");
+static_assert(std::is_same<helper::DenseUnit<N>::type,u::newton>::value,"");
+
+// the same algebra as Unit
+static_assert(std::is_same<product_unit<N,M>,J>::value,"");
+static_assert(std::is_same<quotient_unit<J,M>,N>::value,"");
+static_assert(std::is_same<quotient_unit<N,N>,unit_id<u::unitless>>::value,"");
+static_assert(std::is_same<raised_unit<N,std::ratio<2>>,unit_id<sqare_unit<u::newton>>>::value,"");
+static_assert(std::is_same<raised_unit<unit_id<sqare_unit<u::newton>>,std::ratio<1,2>>,N>::value,"");
+static_assert(std::is_same<raised_unit<N,std::ratio<-3>>,unit_id<raised_unit<u::newton,std::ratio<-3>>>>::value,"");
+static_assert(std::is_same<raised_unit<N,std::ratio<0>>,unit_id<u::unitless>>::value,"");
+
+// combined with other representations
+static_assert(std::is_same<product_unit<N,u::meter>,J>::value,"");
+static_assert(std::is_same<quotient_unit<u::joule,M>,N>::value,"");
+static_assert(std::is_same<product_unit<SparseBaseUnit<0,6>,N>,J>::value,"");
+static_assert(std::is_same<quotient_unit<N,SparseBaseUnit<0,6>>,unit_id<quotient_unit<u::newton,u::meter>>>::value,"");
+
+}
+
+UnitIdTest::UnitIdTest()
+{
+    {
+        const Quantity<M> d{3.0};
+        const Quantity<N> f{2.0};
+        const Quantity<J> w = f * d;
+        assert(w.magnitude()==6.0);
+        assert(w / d == f);
+        assert(sqrt(f * f) == f);
+        assert((f * meter).magnitude()==2.0);
+    }
+    {
+        std::ostringstream s;
+        s << Quantity<N>{-4.5} << " " << Quantity<unit_id<u::meter_per_second>>{2.0};
+        assert(s.str()=="-4.5N 2ms^-1");
+    }
+    {
+        std::istringstream s{"1.5kg*m/s^2 2J"};
+        Quantity<N> f{0};
+        Quantity<N> g{0};
+        s >> f;
+        assert(s && f.magnitude()==1.5);
+        s >> g;
+        assert(!s && g.magnitude()==0.0);
+    }
+    {
+        // quantities of ids and of the si units convert, add and compare
+        const Quantity<N> f{2.0};
+        t::newton g = f;
+        assert(g.magnitude()==2.0);
+        Quantity<N> h{0.0};
+        h = 3.0_n * newton;
+        assert(h.magnitude()==3.0);
+        assert(f == 2.0_n * newton && 2.0_n * newton == f && f != h && f < h && h >= 3.0_n * newton);
+        assert(f + newton == h && newton + f == h);
+        static_assert(std::is_same<decltype(f + newton)::unit,N>::value,"");
+        static_assert(std::is_same<decltype(newton + f)::unit,u::newton>::value,"");
+        g += f;
+        g -= Quantity<N>{1.0};
+        assert(g == h);
+        const t::joule w = f * meter;
+        assert(w.magnitude()==2.0);
+        static_assert(!std::is_convertible<Quantity<N>,t::joule>::value,"");
+    }
+    {
+        // the reason for UnitId, a shorter signature in symbols and debug info
+        using F = void(*)(Quantity<J>, Quantity<N>);
+        using G = void(*)(Quantity<u::joule>, Quantity<u::newton>);
+        assert(std::string{typeid(F).name()}.size() < std::string{typeid(G).name()}.size());
+    }
+
+    std::cout<<__FILE__<<" finished\n";
+}
+}
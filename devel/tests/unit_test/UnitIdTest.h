@@ -0,0 +1,9 @@
+#pragma once
+
+namespace tests {
+class UnitIdTest
+{
+public:
+    UnitIdTest();
+};
+}
@@ -1,4 +1,7 @@
 #include "UnitTestMain.h"
+#include "RationalUnitTest.h"
+#include "SparseUnitTest.h"
+#include "UnitIdTest.h"
 #include "odr_test/DummyTranslationUnit1.h"
 #include "odr_test/DummyTranslationUnit2.h"
 
@@ -6,7 +9,7 @@
 #include <src/unit/unitHelper.h>
 #include <src/unit/unitOperators.h>
 #include <src/unit/unitPrinting.h>
-#include <src/unit/UnitReading.h>
+#include <src/unit/unitReading.h>
 #include <src/unit/unitScaling.h>
 
 
@@ -116,5 +119,9 @@ UnitTestMain::UnitTestMain()
     print_unit_test();
     read_unit_test();
 
+    SparseUnitTest{};
+    UnitIdTest{};
+    RationalUnitTest{};
+
 }
 }
@@ -4,4 +4,7 @@
 #include <src/unit/unitHelper.h>
 #include <src/unit/unitOperators.h>
 #include <src/unit/unitPrinting.h>
-#include <src/unit/UnitReading.h>
+#include <src/unit/unitReading.h>
+#include <src/unit/unitSymbols.h>
+#include <src/unit/unitSymbolTable.h>
+#include <src/unit/unitParsing.h>
@@ -1,7 +1,13 @@
 include($$PWD/odr_test/odr_test.pri)
 
 HEADERS += \
-    $$PWD/UnitTestMain.h
+    $$PWD/UnitTestMain.h \
+    $$PWD/SparseUnitTest.h \
+    $$PWD/UnitIdTest.h \
+    $$PWD/RationalUnitTest.h
 
 SOURCES += \
-    $$PWD/UnitTestMain.cpp
+    $$PWD/UnitTestMain.cpp \
+    $$PWD/SparseUnitTest.cpp \
+    $$PWD/UnitIdTest.cpp \
+    $$PWD/RationalUnitTest.cpp
@@ -1,51 +1,214 @@
 #include "SingleFileGenerator.h"
 
-//1. enable defines
-//2. recompile with #QMAKE_CXXFLAGS += -E
-//3. open SingleFileGenerator.o with texteditor
-//4. remove "#.+" (regex)
-//5. replace "\r\n +\r\n" -> "\r\n\r\n" (regex)
-//6. remove "\}(\r\n)+namespace unit \{\r\n" (regex)
-//7. copy the unit-namespace to SingleFile.h
-//8. add includes
-//9. beautify everything except milli-block and everything starting at namespace u
-//10. fix forward decl to look again like
-//
-//            namespace std{ template<intmax_t, intmax_t > struct ratio;} => and remove this line
-//            namespace unit {
-//            namespace math {
-//11. compile everything
-//12. copy to include dir
-
-
-
-//#define _GLIBCXX_IOSFWD 1
-//#define _GLIBCXX_OSTREAM 1
-//#define _GLIBCXX_RATIO 1
-//#define _GLIBCXX_CTGMATH 1
-//#define _GLIBCXX_TYPE_TRAITS 1
-//#define _GLIBCXX_IOSTREAM 1
-//#define _GLIBCXX_SSTREAM 1
-//#define _GLIBCXX_STRING	1
-//#define _GLIBCXX_ISTREAM 1
-
-
-//all
-#include <src/quantity/quantityOperators.h>
-#include <src/quantity/quantityMath.h>
-
-//si
-#include <src/quantity/quantityReading.h>
-#include <src/quantity/quantityPrinting.h>
-#include <src/quantity/quantityDefinitionsSI.h>
-
-
-//minimal
-//#include <src/unit/unitScaling.h>
-//#include <src/quantity/quantityDefinitionsMinimalExample.h>
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
 
+namespace {
+
+struct Section {
+    std::vector<std::string> systemIncludes;
+    std::string directives; // the preprocessor lines of the code
+    std::string code;
+};
+
+class Amalgamation
+{
+public:
+    explicit Amalgamation(std::string const& develDir) : develDir(develDir) {}
+
+    // appends the header and everything it includes from devel, each file once
+    void add(std::string const& header, Section& section) {
+        if (done.insert(header).second==false) return;
+
+        std::istringstream lines(SingleFileGenerator::readFile(develDir + "/" + header));
+        std::string code;
+        std::string line;
+        while (std::getline(lines, line)) {
+            std::string quoted, angled;
+            if (line.find("#pragma once")==0) continue;
+            if (parseInclude(line, '"', quoted)) {
+                add(directory(header) + quoted, section);
+                continue;
+            }
+            if (parseInclude(line, '<', angled)) {
+                if (angled.find("src/")==0) add(angled, section);
+                else if (isSystemInclude(angled)==false) section.systemIncludes.push_back(angled);
+                continue;
+            }
+            if (line.find("#")==0) section.directives += line + "\n";
+            code += line + "\n";
+        }
+
+        section.code += "// " + header + "\n" + trimBlankLines(code) + "\n\n";
+    }
+
+    bool isSystemInclude(std::string const& header) const {
+        return std::find(systemIncludes.begin(), systemIncludes.end(), header)!=systemIncludes.end();
+    }
+
+    void addSystemIncludes(Section const& section) {
+        systemIncludes.insert(systemIncludes.end(), section.systemIncludes.begin(), section.systemIncludes.end());
+    }
+
+private:
+    static bool parseInclude(std::string const& line, char open, std::string& header) {
+        const std::string directive = std::string("#include ") + open;
+        if (line.find(directive)!=0) return false;
+        const auto end = line.find(open=='"' ? '"' : '>', directive.length());
+        assert(end!=std::string::npos);
+        header = line.substr(directive.length(), end - directive.length());
+        return true;
+    }
+
+    static std::string directory(std::string const& header) {
+        const auto slash = header.rfind('/');
+        return slash==std::string::npos ? "" : header.substr(0, slash + 1);
+    }
+
+    // at most one blank line in a row and none at the ends
+    static std::string trimBlankLines(std::string const& code) {
+        std::istringstream lines(code);
+        std::string result, line;
+        bool blank = false;
+        while (std::getline(lines, line)) {
+            if (line.find_first_not_of(" \t\r")==std::string::npos) {
+                blank = result.empty()==false;
+                continue;
+            }
+            if (blank) result += "\n";
+            blank = false;
+            result += line + "\n";
+        }
+        if (result.empty()==false) result.pop_back();
+        return result;
+    }
+
+    std::string develDir;
+    std::set<std::string> done;
+    std::vector<std::string> systemIncludes;
+};
+
+std::string includesText(Section const& section, std::string const& before, std::string const& after) {
+    std::string s;
+    std::vector<std::string> includes = section.systemIncludes;
+    std::sort(includes.begin(), includes.end());
+    includes.erase(std::unique(includes.begin(), includes.end()), includes.end());
+    for(auto const& i:includes) s += before + i + after + "\n";
+    if (includes.empty()==false) s += "\n";
+    return s;
+}
+
+std::string sectionText(Section const& section, std::string const& enclosingNamespace) {
+    std::string s = includesText(section, "#include <", ">");
+    if (enclosingNamespace.empty()==false) s += "namespace " + enclosingNamespace + " {\n\n";
+    s += section.code;
+    if (enclosingNamespace.empty()==false) s += "}// namespace " + enclosingNamespace + "\n\n";
+    return s;
+}
+
+// the standard headers are imported as header units, gcc 12 duplicates their vtables when
+// they are included in the global module fragment, the code is exported
+std::string moduleText(Section const& section, Section const& imported, SingleFileGenerator::SingleFile const& file) {
+    std::string s = "export module " + file.moduleName + ";\n\n";
+    for(auto const& i:file.moduleImports) s += i + "\n";
+    if (file.moduleImports.empty()==false) s += "\n";
+    s += includesText(section, "import <", ">;");
+    if (imported.directives.empty()==false) s += "// macros are not imported\n" + imported.directives + "\n";
+    if (section.code.empty()==false) s += "export {\n\n" + section.code + "}\n";
+    return s;
+}
+
+}
 
 SingleFileGenerator::SingleFileGenerator()
 {
+    const std::string develDir = "../devel";
+
+    for(auto const& f:singleFiles()) {
+        std::cout<<"generating " << f.path << "\n";
+        std::ofstream out(develDir + "/" + f.path, std::ios::binary);
+        if (out.is_open()==false)
+            assert(false);
+        out<<amalgamate(develDir, f);
+    }
+}
+
+std::vector<SingleFileGenerator::SingleFile> SingleFileGenerator::singleFiles()
+{
+    const std::vector<std::string> all {"src/quantity/quantityOperators.h", "src/quantity/quantityMath.h"};
+    const std::vector<std::string> streams {"src/quantity/quantityReading.h", "src/quantity/quantityPrinting.h"};
+    const std::vector<std::string> streamIncludes {"iostream", "sstream"};
+
+    std::vector<std::string> si = all;
+    si.push_back("src/quantity/quantityDefinitionsSI.h");
+    si.push_back("src/unit/UnitId.h");
+
+    std::vector<std::string> minimal = all;
+    minimal.push_back("src/unit/unitScaling.h");
+    minimal.push_back("src/quantity/quantityDefinitionsMinimalExample.h");
+
+    // modules leave out reading and printing, gcc 12 fails to link the static locals they use
+    const std::vector<std::string> constants {"tools/pysConstsantsGeneration/generated/physicalConstants.h"};
+
+    return {
+        {"../include/units.h", si, streams, streamIncludes, "", "", {}, {}},
+        {"tools/SingleFileSi.h", si, streams, streamIncludes, "singleFileSi", "", {}, {}},
+        {"tools/SingleFileMinimalExample.h", minimal, {}, {}, "singleFileMinimalExample", "", {}, {}},
+        {"../include/units.cppm", {}, {}, {}, "", "units", {"export import :core;", "export import :constants;"}, {}},
+        {"../include/units-core.cppm", si, {}, {}, "", "units:core", {}, {}},
+        {"../include/units-constants.cppm", constants, {}, {}, "", "units:constants", {"import :core;"}, si}
+    };
+}
 
+std::string SingleFileGenerator::amalgamate(const std::string &develDir, const SingleFile &file)
+{
+    Amalgamation a(develDir);
+
+    Section imported;
+    for(auto const& h:file.importedHeaders) a.add(h, imported);
+
+    Section main;
+    for(auto const& h:file.headers) a.add(h, main);
+    a.addSystemIncludes(main);
+
+    Section streams;
+    for(auto const& h:file.streamHeaders) a.add(h, streams);
+    for(auto const& i:file.streamIncludes)
+        if (a.isSystemInclude(i)==false) streams.systemIncludes.push_back(i);
+
+    std::string s;
+    if (file.moduleName.empty()==false) {
+        s += "// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit\n";
+        s += "\n";
+        return s + moduleText(main, imported, file);
+    }
+
+    s += "#pragma once\n";
+    s += "\n";
+    s += "// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit\n";
+    s += "\n";
+    s += sectionText(main, file.enclosingNamespace);
+    if (file.streamHeaders.empty()==false) {
+        s += "#ifndef UNIT_NO_STREAMS\n";
+        s += "\n";
+        s += sectionText(streams, file.enclosingNamespace);
+        s += "#endif // UNIT_NO_STREAMS\n";
+    }
+    return s;
+}
+
+std::string SingleFileGenerator::readFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (in.is_open()==false) {
+        std::cerr<<"cannot read " << path << "\n";
+        assert(false);
+    }
+    std::ostringstream s;
+    s<<in.rdbuf();
+    return s.str();
 }
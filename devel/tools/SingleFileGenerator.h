@@ -1,7 +1,33 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
+/**
+ * amalgamates the headers of devel/src into the single files include/units.h,
+ * tools/SingleFileSi.h and tools/SingleFileMinimalExample.h and into the c++20 module
+ * interface units include/units*.cppm
+ */
 class SingleFileGenerator
 {
 public:
-    SingleFileGenerator();
+    SingleFileGenerator(); // writes all single files, run from a build directory next to devel
+
+    struct SingleFile {
+        std::string path;                        // relative to devel
+        std::vector<std::string> headers;        // relative to devel, in this order
+        std::vector<std::string> streamHeaders;  // after the headers, left out if UNIT_NO_STREAMS is defined
+        std::vector<std::string> streamIncludes; // system headers the single file has always provided, eg iostream
+        std::string enclosingNamespace;          // empty for none
+        std::string moduleName;                  // a module interface unit exporting everything if not empty, eg "units:core"
+        std::vector<std::string> moduleImports;  // eg "import :core;"
+        std::vector<std::string> importedHeaders; // declared by the imports and therefore left out
+    };
+
+    static std::vector<SingleFile> singleFiles();
+
+    // the content of the single file, develDir is the directory containing src
+    static std::string amalgamate(std::string const& develDir, SingleFile const& file);
+
+    static std::string readFile(std::string const& path);
 };
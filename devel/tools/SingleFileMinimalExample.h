@@ -1,68 +1,44 @@
 #pragma once
 
-#include <ratio>
-#include <iostream>
-#include <sstream>
+// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit
+
+#include <complex>
 #include <ctgmath>
+#include <ratio>
+#include <type_traits>
+#include <utility>
 
 namespace singleFileMinimalExample {
 
-
+// src/unit/unitTypes.h
 namespace unit {
 
-template <typename Unit, typename MagnitudeRepresentation = double>
-class Quantity {
-    template <typename, typename>
-    friend class Quantity;
-
-   public:
-    using unit = Unit;
-    using magnitude_type = MagnitudeRepresentation;
-    using classtype = Quantity<unit, magnitude_type>;
-
-    constexpr explicit Quantity() : m_magnitude(0) {}
-    constexpr explicit Quantity(magnitude_type const& v) : m_magnitude(v) {}
-
-    constexpr Quantity(classtype const& v) = default;
-
-    template <typename R>
-    constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
-
-    classtype& operator=(classtype const& v) = default;
-
-    constexpr magnitude_type const& magnitude() const { return m_magnitude; }
-
-   private:
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator+=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator-=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator*=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator/=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    magnitude_type m_magnitude;
-};
-
 using TExponent = int;
-using ExponentIndex = int;
+using ExponentIndex = int;  // cannot be unsigned since UnitOperator uses -1 for recursion abortion
 using DimensionIndex = int;
+}
+
+// src/unit/unitHelper.h
+namespace unit {
 
 template <TExponent... dimensionExponents>
 struct Unit;
 
-namespace helper {
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit;
 
+namespace helper {
 
+// helper to shorten access
 template <typename Unit, ExponentIndex i>
 constexpr TExponent exponent() {
     return Unit::template exponent_value<i>();
 }
 
+constexpr TExponent gcd(TExponent a, TExponent b) {
+    return b == 0 ? (a < 0 ? -a : a) : gcd(b, a % b);
+}
+
 namespace nthElement {
 
 using Index = unsigned int;
@@ -78,6 +54,19 @@ struct NthElement<0, Arg, Args...> {
 };
 }
 
+namespace rational {
+
+template <TExponent... values>
+struct Gcd {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <TExponent v, TExponent... values>
+struct Gcd<v, values...> {
+    static constexpr TExponent value() { return gcd(v, Gcd<values...>::value()); }
+};
+}
+
 namespace baseunit {
 
 template <DimensionIndex it, DimensionIndex index, TExponent... exponents>
@@ -89,11 +78,112 @@ template <DimensionIndex index, TExponent... exponents>
 struct BaseUnitGen<-1, index, exponents...> {
     using type = Unit<exponents...>;
 };
+
+// the base unit of dimension index in the unit system of U, specialized by other unit representations
+template <typename U, DimensionIndex index>
+struct BaseUnitOf {
+    using type = typename BaseUnitGen<U::exponent_count() - 1, index>::type;
+};
 }
+
+// U as Unit<exponents...>, specialized by other unit representations
+template <typename U>
+struct DenseUnit;
+
+template <TExponent... exponents>
+struct DenseUnit<Unit<exponents...>> {
+    using type = Unit<exponents...>;
+};
+
+// whether U1 and U2 are different representations of the same unit, eg a SparseUnit and a Unit
+template <typename U1, typename U2>
+struct EquivalentUnits {
+    template <typename A, typename B>
+    static constexpr bool dense(typename DenseUnit<A>::type*, typename DenseUnit<B>::type*) {
+        return std::is_same<typename DenseUnit<A>::type, typename DenseUnit<B>::type>::value;
+    }
+
+    // representations without a DenseUnit, like RationalUnit
+    template <typename A, typename B>
+    static constexpr bool dense(...) {
+        return false;
+    }
+
+    static constexpr bool value() { return !std::is_same<U1, U2>::value && dense<U1, U2>(nullptr, nullptr); }
+};
+
+// the unit whose print_unit prints U, specialized by representations printed like another one
+template <typename U>
+struct PrintedAs {
+    using type = U;
+};
 }
 
 template <int dimension, int lastDimension>
 using BaseUnit = typename helper::baseunit::BaseUnitGen<lastDimension, dimension>::type;
+}
+
+// src/quantity/Quantity.h
+// the default magnitude type, can be defined before the first include
+#ifndef UNIT_BASETYPE
+#define UNIT_BASETYPE double
+#endif
+
+// namespace scope constants, inline since c++17 so that they have external linkage and modules can export them
+#if __cplusplus >= 201703L
+#define UNIT_CONSTANT inline constexpr
+#else
+#define UNIT_CONSTANT constexpr
+#endif
+
+namespace unit {
+
+template <typename Unit, typename MagnitudeRepresentation = UNIT_BASETYPE>
+class Quantity {
+    template <typename, typename>
+    friend class Quantity;
+
+   public:
+    using unit = Unit;
+    using magnitude_type = MagnitudeRepresentation;
+    using classtype = Quantity<unit, magnitude_type>;
+
+    constexpr explicit Quantity() : m_magnitude(0) {}
+    constexpr explicit Quantity(magnitude_type const& v) : m_magnitude(v) {}
+
+    constexpr Quantity(classtype const& v) = default;
+    constexpr Quantity(classtype &&) = default;
+
+    template <typename R>
+    constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    // the same unit in another representation, eg a SparseUnit or a UnitId
+    template <typename U, typename R, typename = typename std::enable_if<helper::EquivalentUnits<U, unit>::value()>::type>
+    constexpr Quantity(Quantity<U, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    classtype& operator=(classtype const& v) = default;
+
+    constexpr magnitude_type const& magnitude() const { return m_magnitude; }
+
+   private:
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator+=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator-=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator*=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator/=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    magnitude_type m_magnitude;
+};
+}
+
+// src/unit/Unit.h
+namespace unit {
 
 template<TExponent ... dimensionExponents >
 struct Unit{
@@ -106,6 +196,34 @@ struct Unit{
     static constexpr TExponent exponent_value() { return helper::nthElement::NthElement<i,dimensionExponents...>::value(); }
 };
 
+/**
+ * unit with the rational exponents numerators / denominator, the result of raising a Unit to a
+ * fractional power, eg sqrt of a hertz:
+ *
+ *     raised_unit<Unit<0,0,-1,0,0,0,0>, std::ratio<1, 2>>  // RationalUnit<2, 0,0,-1,0,0,0,0>
+ *
+ * The fraction is reduced and the denominator at least 2, results with integer exponents are
+ * Units again. There is no exponent_value, code that expects integer exponents does not compile.
+ */
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit {
+    static_assert(denominator > 1, "a unit with integer exponents is a Unit");
+    static_assert(helper::rational::Gcd<denominator, numerators...>::value() == 1, "the exponents must be reduced");
+
+    using classtype = RationalUnit<denominator, numerators...>;
+
+    static constexpr unsigned exponent_count() { return sizeof...(numerators); }
+
+    static constexpr TExponent exponent_denominator() { return denominator; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_numerator() { return helper::nthElement::NthElement<i, numerators...>::value(); }
+};
+
+}
+
+// src/unit/unitOperators.h
+namespace unit {
 
 namespace helper {
 
@@ -137,24 +255,139 @@ template <typename U1, typename U2, template <class, class, int> class Op, TExpo
 struct UnitOperator<-1, U1, U2, Op, exponents...> {
     using type = Unit<exponents...>;
 };
+
+template <bool... values>
+struct AllOf {
+    static constexpr bool value() { return std::is_same<AllOf<values...>, AllOf<(values || true)...>>::value; }
+};
 }
+
+namespace rational {
+
+// Unit<numerators / denominator...> for integer exponents, the reduced RationalUnit otherwise
+template <TExponent denominator, TExponent... numerators>
+struct Reduced {
+    static constexpr TExponent g() { return Gcd<denominator, numerators...>::value(); }
+    using type = typename std::conditional<denominator == g(), Unit<numerators / g()...>,
+                                           RationalUnit<denominator / g(), numerators / g()...>>::type;
+};
+
+// the exponents of U as numerators, a Unit used as list, over a common denominator
+template <typename U>
+struct Fraction : Fraction<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct Fraction<Unit<exponents...>> {
+    static constexpr TExponent denominator() { return 1; }
+    using numerators = Unit<exponents...>;
+};
+
+template <TExponent d, TExponent... n>
+struct Fraction<RationalUnit<d, n...>> {
+    static constexpr TExponent denominator() { return d; }
+    using numerators = Unit<n...>;
+};
+
+template <TExponent d1, typename N1, TExponent d2, typename N2, int sign>
+struct Sum;
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2, int sign>
+struct Sum<d1, Unit<n1...>, d2, Unit<n2...>, sign> {
+    static_assert(sizeof...(n1) == sizeof...(n2), "units of different unit systems");
+    using type = typename Reduced<d1 / gcd(d1, d2) * d2, (n1 * (d2 / gcd(d1, d2)) + sign * n2 * (d1 / gcd(d1, d2)))...>::type;
+};
+
+template <typename U1, typename U2, int sign>
+struct Combined : Sum<Fraction<U1>::denominator(), typename Fraction<U1>::numerators,
+                      Fraction<U2>::denominator(), typename Fraction<U2>::numerators, sign> {};
+
+template <TExponent d, typename N, typename fract>
+struct Raise;
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raise<d, Unit<n...>, fract> {
+    using type = typename Reduced<static_cast<TExponent>(d * fract::den), static_cast<TExponent>(n * fract::num)...>::type;
+};
+
+template <typename U, typename fract>
+struct Power : Raise<Fraction<U>::denominator(), typename Fraction<U>::numerators, fract> {};
+
+// whether the primary Raised stays with integer exponents, other representations raise themselves
+template <typename U, typename fract>
+struct IntegerPower {
+    static constexpr bool value() { return true; }
+};
+
+template <TExponent... exponents, typename fract>
+struct IntegerPower<Unit<exponents...>, fract> {
+    static constexpr bool value() { return op::AllOf<(exponents * fract::num % fract::den == 0)...>::value(); }
+};
 }
 
+namespace op {
+
+// the operations on Unit<exponents...>, specialized by other unit representations
 template <typename U1, typename U2>
-using product_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::sum>::type;
+struct Product {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, sum>::type;
+};
 
 template <typename U1, typename U2>
-using quotient_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::difference>::type;
+struct Quotient {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, difference>::type;
+};
 
+// fractional powers give a RationalUnit
 template <typename U1, typename fract>
-using raised_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, fract, helper::op::multiply>::type;
+struct Raised {
+    using type = typename std::conditional<rational::IntegerPower<U1, fract>::value(),
+                                           UnitOperator<U1::exponent_count() - 1, U1, fract, multiply>,
+                                           rational::Power<U1, fract>>::type::type;
+};
 
-template <typename U>
-using sqare_unit = product_unit<U, U>;
+// a RationalUnit with a Unit gives a RationalUnit or, for integer exponents, a Unit
+template <TExponent d, TExponent... n, typename U2>
+struct Product<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, 1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Product<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Product<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, 1> {};
+
+template <TExponent d, TExponent... n, typename U2>
+struct Quotient<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, -1> {};
 
+template <typename U1, TExponent d, TExponent... n>
+struct Quotient<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, -1> {};
 
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Quotient<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, -1> {};
 
+template <TExponent d, TExponent... n, typename fract>
+struct Raised<RationalUnit<d, n...>, fract> : rational::Power<RationalUnit<d, n...>, fract> {};
+}
+}
+
+template <typename U1, typename U2>
+using product_unit = typename helper::op::Product<U1, U2>::type;
 
+template <typename U1, typename U2>
+using quotient_unit = typename helper::op::Quotient<U1, U2>::type;
+
+template <typename U1, typename fract>
+using raised_unit = typename helper::op::Raised<U1, fract>::type;
+
+template <typename U>
+using sqare_unit = product_unit<U, U>;
+}
+
+// src/quantity/quantityOperators.h
+namespace unit {
+
+/**
+ *  This function casts eg from Quantity<x,double> -> Quantity<x,int>
+ */
 template <typename TDst, typename QSrc>
 constexpr Quantity<typename QSrc::unit, TDst> static_unit_cast(QSrc const& l) {
     return Quantity<typename QSrc::unit, TDst>{static_cast<TDst>(l.magnitude())};
@@ -239,25 +472,176 @@ constexpr Quantity<LU, LT> operator-(Quantity<LU, LT> const& l) {
     return Quantity<LU, LT>{-l.magnitude()};
 }
 
+namespace helper {
+
+template <typename LU, typename RU>
+using IfEquivalent = typename std::enable_if<EquivalentUnits<LU, RU>::value()>::type;
+}
+
+// the same unit in different representations, results have the representation of the left operand
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator+=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l += Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator-=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l -= Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator+(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() + r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() + r.magnitude())>{l.magnitude() + r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator-(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() - r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() - r.magnitude())>{l.magnitude() - r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() < r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() <= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() > r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() >= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator==(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() == r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator!=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() != r.magnitude();
+}
+}
+
+// src/quantity/quantityMath.h
+namespace unit {
+
+namespace helper {
+
+namespace math {
+
+// brings the std overloads in scope of the unqualified calls below. Without them the
+// trailing return types would pick up eg ::abs(int) for double arguments. Magnitude types
+// from other namespaces are still found by adl.
+using std::abs;
+using std::sqrt;
+using std::pow;
+
+template <typename T>
+constexpr auto abs_impl(T const& v) -> decltype(abs(v)) {
+    return abs(v);
+}
+
+template <typename T>
+constexpr auto sqrt_impl(T const& v) -> decltype(sqrt(v)) {
+    return sqrt(v);
+}
+
+template <typename power, typename T>
+struct Pow {
+    using result_type = decltype(pow(std::declval<T const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static constexpr result_type apply(T const& v) {
+        return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    }
+};
+
+// complex fast paths: std::pow(complex, double) goes through exp and log,
+// small integer and half powers are done by multiplication and sqrt instead.
+// v is already converted to the result type, eg complex<float> to complex<double>
+template <typename C, std::intmax_t num, std::intmax_t den>
+struct ComplexPow {
+    static C apply(C const& v) { return pow(v, static_cast<double>(num) / static_cast<double>(den)); }
+};
+
+template <typename C>
+struct ComplexPow<C, 0, 1> {
+    static C apply(C const&) { return C{1}; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 1> {
+    static C apply(C const& v) { return v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 2, 1> {
+    static C apply(C const& v) { return v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 1> {
+    static C apply(C const& v) { return v * v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 4, 1> {
+    static C apply(C const& v) { return (v * v) * (v * v); }
+};
+
+template <typename C>
+struct ComplexPow<C, -1, 1> {
+    static C apply(C const& v) { return C{1} / v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 2> {
+    static C apply(C const& v) { return sqrt(v); }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 2> {
+    static C apply(C const& v) { return v * sqrt(v); }
+};
+
+template <typename power, typename T>
+struct Pow<power, std::complex<T>> {
+    using result_type = decltype(pow(std::declval<std::complex<T> const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static result_type apply(std::complex<T> const& v) {
+        return ComplexPow<result_type, power::num, power::den>::apply(result_type{v});
+    }
+};
+}
+
+}
 
 template <typename U, typename T>
 constexpr auto
 abs(Quantity<U, T> const& q)
-        -> Quantity<U, decltype(abs(q.magnitude()))>
+        -> Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>
 {
-    using std::abs;
-    return Quantity<U, decltype(abs(q.magnitude()))>{
-                                abs(q.magnitude())};
+    return Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>{
+                                helper::math::abs_impl(q.magnitude())};
 }
 
 template <typename U, typename T>
 constexpr auto
 sqrt(Quantity<U, T> const& q)
-        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>
+        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>
 {
-    using std::sqrt;
-    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>{
-                                                               sqrt(q.magnitude())};
+    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>{
+                                                               helper::math::sqrt_impl(q.magnitude())};
 }
 
 namespace helper {
@@ -265,18 +649,17 @@ namespace helper {
 template <typename power, typename T>
 constexpr auto
 pow_impl(T const& v)
- -> decltype(pow(v, static_cast<double>(power::num) / static_cast<double>(power::den)))
+ -> typename math::Pow<power, T>::result_type
 
 {
-    using std::pow;
-    return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    return math::Pow<power, T>::apply(v);
 }
 
 }
 
 template <typename power, typename U, typename T>
 constexpr auto
-pow(Quantity<U, T> const& q)
+pow(Quantity<U, T> const& q)  // cmath pow function has dynamic exponent and therefore dynamic return unit type and therefore cannot be realized by Quantity
         -> Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>
 {
     return Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>{
@@ -301,9 +684,10 @@ square(Quantity<U, T> const& q)
                                                  q.magnitude() * q.magnitude()};
 }
 
+}
 
-
-
+// src/unit/unitScaling.h
+namespace unit {
 namespace helper {
 
 template <typename ratioIn, typename ratioOut, typename T>
@@ -333,40 +717,43 @@ template<typename T> constexpr T giga(T const& v) { return helper::rescaleTo1<st
 template<typename T> constexpr T tera(T const& v) { return helper::rescaleTo1<std::tera>(v); }
 template<typename T> constexpr T peta(T const& v) { return helper::rescaleTo1<std::peta>(v); }
 
+}
 
-namespace u {
-
+// src/quantity/quantityDefinitionsMinimalExample.h
+namespace unit {
 
-using unitless = BaseUnit<-1, 0>;
-using foo = BaseUnit<0, 0>;
+namespace u {
 
+// base units
+using unitless = BaseUnit<-1, 0>;  // == Unit<0>
+using foo = BaseUnit<0, 0>;        // == Unit<1>
 
+// derived units
 using foo_inv = quotient_unit<unitless, foo>;
 }
 
 namespace t {
 
-
+// base units
 using unitless = Quantity<u::unitless>;
 using foo = Quantity<u::foo>;
 
-
+// derived units
 using foo_inv = Quantity<u::foo_inv>;
 }
 
-constexpr t::unitless number{1};
-constexpr t::foo foo{1};
-constexpr t::foo_inv foo_inv{1};
+UNIT_CONSTANT t::unitless number{1};
+UNIT_CONSTANT      t::foo foo{1};
+UNIT_CONSTANT  t::foo_inv foo_inv{1};
 
 namespace literals {
 
-
-constexpr t::unitless operator"" _n ( long double v ) {return t::unitless {static_cast<double>(v)};}
-constexpr t::foo operator"" _foo ( long double v ) {return t::foo {static_cast<double>(v)};}
+//base units
+constexpr   t::unitless operator""   _n ( long double v )  {return    t::unitless {static_cast<double>(v)};}
+constexpr        t::foo operator"" _foo ( long double v )  {return         t::foo {static_cast<double>(v)};}
 
 }
 }
 
+}// namespace singleFileMinimalExample
 
-
-}
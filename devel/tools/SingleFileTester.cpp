@@ -1,8 +1,12 @@
 #include "SingleFileTester.h"
+#include "SingleFileGenerator.h"
 
 #include "SingleFileSi.h"
 #include "SingleFileMinimalExample.h"
 
+#include <cassert>
+#include <string>
+
 
 
 int run_si(int t) {
@@ -40,10 +44,27 @@ int run_minimalExample(int t) {
 }
 
 
+// the committed single files have to be the ones generated from devel/src
+void check_generated() {
+
+    std::string develDir = __FILE__;
+    develDir = develDir.substr(0, develDir.rfind("tools/SingleFileTester.cpp"));
+    if (develDir.empty()) develDir = ".";
+
+    for(auto const& f:SingleFileGenerator::singleFiles()) {
+        const bool upToDate = SingleFileGenerator::amalgamate(develDir, f)==SingleFileGenerator::readFile(develDir + "/" + f.path);
+        if (!upToDate) std::cerr<<f.path<<" differs from devel/src, run SingleFileGenerator\n";
+        assert(upToDate);
+    }
+}
+
+
 SingleFileTester::SingleFileTester()
 {
 
     run_si(4);
+    run_minimalExample(4);
+    check_generated();
 
     std::cout<<__FILE__<<"\n";
 
@@ -0,0 +1,200 @@
+#include "ExactNumber.h"
+
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+ExactNumber::ExactNumber() : negative(false), den{1} {}
+
+ExactNumber::ExactNumber(std::uint32_t v) : negative(false), den{1}
+{
+    if (v != 0) num.push_back(v);
+}
+
+ExactNumber ExactNumber::parse(const std::string &decimal)
+{
+    ExactNumber r;
+    std::size_t i = 0;
+    if (i < decimal.length() && (decimal[i] == '-' || decimal[i] == '+')) r.negative = decimal[i++] == '-';
+
+    int exponent = 0;
+    bool point = false;
+    bool digits = false;
+    for (; i < decimal.length(); ++i) {
+        const char c = decimal[i];
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            r.num = add(multiply(r.num, 10), static_cast<std::uint32_t>(c - '0'));
+            if (point) --exponent;
+            digits = true;
+        } else if (c == '.' && point == false) {
+            point = true;
+        } else {
+            break;
+        }
+    }
+    assert(digits);
+
+    if (i < decimal.length()) {
+        assert(decimal[i] == 'e' || decimal[i] == 'E');
+        char* end = nullptr;
+        exponent += static_cast<int>(std::strtol(decimal.c_str() + i + 1, &end, 10));
+        assert(*end == '\0');
+    }
+
+    if (r.num.empty()) r.negative = false;
+    return r * pow10(exponent);
+}
+
+ExactNumber ExactNumber::pow10(int exponent)
+{
+    ExactNumber r{1};
+    for (int i = 0; i < std::abs(exponent); ++i) r.num = multiply(r.num, 10);
+    return exponent < 0 ? r.inverse() : r;
+}
+
+ExactNumber ExactNumber::operator*(const ExactNumber &r) const
+{
+    // not reduced, the numbers of the generator stay small enough
+    ExactNumber p;
+    p.num = multiply(num, r.num);
+    p.den = multiply(den, r.den);
+    p.negative = p.num.empty() ? false : negative != r.negative;
+    return p;
+}
+
+ExactNumber ExactNumber::inverse() const
+{
+    assert(isZero() == false);
+    ExactNumber r = *this;
+    r.num.swap(r.den);
+    return r;
+}
+
+ExactNumber ExactNumber::pow(int exponent) const
+{
+    ExactNumber r{1};
+    const ExactNumber base = exponent < 0 ? inverse() : *this;
+    for (int i = 0; i < std::abs(exponent); ++i) r = r * base;
+    return r;
+}
+
+bool ExactNumber::isZero() const
+{
+    return num.empty();
+}
+
+double ExactNumber::toDouble() const
+{
+    if (isZero()) return 0.0;
+
+    // q = num / den * 2^shift with 55 or 56 bits, enough for the rounding bit
+    const int shift = 55 - (static_cast<int>(bitLength(num)) - static_cast<int>(bitLength(den)));
+    Digits remainder = shift > 0 ? shiftLeft(num, static_cast<std::size_t>(shift)) : num;
+    const Digits divisor = shift < 0 ? shiftLeft(den, static_cast<std::size_t>(-shift)) : den;
+
+    std::uint64_t q = 0;
+    for (int bit = 57; bit >= 0; --bit) {
+        const Digits d = shiftLeft(divisor, static_cast<std::size_t>(bit));
+        if (compare(remainder, d) >= 0) {
+            remainder = subtract(remainder, d);
+            q |= std::uint64_t{1} << bit;
+        }
+    }
+
+    int extra = 0;
+    while ((q >> extra) >= (std::uint64_t{1} << 53)) ++extra;
+    std::uint64_t mantissa = q >> extra;
+    const std::uint64_t dropped = q & ((std::uint64_t{1} << extra) - 1);
+    const std::uint64_t half = std::uint64_t{1} << (extra - 1);
+    const bool sticky = remainder.empty() == false;
+    if (dropped > half || (dropped == half && (sticky || (mantissa & 1) == 1))) ++mantissa;
+
+    const double magnitude = std::ldexp(static_cast<double>(mantissa), extra - shift);
+    return negative ? -magnitude : magnitude;
+}
+
+void ExactNumber::trim(Digits &a)
+{
+    while (a.empty() == false && a.back() == 0) a.pop_back();
+}
+
+int ExactNumber::compare(const Digits &a, const Digits &b)
+{
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    for (std::size_t i = a.size(); i-- > 0;)
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    return 0;
+}
+
+ExactNumber::Digits ExactNumber::multiply(const Digits &a, const Digits &b)
+{
+    if (a.empty() || b.empty()) return Digits{};
+    Digits r(a.size() + b.size(), 0);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            const std::uint64_t t = std::uint64_t{a[i]} * b[j] + r[i + j] + carry;
+            r[i + j] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+        r[i + b.size()] = static_cast<std::uint32_t>(carry);
+    }
+    trim(r);
+    return r;
+}
+
+ExactNumber::Digits ExactNumber::multiply(const Digits &a, std::uint32_t b)
+{
+    return multiply(a, Digits{b});
+}
+
+ExactNumber::Digits ExactNumber::add(const Digits &a, std::uint32_t b)
+{
+    Digits r = a;
+    std::uint64_t carry = b;
+    for (std::size_t i = 0; i < r.size() && carry != 0; ++i) {
+        const std::uint64_t t = std::uint64_t{r[i]} + carry;
+        r[i] = static_cast<std::uint32_t>(t);
+        carry = t >> 32;
+    }
+    if (carry != 0) r.push_back(static_cast<std::uint32_t>(carry));
+    return r;
+}
+
+ExactNumber::Digits ExactNumber::subtract(const Digits &a, const Digits &b)
+{
+    Digits r = a;
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        std::int64_t t = std::int64_t{r[i]} - borrow - (i < b.size() ? std::int64_t{b[i]} : 0);
+        borrow = t < 0 ? 1 : 0;
+        if (t < 0) t += std::int64_t{1} << 32;
+        r[i] = static_cast<std::uint32_t>(t);
+    }
+    assert(borrow == 0);
+    trim(r);
+    return r;
+}
+
+ExactNumber::Digits ExactNumber::shiftLeft(const Digits &a, std::size_t bits)
+{
+    if (a.empty()) return a;
+    Digits r(bits / 32, 0);
+    const unsigned s = bits % 32;
+    std::uint32_t carry = 0;
+    for (auto d : a) {
+        r.push_back(s == 0 ? d : (d << s) | carry);
+        carry = s == 0 ? 0 : d >> (32 - s);
+    }
+    if (carry != 0) r.push_back(carry);
+    return r;
+}
+
+std::size_t ExactNumber::bitLength(const Digits &a)
+{
+    if (a.empty()) return 0;
+    std::size_t bits = 32 * (a.size() - 1);
+    for (std::uint32_t top = a.back(); top != 0; top >>= 1) ++bits;
+    return bits;
+}
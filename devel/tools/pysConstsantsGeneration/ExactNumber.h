@@ -0,0 +1,49 @@
+#ifndef EXACTNUMBER_H
+#define EXACTNUMBER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * exact rational number with arbitrary precision, so that constants derived from other constants
+ * are rounded once when they are written and not after every multiplication
+ */
+class ExactNumber
+{
+public:
+    ExactNumber(); // 0
+    ExactNumber(std::uint32_t v);
+
+    // decimal like "-192.0155714e-12"
+    static ExactNumber parse(std::string const& decimal);
+    static ExactNumber pow10(int exponent);
+
+    ExactNumber operator*(ExactNumber const& r) const;
+    ExactNumber inverse() const;
+    ExactNumber pow(int exponent) const;
+
+    bool isZero() const;
+
+    // the nearest double, ties to even
+    double toDouble() const;
+
+private:
+    // little endian 32 bit digits without leading zeros, zero is empty
+    using Digits = std::vector<std::uint32_t>;
+
+    static void trim(Digits& a);
+    static int compare(Digits const& a, Digits const& b);
+    static Digits multiply(Digits const& a, Digits const& b);
+    static Digits multiply(Digits const& a, std::uint32_t b);
+    static Digits add(Digits const& a, std::uint32_t b);
+    static Digits subtract(Digits const& a, Digits const& b); // a >= b
+    static Digits shiftLeft(Digits const& a, std::size_t bits);
+    static std::size_t bitLength(Digits const& a);
+
+    bool negative;
+    Digits num;
+    Digits den;
+};
+
+#endif // EXACTNUMBER_H
@@ -1,12 +1,17 @@
 #include "NistConstantsGenerator.h"
 #include "nistConstantsCout.h"
 
+#include <src/unit/unitSymbolTable.h>
+
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <cassert>
 #include <algorithm>
 #include <cstdio>
+#include <functional>
+#include <queue>
+#include <unordered_map>
 
 NistConstantsGenerator::NistConstantsGenerator()
 {
@@ -14,7 +19,7 @@ NistConstantsGenerator::NistConstantsGenerator()
 
     const std::string cdir = "../devel/tools/pysConstsantsGeneration";
     const std::string inFile = cdir + "/allascii.txt";
-    const std::string outFile = cdir + "/generated/physicalConstants.h";
+    const std::string outDir = cdir + "/generated";
 
     std::cout<<"generating physical constants from " << inFile << "\n";
 
@@ -25,7 +30,7 @@ NistConstantsGenerator::NistConstantsGenerator()
 
     auto defintions = toDefintions(raw_lines_no_hdr);
 
-    writeCpp(outFile, httpSource, defintions);
+    writeCpp(outDir, httpSource, defintions);
 }
 
 NistConstantsGenerator::RawLines NistConstantsGenerator::readTxt(const std::string &file)
@@ -76,45 +81,278 @@ NistConstantsGenerator::PysDefinitions NistConstantsGenerator::toDefintions(cons
     return d;
 }
 
-void NistConstantsGenerator::writeCpp(std::string const& outfile, std::string const& httpSource, const NistConstantsGenerator::PysDefinitions &defintions)
+NistConstantsGenerator::Domain NistConstantsGenerator::domainOf(const NistDefinition &d)
 {
-    std::ofstream myfile(outfile);
-    if (myfile.is_open() == false)
+    std::string const& name = d.name();
+
+    const std::string relationship = "_relationship";
+    if (name.length()>relationship.length() && name.compare(name.length()-relationship.length(), relationship.length(), relationship)==0)
+        return relationships;
+    if (name=="electron_volt") return universal;
+
+    const std::vector<std::pair<Domain,std::string>> prefixes {
+        {atomic,"atomic_unit_of_"}, {atomic,"Bohr_radius"}, {atomic,"Hartree_energy"}, {atomic,"Rydberg_constant"},
+        {atomic,"fine_structure"}, {atomic,"inverse_fine_structure"}, {atomic,"classical_electron_radius"}, {atomic,"Thomson_cross_section"},
+
+        {electromagnetic,"elementary_charge"}, {electromagnetic,"mag_constant"}, {electromagnetic,"electric_constant"},
+        {electromagnetic,"characteristic_impedance"}, {electromagnetic,"Josephson"}, {electromagnetic,"von_Klitzing"},
+        {electromagnetic,"conventional_value_of"}, {electromagnetic,"conductance_quantum"}, {electromagnetic,"inverse_of_conductance_quantum"},
+        {electromagnetic,"mag_flux_quantum"}, {electromagnetic,"Bohr_magneton"}, {electromagnetic,"nuclear_magneton"}, {electromagnetic,"Faraday_constant"},
+
+        {nuclear,"electron_"}, {nuclear,"proton_"}, {nuclear,"neutron_"}, {nuclear,"muon_"}, {nuclear,"tau_"}, {nuclear,"deuteron_"},
+        {nuclear,"triton_"}, {nuclear,"helion_"}, {nuclear,"alpha_particle_"}, {nuclear,"shielded_"}, {nuclear,"atomic_mass_"},
+        {nuclear,"Compton_wavelength"}, {nuclear,"Fermi_coupling"}, {nuclear,"weak_mixing"}
+    };
+
+    for(auto const& p:prefixes)
+        if (name.compare(0, p.second.length(), p.second)==0) return p.first;
+
+    return universal;
+}
+
+std::string NistConstantsGenerator::headerOf(NistConstantsGenerator::Domain domain)
+{
+    switch (domain) {
+        case universal: return "physicalConstantsUniversal.h";
+        case electromagnetic: return "physicalConstantsElectromagnetic.h";
+        case atomic: return "physicalConstantsAtomic.h";
+        case nuclear: return "physicalConstantsNuclear.h";
+        case relationships: return "physicalConstantsRelationships.h";
+        default: break;
+    }
+    assert(false);
+    return "";
+}
+
+void NistConstantsGenerator::writeCpp(std::string const& generatedDir, std::string const& httpSource, const NistConstantsGenerator::PysDefinitions &defintions)
+{
+    const auto order = dependencyOrder(defintions);
+    const auto evaluated = evaluate(defintions, order);
+
+    for(int di = 0; di<domainCount; ++di) {
+        const Domain domain = static_cast<Domain>(di);
+
+        std::ofstream myfile(generatedDir + "/" + headerOf(domain));
+        if (myfile.is_open() == false)
+            assert(false);
+        toCppCode(myfile, httpSource, domain, defintions, evaluated, order);
+    }
+
+    std::ofstream uncertainties(generatedDir + "/physicalConstantsUncertainties.h");
+    if (uncertainties.is_open() == false)
+        assert(false);
+    toCppCodeUncertainties(uncertainties, httpSource, defintions, evaluated, order);
+
+    std::ofstream registry(generatedDir + "/physicalConstantsRegistry.h");
+    if (registry.is_open() == false)
         assert(false);
+    toCppCodeRegistry(registry, httpSource, defintions, evaluated);
 
-    toCppCode(myfile,httpSource, defintions);
-    //toCppCode(std::cout,httpSource, defintions);
+    std::ofstream umbrella(generatedDir + "/physicalConstants.h");
+    if (umbrella.is_open() == false)
+        assert(false);
+    toCppCodeUmbrella(umbrella, httpSource);
 }
 
-void NistConstantsGenerator::toCppCode(std::ostream &s, std::string const& httpSource, const NistConstantsGenerator::PysDefinitions &defintions)
+void NistConstantsGenerator::toCppCode(std::ostream &s, std::string const& httpSource, Domain domain, const NistConstantsGenerator::PysDefinitions &defintions, Evaluations const& evaluated, std::vector<std::size_t> const& order)
 {
     const bool uncertainty = true;
 
     toCppCodeConstantsPrefix(s, httpSource);
-    forEachUnused(std::list<NistDefinition>{defintions.begin(),defintions.end()}, [&s](NistDefinition const& d){ d.toCppStatement(s,!uncertainty);});
+    for(auto i:order)
+        if (domainOf(defintions[i])==domain) defintions[i].toCppStatement(s,evaluated[i].value,evaluated[i].exponents,!uncertainty);
+    toCppCodeConstantsSuffix(s);
+}
+
+void NistConstantsGenerator::toCppCodeUncertainties(std::ostream &s, std::string const& httpSource, const NistConstantsGenerator::PysDefinitions &defintions, Evaluations const& evaluated, std::vector<std::size_t> const& order)
+{
+    const bool uncertainty = true;
 
+    toCppCodeConstantsPrefix(s, httpSource);
     toCppCodeUncertaintiesPrefix(s);
-    forEachUnused(std::list<NistDefinition>{defintions.begin(),defintions.end()}, [&s](NistDefinition const& d){ d.toCppStatement(s,uncertainty);});
+    for(auto i:order) defintions[i].toCppStatement(s,evaluated[i].uncertainty,evaluated[i].exponents,uncertainty);
     toCppCodeUncertaintiesSuffix(s);
-
     toCppCodeConstantsSuffix(s);
 }
 
-
-void NistConstantsGenerator::toCppCodeConstantsPrefix(std::ostream &s, std::string const& httpSource)
+void NistConstantsGenerator::toCppCodeUmbrella(std::ostream &s, std::string const& httpSource)
 {
     s<<"#pragma once\n";
     s<<"\n";
     s<<"/**********************generated from " << httpSource << "**********************/\n";
     s<<"\n";
+    s<<"// all constants, include the headers of single domains to compile less\n";
+    s<<"\n";
     s<<"#include <src/quantity/quantityDefinitionsSI.h>\n";
-    s<<"//#include \"units.h\"\n";
+    for(int di = 0; di<domainCount; ++di)
+        s<<"#include \"" << headerOf(static_cast<Domain>(di)) << "\"\n";
+    s<<"#include \"physicalConstantsUncertainties.h\"\n";
+}
+
+
+void NistConstantsGenerator::toCppCodeRegistry(std::ostream &s, std::string const& httpSource, const NistConstantsGenerator::PysDefinitions &defintions, Evaluations const& evaluated)
+{
+    std::vector<std::size_t> sorted(defintions.size());
+    for(std::size_t i = 0; i<sorted.size(); ++i) sorted[i] = i;
+    std::sort(sorted.begin(), sorted.end(), [&defintions](std::size_t l, std::size_t r) { return defintions[l].name()<defintions[r].name(); });
+
+    std::vector<std::string> names;
+    for(auto i:sorted) names.push_back(defintions[i].name());
+    assert(std::adjacent_find(names.begin(), names.end())==names.end()); //unique names
+
+    // the same minimal perfect hash as the unit catalog, slots index the sorted entries
+    std::vector<unit::helper::hash::THash> hashes;
+    for(auto const& n:names) hashes.push_back(unit::helper::hash::murmur3(n.data(), n.size()));
+    std::vector<unit::helper::hash::THash> displacements;
+    std::vector<std::size_t> slots;
+    const bool separated = unit::helper::hash::displace(hashes, displacements, slots);
+    assert(separated); //names with equal hashes cannot be separated
+    (void)separated;
+
+    s<<"#pragma once\n";
+    s<<"\n";
+    s<<"/**********************generated from " << httpSource << "**********************/\n";
+    s<<"\n";
+    s<<"#include <src/quantity/Quantity.h>\n";
+    s<<"#include <src/unit/Unit.h>\n";
+    s<<"#include <src/unit/unitHash.h>\n";
+    s<<"\n";
+    s<<"#include <cstddef>\n";
+    s<<"#include <cstdint>\n";
+    s<<"#include <cstring>\n";
+    s<<"#include <string>\n";
     s<<"\n";
     s<<"\n";
     s<<"namespace unit {\n";
     s<<"namespace physicalConstant{\n";
+    s<<"namespace registry{\n";
+    s<<"\n";
+    s<<"// exponents of meter, kilogram, second, ampere, kelvin, mole and candela, 8 bit each from the lowest byte on\n";
+    s<<"using packed_exponents = std::uint64_t;\n";
+    s<<"\n";
+    s<<"// a constant in coherent si units\n";
+    s<<"struct entry {\n";
+    s<<"    char const* name;\n";
+    s<<"    double magnitude;\n";
+    s<<"    double uncertainty;\n";
+    s<<"    packed_exponents exponents;\n";
+    s<<"\n";
+    s<<"    int exponent(std::size_t i) const { return static_cast<std::int8_t>((exponents >> (8 * i)) & 0xff); }\n";
+    s<<"};\n";
+    s<<"\n";
+    s<<"}// namespace registry\n";
+    s<<"}// namespace physicalConstant\n";
+    s<<"\n";
+    s<<"namespace helper {\n";
+    s<<"namespace constantsRegistry {\n";
+    s<<"\n";
+    s<<"constexpr std::size_t entryCount = " << names.size() << ";\n";
+    s<<"constexpr std::size_t bucketCount = " << displacements.size() << ";\n";
+    s<<"\n";
+    s<<"// sorted by name\n";
+    s<<"inline physicalConstant::registry::entry const* entries() {\n";
+    s<<"    static const physicalConstant::registry::entry e[entryCount] = {\n";
+    for(auto i:sorted) {
+        std::uint64_t packed = 0;
+        for(std::size_t e = 0; e<evaluated[i].exponents.size(); ++e) {
+            assert(evaluated[i].exponents[e]>=-128 && evaluated[i].exponents[e]<=127);
+            packed |= std::uint64_t{static_cast<std::uint8_t>(evaluated[i].exponents[e])} << (8*e);
+        }
+        char hex[32];
+        std::snprintf(hex, sizeof(hex), "0x%014llx", static_cast<unsigned long long>(packed));
+        s<<"        {\"" << defintions[i].name() << "\", " << NistDefinition::cppLiteral(evaluated[i].value) << ", "
+         << NistDefinition::cppLiteral(evaluated[i].uncertainty) << ", " << hex << "},\n";
+    }
+    s<<"    };\n";
+    s<<"    return e;\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"inline helper::hash::THash const* displacements() {\n";
+    s<<"    static const helper::hash::THash d[bucketCount] = {";
+    for(std::size_t i = 0; i<displacements.size(); ++i) s<<(i%12==0 ? "\n        " : " ") << displacements[i] << "u,";
+    s<<"\n    };\n";
+    s<<"    return d;\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"// index into entries() for every hash slot\n";
+    s<<"inline std::uint16_t const* slots() {\n";
+    s<<"    static const std::uint16_t d[entryCount] = {";
+    for(std::size_t i = 0; i<slots.size(); ++i) s<<(i%16==0 ? "\n        " : " ") << slots[i] << ",";
+    s<<"\n    };\n";
+    s<<"    return d;\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"template <typename U, std::size_t i = 0, bool = (i < U::exponent_count())>\n";
+    s<<"struct Packed {\n";
+    s<<"    static_assert(U::exponent_count() <= 7, \"the registry knows the seven si base units only\");\n";
+    s<<"    static constexpr physicalConstant::registry::packed_exponents value =\n";
+    s<<"        (physicalConstant::registry::packed_exponents{static_cast<std::uint8_t>(U::template exponent_value<i>())} << (8 * i)) | Packed<U, i + 1>::value;\n";
+    s<<"};\n";
+    s<<"\n";
+    s<<"template <typename U, std::size_t i>\n";
+    s<<"struct Packed<U, i, false> {\n";
+    s<<"    static constexpr physicalConstant::registry::packed_exponents value = 0;\n";
+    s<<"};\n";
+    s<<"}\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"namespace physicalConstant{\n";
+    s<<"namespace registry{\n";
+    s<<"\n";
+    s<<"inline std::size_t size() { return helper::constantsRegistry::entryCount; }\n";
+    s<<"inline entry const* begin() { return helper::constantsRegistry::entries(); }\n";
+    s<<"inline entry const* end() { return begin() + size(); }\n";
+    s<<"\n";
+    s<<"/**\n";
+    s<<" * the constant with the given name or nullptr, in constant time:\n";
+    s<<" *\n";
+    s<<" *     entry const* c = registry::find(\"speed_of_light_in_vacuum\");\n";
+    s<<" */\n";
+    s<<"inline entry const* find(char const* name, std::size_t length) {\n";
+    s<<"    namespace r = helper::constantsRegistry;\n";
+    s<<"    entry const& e = r::entries()[r::slots()[helper::hash::slot(helper::hash::murmur3(name, length), r::displacements(), r::bucketCount, r::entryCount)]];\n";
+    s<<"    return std::strlen(e.name) == length && std::memcmp(e.name, name, length) == 0 ? &e : nullptr;\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"inline entry const* find(std::string const& name) { return find(name.data(), name.length()); }\n";
+    s<<"\n";
+    s<<"template <typename U>\n";
+    s<<"constexpr packed_exponents pack() {\n";
+    s<<"    return helper::constantsRegistry::Packed<U>::value;\n";
+    s<<"}\n";
+    s<<"\n";
+    s<<"/**\n";
+    s<<" * the constant as quantity, false if it is unknown or has another unit. q is unchanged then.\n";
+    s<<" *\n";
+    s<<" *     Quantity<Unit<1, 0, -1, 0, 0, 0, 0>> c;\n";
+    s<<" *     bool found = registry::get(\"speed_of_light_in_vacuum\", c);\n";
+    s<<" */\n";
+    s<<"template <typename U, typename T>\n";
+    s<<"bool get(std::string const& name, Quantity<U, T>& q) {\n";
+    s<<"    entry const* e = find(name);\n";
+    s<<"    if (e == nullptr || e->exponents != pack<U>()) return false;\n";
+    s<<"    q = Quantity<U, T>{static_cast<T>(e->magnitude)};\n";
+    s<<"    return true;\n";
+    s<<"}\n";
     s<<"\n";
-    s<<"using namespace literals;\n";
+    s<<"}// namespace registry\n";
+    s<<"}// namespace physicalConstant\n";
+    s<<"}// namespace unit\n";
+}
+
+void NistConstantsGenerator::toCppCodeConstantsPrefix(std::ostream &s, std::string const& httpSource)
+{
+    // the constants are evaluated by the generator, so only the types are needed
+    s<<"#pragma once\n";
+    s<<"\n";
+    s<<"/**********************generated from " << httpSource << "**********************/\n";
+    s<<"\n";
+    s<<"#include <src/quantity/Quantity.h>\n";
+    s<<"#include <src/unit/Unit.h>\n";
+    s<<"\n";
+    s<<"\n";
+    s<<"namespace unit {\n";
+    s<<"namespace physicalConstant{\n";
     s << "\n";
 }
 
@@ -144,28 +382,72 @@ void NistConstantsGenerator::toCppCodeUncertaintiesSuffix(std::ostream &s)
     s << "}// namespace uncertaintiy\n";
 }
 
-std::list<NistDefinition>::const_iterator NistConstantsGenerator::findUnused(const std::list<NistDefinition> &defintions)
+std::vector<std::size_t> NistConstantsGenerator::dependencyOrder(const NistConstantsGenerator::PysDefinitions &defintions)
 {
-    for(auto candiate = defintions.begin(); candiate!=defintions.end(); ++candiate)
-    {
-        const bool candidateUsesOthers =
-            std::find_if(defintions.begin(), defintions.end(),
-                         [candiate](NistDefinition const& other) { return candiate->uses(other); }) != defintions.end();
-
-        if (candidateUsesOthers==false) return candiate;
+    // kahn's algorithm on the graph of uses, built once from the identifiers of every unit
+    std::unordered_map<std::string, std::size_t> byName;
+    for(std::size_t i = 0; i<defintions.size(); ++i)
+        byName.emplace(defintions[i].name(), i);
+
+    std::vector<std::vector<std::size_t>> users(defintions.size());
+    std::vector<std::size_t> pending(defintions.size(), 0);
+    for(std::size_t i = 0; i<defintions.size(); ++i)
+        for(auto const& id:defintions[i].identifiers()) {
+            auto used = byName.find(id);
+            if (used==byName.end() || used->second==i) continue;
+            users[used->second].push_back(i);
+            ++pending[i];
+        }
+
+    // the lowest ready index first keeps the order of the table where the uses allow it
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+    for(std::size_t i = 0; i<defintions.size(); ++i)
+        if (pending[i]==0) ready.push(i);
+
+    std::vector<std::size_t> order;
+    order.reserve(defintions.size());
+    while(ready.empty()==false) {
+        const std::size_t i = ready.top();
+        ready.pop();
+        order.push_back(i);
+        for(auto user:users[i])
+            if (--pending[user]==0) ready.push(user);
     }
-    return defintions.end();
-}
 
+    assert(order.size()==defintions.size()); //cyclic uses
+    return order;
+}
 
-void NistConstantsGenerator::forEachUnused(std::list<NistDefinition> defintions, std::function<void(NistDefinition const&)> f)
+NistConstantsGenerator::Evaluations NistConstantsGenerator::evaluate(const NistConstantsGenerator::PysDefinitions &defintions, std::vector<std::size_t> const& order)
 {
-    while(defintions.empty()==false){
-        auto unused = findUnused(defintions);
-        assert(unused!=defintions.end());
-        f(*unused);
-        defintions.erase(unused);
+    // units like MeV or u refer to other constants, their exact values are known before they are used
+    std::unordered_map<std::string, std::size_t> byName;
+    for(std::size_t i = 0; i<defintions.size(); ++i)
+        byName.emplace(defintions[i].name(), i);
+
+    std::vector<ExactNumber> exact(defintions.size());
+    Evaluations evaluated(defintions.size());
+
+    for(auto i:order) {
+        ExactNumber scale{1};
+        NistDefinition::Exponents exponents{};
+
+        for(auto const& f:defintions[i].unitFactors()) {
+            auto const& symbol = NistDefinition::unitSymbol(f.symbol);
+            scale = scale * ExactNumber::pow10(symbol.exp10 * f.exponent);
+            for(std::size_t e = 0; e<exponents.size(); ++e) exponents[e] += symbol.exponents[e] * f.exponent;
+
+            if (symbol.constant.length()==0) continue;
+            auto used = byName.find(symbol.constant);
+            assert(used!=byName.end());
+            scale = scale * exact[used->second].pow(f.exponent);
+            for(std::size_t e = 0; e<exponents.size(); ++e) exponents[e] += evaluated[used->second].exponents[e] * f.exponent;
+        }
+
+        exact[i] = ExactNumber::parse(defintions[i].valueText()) * scale;
+        const ExactNumber uncertainty = ExactNumber::parse(defintions[i].uncertaintyText()) * scale;
+        evaluated[i] = Evaluated{exact[i].toDouble(), uncertainty.toDouble(), exponents};
     }
-}
-
 
+    return evaluated;
+}
@@ -2,11 +2,12 @@
 #define PHYCONSTANTSGENERATOR_H
 
 #include "NistDefinition.h"
+#include "ExactNumber.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <list>
-#include <functional>
 
 
 class NistConstantsGenerator
@@ -14,6 +15,21 @@ class NistConstantsGenerator
 public:
     NistConstantsGenerator();
 
+    using PysDefinitions = std::vector<NistDefinition>;
+
+    // indices of the definitions, every definition comes after the ones it uses
+    static std::vector<std::size_t> dependencyOrder(PysDefinitions const& defintions);
+
+    // a constant in coherent si units, computed exactly from the listing and rounded once
+    struct Evaluated {
+        double value;
+        double uncertainty;
+        NistDefinition::Exponents exponents;
+    };
+    using Evaluations = std::vector<Evaluated>;
+
+    static Evaluations evaluate(PysDefinitions const& defintions, std::vector<std::size_t> const& order);
+
 private:
 
 
@@ -22,22 +38,26 @@ private:
     static RawLines readTxt(std::string const& file);
     static RawLines removeHeader(RawLines const& linesWithHeader, std::string& httpSource);
 
-    using PysDefinitions = std::vector<NistDefinition>;
     static PysDefinitions toDefintions(RawLines const& rawDefinitions);
 
-    static void writeCpp(std::string const& constantsHdr, std::string const& httpSource, PysDefinitions const& defintions);
+    // the constants are split into headers by domain, so users only compile what they include
+    enum Domain { universal, electromagnetic, atomic, nuclear, relationships, domainCount };
+
+    static Domain domainOf(NistDefinition const& d);
+    static std::string headerOf(Domain domain);
+
+    static void writeCpp(std::string const& generatedDir, std::string const& httpSource, PysDefinitions const& defintions);
 
-    static void toCppCode(std::ostream& s, std::string const& httpSource, PysDefinitions const& defintions);
+    static void toCppCode(std::ostream& s, std::string const& httpSource, Domain domain, PysDefinitions const& defintions, Evaluations const& evaluated, std::vector<std::size_t> const& order);
+    static void toCppCodeUncertainties(std::ostream& s, std::string const& httpSource, PysDefinitions const& defintions, Evaluations const& evaluated, std::vector<std::size_t> const& order);
+    static void toCppCodeUmbrella(std::ostream& s, std::string const& httpSource);
+    static void toCppCodeRegistry(std::ostream& s, std::string const& httpSource, PysDefinitions const& defintions, Evaluations const& evaluated);
 
     static void toCppCodeConstantsPrefix(std::ostream& s, std::string const& httpSource);
     static void toCppCodeConstantsSuffix(std::ostream& s);
     static void toCppCodeUncertaintiesPrefix(std::ostream& s);
     static void toCppCodeUncertaintiesSuffix(std::ostream& s);
 
-    static void forEachUnused(std::list<NistDefinition> defintions, std::function<void(NistDefinition const&)> f);
-
-    static std::list<NistDefinition>::const_iterator findUnused(std::list<NistDefinition> const&  defintions);
-
 };
 
 #endif // PHYCONSTANTSGENERATOR_H
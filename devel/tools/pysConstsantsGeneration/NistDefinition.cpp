@@ -1,11 +1,15 @@
 #include "NistDefinition.h"
 
+#include <src/quantity/quantityFormatting.h>
+
 #include <cassert>
 #include <vector>
 #include <istream>
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <cctype>
+#include <cstdlib>
 
 std::string replaceAll(std::string str, const std::string& from, const std::string& to) {
     size_t start_pos = 0;
@@ -32,27 +36,6 @@ std::string removeTrailingWhitespace(std::string str) {
     return str;
 }
 
-using UnitMap = std::vector<std::pair<std::string,std::string>>;
-
-bool hasNoPrefixCollisions(UnitMap const& map) {
-    if (map.size() <= 1)
-        return true;
-
-    const auto forelast = --map.end();
-    auto it = map.begin();
-    for (; it != forelast; ++it)
-        if (std::find_if(it + 1, map.end(), [it](std::pair<std::string, std::string> const& pair) {
-                if (pair.first.find(it->first) != std::string::npos) {
-                    return true;
-                }
-                return false;
-            }) != map.end()) {
-            return true;
-        }
-
-    return false;
-}
-
 std::vector<std::string> splitByWhitespace(std::string str) {
 
     std::istringstream iss(str);
@@ -84,24 +67,68 @@ NistDefinition::NistDefinition(const std::string &rawLine)
 
 
 
-void NistDefinition::toCppStatement(std::ostream& s, bool uncertainty_) const
+void NistDefinition::toCppStatement(std::ostream& s, double magnitude, Exponents const& exponents, bool uncertainty_) const
 {
-    s << "constexpr auto ";
+    std::string type = "Quantity<Unit<";
+    for (std::size_t i = 0; i < exponents.size(); ++i) type += (i == 0 ? "" : ", ") + std::to_string(exponents[i]);
+    type += ">>";
+
+    s << "UNIT_CONSTANT ";
+    s << type;
+    s << std::string(type.length() < 35 ? 35 - type.length() : 0, ' ');
     s.width(55);
     s << quantity;
-    s <<  " = ";
-    s.width(20);
-    s << (uncertainty_ ? uncertainty : value);
-    s << "_n";
-    s << unitSep(uncertainty_);
-    s << cppUnit(uncertainty_);
-    s << ";\n";
+    s << "{";
+    s << cppLiteral(magnitude);
+    s << "};";
+    s << " // " << (uncertainty_ ? uncertainty : value);
+    if (unitText.length() > 0) s << " " << unitText;
+    s << "\n";
 }
 
 
+std::string NistDefinition::cppLiteral(double v)
+{
+    char literal[unit::helper::formatting::maxLength];
+    std::string number(literal, unit::helper::formatting::shortest(v, literal));
+    if (number.find_first_of(".e") == std::string::npos) number += ".0";
+    return number;
+}
+
 bool NistDefinition::uses(const NistDefinition &other) const
 {
-    return unit.find(other.quantity)!=std::string::npos;
+    const auto ids = identifiers();
+    return std::find(ids.begin(), ids.end(), other.quantity) != ids.end();
+}
+
+const std::string &NistDefinition::name() const
+{
+    return quantity;
+}
+
+const std::string &NistDefinition::valueText() const
+{
+    return value;
+}
+
+const std::string &NistDefinition::uncertaintyText() const
+{
+    return uncertainty;
+}
+
+const std::vector<NistDefinition::UnitFactor> &NistDefinition::unitFactors() const
+{
+    return factors;
+}
+
+std::vector<std::string> NistDefinition::identifiers() const
+{
+    std::vector<std::string> ids;
+    for (auto const& f : factors) {
+        auto const& symbol = unitSymbol(f.symbol);
+        if (symbol.constant.length() > 0) ids.push_back(symbol.constant);
+    }
+    return ids;
 }
 
 void NistDefinition::parseQuantity(std::string v)
@@ -161,29 +188,14 @@ void NistDefinition::parseUnit(std::string v)
     v = removeLeadingWhitespace(v);
     v = removeTrailingWhitespace(v);
 
+    unitText = v;
+
     auto s = splitByWhitespace(v);
 
     for(auto const& u:s)
         addUnit(u);
 }
 
-const char *NistDefinition::unitSep(bool uncertainty_) const
-{
-    if (unit.length()<=0) return "";
-    if (uncertainty_) return " * ";
-
-    const bool hasOperator = unit.substr(0,2)==" /";
-
-    return hasOperator ? "" : " * ";
-}
-
-std::string NistDefinition::cppUnit(bool ofUncertainty) const
-{
-    if (unit.length()<=0) return "";
-    if (ofUncertainty) return std::string("decltype(physicalConstant::") + quantity + ")::classtype{1}";
-    return unit;
-}
-
 void NistDefinition::addUnit(std::string factor)
 {
 
@@ -210,76 +222,50 @@ void NistDefinition::addUnit(std::string factor)
 
     auto expPos = factor.find("^");
     const std::string factorUnit = factor.substr(0,expPos); //"mol"
-    const std::string factorExponent = expPos==std::string::npos?std::string() : factor.substr(expPos+1); //"^-2"
-
-    UnitMap const& replaceMap{ //correct order will be checked later
-
-        {"MeV","mega(electron_volt)"},
-        {"GeV","giga(electron_volt)"},
-        {"ohm","ohm"},
-        {"mol","mole"},
-        {"MHz","mega(hertz)"},
-        {"E_h","hartree_electron_volt_relationship"},
-        {"eV","electron_volt"},
-        {"kg","kilogram"},
-        {"Wb","weber"},
-        {"fm","femto(meter)"},
-        {"Pa","pascal"},
-        {"Hz","hertz"},
-        {"sr","steradian"},
-        {"u","unified_atomic_mass_unit"},
-        {"J","joule"},
-        {"m","meter"},
-        {"K","kelvin"},
-        {"C","coulomb"},
-        {"s","second"},
-        {"A","ampere"},
-        {"V","volt"},
-        {"N","newton"},
-        {"T","tesla"},
-        {"F","farad"},
-        {"S","siemens"},
-        {"W","watt"},
-        {"c","speed_of_light_in_vacuum"}
-    };
-
-    assert(hasNoPrefixCollisions(replaceMap)==false);
-
-
-    for(auto const& replaceRule:replaceMap)
-        if (replaceRule.first==factorUnit) {
-            if (unit.length() > 0 ) unit += " * ";
-            unit += addExponent(replaceRule.second ,factorExponent);
-            unit = replaceAll(unit, "*  /", "/");
-            return;
-        }
-
-    assert(false); //unknown unit
+    const int factorExponent = expPos==std::string::npos ? 1 : std::atoi(factor.c_str()+expPos+1); //-2
 
+    assert(factorExponent!=0);
+    unitSymbol(factorUnit); //asserts on unknown units
 
+    factors.push_back(UnitFactor{factorUnit, factorExponent});
 }
 
-std::string NistDefinition::addExponent(std::string const& u, std::string exponent)
+const NistDefinition::UnitSymbol &NistDefinition::unitSymbol(const std::string &symbol)
 {
-   // u=="mole{1}"
-   // exponent=="-3"
-
-    if (exponent.length()<=0) return u;
-
-    const bool inv = exponent[0]=='-';
-    const std::string invPrefix = inv ? " / " : "";
-
-    if (inv) {
-        exponent = exponent.substr(1);
-    }
-
-    assert(exponent.length()==1);
-
-    if (exponent[0]=='1') return invPrefix + u;
-    if (exponent[0]=='2') return invPrefix + std::string("square( ") + u + " )";
-    if (exponent[0]=='3') return invPrefix + std::string("cube( ") + u + " )";
-    return invPrefix + std::string("pow<std::ratio<") + exponent + ">>( " + u + " )";
+    //                                          m  kg   s   A   K mol cd
+    static const std::vector<UnitSymbol> symbols {
+        {"MeV", 6, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "electron_volt"},
+        {"GeV", 9, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "electron_volt"},
+        {"ohm", 0, Exponents{{ 2,  1, -3, -2,  0,  0,  0}}, ""},
+        {"mol", 0, Exponents{{ 0,  0,  0,  0,  0,  1,  0}}, ""},
+        {"MHz", 6, Exponents{{ 0,  0, -1,  0,  0,  0,  0}}, ""},
+        {"E_h", 0, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "hartree_electron_volt_relationship"},
+        {"eV",  0, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "electron_volt"},
+        {"kg",  0, Exponents{{ 0,  1,  0,  0,  0,  0,  0}}, ""},
+        {"Wb",  0, Exponents{{ 2,  1, -2, -1,  0,  0,  0}}, ""},
+        {"fm", -15,Exponents{{ 1,  0,  0,  0,  0,  0,  0}}, ""},
+        {"Pa",  0, Exponents{{-1,  1, -2,  0,  0,  0,  0}}, ""},
+        {"Hz",  0, Exponents{{ 0,  0, -1,  0,  0,  0,  0}}, ""},
+        {"sr",  0, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, ""},
+        {"u",   0, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "unified_atomic_mass_unit"},
+        {"J",   0, Exponents{{ 2,  1, -2,  0,  0,  0,  0}}, ""},
+        {"m",   0, Exponents{{ 1,  0,  0,  0,  0,  0,  0}}, ""},
+        {"K",   0, Exponents{{ 0,  0,  0,  0,  1,  0,  0}}, ""},
+        {"C",   0, Exponents{{ 0,  0,  1,  1,  0,  0,  0}}, ""},
+        {"s",   0, Exponents{{ 0,  0,  1,  0,  0,  0,  0}}, ""},
+        {"A",   0, Exponents{{ 0,  0,  0,  1,  0,  0,  0}}, ""},
+        {"V",   0, Exponents{{ 2,  1, -3, -1,  0,  0,  0}}, ""},
+        {"N",   0, Exponents{{ 1,  1, -2,  0,  0,  0,  0}}, ""},
+        {"T",   0, Exponents{{ 0,  1, -2, -1,  0,  0,  0}}, ""},
+        {"F",   0, Exponents{{-2, -1,  4,  2,  0,  0,  0}}, ""},
+        {"S",   0, Exponents{{-2, -1,  3,  2,  0,  0,  0}}, ""},
+        {"W",   0, Exponents{{ 2,  1, -3,  0,  0,  0,  0}}, ""},
+        {"c",   0, Exponents{{ 0,  0,  0,  0,  0,  0,  0}}, "speed_of_light_in_vacuum"}
+    };
 
+    auto it = std::find_if(symbols.begin(), symbols.end(), [&symbol](UnitSymbol const& u) { return u.symbol == symbol; });
+    assert(it != symbols.end()); //unknown unit
+    return *it;
 }
 
 bool NistDefinition::isDouble(std::string v)
@@ -1,17 +1,47 @@
 #ifndef PYSDEFINITION_H
 #define PYSDEFINITION_H
 
+#include <array>
 #include <string>
 #include <ostream>
+#include <vector>
 
 class NistDefinition
 {
 public:
     NistDefinition(std::string const& rawLine);
 
-    void toCppStatement(std::ostream& s, bool uncertainty_ = false) const;
+    // exponents of meter, kilogram, second, ampere, kelvin, mole and candela
+    using Exponents = std::array<int, 7>;
+
+    // a unit of the listing, either si with a decimal prefix or another constant
+    struct UnitSymbol {
+        std::string symbol;
+        int exp10;
+        Exponents exponents;
+        std::string constant;
+    };
+
+    struct UnitFactor {
+        std::string symbol;
+        int exponent;
+    };
+
+    static UnitSymbol const& unitSymbol(std::string const& symbol);
+
+    // shortest literal that reads back as v, always with a '.' or an exponent
+    static std::string cppLiteral(double v);
+
+    // magnitude is in coherent si units
+    void toCppStatement(std::ostream& s, double magnitude, Exponents const& exponents, bool uncertainty_ = false) const;
     bool uses(NistDefinition const& other) const;
 
+    std::string const& name() const;
+    std::string const& valueText() const;
+    std::string const& uncertaintyText() const;
+    std::vector<UnitFactor> const& unitFactors() const;
+    std::vector<std::string> identifiers() const; // names of the constants used in the unit
+
 private:
 
    void parseQuantity(std::string v);
@@ -19,18 +49,15 @@ private:
    void parseUncertaintiy(std::string v);
    void parseUnit(std::string v);
 
-   const char* unitSep(bool uncertainty_)const;
-   std::string cppUnit(bool uncertainty_)const;
-
    void addUnit(std::string v);
-   static std::string addExponent(std::string const& u, std::string exponent);
 
    static bool isDouble(std::string v);
 
    std::string quantity;
    std::string value;
    std::string uncertainty;
-   std::string unit;
+   std::string unitText;
+   std::vector<UnitFactor> factors;
 
 };
 
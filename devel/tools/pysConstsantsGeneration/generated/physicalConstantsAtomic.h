@@ -0,0 +1,50 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<-1, -2, 7, 3, 0, 0, 0>>                 atomic_unit_of_1st_hyperpolarizability{3.206361329e-53}; // 3.206361329e-53 C^3 m^3 J^-2
+UNIT_CONSTANT Quantity<Unit<-2, -3, 10, 4, 0, 0, 0>>                 atomic_unit_of_2nd_hyperpolarizability{6.235380085e-65}; // 6.235380085e-65 C^4 m^4 J^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_action{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                  atomic_unit_of_charge{1.6021766208e-19}; // 1.6021766208e-19 C
+UNIT_CONSTANT Quantity<Unit<-3, 0, 1, 1, 0, 0, 0>>                          atomic_unit_of_charge_density{1081202377000.0}; // 1.0812023770e12 C m^-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                                 atomic_unit_of_current{0.006623618183}; // 6.623618183e-3 A
+UNIT_CONSTANT Quantity<Unit<1, 0, 1, 1, 0, 0, 0>>                     atomic_unit_of_electric_dipole_mom{8.478353552e-30}; // 8.478353552e-30 C m
+UNIT_CONSTANT Quantity<Unit<1, 1, -3, -1, 0, 0, 0>>                          atomic_unit_of_electric_field{514220670700.0}; // 5.142206707e11 V m^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, -1, 0, 0, 0>>                 atomic_unit_of_electric_field_gradient{9.717362356e+21}; // 9.717362356e21 V m^-2
+UNIT_CONSTANT Quantity<Unit<0, -1, 4, 2, 0, 0, 0>>                 atomic_unit_of_electric_polarizability{1.6487772731e-41}; // 1.6487772731e-41 C^2 m^2 J^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                      atomic_unit_of_electric_potential{27.21138602}; // 27.21138602 V
+UNIT_CONSTANT Quantity<Unit<2, 0, 1, 1, 0, 0, 0>>                 atomic_unit_of_electric_quadrupole_mom{4.486551484e-40}; // 4.486551484e-40 C m^2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                  atomic_unit_of_energy{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                                   atomic_unit_of_force{8.23872336e-8}; // 8.23872336e-8 N
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                  atomic_unit_of_length{5.2917721067e-11}; // 0.52917721067e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                          atomic_unit_of_mag_dipole_mom{1.854801999e-23}; // 1.854801999e-23 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        atomic_unit_of_mag_flux_density{235051.755}; // 2.350517550e5 T
+UNIT_CONSTANT Quantity<Unit<2, -1, 2, 2, 0, 0, 0>>                         atomic_unit_of_magnetizability{7.8910365886e-29}; // 7.8910365886e-29 J T^-2
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    atomic_unit_of_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_mom_um{1.992851882e-24}; // 1.992851882e-24 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                            atomic_unit_of_permittivity{1.112650056e-10}; // 1.112650056e-10 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                    atomic_unit_of_time{2.418884326509e-17}; // 2.418884326509e-17 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                                atomic_unit_of_velocity{2187691.26277}; // 2.18769126277e6 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                            Bohr_radius{5.2917721067e-11}; // 0.52917721067e-10 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              classical_electron_radius{2.8179403227e-15}; // 2.8179403227e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                fine_structure_constant{0.0072973525664}; // 7.2973525664e-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                         Hartree_energy{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                   Hartree_energy_in_eV{4.359744650080796e-18}; // 27.21138602 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        inverse_fine_structure_constant{137.035999139}; // 137.035999139
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                                       Rydberg_constant{10973731.568508}; // 10973731.568508 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                         Rydberg_constant_times_c_in_Hz{3289841960355000.0}; // 3.289841960355e15 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        Rydberg_constant_times_hc_in_eV{2.1798723248801804e-18}; // 13.605693009 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         Rydberg_constant_times_hc_in_J{2.179872325e-18}; // 2.179872325e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                                  Thomson_cross_section{6.6524587158e-29}; // 0.66524587158e-28 m^2
+
+
+}// namespace physicalConstant
+}// namespace unit
+
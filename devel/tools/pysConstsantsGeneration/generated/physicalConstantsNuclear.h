@@ -0,0 +1,179 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                     alpha_particle_electron_mass_ratio{7294.29954136}; // 7294.29954136
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    alpha_particle_mass{6.64465723e-27}; // 6.644657230e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  alpha_particle_mass_energy_equivalent{5.971920097e-10}; // 5.971920097e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                              alpha_particle_molar_mass{0.004001506179127}; // 4.001506179127e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                       alpha_particle_proton_mass_ratio{3.97259968907}; // 3.97259968907
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   atomic_mass_constant{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 atomic_mass_constant_energy_equivalent{1.492418062e-10}; // 1.492418062e-10 J
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                     Compton_wavelength{2.4263102367e-12}; // 2.4263102367e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           Compton_wavelength_over_2_pi{3.8615926764e-13}; // 386.15926764e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        deuteron_electron_mag_mom_ratio{-0.0004664345535}; // -4.664345535e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           deuteron_electron_mass_ratio{3670.48296785}; // 3670.48296785
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      deuteron_g_factor{0.8574382311}; // 0.8574382311
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       deuteron_mag_mom{4.33073504e-27}; // 0.4330735040e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                deuteron_mag_mom_to_Bohr_magneton_ratio{0.0004669754554}; // 0.4669754554e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             deuteron_mag_mom_to_nuclear_magneton_ratio{0.8574382311}; // 0.8574382311
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          deuteron_mass{3.343583719e-27}; // 3.343583719e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        deuteron_mass_energy_equivalent{3.005063183e-10}; // 3.005063183e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    deuteron_molar_mass{0.002013553212745}; // 2.013553212745e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         deuteron_neutron_mag_mom_ratio{-0.44820652}; // -0.44820652
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          deuteron_proton_mag_mom_ratio{0.3070122077}; // 0.3070122077
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             deuteron_proton_mass_ratio{1.99900750087}; // 1.99900750087
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             deuteron_rms_charge_radius{2.1413e-15}; // 2.1413e-15 m
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_charge_to_mass_quotient{-175882002400.0}; // -1.758820024e11 C kg^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        electron_deuteron_mag_mom_ratio{-2143.923499}; // -2143.923499
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           electron_deuteron_mass_ratio{0.0002724437107484}; // 2.724437107484e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      electron_g_factor{-2.00231930436182}; // -2.00231930436182
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                 electron_gyromag_ratio{176085964400.0}; // 1.760859644e11 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_gyromag_ratio_over_2_pi{28024951640.0}; // 28024.95164 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_helion_mass_ratio{0.0001819543074854}; // 1.819543074854e-4
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       electron_mag_mom{-9.28476462e-24}; // -928.4764620e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_mag_mom_anomaly{0.00115965218091}; // 1.15965218091e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                electron_mag_mom_to_Bohr_magneton_ratio{-1.00115965218091}; // -1.00115965218091
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             electron_mag_mom_to_nuclear_magneton_ratio{-1838.28197234}; // -1838.28197234
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          electron_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        electron_mass_energy_equivalent{8.18710565e-14}; // 8.18710565e-14 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    electron_molar_mass{5.4857990907e-7}; // 5.48579909070e-7 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_muon_mag_mom_ratio{206.766988}; // 206.7669880
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_muon_mass_ratio{0.0048363317}; // 4.83633170e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         electron_neutron_mag_mom_ratio{960.9205}; // 960.92050
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_neutron_mass_ratio{0.00054386734428}; // 5.4386734428e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          electron_proton_mag_mom_ratio{-658.2106866}; // -658.2106866
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_proton_mass_ratio{0.000544617021352}; // 5.44617021352e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                electron_tau_mass_ratio{0.000287592}; // 2.87592e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  electron_to_alpha_particle_mass_ratio{0.0001370933554798}; // 1.370933554798e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_helion_mag_mom_ratio{864.058257}; // 864.058257
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_proton_mag_mom_ratio{-658.2275971}; // -658.2275971
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_triton_mass_ratio{0.0001819200062203}; // 1.819200062203e-4
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>           alpha_particle_mass_energy_equivalent_in_MeV{5.971920096283645e-10}; // 3727.379378 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>          atomic_mass_constant_energy_equivalent_in_MeV{1.4924180620631248e-10}; // 931.4940954 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 deuteron_mass_energy_equivalent_in_MeV{3.005063182911834e-10}; // 1875.612928 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 electron_mass_energy_equivalent_in_MeV{8.187105646948593e-14}; // 0.5109989461 MeV
+UNIT_CONSTANT Quantity<Unit<-4, -2, 4, 0, 0, 0, 0>>                                Fermi_coupling_constant{454379573748293.4}; // 1.1663787e-5 GeV^-2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             helion_electron_mass_ratio{5495.88527922}; // 5495.88527922
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        helion_g_factor{-4.255250616}; // -4.255250616
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         helion_mag_mom{-1.074617522e-26}; // -1.074617522e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  helion_mag_mom_to_Bohr_magneton_ratio{-0.001158740958}; // -1.158740958e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               helion_mag_mom_to_nuclear_magneton_ratio{-2.127625308}; // -2.127625308
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            helion_mass{5.0064127e-27}; // 5.006412700e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          helion_mass_energy_equivalent{4.499539341e-10}; // 4.499539341e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   helion_mass_energy_equivalent_in_MeV{4.4995393411406323e-10}; // 2808.391586 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      helion_molar_mass{0.00301493224673}; // 3.01493224673e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               helion_proton_mass_ratio{2.99315267046}; // 2.99315267046
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                muon_Compton_wavelength{1.173444111e-14}; // 11.73444111e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      muon_Compton_wavelength_over_2_pi{1.867594308e-15}; // 1.867594308e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               muon_electron_mass_ratio{206.7682826}; // 206.7682826
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                          muon_g_factor{-2.0023318418}; // -2.0023318418
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                           muon_mag_mom{-4.49044826e-26}; // -4.49044826e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                   muon_mag_mom_anomaly{0.00116592089}; // 1.16592089e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    muon_mag_mom_to_Bohr_magneton_ratio{-0.00484197048}; // -4.84197048e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 muon_mag_mom_to_nuclear_magneton_ratio{-8.89059705}; // -8.89059705
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                              muon_mass{1.883531594e-28}; // 1.883531594e-28 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            muon_mass_energy_equivalent{1.692833774e-11}; // 1.692833774e-11 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     muon_mass_energy_equivalent_in_MeV{1.692833774156309e-11}; // 105.6583745 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                        muon_molar_mass{0.0001134289257}; // 0.1134289257e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                muon_neutron_mass_ratio{0.1124545167}; // 0.1124545167
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              muon_proton_mag_mom_ratio{-3.183345142}; // -3.183345142
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 muon_proton_mass_ratio{0.1126095262}; // 0.1126095262
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    muon_tau_mass_ratio{0.0594649}; // 5.94649e-2
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             neutron_Compton_wavelength{1.31959090481e-15}; // 1.31959090481e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                   neutron_Compton_wavelength_over_2_pi{2.1001941536e-16}; // 0.21001941536e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_electron_mag_mom_ratio{0.00104066882}; // 1.04066882e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            neutron_electron_mass_ratio{1838.68366158}; // 1838.68366158
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                       neutron_g_factor{-3.82608545}; // -3.82608545
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                  neutron_gyromag_ratio{183247172.0}; // 1.83247172e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                        neutron_gyromag_ratio_over_2_pi{29164693.3}; // 29.1646933 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                        neutron_mag_mom{-9.662365e-27}; // -0.96623650e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 neutron_mag_mom_to_Bohr_magneton_ratio{-0.00104187563}; // -1.04187563e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              neutron_mag_mom_to_nuclear_magneton_ratio{-1.91304273}; // -1.91304273
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                           neutron_mass{1.674927471e-27}; // 1.674927471e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         neutron_mass_energy_equivalent{1.505349739e-10}; // 1.505349739e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  neutron_mass_energy_equivalent_in_MeV{1.5053497389015495e-10}; // 939.5654133 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                     neutron_molar_mass{0.00100866491588}; // 1.00866491588e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                neutron_muon_mass_ratio{8.89248408}; // 8.89248408
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           neutron_proton_mag_mom_ratio{-0.68497934}; // -0.68497934
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_proton_mass_difference{2.30557377e-30}; // 2.30557377e-30
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       neutron_proton_mass_difference_energy_equivalent{2.07214637e-13}; // 2.07214637e-13
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>neutron_proton_mass_difference_energy_equivalent_in_MeV{1.29333205}; // 1.29333205
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    neutron_proton_mass_difference_in_u{0.001388449}; // 0.00138844900
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              neutron_proton_mass_ratio{1.00137841898}; // 1.00137841898
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 neutron_tau_mass_ratio{0.52879}; // 0.528790
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               neutron_to_shielded_proton_mag_mom_ratio{-0.68499694}; // -0.68499694
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_charge_to_mass_quotient{95788332.26}; // 9.578833226e7 C kg^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              proton_Compton_wavelength{1.32140985396e-15}; // 1.32140985396e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                    proton_Compton_wavelength_over_2_pi{2.10308910109e-16}; // 0.210308910109e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             proton_electron_mass_ratio{1836.15267389}; // 1836.15267389
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        proton_g_factor{5.585694702}; // 5.585694702
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                   proton_gyromag_ratio{267522190.0}; // 2.675221900e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_gyromag_ratio_over_2_pi{42577478.92}; // 42.57747892 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         proton_mag_mom{1.4106067873e-26}; // 1.4106067873e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  proton_mag_mom_to_Bohr_magneton_ratio{0.0015210322053}; // 1.5210322053e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               proton_mag_mom_to_nuclear_magneton_ratio{2.7928473508}; // 2.7928473508
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        proton_mag_shielding_correction{0.000025691}; // 25.691e-6
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            proton_mass{1.672621898e-27}; // 1.672621898e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          proton_mass_energy_equivalent{1.503277593e-10}; // 1.503277593e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   proton_mass_energy_equivalent_in_MeV{1.503277592608217e-10}; // 938.2720813 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      proton_molar_mass{0.001007276466879}; // 1.007276466879e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 proton_muon_mass_ratio{8.88024338}; // 8.88024338
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           proton_neutron_mag_mom_ratio{-1.45989805}; // -1.45989805
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              proton_neutron_mass_ratio{0.99862347844}; // 0.99862347844
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                               proton_rms_charge_radius{8.751e-16}; // 0.8751e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  proton_tau_mass_ratio{0.528063}; // 0.528063
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_helion_gyromag_ratio{203789458.5}; // 2.037894585e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_helion_gyromag_ratio_over_2_pi{32434099.66}; // 32.43409966 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_helion_mag_mom{-1.07455308e-26}; // -1.074553080e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_helion_mag_mom_to_Bohr_magneton_ratio{-0.001158671471}; // -1.158671471e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_helion_mag_mom_to_nuclear_magneton_ratio{-2.12749772}; // -2.127497720
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                shielded_helion_to_proton_mag_mom_ratio{-0.7617665603}; // -0.7617665603
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       shielded_helion_to_shielded_proton_mag_mom_ratio{-0.7617861313}; // -0.7617861313
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_proton_gyromag_ratio{267515317.1}; // 2.675153171e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_proton_gyromag_ratio_over_2_pi{42576385.07}; // 42.57638507 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_proton_mag_mom{1.410570547e-26}; // 1.410570547e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_proton_mag_mom_to_Bohr_magneton_ratio{0.001520993128}; // 1.520993128e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_proton_mag_mom_to_nuclear_magneton_ratio{2.7927756}; // 2.792775600
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 tau_Compton_wavelength{6.97787e-16}; // 0.697787e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       tau_Compton_wavelength_over_2_pi{1.11056e-16}; // 0.111056e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                tau_electron_mass_ratio{3477.15}; // 3477.15
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                               tau_mass{3.16747e-27}; // 3.16747e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             tau_mass_energy_equivalent{2.84678e-10}; // 2.84678e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      tau_mass_energy_equivalent_in_MeV{2.846779463369856e-10}; // 1776.82 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                         tau_molar_mass{0.00190749}; // 1.90749e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    tau_muon_mass_ratio{16.8167}; // 16.8167
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 tau_neutron_mass_ratio{1.89111}; // 1.89111
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  tau_proton_mass_ratio{1.89372}; // 1.89372
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             triton_electron_mass_ratio{5496.92153588}; // 5496.92153588
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        triton_g_factor{5.95792492}; // 5.957924920
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         triton_mag_mom{1.504609503e-26}; // 1.504609503e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  triton_mag_mom_to_Bohr_magneton_ratio{0.0016223936616}; // 1.6223936616e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               triton_mag_mom_to_nuclear_magneton_ratio{2.97896246}; // 2.978962460
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            triton_mass{5.0073566649999996e-27}; // 5.007356665e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          triton_mass_energy_equivalent{4.500387735e-10}; // 4.500387735e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   triton_mass_energy_equivalent_in_MeV{4.500387735317938e-10}; // 2808.921112 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      triton_molar_mass{0.00301550071632}; // 3.01550071632e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               triton_proton_mass_ratio{2.99371703348}; // 2.99371703348
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               alpha_particle_mass_in_u{6.644657229241617e-27}; // 4.001506179127 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     deuteron_mass_in_u{3.3435837188804984e-27}; // 2.013553212745 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     electron_mass_in_u{9.109383555703852e-31}; // 5.48579909070e-4 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       helion_mass_in_u{5.0064126986500775e-27}; // 3.01493224673 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                         muon_mass_in_u{1.8835315939010934e-28}; // 0.1134289257 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                      neutron_mass_in_u{1.674927471097056e-27}; // 1.00866491588 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       proton_mass_in_u{1.6726218973258465e-27}; // 1.007276466879 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          tau_mass_in_u{3.1674616134096e-27}; // 1.90749 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       triton_mass_in_u{5.0073566645973254e-27}; // 3.01550071632 u
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      weak_mixing_angle{0.2223}; // 0.2223
+
+
+}// namespace physicalConstant
+}// namespace unit
+
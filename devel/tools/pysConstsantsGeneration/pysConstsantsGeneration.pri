@@ -1,11 +1,20 @@
 SOURCES +=  \
+    $$PWD/ExactNumber.cpp \
     $$PWD/NistConstantsGenerator.cpp \
     $$PWD/NistDefinition.cpp
 
 
 HEADERS += \
+    $$PWD/ExactNumber.h \
     $$PWD/NistConstantsGenerator.h \
     $$PWD/NistDefinition.h \
     $$PWD/generated/physicalConstants.h \
+    $$PWD/generated/physicalConstantsAtomic.h \
+    $$PWD/generated/physicalConstantsElectromagnetic.h \
+    $$PWD/generated/physicalConstantsNuclear.h \
+    $$PWD/generated/physicalConstantsRegistry.h \
+    $$PWD/generated/physicalConstantsRelationships.h \
+    $$PWD/generated/physicalConstantsUncertainties.h \
+    $$PWD/generated/physicalConstantsUniversal.h \
     $$PWD/nistConstantsCout.h
 
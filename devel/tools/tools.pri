@@ -1,4 +1,5 @@
 include($$PWD/pysConstsantsGeneration/pysConstsantsGeneration.pri)
+include($$PWD/unitCatalogGeneration/unitCatalogGeneration.pri)
 
 SOURCES +=  \
     $$PWD/SingleFileGenerator.cpp \
@@ -0,0 +1,445 @@
+#include "UnitCatalogGenerator.h"
+
+#include <src/quantity/quantityFormatting.h>
+#include <src/unit/unitSymbolTable.h>
+#include <tools/pysConstsantsGeneration/ExactNumber.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <set>
+#include <sstream>
+
+namespace {
+
+const std::intmax_t maxInt = std::numeric_limits<std::intmax_t>::max();
+
+struct Prefix {
+    const char* name;
+    const char* symbol;
+    int exp10;
+};
+
+const std::vector<Prefix> prefixes {
+    {"femto", "f", -15}, {"pico", "p", -12}, {"nano", "n", -9}, {"micro", "u", -6},
+    {"milli", "m", -3},  {"centi", "c", -2}, {"deci", "d", -1}, {"deca", "da", 1},
+    {"hecto", "h", 2},   {"kilo", "k", 3},   {"mega", "M", 6},  {"giga", "G", 9},
+    {"tera", "T", 12},   {"peta", "P", 15}
+};
+
+// symbols of the si base units in the order of the dimensions of quantityDefinitionsSI.h
+const std::vector<std::string> baseSymbols {"m", "kg", "s", "A", "K", "mol", "cd"};
+
+std::intmax_t gcd(std::intmax_t a, std::intmax_t b) {
+    while (b != 0) {
+        const std::intmax_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+std::intmax_t checkedMultiply(std::intmax_t a, std::intmax_t b) {
+    assert(b == 0 || a <= maxInt / b); //factor too large for std::ratio
+    return a * b;
+}
+
+std::vector<std::string> splitByWhitespace(std::string const& str) {
+    std::istringstream iss(str);
+    std::vector<std::string> r;
+    std::string sub;
+    while (iss >> sub) r.push_back(sub);
+    return r;
+}
+
+std::vector<std::string> split(std::string const& str, char sep) {
+    std::vector<std::string> r;
+    std::istringstream iss(str);
+    std::string sub;
+    while (std::getline(iss, sub, sep)) r.push_back(sub);
+    return r;
+}
+
+// "0.0254" -> 254 * 10^-4, "1.602176634e-19" -> 1602176634 * 10^-28
+UnitCatalogGenerator::Factor parseDecimal(std::string const& v) {
+    const auto ePos = v.find_first_of("eE");
+    const std::string mantissa = v.substr(0, ePos);
+    int exp10 = ePos == std::string::npos ? 0 : std::atoi(v.c_str() + ePos + 1);
+
+    std::intmax_t num = 0;
+    bool fraction = false;
+    for (char c : mantissa) {
+        if (c == '.') {
+            fraction = true;
+            continue;
+        }
+        assert(c >= '0' && c <= '9');
+        num = checkedMultiply(num, 10) + (c - '0');
+        if (fraction) --exp10;
+    }
+    assert(num > 0);
+    return UnitCatalogGenerator::Factor{num, 1, exp10};
+}
+}
+
+UnitCatalogGenerator::UnitCatalogGenerator()
+{
+    const std::string cdir = "../devel/tools/unitCatalogGeneration";
+    const std::string inFile = cdir + "/unitCatalog.txt";
+    const std::string constantsFile = cdir + "/generated/unitConversions.h";
+    const std::string tableFile = cdir + "/generated/unitConversionTable.h";
+
+    std::cout << "generating unit conversions from " << inFile << "\n";
+
+    const auto conversions = toConversions(removeHeader(readTxt(inFile)));
+
+    writeConstants(constantsFile, conversions);
+    writeTable(tableFile, conversions);
+}
+
+UnitCatalogGenerator::RawLines UnitCatalogGenerator::readTxt(const std::string &file)
+{
+    RawLines lines;
+    std::string line;
+
+    std::ifstream myfile(file);
+    if (myfile.is_open() == false)
+        assert(false);
+
+    while (std::getline(myfile, line)) lines.push_back(line);
+
+    return lines;
+}
+
+UnitCatalogGenerator::RawLines UnitCatalogGenerator::removeHeader(const RawLines &linesWithHeader)
+{
+    const std::string headerSep("-----------------");
+
+    auto it = std::find_if(linesWithHeader.begin(), linesWithHeader.end(),
+                           [&headerSep](std::string const& l) { return l.find(headerSep) != std::string::npos; });
+    assert(it != linesWithHeader.end());
+
+    ++it; //advance to the line after the separator
+
+    RawLines r;
+    for (; it != linesWithHeader.end(); ++it) {
+        const auto hasContent = it->find_first_not_of(" \t");
+        if (hasContent == std::string::npos || (*it)[hasContent] == '#') continue;
+        r.push_back(*it);
+    }
+    return r;
+}
+
+UnitCatalogGenerator::Conversions UnitCatalogGenerator::toConversions(const RawLines &rawLines)
+{
+    Conversions conversions;
+
+    for (auto const& line : rawLines) {
+        const auto columns = splitByWhitespace(line);
+        assert(columns.size() == 4 || columns.size() == 5);
+
+        Conversion c;
+        c.name = columns[0];
+        c.symbol = columns[1] == "-" ? std::string() : columns[1];
+
+        Factor unitFactor{1, 1, 0};
+        parseUnit(columns[3], conversions, unitFactor, c.exponents);
+        c.factor = multiply(parseFactor(columns[2]), unitFactor);
+
+        if (columns.size() == 5) {
+            assert(columns[4] == "prefix");
+            addPrefixed(conversions, c);
+        } else {
+            conversions.push_back(c);
+        }
+    }
+
+    std::set<std::string> keys;
+    for (auto const& c : conversions) {
+        const bool newName = keys.insert(c.name).second;
+        const bool newSymbol = c.symbol.empty() || c.symbol == c.name || keys.insert(c.symbol).second;
+        assert(newName && newSymbol); //duplicate key or prefix collision
+    }
+
+    return conversions;
+}
+
+void UnitCatalogGenerator::parseUnit(const std::string &v, const Conversions &known, Factor &factor, Exponents &exponents)
+{
+    exponents.fill(0);
+
+    for (auto const& token : split(v, '.')) {
+        const auto expPos = token.find('^');
+        const std::string symbol = token.substr(0, expPos);
+        const int exponent = expPos == std::string::npos ? 1 : std::atoi(token.c_str() + expPos + 1);
+        assert(exponent != 0);
+
+        if (symbol == "1") continue;
+
+        const auto base = std::find(baseSymbols.begin(), baseSymbols.end(), symbol);
+        if (base != baseSymbols.end()) {
+            exponents[base - baseSymbols.begin()] += exponent;
+            continue;
+        }
+
+        const auto other = std::find_if(known.rbegin(), known.rend(),
+                                        [&symbol](Conversion const& c) { return c.symbol == symbol || c.name == symbol; });
+        assert(other != known.rend()); //unknown unit, units must be defined before they are used
+
+        factor = multiply(factor, power(other->factor, exponent));
+        for (std::size_t i = 0; i < exponents.size(); ++i) exponents[i] += exponent * other->exponents[i];
+    }
+}
+
+void UnitCatalogGenerator::addPrefixed(Conversions &conversions, const Conversion &c)
+{
+    conversions.push_back(c);
+
+    for (auto const& p : prefixes) {
+        Conversion prefixed = c;
+        prefixed.name = p.name + c.name;
+        prefixed.symbol = c.symbol.empty() ? std::string() : p.symbol + c.symbol;
+        prefixed.factor = multiply(c.factor, Factor{1, 1, p.exp10});
+        conversions.push_back(prefixed);
+    }
+}
+
+UnitCatalogGenerator::Factor UnitCatalogGenerator::parseFactor(std::string v)
+{
+    const auto parts = split(v, '/');
+    assert(parts.size() == 1 || parts.size() == 2);
+
+    const Factor n = parseDecimal(parts[0]);
+    if (parts.size() == 1) return normalize(n);
+
+    const Factor d = parseDecimal(parts[1]);
+    return multiply(n, Factor{d.den, d.num, -d.exp10});
+}
+
+UnitCatalogGenerator::Factor UnitCatalogGenerator::multiply(Factor l, Factor r)
+{
+    const std::intmax_t g1 = gcd(l.num, r.den);
+    const std::intmax_t g2 = gcd(r.num, l.den);
+
+    return normalize(Factor{checkedMultiply(l.num / g1, r.num / g2),
+                            checkedMultiply(l.den / g2, r.den / g1),
+                            l.exp10 + r.exp10});
+}
+
+UnitCatalogGenerator::Factor UnitCatalogGenerator::power(Factor f, int exponent)
+{
+    if (exponent < 0) return power(Factor{f.den, f.num, -f.exp10}, -exponent);
+
+    Factor r{1, 1, 0};
+    for (int i = 0; i < exponent; ++i) r = multiply(r, f);
+    return r;
+}
+
+bool UnitCatalogGenerator::isOne(const Factor &f)
+{
+    return f.num == 1 && f.den == 1 && f.exp10 == 0;
+}
+
+UnitCatalogGenerator::Factor UnitCatalogGenerator::normalize(Factor f)
+{
+    const std::intmax_t g = gcd(f.num, f.den);
+    f.num /= g;
+    f.den /= g;
+
+    while (f.num % 10 == 0) {
+        f.num /= 10;
+        ++f.exp10;
+    }
+    while (f.den % 10 == 0) {
+        f.den /= 10;
+        --f.exp10;
+    }
+    return f;
+}
+
+// moves the decimal exponent into the ratio as far as std::intmax_t allows
+UnitCatalogGenerator::Factor UnitCatalogGenerator::foldExponent(Factor f)
+{
+    while (f.exp10 > 0 && f.num <= maxInt / 10) {
+        f.num *= 10;
+        --f.exp10;
+    }
+    while (f.exp10 < 0 && f.den <= maxInt / 10) {
+        f.den *= 10;
+        ++f.exp10;
+    }
+
+    const std::intmax_t g = gcd(f.num, f.den);
+    f.num /= g;
+    f.den /= g;
+    return f;
+}
+
+void UnitCatalogGenerator::toCppFactor(std::ostream &s, const Factor &f)
+{
+    const Factor folded = foldExponent(f);
+    s << "exact_factor<std::ratio<" << folded.num << ", " << folded.den << ">";
+    if (folded.exp10 != 0) s << ", " << folded.exp10;
+    s << ">";
+}
+
+void UnitCatalogGenerator::toCppValue(std::ostream &s, const Factor &f)
+{
+    const ExactNumber exact = ExactNumber::parse(std::to_string(f.num)) * ExactNumber::parse(std::to_string(f.den)).inverse() * ExactNumber::pow10(f.exp10);
+    char literal[unit::helper::formatting::maxLength];
+    std::string number(literal, unit::helper::formatting::shortest(exact.toDouble(), literal));
+    if (number.find_first_of(".e") == std::string::npos) number += ".0";
+    s << number;
+}
+
+void UnitCatalogGenerator::toCppUnit(std::ostream &s, const Exponents &e)
+{
+    s << "Unit<";
+    for (std::size_t i = 0; i < e.size(); ++i) s << (i == 0 ? "" : ", ") << e[i];
+    s << ">";
+}
+
+void UnitCatalogGenerator::writeConstants(const std::string &file, const Conversions &conversions)
+{
+    std::ofstream s(file);
+    if (s.is_open() == false)
+        assert(false);
+
+    s << "#pragma once\n";
+    s << "\n";
+    s << "/**********************generated from unitCatalog.txt by UnitCatalogGenerator**********************/\n";
+    s << "\n";
+    s << "#include <src/quantity/quantityConversion.h>\n";
+    s << "#include <src/quantity/quantityDefinitionsSI.h>\n";
+    s << "\n";
+    s << "#include <ratio>\n";
+    s << "\n";
+    s << "namespace unit {\n";
+    s << "namespace conversion {\n";
+    s << "\n";
+    s << "namespace exact {\n";
+    s << "\n";
+    for (auto const& c : conversions) {
+        if (isOne(c.factor)) continue; //coherent si unit
+        s << "using ";
+        s.width(32);
+        s << c.name << " = ";
+        toCppFactor(s, c.factor);
+        s << ";\n";
+    }
+    s << "\n";
+    s << "}// namespace exact\n";
+    s << "\n";
+    for (auto const& c : conversions) {
+        if (isOne(c.factor)) continue;
+        s << "constexpr Quantity<";
+        toCppUnit(s, c.exponents);
+        s << "> ";
+        s.width(32);
+        s << c.name << "{";
+        toCppValue(s, c.factor);
+        s << "};";
+        if (c.symbol.empty() == false) s << " // " << c.symbol;
+        s << "\n";
+    }
+    s << "\n";
+    s << "}// namespace conversion\n";
+    s << "}// namespace unit\n";
+}
+
+void UnitCatalogGenerator::writeTable(const std::string &file, const Conversions &conversions)
+{
+    using namespace unit::helper::hash;
+
+    struct Key {
+        std::string key;
+        std::size_t conversion;
+    };
+
+    std::vector<Key> keys;
+    for (std::size_t i = 0; i < conversions.size(); ++i) {
+        keys.push_back(Key{conversions[i].name, i});
+        if (conversions[i].symbol.empty() == false && conversions[i].symbol != conversions[i].name)
+            keys.push_back(Key{conversions[i].symbol, i});
+    }
+
+    const std::size_t size = keys.size();
+    const std::size_t bucketCount = size / 2 + 1;
+
+    std::vector<THash> hashes;
+    for (auto const& k : keys) hashes.push_back(murmur3(k.key.data(), k.key.size()));
+
+    std::vector<THash> displacements;
+    std::vector<std::size_t> slots;
+    const bool separated = displace(hashes, displacements, slots);
+    assert(separated); //keys with equal hashes cannot be separated
+    (void)separated;
+
+    std::ofstream s(file);
+    if (s.is_open() == false)
+        assert(false);
+
+    s << "#pragma once\n";
+    s << "\n";
+    s << "/**********************generated from unitCatalog.txt by UnitCatalogGenerator**********************/\n";
+    s << "\n";
+    s << "#include <src/quantity/quantityConversion.h>\n";
+    s << "#include <src/unit/unitHash.h>\n";
+    s << "\n";
+    s << "#include <cstddef>\n";
+    s << "#include <string>\n";
+    s << "\n";
+    s << "namespace unit {\n";
+    s << "namespace conversion {\n";
+    s << "\n";
+    s << "using Entry = ConversionEntry<" << baseSymbols.size() << ">;\n";
+    s << "\n";
+    s << "namespace table {\n";
+    s << "\n";
+    s << "// class template so that the header only tables have a single definition\n";
+    s << "template <typename = void>\n";
+    s << "struct Table {\n";
+    s << "    static constexpr Entry entries[" << size << "] = {\n";
+    for (auto slot : slots) {
+        const Conversion& c = conversions[keys[slot].conversion];
+        const Factor f = foldExponent(c.factor);
+        s << "        {\"" << keys[slot].key << "\", ";
+        toCppValue(s, f);
+        s << ", " << f.num << ", " << f.den << ", " << f.exp10 << ", {";
+        for (std::size_t i = 0; i < c.exponents.size(); ++i) s << (i == 0 ? "" : ", ") << c.exponents[i];
+        s << "}},\n";
+    }
+    s << "    };\n";
+    s << "\n";
+    s << "    static constexpr helper::hash::THash displacements[" << bucketCount << "] = {";
+    for (std::size_t i = 0; i < bucketCount; ++i) s << (i % 16 == 0 ? "\n        " : " ") << displacements[i] << "u,";
+    s << "\n    };\n";
+    s << "};\n";
+    s << "\n";
+    s << "template <typename T> constexpr Entry Table<T>::entries[" << size << "];\n";
+    s << "template <typename T> constexpr helper::hash::THash Table<T>::displacements[" << bucketCount << "];\n";
+    s << "}\n";
+    s << "\n";
+    s << "/**\n";
+    s << " * conversion entry of a unit name or symbol, nullptr if the unit is not in the catalog\n";
+    s << " */\n";
+    s << "inline Entry const* find(char const* name, std::size_t length) {\n";
+    s << "    return helper::hash::find(table::Table<>::entries, table::Table<>::displacements, name, length);\n";
+    s << "}\n";
+    s << "\n";
+    s << "inline Entry const* find(std::string const& name) { return find(name.data(), name.size()); }\n";
+    s << "\n";
+    s << "/**\n";
+    s << " * value given in the unit name as quantity, false if the unit is unknown or of another dimension than U\n";
+    s << " */\n";
+    s << "template <typename U, typename T>\n";
+    s << "bool to_quantity(T const& value, std::string const& name, Quantity<U, T>& out) {\n";
+    s << "    return unit::to_quantity(find(name), value, out);\n";
+    s << "}\n";
+    s << "\n";
+    s << "}// namespace conversion\n";
+    s << "}// namespace unit\n";
+}
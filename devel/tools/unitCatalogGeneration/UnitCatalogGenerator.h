@@ -0,0 +1,64 @@
+#ifndef UNITCATALOGGENERATOR_H
+#define UNITCATALOGGENERATOR_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * generates constexpr conversion constants and a perfect hash lookup table from unitCatalog.txt
+ */
+class UnitCatalogGenerator
+{
+public:
+    UnitCatalogGenerator();
+
+    // num / den * 10^exp10
+    struct Factor {
+        std::intmax_t num;
+        std::intmax_t den;
+        int exp10;
+    };
+
+    using Exponents = std::array<int, 7>;
+
+    struct Conversion {
+        std::string name;
+        std::string symbol;
+        Factor factor;
+        Exponents exponents;
+    };
+
+    using Conversions = std::vector<Conversion>;
+
+    static Factor parseFactor(std::string v);
+    static Factor multiply(Factor l, Factor r);
+    static Factor power(Factor f, int exponent);
+    static bool isOne(Factor const& f);
+
+private:
+
+    using RawLines = std::vector<std::string>;
+
+    static RawLines readTxt(std::string const& file);
+    static RawLines removeHeader(RawLines const& linesWithHeader);
+
+    static Conversions toConversions(RawLines const& rawLines);
+    static void parseUnit(std::string const& v, Conversions const& known, Factor& factor, Exponents& exponents);
+    static void addPrefixed(Conversions& conversions, Conversion const& c);
+
+    static Factor normalize(Factor f);
+    static Factor foldExponent(Factor f);
+
+    static void writeConstants(std::string const& file, Conversions const& conversions);
+    static void writeTable(std::string const& file, Conversions const& conversions);
+
+    static void toCppFactor(std::ostream& s, Factor const& f);
+    // the nearest double of the factor, rounded once from the exact value
+    static void toCppValue(std::ostream& s, Factor const& f);
+    static void toCppUnit(std::ostream& s, Exponents const& e);
+};
+
+#endif // UNITCATALOGGENERATOR_H
@@ -0,0 +1,1222 @@
+#pragma once
+
+/**********************generated from unitCatalog.txt by UnitCatalogGenerator**********************/
+
+#include <src/quantity/quantityConversion.h>
+#include <src/unit/unitHash.h>
+
+#include <cstddef>
+#include <string>
+
+namespace unit {
+namespace conversion {
+
+using Entry = ConversionEntry<7>;
+
+namespace table {
+
+// class template so that the header only tables have a single definition
+template <typename = void>
+struct Table {
+    static constexpr Entry entries[1136] = {
+        {"plm", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"GeV", 1.602176634e-10, 801088317, 500000000000000000, -1, {2, 1, -2, 0, 0, 0, 0}},
+        {"inch", 0.0254, 127, 5000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"carat", 0.0002, 1, 5000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"nSv", 1e-9, 1, 1000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"teracoulomb", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"centisecond", 0.01, 1, 100, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"petabar", 100000000000000000000.0, 1000000000000000000, 1, 2, {-1, 1, -2, 0, 0, 0, 0}},
+        {"wk", 604800.0, 604800, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"nm", 1e-9, 1, 1000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"milliohm", 0.001, 1, 1000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"mGy", 0.001, 1, 1000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"MGy", 1000000.0, 1000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"decakelvin", 10.0, 10, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"nanovolt", 1e-9, 1, 1000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"fGy", 1e-15, 1, 1000000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"teraweber", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"MJ", 1000000.0, 1000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ML", 1000.0, 1000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"inch_of_mercury", 3386.389, 3386389, 1000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"min", 60.0, 60, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"fJ", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"megalumen", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"kSv", 1000.0, 1000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"gigacandela", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"C", 1.0, 1, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"astronomical_unit", 149597870700.0, 149597870700, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"pN", 1e-12, 1, 1000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"MSv", 1000000.0, 1000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"Glx", 1000000000.0, 1000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"cA", 0.01, 1, 100, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"angstrom", 1e-10, 1, 10000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"pound", 0.45359237, 45359237, 100000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"cubic_yard", 0.764554857984, 1493271207, 1953125000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"nWb", 1e-9, 1, 1000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"ueV", 1.602176634e-25, 801088317, 500000000000000000, -16, {2, 1, -2, 0, 0, 0, 0}},
+        {"dHz", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"Tkat", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"TA", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"miUS", 1609.3472186944373, 6336000, 3937, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"peV", 1.602176634e-31, 801088317, 500000000000000000, -22, {2, 1, -2, 0, 0, 0, 0}},
+        {"GGy", 1000000000.0, 1000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"petapascal", 1000000000000000.0, 1000000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"nanosecond", 1e-9, 1, 1000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"gigaampere", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"microcoulomb", 1e-6, 1, 1000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"teraampere", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"pica", 0.004233333333333334, 127, 30000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"pg", 1e-15, 1, 1000000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"petaampere", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"nPa", 1e-9, 1, 1000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"knot", 0.5144444444444445, 463, 900, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"technical_atmosphere", 98066.5, 196133, 2, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"millicoulomb", 0.001, 1, 1000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"daOhm", 10.0, 10, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"millijoule", 0.001, 1, 1000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"nlm", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"kcd", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"petanewton", 1000000000000000.0, 1000000000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"centimole", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"kA", 1000.0, 1000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"PA", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"um", 1e-6, 1, 1000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"femtocalorie", 4.184e-15, 523, 125000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"pBq", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"eV", 1.602176634e-19, 801088317, 500000000000000000, -10, {2, 1, -2, 0, 0, 0, 0}},
+        {"terakelvin", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"micrometer", 1e-6, 1, 1000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"gr", 0.00006479891, 6479891, 100000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mT", 0.001, 1, 1000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"petacalorie", 4184000000000000.0, 4184000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cL", 0.00001, 1, 100000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"hm", 100.0, 100, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"microohm", 1e-6, 1, 1000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"ukat", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"hectonewton", 100.0, 100, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"decijoule", 0.1, 1, 10, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decalumen", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"dH", 0.1, 1, 10, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"lx", 1.0, 1, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"flm", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"megagray", 1000000.0, 1000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hWh", 360000.0, 360000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decisecond", 0.1, 1, 10, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"teramole", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"imperial_gallon", 0.00454609, 454609, 100000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"teracandela", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"acre_foot", 1233.48183754752, 60228605349, 48828125, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"hectoampere", 100.0, 100, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"kOhm", 1000.0, 1000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"nanofarad", 1e-9, 1, 1000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"gigacalorie", 4184000000.0, 4184000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"PN", 1000000000000000.0, 1000000000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"Pmol", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"pbar", 1e-7, 1, 10000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"GPa", 1000000000.0, 1000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"femtosiemens", 1e-15, 1, 1000000000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"decalux", 10.0, 10, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"cP", 0.001, 1, 1000, 0, {-1, 1, -1, 0, 0, 0, 0}},
+        {"decicandela", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"cJ", 0.01, 1, 100, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"milliampere", 0.001, 1, 1000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"nanojoule", 1e-9, 1, 1000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kelvin", 1.0, 1, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"ps", 1e-12, 1, 1000000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hectoelectronvolt", 1.602176634e-17, 801088317, 500000000000000000, -8, {2, 1, -2, 0, 0, 0, 0}},
+        {"hbar", 10000000.0, 10000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"microelectronvolt", 1.602176634e-25, 801088317, 500000000000000000, -16, {2, 1, -2, 0, 0, 0, 0}},
+        {"decawatt_hour", 36000.0, 36000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"Pm", 1000000000000000.0, 1000000000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"kilosiemens", 1000.0, 1000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"PF", 1000000000000000.0, 1000000000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"cbar", 1000.0, 1000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"dalx", 10.0, 10, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"Ps", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hectolumen", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"Pcd", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"decakatal", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"megapascal", 1000000.0, 1000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"decimeter", 0.1, 1, 10, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"decaelectronvolt", 1.602176634e-18, 801088317, 500000000000000000, -9, {2, 1, -2, 0, 0, 0, 0}},
+        {"Tcal", 4184000000000.0, 4184000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ptUK", 0.00056826125, 454609, 800000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"fSv", 1e-15, 1, 1000000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"millimole", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"microbecquerel", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"pc", 30856775814913672.0, 30856775814913673, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"megaliter", 1000.0, 1000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"piconewton", 1e-12, 1, 1000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"rad", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"ounce_force", 0.2780138509537812, 8896443230521, 32000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"TN", 1000000000000.0, 1000000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"femtojoule", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"nanowatt", 1e-9, 1, 1000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"centivolt", 0.01, 1, 100, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"fOhm", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"nanocandela", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"millimeter_of_mercury", 133.322387415, 26664477483, 200000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"dyn", 0.00001, 1, 100000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"femtoohm", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"picojoule", 1e-12, 1, 1000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"dC", 0.1, 1, 10, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"pcd", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"kL", 1.0, 1, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"ccd", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"cs", 0.01, 1, 100, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"picoampere", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"fV", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"hectogray", 100.0, 100, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"a", 31557600.0, 31557600, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"nanotesla", 1e-9, 1, 1000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"P", 0.1, 1, 10, 0, {-1, 1, -1, 0, 0, 0, 0}},
+        {"decitesla", 0.1, 1, 10, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"gigapascal", 1000000000.0, 1000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"liter", 0.001, 1, 1000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"picocalorie", 4.184e-12, 523, 125000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"centigram", 0.00001, 1, 100000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mK", 0.001, 1, 1000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"mHz", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"rev", 6.283185307179586, 3141592653589793, 500000000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"picometer", 1e-12, 1, 1000000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"terabar", 100000000000000000.0, 100000000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"sqin", 0.00064516, 16129, 25000000, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"microhertz", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"mph", 0.44704, 1397, 3125, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"teraelectronvolt", 1.602176634e-7, 801088317, 5000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"centiohm", 0.01, 1, 100, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"Gkat", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"b", 1e-28, 1, 1000000000000000000, -10, {2, 0, 0, 0, 0, 0, 0}},
+        {"pJ", 1e-12, 1, 1000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hectobecquerel", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"gigagray", 1000000000.0, 1000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"teraohm", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"V", 1.0, 1, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"picovolt", 1e-12, 1, 1000000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"petahenry", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"pm", 1e-12, 1, 1000000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"becquerel", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"survey_foot", 0.3048006096012192, 1200, 3937, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"fmol", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"centiwatt", 0.01, 1, 100, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"nanogram", 1e-12, 1, 1000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"fA", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"hectocandela", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"TWb", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"dJ", 0.1, 1, 10, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"PL", 1000000000000.0, 1000000000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"nanopascal", 1e-9, 1, 1000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"deciliter", 0.0001, 1, 10000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"GV", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"femtokatal", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"kg", 1.0, 1, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"MF", 1000000.0, 1000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"decilumen", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"daV", 10.0, 10, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"picowatt", 1e-12, 1, 1000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"atm", 101325.0, 101325, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hectofarad", 100.0, 100, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"degree_rankine", 0.5555555555555556, 5, 9, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"petalumen", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"hectomole", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"TH", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"megatesla", 1000000.0, 1000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"kBq", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"flx", 1e-15, 1, 1000000000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"daC", 10.0, 10, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"millilux", 0.001, 1, 1000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"cK", 0.01, 1, 100, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"Wb", 1.0, 1, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"ph", 10000.0, 10000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"gn", 9.80665, 196133, 20000, 0, {1, 0, -2, 0, 0, 0, 0}},
+        {"femtowatt", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"Gcd", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"cT", 0.01, 1, 100, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"petacandela", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"Ts", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hOhm", 100.0, 100, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"phot", 10000.0, 10000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"kF", 1000.0, 1000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"siemens", 1.0, 1, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"millikatal", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"daW", 10.0, 10, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"fbar", 1e-10, 1, 10000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"gigagram", 1000000.0, 1000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"week", 604800.0, 604800, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hlm", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"Pg", 1000000000000.0, 1000000000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"hHz", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"pA", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"fL", 1e-18, 1, 1000000000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"Mlx", 1000000.0, 1000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"petafarad", 1000000000000000.0, 1000000000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"cuyd", 0.764554857984, 1493271207, 1953125000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"imperial_pint", 0.00056826125, 454609, 800000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"square_inch", 0.00064516, 16129, 25000000, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"uSv", 1e-6, 1, 1000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"femtoelectronvolt", 1.602176634e-34, 801088317, 500000000000000000, -25, {2, 1, -2, 0, 0, 0, 0}},
+        {"kWh", 3600000.0, 3600000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"long_ton", 1016.0469088, 317514659, 312500, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"microweber", 1e-6, 1, 1000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"dF", 0.1, 1, 10, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"GWb", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"decifarad", 0.1, 1, 10, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"petatesla", 1000000000000000.0, 1000000000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"kJ", 1000.0, 1000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kiloliter", 1.0, 1, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"Gal", 0.01, 1, 100, 0, {1, 0, -2, 0, 0, 0, 0}},
+        {"quart", 0.000946352946, 473176473, 500000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"lbt", 0.3732417216, 58319019, 156250000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"milliweber", 0.001, 1, 1000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"GOhm", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"cm", 0.01, 1, 100, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"femtogram", 1e-18, 1, 1000000000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"megabar", 100000000000.0, 100000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hectolux", 100.0, 100, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"mBq", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"nanoweber", 1e-9, 1, 1000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"square_yard", 0.83612736, 1306449, 1562500, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"hectohenry", 100.0, 100, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"hcal", 418.4, 2092, 5, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ounce", 0.028349523125, 45359237, 1600000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mm", 0.001, 1, 1000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"femtotesla", 1e-15, 1, 1000000000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"nF", 1e-9, 1, 1000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"megajoule", 1000000.0, 1000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"dPa", 0.1, 1, 10, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"pH", 1e-12, 1, 1000000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"decicoulomb", 0.1, 1, 10, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"L", 0.001, 1, 1000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"nanokelvin", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"stone", 6.35029318, 317514659, 50000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"centimeter_of_water", 98.0665, 196133, 2000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"cBq", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"Tlm", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"gigatesla", 1000000000.0, 1000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"ms", 0.001, 1, 1000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"dabar", 1000000.0, 1000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"umol", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"heV", 1.602176634e-17, 801088317, 500000000000000000, -8, {2, 1, -2, 0, 0, 0, 0}},
+        {"decinewton", 0.1, 1, 10, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"microvolt", 1e-6, 1, 1000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"mC", 0.001, 1, 1000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"teravolt", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"second", 1.0, 1, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"petacoulomb", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"mol", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"fathom", 1.8288, 1143, 625, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"torr", 133.32236842105263, 20265, 152, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"neV", 1.602176634e-28, 801088317, 500000000000000000, -19, {2, 1, -2, 0, 0, 0, 0}},
+        {"ly", 9460730472580800.0, 9460730472580800, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"mJ", 0.001, 1, 1000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"fK", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"decavolt", 10.0, 10, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"microwatt", 1e-6, 1, 1000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"Gmol", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"uS", 1e-6, 1, 1000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"pcal", 4.184e-12, 523, 125000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"Gs", 1000000000.0, 1000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"decibecquerel", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"bar", 100000.0, 100000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"MK", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"hS", 100.0, 100, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"MeV", 1.602176634e-13, 801088317, 500000000000000000, -4, {2, 1, -2, 0, 0, 0, 0}},
+        {"GT", 1000000000.0, 1000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"microampere", 1e-6, 1, 1000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"femtohenry", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"fN", 1e-15, 1, 1000000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"dakat", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"nanoampere", 1e-9, 1, 1000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"uW", 1e-6, 1, 1000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"G", 0.0001, 1, 10000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"decamole", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"picowatt_hour", 3.6e-9, 9, 2500000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"petahertz", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"fHz", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"clm", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"in", 0.0254, 127, 5000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"micron", 1e-6, 1, 1000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"Mkat", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"hp", 745.6998715822702, 37284993579113511, 50000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"dlm", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"microlux", 1e-6, 1, 1000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"m", 1.0, 1, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"ft", 0.3048, 381, 1250, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"terawatt_hour", 3600000000000000.0, 3600000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"megacalorie", 4184000.0, 4184000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"pPa", 1e-12, 1, 1000000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"galileo", 0.01, 1, 100, 0, {1, 0, -2, 0, 0, 0, 0}},
+        {"decikatal", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"petajoule", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ppb", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"pC", 1e-12, 1, 1000000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"daL", 0.01, 1, 100, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"pint", 0.000473176473, 473176473, 1000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"mOhm", 0.001, 1, 1000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"daSv", 10.0, 10, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"femtomole", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"mWh", 3.6, 18, 5, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"Pkat", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"millicandela", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"survey_mile", 1609.3472186944373, 6336000, 3937, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"Mcd", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"milliwatt_hour", 3.6, 18, 5, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"GH", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"decapascal", 10.0, 10, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"yard", 0.9144, 1143, 1250, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"ozf", 0.2780138509537812, 8896443230521, 32000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"watt", 1.0, 1, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"nanoelectronvolt", 1.602176634e-28, 801088317, 500000000000000000, -19, {2, 1, -2, 0, 0, 0, 0}},
+        {"dWb", 0.1, 1, 10, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"femtolux", 1e-15, 1, 1000000000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"centihenry", 0.01, 1, 100, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"kilonewton", 1000.0, 1000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"hT", 100.0, 100, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"uH", 1e-6, 1, 1000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"terawatt", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"hectare", 10000.0, 10000, 1, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"fH", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"millibecquerel", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"uWb", 1e-6, 1, 1000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"kilokelvin", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"fg", 1e-18, 1, 1000000000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"decahenry", 10.0, 10, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"TGy", 1000000000000.0, 1000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"microsievert", 1e-6, 1, 1000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"mi", 1609.344, 201168, 125, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"POhm", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"uHz", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"kilowatt", 1000.0, 1000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"ng", 1e-12, 1, 1000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"gray", 1.0, 1, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"MW", 1000000.0, 1000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"rem", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"centibecquerel", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"centicalorie", 0.04184, 523, 12500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hBq", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"ds", 0.1, 1, 10, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"TeV", 1.602176634e-7, 801088317, 5000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"foot", 0.3048, 381, 1250, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"centifarad", 0.01, 1, 100, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"gigamole", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"hPa", 100.0, 100, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"decihertz", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"parts_per_million", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"nmi", 1852.0, 1852, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"decibar", 10000.0, 10000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"clx", 0.01, 1, 100, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"teracalorie", 4184000000000.0, 4184000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"TF", 1000000000000.0, 1000000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"millilumen", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"nA", 1e-9, 1, 1000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"klx", 1000.0, 1000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"mcal", 0.004184, 523, 125000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hectokatal", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"statvolt", 299.792458, 149896229, 500000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"dcal", 0.4184, 523, 1250, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"picohenry", 1e-12, 1, 1000000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"Mg", 1000.0, 1000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"picoohm", 1e-12, 1, 1000000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"ksi", 6894757.293168361, 8896443230521, 1290320, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"decasecond", 10.0, 10, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hectogram", 0.1, 1, 10, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mPa", 0.001, 1, 1000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"St", 0.0001, 1, 10000, 0, {2, 0, -1, 0, 0, 0, 0}},
+        {"gram", 0.001, 1, 1000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"T", 1.0, 1, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"kat", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"MWb", 1000000.0, 1000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"barrel", 0.158987294928, 9936705933, 62500000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"t", 1000.0, 1000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"dag", 0.01, 1, 100, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"hectoliter", 0.1, 1, 10, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"millicalorie", 0.004184, 523, 125000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cSv", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"mcd", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"au", 149597870700.0, 149597870700, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"microtesla", 1e-6, 1, 1000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"centiweber", 0.01, 1, 100, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"grain", 0.00006479891, 6479891, 100000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"kilolux", 1000.0, 1000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"Hz", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"fPa", 1e-15, 1, 1000000000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"megaelectronvolt", 1.602176634e-13, 801088317, 500000000000000000, -4, {2, 1, -2, 0, 0, 0, 0}},
+        {"terahertz", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"GL", 1000000.0, 1000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"ton_of_refrigeration", 3516.8528420666667, 52752792631, 15000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"PT", 1000000000000000.0, 1000000000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"hV", 100.0, 100, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"Gg", 1000000.0, 1000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"cW", 0.01, 1, 100, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"tonf", 8896.443230521, 8896443230521, 1000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"mW", 0.001, 1, 1000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"dN", 0.1, 1, 10, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"micropascal", 1e-6, 1, 1000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"farad", 1.0, 1, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"hectojoule", 100.0, 100, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"petamole", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"joule", 1.0, 1, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"sqft", 0.09290304, 145161, 1562500, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"Ms", 1000000.0, 1000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"femtocandela", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"mF", 0.001, 1, 1000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"dbar", 10000.0, 10000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"fortnight", 1209600.0, 1209600, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"Gcal", 4184000000.0, 4184000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hmol", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"giganewton", 1000000000.0, 1000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"kV", 1000.0, 1000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"gigavolt", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"daWb", 10.0, 10, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"decipascal", 0.1, 1, 10, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"gigakelvin", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"decigray", 0.1, 1, 10, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"nWh", 3.6e-6, 9, 2500000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"picolux", 1e-12, 1, 1000000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"GK", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"Torr", 133.32236842105263, 20265, 152, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"terafarad", 1000000000000.0, 1000000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"tonne", 1000.0, 1000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"decisievert", 0.1, 1, 10, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"milliwatt", 0.001, 1, 1000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"pT", 1e-12, 1, 1000000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"cup", 0.0002365882365, 473176473, 2000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"therm", 105480400.0, 105480400, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"picopascal", 1e-12, 1, 1000000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hkat", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"megaweber", 1000000.0, 1000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"millifarad", 0.001, 1, 1000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"decacandela", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"st", 6.35029318, 317514659, 50000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"pV", 1e-12, 1, 1000000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"gallon", 0.003785411784, 473176473, 125000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"hC", 100.0, 100, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"furlong", 201.168, 25146, 125, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"lm", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"TL", 1000000000.0, 1000000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"hF", 100.0, 100, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"TS", 1000000000000.0, 1000000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"erg", 1e-7, 1, 10000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"petawatt_hour", 3600000000000000000.0, 3600000000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kilotesla", 1000.0, 1000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"millisiemens", 0.001, 1, 1000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"megaampere", 1000000.0, 1000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"g", 0.001, 1, 1000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"hA", 100.0, 100, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"petabecquerel", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"megameter", 1000000.0, 1000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"dBq", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"K", 1.0, 1, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"kHz", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"MS", 1000000.0, 1000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"fcal", 4.184e-15, 523, 125000000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hg", 0.1, 1, 10, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"nanoohm", 1e-9, 1, 1000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"metric_horsepower", 735.49875, 588399, 800, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"decilux", 0.1, 1, 10, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"Pcal", 4184000000000000.0, 4184000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ftUS", 0.3048006096012192, 1200, 3937, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"cV", 0.01, 1, 100, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"nanonewton", 1e-9, 1, 1000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"daF", 10.0, 10, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"petagram", 1000000000000.0, 1000000000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"gigalumen", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"nanolux", 1e-9, 1, 1000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"ug", 1e-9, 1, 1000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"dcd", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"Ohm", 1.0, 1, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"kip", 4448.2216152605, 8896443230521, 2000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"at", 98066.5, 196133, 2, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"pOhm", 1e-12, 1, 1000000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"kilohenry", 1000.0, 1000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"gigaweber", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"kiloelectronvolt", 1.602176634e-16, 801088317, 500000000000000000, -7, {2, 1, -2, 0, 0, 0, 0}},
+        {"Gbar", 100000000000000.0, 100000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"femtobecquerel", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"TPa", 1000000000000.0, 1000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kilojoule", 1000.0, 1000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"nanohenry", 1e-9, 1, 1000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"daS", 10.0, 10, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"hL", 0.1, 1, 10, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"coulomb", 1.0, 1, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"decacoulomb", 10.0, 10, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"kgf", 9.80665, 196133, 20000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"teranewton", 1000000000000.0, 1000000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"picocoulomb", 1e-12, 1, 1000000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"square_foot", 0.09290304, 145161, 1562500, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"foot_candle", 10.763910416709722, 1562500, 145161, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"thm", 105480400.0, 105480400, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"centiliter", 0.00001, 1, 100000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"petakatal", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"nL", 1e-12, 1, 1000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"dV", 0.1, 1, 10, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"kilosievert", 1000.0, 1000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"daH", 10.0, 10, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"megabecquerel", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"ha", 10000.0, 10000, 1, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"hH", 100.0, 100, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"nanowatt_hour", 3.6e-6, 9, 2500000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"Bq", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"henry", 1.0, 1, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"u", 1.6605390666e-27, 8302695333, 500000000000000000, -19, {0, 1, 0, 0, 0, 0, 0}},
+        {"picohertz", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"hGy", 100.0, 100, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"Mlm", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"ks", 1000.0, 1000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"MWh", 3600000000.0, 3600000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"daGy", 10.0, 10, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hpE", 746.0, 746, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"yd", 0.9144, 1143, 1250, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"femtobar", 1e-10, 1, 10000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kiloweber", 1000.0, 1000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"atmosphere", 101325.0, 101325, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"deciwatt", 0.1, 1, 10, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"megahenry", 1000000.0, 1000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"electronvolt", 1.602176634e-19, 801088317, 500000000000000000, -10, {2, 1, -2, 0, 0, 0, 0}},
+        {"terahenry", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"Sv", 1.0, 1, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"petakelvin", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"kT", 1000.0, 1000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"rd", 5.0292, 12573, 2500, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"centicandela", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"uBq", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"megawatt_hour", 3600000000.0, 3600000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"mil", 0.0000254, 127, 5000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"hJ", 100.0, 100, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decabar", 1000000.0, 1000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"GJ", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"centimeter", 0.01, 1, 100, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"gigakatal", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"nanobecquerel", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"microgram", 1e-9, 1, 1000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"GSv", 1000000000.0, 1000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"femtocoulomb", 1e-15, 1, 1000000000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"millibar", 100.0, 100, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"microlumen", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"abampere", 10.0, 10, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"chain", 20.1168, 12573, 625, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"megafarad", 1000000.0, 1000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"centisievert", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"femtosievert", 1e-15, 1, 1000000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"pSv", 1e-12, 1, 1000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hectokelvin", 100.0, 100, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"PK", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"millisievert", 0.001, 1, 1000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"day", 86400.0, 86400, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"fWh", 3.6e-12, 9, 2500000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"megasiemens", 1000000.0, 1000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"inch_of_water", 249.0889, 2490889, 10000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"abA", 10.0, 10, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"fW", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"microbar", 0.1, 1, 10, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"pmol", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"gigabecquerel", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"kcal", 4184.0, 4184, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"gigahenry", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"pK", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"femtoweber", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"ohm", 1.0, 1, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"kkat", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"TJ", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"pL", 1e-15, 1, 1000000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"hSv", 100.0, 100, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"centinewton", 0.01, 1, 100, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"picoliter", 1e-15, 1, 1000000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"dyne", 0.00001, 1, 100000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"%", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"centilumen", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"deV", 1.602176634e-20, 801088317, 500000000000000000, -11, {2, 1, -2, 0, 0, 0, 0}},
+        {"cN", 0.01, 1, 100, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"uGy", 1e-6, 1, 1000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"nJ", 1e-9, 1, 1000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cg", 0.00001, 1, 100000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"dW", 0.1, 1, 10, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"Pbar", 100000000000000000000.0, 1000000000000000000, 1, 2, {-1, 1, -2, 0, 0, 0, 0}},
+        {"decimole", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"uWh", 0.0036, 9, 2500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"femtowatt_hour", 3.6e-12, 9, 2500000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"pound_force", 4.4482216152605, 8896443230521, 2000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"kilowatt_hour", 3600000.0, 3600000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"feV", 1.602176634e-34, 801088317, 500000000000000000, -25, {2, 1, -2, 0, 0, 0, 0}},
+        {"pS", 1e-12, 1, 1000000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"keV", 1.602176634e-16, 801088317, 500000000000000000, -7, {2, 1, -2, 0, 0, 0, 0}},
+        {"GS", 1000000000.0, 1000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"gigaelectronvolt", 1.602176634e-10, 801088317, 500000000000000000, -1, {2, 1, -2, 0, 0, 0, 0}},
+        {"hectoweber", 100.0, 100, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"micromole", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"uV", 1e-6, 1, 1000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"PV", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"milligram", 1e-6, 1, 1000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"microkatal", 1e-6, 1, 1000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"mH", 0.001, 1, 1000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"square_mile", 2589988.110336, 40468564224, 15625, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"femtoampere", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"ampere", 1.0, 1, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"kGy", 1000.0, 1000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"microcandela", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"centielectronvolt", 1.602176634e-21, 801088317, 500000000000000000, -12, {2, 1, -2, 0, 0, 0, 0}},
+        {"mole", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"Wh", 3600.0, 3600, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ns", 1e-9, 1, 1000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"lux", 1.0, 1, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"ceV", 1.602176634e-21, 801088317, 500000000000000000, -12, {2, 1, -2, 0, 0, 0, 0}},
+        {"gigaliter", 1000000.0, 1000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"decasiemens", 10.0, 10, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"hlx", 100.0, 100, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"PC", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"fBq", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"microsiemens", 1e-6, 1, 1000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"decikelvin", 0.1, 1, 10, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"nS", 1e-9, 1, 1000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"cmH2O", 98.0665, 196133, 2000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"klm", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"microliter", 1e-9, 1, 1000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"PSv", 1000000000000000.0, 1000000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"nanomole", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"ozt", 0.0311034768, 19439673, 625000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"ucd", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"foot_pound_force", 1.3558179483314003, 3389544870828501, 2500000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"mbar", 100.0, 100, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kilogray", 1000.0, 1000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"lumen", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"Tmol", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"pWh", 3.6e-9, 9, 2500000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"deciweber", 0.1, 1, 10, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"MA", 1000000.0, 1000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"fT", 1e-15, 1, 1000000000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"teratesla", 1000000000000.0, 1000000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"TT", 1000000000000.0, 1000000000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"gigawatt", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"Plx", 1000000000000000.0, 1000000000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"cuin", 0.000016387064, 2048383, 125000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"milligray", 0.001, 1, 1000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hertz", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"cubic_inch", 0.000016387064, 2048383, 125000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"pHz", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"N", 1.0, 1, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"nanolumen", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"tablespoon", 0.00001478676478125, 473176473, 32000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"millikelvin", 0.001, 1, 1000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"qt", 0.000946352946, 473176473, 500000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"centijoule", 0.01, 1, 100, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"katal", 1.0, 1, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"terasecond", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"dK", 0.1, 1, 10, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"GHz", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"kilosecond", 1000.0, 1000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"galUK", 0.00454609, 454609, 100000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"picosievert", 1e-12, 1, 1000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"W", 1.0, 1, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"Plm", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"pF", 1e-12, 1, 1000000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"picogram", 1e-15, 1, 1000000000000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"deciampere", 0.1, 1, 10, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"watt_hour", 3600.0, 3600, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"terapascal", 1000000000000.0, 1000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"pdl", 0.138254954376, 17281869297, 125000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"nOhm", 1e-9, 1, 1000000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"hectobar", 10000000.0, 10000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"dacal", 41.84, 1046, 25, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"uK", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"das", 10.0, 10, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"light_year", 9460730472580800.0, 9460730472580800, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"femtometer", 1e-15, 1, 1000000000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"daeV", 1.602176634e-18, 801088317, 500000000000000000, -9, {2, 1, -2, 0, 0, 0, 0}},
+        {"millinewton", 0.001, 1, 1000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"petasiemens", 1000000000000000.0, 1000000000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"MOhm", 1000000.0, 1000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"decaampere", 10.0, 10, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"tbsp", 0.00001478676478125, 473176473, 32000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"centibar", 1000.0, 1000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kS", 1000.0, 1000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"dT", 0.1, 1, 10, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"ac", 4046.8564224, 316160658, 78125, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"decaohm", 10.0, 10, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"teaspoon", 4.92892159375e-6, 157725491, 32000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"dkat", 0.1, 1, 10, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"nanosiemens", 1e-9, 1, 1000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"petavolt", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"kn", 0.5144444444444445, 463, 900, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"femtokelvin", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"uN", 1e-6, 1, 1000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"petameter", 1000000000000000.0, 1000000000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"cGy", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"uL", 1e-9, 1, 1000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"decagram", 0.01, 1, 100, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"gigasecond", 1000000000.0, 1000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"meter", 1.0, 1, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"dr", 0.0017718451953125, 45359237, 25600000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"gigabar", 100000000000000.0, 100000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hectosiemens", 100.0, 100, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"Mbar", 100000000000.0, 100000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"TSv", 1000000000000.0, 1000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hW", 100.0, 100, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"parts_per_billion", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"bbl", 0.158987294928, 9936705933, 62500000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"deciwatt_hour", 360.0, 360, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"picofarad", 1e-12, 1, 1000000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"microhenry", 1e-6, 1, 1000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"international_calorie", 4.1868, 10467, 2500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ulm", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"dA", 0.1, 1, 10, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"megacoulomb", 1000000.0, 1000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"newton", 1.0, 1, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"femtohertz", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"degree", 0.017453292519943295, 3490658503988659, 200000000000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"british_thermal_unit", 1055.05585262, 52752792631, 50000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"gigaohm", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"megakelvin", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"femtopascal", 1e-15, 1, 1000000000000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"daWh", 36000.0, 36000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"femtolumen", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"picolumen", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"micronewton", 1e-6, 1, 1000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"fkat", 1e-15, 1, 1000000000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"picogray", 1e-12, 1, 1000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"gigawatt_hour", 3600000000000.0, 3600000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decanewton", 10.0, 10, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"kilohertz", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"millitesla", 0.001, 1, 1000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"maxwell", 1e-8, 1, 100000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"dam", 10.0, 10, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"cOhm", 0.01, 1, 100, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"julian_year", 31557600.0, 31557600, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"PW", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"mA", 0.001, 1, 1000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"centikelvin", 0.01, 1, 100, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"atomic_mass_unit", 1.6605390666e-27, 8302695333, 500000000000000000, -19, {0, 1, 0, 0, 0, 0, 0}},
+        {"ton_force", 8896.443230521, 8896443230521, 1000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"mkat", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"daN", 10.0, 10, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"PWb", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"daBq", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"PeV", 0.0001602176634, 801088317, 5000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decameter", 10.0, 10, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"mS", 0.001, 1, 1000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"ncd", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"ucal", 4.184e-6, 523, 125000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"millihertz", 0.001, 1, 1000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"ncal", 4.184e-9, 523, 125000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decaweber", 10.0, 10, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"dWh", 360.0, 360, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"dalm", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"dGy", 0.1, 1, 10, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"kilocoulomb", 1000.0, 1000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"microgray", 1e-6, 1, 1000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"kilokatal", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"decicalorie", 0.4184, 523, 1250, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"hK", 100.0, 100, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"troy_pound", 0.3732417216, 58319019, 156250000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"kWb", 1000.0, 1000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"km/h", 0.2777777777777778, 5, 18, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"nkat", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"TC", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"centiampere", 0.01, 1, 100, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"megaohm", 1000000.0, 1000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"kilogram", 1.0, 1, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mlx", 0.001, 1, 1000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"ct", 0.0002, 1, 5000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"curie", 37000000000.0, 37000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"gigafarad", 1000000000.0, 1000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"ulx", 1e-6, 1, 1000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"cHz", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"cmol", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"nV", 1e-9, 1, 1000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"GN", 1000000000.0, 1000000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"Tlx", 1000000000000.0, 1000000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"terajoule", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"point", 0.00035277777777777776, 127, 360000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"daA", 10.0, 10, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"dalton", 1.6605390666e-27, 8302695333, 500000000000000000, -19, {0, 1, 0, 0, 0, 0, 0}},
+        {"centihertz", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"femtovolt", 1e-15, 1, 1000000000000000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"nanogray", 1e-9, 1, 1000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"megasievert", 1000000.0, 1000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"mL", 1e-6, 1, 1000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"quad", 1055055852620000000.0, 1055055852620000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cH", 0.01, 1, 100, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"MH", 1000000.0, 1000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"megavolt", 1000000.0, 1000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"nanometer", 1e-9, 1, 1000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"centiwatt_hour", 36.0, 36, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decihenry", 0.1, 1, 10, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"megawatt", 1000000.0, 1000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"decagray", 10.0, 10, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"uA", 1e-6, 1, 1000000, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"daHz", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"pW", 1e-12, 1, 1000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"nanobar", 0.0001, 1, 10000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"calIT", 4.1868, 10467, 2500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"teragram", 1000000000.0, 1000000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"teralux", 1000000000000.0, 1000000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"sqyd", 0.83612736, 1306449, 1562500, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"Mm", 1000000.0, 1000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"barn", 1e-28, 1, 1000000000000000000, -10, {2, 0, 0, 0, 0, 0, 0}},
+        {"megalux", 1000000.0, 1000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"nBq", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"nHz", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"MPa", 1000000.0, 1000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"teraliter", 1000000000.0, 1000000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"daK", 10.0, 10, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"TBq", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"cWb", 0.01, 1, 100, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"PHz", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"decahertz", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"kPa", 1000.0, 1000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"nautical_mile", 1852.0, 1852, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"tesla", 1.0, 1, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"ftlbf", 1.3558179483314003, 3389544870828501, 2500000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"daJ", 10.0, 10, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cal", 4.184, 523, 125, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"PH", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"hectosecond", 100.0, 100, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"picokatal", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"picocandela", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"standard_gravity", 9.80665, 196133, 20000, 0, {1, 0, -2, 0, 0, 0, 0}},
+        {"Glm", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"gigajoule", 1000000000.0, 1000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kiloampere", 1000.0, 1000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"nmol", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"lb", 0.45359237, 45359237, 100000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"dL", 0.0001, 1, 10000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"fc", 10.763910416709722, 1562500, 145161, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"kilometer", 1000.0, 1000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"pound_per_square_inch", 6894.757293168362, 8896443230521, 1290320000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kW", 1000.0, 1000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"petawatt", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"uF", 1e-6, 1, 1000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"nanohertz", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"S", 1.0, 1, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"dS", 0.1, 1, 10, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"petaelectronvolt", 0.0001602176634, 801088317, 5000000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"milliliter", 1e-6, 1, 1000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"ton_of_tnt", 4184000000.0, 4184000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"femtonewton", 1e-15, 1, 1000000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"F", 1.0, 1, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"decafarad", 10.0, 10, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"fF", 1e-15, 1, 1000000000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"calorie", 4.184, 523, 125, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"floz", 0.0000295735295625, 473176473, 16000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"Mcal", 4184000.0, 4184000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"dOhm", 0.1, 1, 10, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"acre", 4046.8564224, 316160658, 78125, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"kbar", 100000000.0, 100000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"PBq", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"decabecquerel", 10.0, 10, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"gigalux", 1000000000.0, 1000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"Mmol", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"hectosievert", 100.0, 100, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"picosiemens", 1e-12, 1, 1000000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"microkelvin", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"decaliter", 0.01, 1, 100, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"centipoise", 0.001, 1, 1000, 0, {-1, 1, -1, 0, 0, 0, 0}},
+        {"millihenry", 0.001, 1, 1000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"revolution", 6.283185307179586, 3141592653589793, 500000000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"troy_ounce", 0.0311034768, 19439673, 625000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"nanoliter", 1e-12, 1, 1000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"uC", 1e-6, 1, 1000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"hectometer", 100.0, 100, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"dm", 0.1, 1, 10, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"fWb", 1e-15, 1, 1000000000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"picoweber", 1e-12, 1, 1000000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"cubic_foot", 0.028316846592, 55306341, 1953125000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"terasievert", 1000000000000.0, 1000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"millielectronvolt", 1.602176634e-22, 801088317, 500000000000000000, -13, {2, 1, -2, 0, 0, 0, 0}},
+        {"kilobar", 100000000.0, 100000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"gigasiemens", 1000000000.0, 1000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"uT", 1e-6, 1, 1000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"femtogray", 1e-15, 1, 1000000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"petagray", 1000000000000000.0, 1000000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"PWh", 3600000000000000000.0, 3600000000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"BTU", 1055.05585262, 52752792631, 50000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"gigameter", 1000000000.0, 1000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"pascal", 1.0, 1, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"us", 1e-6, 1, 1000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"electric_horsepower", 746.0, 746, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"megacandela", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"fps", 0.3048, 381, 1250, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"cS", 0.01, 1, 100, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"hWb", 100.0, 100, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"decasievert", 10.0, 10, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"centipascal", 0.01, 1, 100, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"meV", 1.602176634e-22, 801088317, 500000000000000000, -13, {2, 1, -2, 0, 0, 0, 0}},
+        {"nC", 1e-9, 1, 1000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"daPa", 10.0, 10, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"fC", 1e-15, 1, 1000000000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"A", 1.0, 1, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"dg", 0.0001, 1, 10000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"TWh", 3600000000000000.0, 3600000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"femtoliter", 1e-18, 1, 1000000000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"MHz", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"kilogram_force", 9.80665, 196133, 20000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"Ci", 37000000000.0, 37000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"sqmi", 2589988.110336, 40468564224, 15625, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"weber", 1.0, 1, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"horsepower", 745.6998715822702, 37284993579113511, 50000000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"femtosecond", 1e-15, 1, 1000000000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"ccal", 0.04184, 523, 12500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"cWh", 36.0, 36, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"uJ", 1e-6, 1, 1000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"dram", 0.0017718451953125, 45359237, 25600000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"ppm", 1e-6, 1, 1000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"fm", 1e-15, 1, 1000000000000000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"mSv", 0.001, 1, 1000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"nbar", 0.0001, 1, 10000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"lbf", 4.4482216152605, 8896443230521, 2000000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"poundal", 0.138254954376, 17281869297, 125000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"hectoohm", 100.0, 100, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"shake", 1e-8, 1, 100000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"fs", 1e-15, 1, 1000000000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"J", 1.0, 1, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"pt", 0.000473176473, 473176473, 1000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"kilocandela", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"megahertz", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"GF", 1000000000.0, 1000000000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"GW", 1000000000.0, 1000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"megamole", 1000000.0, 1000000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"pGy", 1e-12, 1, 1000000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"picobecquerel", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"fluid_ounce", 0.0000295735295625, 473176473, 16000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"dmol", 0.1, 1, 10, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"centikatal", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"GBq", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"ch", 20.1168, 12573, 625, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"hectocoulomb", 100.0, 100, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"tTNT", 4184000000.0, 4184000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"picomole", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"MV", 1000000.0, 1000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"poise", 0.1, 1, 10, 0, {-1, 1, -1, 0, 0, 0, 0}},
+        {"petaliter", 1000000000000.0, 1000000000000, 1, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"kilocalorie", 4184.0, 4184, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"short_ton", 907.18474, 45359237, 50000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"petasievert", 1000000000000000.0, 1000000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"kilofarad", 1000.0, 1000, 1, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"picokelvin", 1e-12, 1, 1000000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"millipascal", 0.001, 1, 1000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"Gm", 1000000000.0, 1000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"nW", 1e-9, 1, 1000000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"mlm", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"petasecond", 1000000000000000.0, 1000000000000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"centicoulomb", 0.01, 1, 100, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"TK", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"d", 86400.0, 86400, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"kilolumen", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"teragray", 1000000000000.0, 1000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"hcd", 100.0, 100, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"femtofarad", 1e-15, 1, 1000000000000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"mV", 0.001, 1, 1000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"nGy", 1e-9, 1, 1000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"kilopascal", 1000.0, 1000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"terasiemens", 1000000000000.0, 1000000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"PPa", 1000000000000000.0, 1000000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hectohertz", 100.0, 100, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"microwatt_hour", 0.0036, 9, 2500, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"ton", 907.18474, 45359237, 50000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"picosecond", 1e-12, 1, 1000000000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"kN", 1000.0, 1000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"nT", 1e-9, 1, 1000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"s", 1.0, 1, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"hN", 100.0, 100, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"centitesla", 0.01, 1, 100, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"millisecond", 0.001, 1, 1000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"mWb", 0.001, 1, 1000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"minute", 60.0, 60, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"km", 1000.0, 1000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"GWh", 3600000000000.0, 3600000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"decawatt", 10.0, 10, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"hectotesla", 100.0, 100, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"microsecond", 1e-6, 1, 1000000, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"volt", 1.0, 1, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"inHg", 3386.389, 3386389, 1000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"R", 0.5555555555555556, 5, 9, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"Tcd", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"dlx", 0.1, 1, 10, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"terabecquerel", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"permille", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"GC", 1000000000.0, 1000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"fcd", 1e-15, 1, 1000000000000000, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"PGy", 1000000000000000.0, 1000000000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"TV", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"are", 100.0, 100, 1, 0, {2, 0, 0, 0, 0, 0, 0}},
+        {"stokes", 0.0001, 1, 10000, 0, {2, 0, -1, 0, 0, 0, 0}},
+        {"MN", 1000000.0, 1000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"MT", 1000000.0, 1000000, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"microfarad", 1e-6, 1, 1000000, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"decatesla", 10.0, 10, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"Pa", 1.0, 1, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"TW", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"centilux", 0.01, 1, 100, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"megakatal", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"kilometer_per_hour", 0.2777777777777778, 5, 18, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"mmHg", 133.322387415, 26664477483, 200000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"nanosievert", 1e-9, 1, 1000000000, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"oz", 0.028349523125, 45359237, 1600000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"Da", 1.6605390666e-27, 8302695333, 500000000000000000, -19, {0, 1, 0, 0, 0, 0, 0}},
+        {"picotesla", 1e-12, 1, 1000000000000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"gigacoulomb", 1000000000.0, 1000000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"ckat", 0.01, 1, 100, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"nanokatal", 1e-9, 1, 1000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"PS", 1000000000000000.0, 1000000000000000, 1, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"megasecond", 1000000.0, 1000000, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"gal", 0.003785411784, 473176473, 125000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"uOhm", 1e-6, 1, 1000000, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"cuft", 0.028316846592, 55306341, 1953125000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"plx", 1e-12, 1, 1000000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"gigasievert", 1000000000.0, 1000000000, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"fur", 201.168, 25146, 125, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"foot_per_second", 0.3048, 381, 1250, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"cd", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"kilovolt", 1000.0, 1000, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"rod", 5.0292, 12573, 2500, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"hectocalorie", 418.4, 2092, 5, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"deg", 0.017453292519943295, 3490658503988659, 200000000000000000, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"centigray", 0.01, 1, 100, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"decisiemens", 0.1, 1, 10, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"hour", 3600.0, 3600, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"MC", 1000000.0, 1000000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"cF", 0.01, 1, 100, 0, {-2, -1, 4, 2, 0, 0, 0}},
+        {"petaweber", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"hectovolt", 100.0, 100, 1, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"ubar", 0.1, 1, 10, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kip_per_square_inch", 6894757.293168361, 8896443230521, 1290320, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"kilomole", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"picoelectronvolt", 1.602176634e-31, 801088317, 500000000000000000, -22, {2, 1, -2, 0, 0, 0, 0}},
+        {"THz", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"nlx", 1e-9, 1, 1000000000, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"inH2O", 249.0889, 2490889, 10000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"decacalorie", 41.84, 1046, 25, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"mg", 1e-6, 1, 1000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"mmol", 0.001, 1, 1000, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"damol", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"dSv", 0.1, 1, 10, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"Tm", 1000000000000.0, 1000000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"picobar", 1e-7, 1, 10000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"fS", 1e-15, 1, 1000000000000000, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"cPa", 0.01, 1, 100, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"hectowatt_hour", 360000.0, 360000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kilobecquerel", 1000.0, 1000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"petaohm", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"terakatal", 1000000000000.0, 1000000000000, 1, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"millimeter", 0.001, 1, 1000, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"H", 1.0, 1, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"pWb", 1e-12, 1, 1000000000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"uPa", 1e-6, 1, 1000000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"MBq", 1000000.0, 1000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"gauss", 0.0001, 1, 10000, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"GA", 1000000000.0, 1000000000, 1, 0, {0, 0, 0, 1, 0, 0, 0}},
+        {"hectowatt", 100.0, 100, 1, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"dacd", 10.0, 10, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"megagram", 1000.0, 1000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"microcalorie", 4.184e-6, 523, 125000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"percent", 0.01, 1, 100, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"kiloohm", 1000.0, 1000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"PJ", 1000000000000000.0, 1000000000000000, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"microjoule", 1e-6, 1, 1000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"kK", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"tsp", 4.92892159375e-6, 157725491, 32000000000000, 0, {3, 0, 0, 0, 0, 0, 0}},
+        {"candela", 1.0, 1, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+        {"hectopascal", 100.0, 100, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"slug", 14.593902937206364, 8896443230521, 609600000000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"Tg", 1000000000.0, 1000000000, 1, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"decajoule", 10.0, 10, 1, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"mN", 0.001, 1, 1000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"psi", 6894.757293168362, 8896443230521, 1290320000, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"Tbar", 100000000000000000.0, 100000000000000000, 1, 0, {-1, 1, -2, 0, 0, 0, 0}},
+        {"nH", 1e-9, 1, 1000000000, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"millivolt", 0.001, 1, 1000, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"nK", 1e-9, 1, 1000000000, 0, {0, 0, 0, 0, 1, 0, 0}},
+        {"hs", 100.0, 100, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"deciohm", 0.1, 1, 10, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"h", 3600.0, 3600, 1, 0, {0, 0, 1, 0, 0, 0, 0}},
+        {"mile", 1609.344, 201168, 125, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"kH", 1000.0, 1000, 1, 0, {2, 1, -2, -2, 0, 0, 0}},
+        {"kC", 1000.0, 1000, 1, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"terameter", 1000000000000.0, 1000000000000, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"nanocoulomb", 1e-9, 1, 1000000000, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"kmol", 1000.0, 1000, 1, 0, {0, 0, 0, 0, 0, 1, 0}},
+        {"cC", 0.01, 1, 100, 0, {0, 0, 1, 1, 0, 0, 0}},
+        {"parsec", 30856775814913672.0, 30856775814913673, 1, 0, {1, 0, 0, 0, 0, 0, 0}},
+        {"nN", 1e-9, 1, 1000000000, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"sievert", 1.0, 1, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"petalux", 1000000000000000.0, 1000000000000000, 1, 0, {-2, 0, 0, 0, 0, 0, 1}},
+        {"centisiemens", 0.01, 1, 100, 0, {-2, -1, 3, 2, 0, 0, 0}},
+        {"gigahertz", 1000000000.0, 1000000000, 1, 0, {0, 0, -1, 0, 0, 0, 0}},
+        {"decivolt", 0.1, 1, 10, 0, {2, 1, -3, -1, 0, 0, 0}},
+        {"TOhm", 1000000000000.0, 1000000000000, 1, 0, {2, 1, -3, -2, 0, 0, 0}},
+        {"TR", 3516.8528420666667, 52752792631, 15000000, 0, {2, 1, -3, 0, 0, 0, 0}},
+        {"meganewton", 1000000.0, 1000000, 1, 0, {1, 1, -2, 0, 0, 0, 0}},
+        {"Gy", 1.0, 1, 1, 0, {2, 0, -2, 0, 0, 0, 0}},
+        {"Mx", 1e-8, 1, 100000000, 0, {2, 1, -2, -1, 0, 0, 0}},
+        {"decigram", 0.0001, 1, 10000, 0, {0, 1, 0, 0, 0, 0, 0}},
+        {"daT", 10.0, 10, 1, 0, {0, 1, -2, -1, 0, 0, 0}},
+        {"decielectronvolt", 1.602176634e-20, 801088317, 500000000000000000, -11, {2, 1, -2, 0, 0, 0, 0}},
+        {"pkat", 1e-12, 1, 1000000000000, 0, {0, 0, -1, 0, 0, 1, 0}},
+        {"mile_per_hour", 0.44704, 1397, 3125, 0, {1, 0, -1, 0, 0, 0, 0}},
+        {"nanocalorie", 4.184e-9, 523, 125000000000, 0, {2, 1, -2, 0, 0, 0, 0}},
+        {"teralumen", 1000000000000.0, 1000000000000, 1, 0, {0, 0, 0, 0, 0, 0, 1}},
+    };
+
+    static constexpr helper::hash::THash displacements[569] = {
+        4u, 0u, 1u, 1u, 2u, 10u, 3u, 2u, 1u, 0u, 0u, 2u, 0u, 11u, 23u, 2u,
+        2u, 8u, 3u, 3u, 0u, 1u, 2u, 5u, 2u, 1u, 1u, 18u, 1u, 11u, 3u, 2u,
+        2u, 3u, 6u, 2u, 2u, 0u, 13u, 13u, 0u, 5u, 4u, 4u, 2u, 6u, 5u, 3u,
+        3u, 4u, 0u, 2u, 2u, 5u, 14u, 4u, 9u, 24u, 0u, 1u, 9u, 26u, 3u, 7u,
+        1u, 2u, 5u, 14u, 2u, 9u, 8u, 4u, 1u, 1u, 10u, 2u, 7u, 5u, 1u, 1u,
+        20u, 3u, 9u, 11u, 8u, 13u, 1u, 0u, 6u, 3u, 19u, 1u, 11u, 1u, 1u, 7u,
+        5u, 0u, 44u, 0u, 13u, 5u, 5u, 2u, 15u, 1u, 3u, 0u, 1u, 13u, 1u, 2u,
+        8u, 1u, 24u, 0u, 6u, 1u, 10u, 2u, 0u, 1u, 1u, 5u, 5u, 14u, 6u, 1u,
+        1u, 7u, 17u, 11u, 4u, 4u, 9u, 11u, 5u, 5u, 17u, 2u, 16u, 17u, 0u, 6u,
+        0u, 0u, 0u, 0u, 6u, 0u, 8u, 7u, 4u, 0u, 3u, 1u, 0u, 9u, 1u, 2u,
+        2u, 8u, 25u, 0u, 12u, 0u, 0u, 2u, 12u, 2u, 3u, 1u, 8u, 3u, 14u, 2u,
+        1u, 3u, 1u, 2u, 4u, 3u, 6u, 6u, 4u, 3u, 16u, 12u, 17u, 24u, 9u, 2u,
+        4u, 2u, 0u, 15u, 1u, 22u, 0u, 0u, 3u, 5u, 8u, 11u, 1u, 1u, 12u, 100u,
+        4u, 6u, 2u, 4u, 0u, 0u, 18u, 15u, 0u, 9u, 11u, 7u, 5u, 2u, 17u, 3u,
+        0u, 0u, 1u, 20u, 17u, 0u, 20u, 4u, 0u, 1u, 6u, 7u, 0u, 0u, 12u, 1u,
+        15u, 20u, 1u, 1u, 4u, 4u, 3u, 9u, 17u, 17u, 0u, 1u, 3u, 15u, 1u, 2u,
+        1u, 2u, 21u, 22u, 4u, 1u, 8u, 5u, 2u, 2u, 6u, 8u, 21u, 3u, 6u, 0u,
+        0u, 4u, 17u, 12u, 1u, 0u, 1u, 0u, 2u, 2u, 0u, 8u, 3u, 2u, 0u, 36u,
+        7u, 1u, 0u, 4u, 0u, 8u, 3u, 1u, 4u, 6u, 3u, 1u, 24u, 1u, 0u, 1u,
+        2u, 1u, 1u, 2u, 3u, 22u, 4u, 14u, 15u, 2u, 1u, 1u, 8u, 1u, 7u, 2u,
+        1u, 7u, 8u, 2u, 21u, 3u, 41u, 20u, 9u, 1u, 4u, 1u, 19u, 5u, 1u, 3u,
+        32u, 3u, 10u, 8u, 17u, 3u, 15u, 0u, 11u, 29u, 11u, 1u, 9u, 16u, 7u, 4u,
+        0u, 6u, 30u, 8u, 9u, 1u, 3u, 20u, 58u, 0u, 92u, 1u, 49u, 6u, 0u, 20u,
+        3u, 14u, 19u, 39u, 21u, 1u, 0u, 86u, 24u, 25u, 14u, 18u, 6u, 8u, 2u, 44u,
+        28u, 25u, 25u, 24u, 1u, 19u, 3u, 31u, 3u, 9u, 2u, 10u, 13u, 1u, 10u, 6u,
+        57u, 1u, 1u, 53u, 6u, 2u, 24u, 33u, 1u, 4u, 26u, 10u, 1u, 27u, 15u, 26u,
+        1u, 19u, 33u, 35u, 5u, 2u, 0u, 2u, 13u, 0u, 7u, 2u, 7u, 40u, 78u, 5u,
+        59u, 0u, 0u, 1u, 62u, 0u, 3u, 2u, 2u, 17u, 5u, 12u, 7u, 11u, 0u, 0u,
+        27u, 0u, 5u, 122u, 45u, 0u, 41u, 22u, 21u, 29u, 3u, 2u, 1u, 0u, 3u, 94u,
+        20u, 63u, 8u, 116u, 30u, 4u, 111u, 6u, 8u, 139u, 56u, 61u, 93u, 7u, 11u, 6u,
+        59u, 93u, 3u, 44u, 10u, 5u, 3u, 140u, 3u, 15u, 8u, 113u, 15u, 51u, 45u, 0u,
+        108u, 0u, 42u, 19u, 14u, 4u, 55u, 4u, 16u, 0u, 31u, 4u, 0u, 21u, 7u, 1u,
+        18u, 36u, 4u, 51u, 405u, 8u, 99u, 3u, 45u, 0u, 2u, 54u, 16u, 0u, 12u, 4u,
+        2u, 1u, 11u, 35u, 3u, 64u, 33u, 275u, 6u, 15u, 39u, 3u, 13u, 0u, 98u, 36u,
+        1u, 11u, 25u, 33u, 0u, 36u, 1u, 347u, 1u, 0u, 72u, 141u, 7u, 14u, 1u, 477u,
+        4u, 24u, 88u, 702u, 63u, 48u, 4u, 10u, 8u,
+    };
+};
+
+template <typename T> constexpr Entry Table<T>::entries[1136];
+template <typename T> constexpr helper::hash::THash Table<T>::displacements[569];
+}
+
+/**
+ * conversion entry of a unit name or symbol, nullptr if the unit is not in the catalog
+ */
+inline Entry const* find(char const* name, std::size_t length) {
+    return helper::hash::find(table::Table<>::entries, table::Table<>::displacements, name, length);
+}
+
+inline Entry const* find(std::string const& name) { return find(name.data(), name.size()); }
+
+/**
+ * value given in the unit name as quantity, false if the unit is unknown or of another dimension than U
+ */
+template <typename U, typename T>
+bool to_quantity(T const& value, std::string const& name, Quantity<U, T>& out) {
+    return unit::to_quantity(find(name), value, out);
+}
+
+}// namespace conversion
+}// namespace unit
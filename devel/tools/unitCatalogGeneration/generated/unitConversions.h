@@ -0,0 +1,1124 @@
+#pragma once
+
+/**********************generated from unitCatalog.txt by UnitCatalogGenerator**********************/
+
+#include <src/quantity/quantityConversion.h>
+#include <src/quantity/quantityDefinitionsSI.h>
+
+#include <ratio>
+
+namespace unit {
+namespace conversion {
+
+namespace exact {
+
+using                       femtometer = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picometer = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanometer = exact_factor<std::ratio<1, 1000000000>>;
+using                       micrometer = exact_factor<std::ratio<1, 1000000>>;
+using                       millimeter = exact_factor<std::ratio<1, 1000>>;
+using                       centimeter = exact_factor<std::ratio<1, 100>>;
+using                        decimeter = exact_factor<std::ratio<1, 10>>;
+using                        decameter = exact_factor<std::ratio<10, 1>>;
+using                       hectometer = exact_factor<std::ratio<100, 1>>;
+using                        kilometer = exact_factor<std::ratio<1000, 1>>;
+using                        megameter = exact_factor<std::ratio<1000000, 1>>;
+using                        gigameter = exact_factor<std::ratio<1000000000, 1>>;
+using                        terameter = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petameter = exact_factor<std::ratio<1000000000000000, 1>>;
+using                             gram = exact_factor<std::ratio<1, 1000>>;
+using                        femtogram = exact_factor<std::ratio<1, 1000000000000000000>>;
+using                         picogram = exact_factor<std::ratio<1, 1000000000000000>>;
+using                         nanogram = exact_factor<std::ratio<1, 1000000000000>>;
+using                        microgram = exact_factor<std::ratio<1, 1000000000>>;
+using                        milligram = exact_factor<std::ratio<1, 1000000>>;
+using                        centigram = exact_factor<std::ratio<1, 100000>>;
+using                         decigram = exact_factor<std::ratio<1, 10000>>;
+using                         decagram = exact_factor<std::ratio<1, 100>>;
+using                        hectogram = exact_factor<std::ratio<1, 10>>;
+using                         megagram = exact_factor<std::ratio<1000, 1>>;
+using                         gigagram = exact_factor<std::ratio<1000000, 1>>;
+using                         teragram = exact_factor<std::ratio<1000000000, 1>>;
+using                         petagram = exact_factor<std::ratio<1000000000000, 1>>;
+using                      femtosecond = exact_factor<std::ratio<1, 1000000000000000>>;
+using                       picosecond = exact_factor<std::ratio<1, 1000000000000>>;
+using                       nanosecond = exact_factor<std::ratio<1, 1000000000>>;
+using                      microsecond = exact_factor<std::ratio<1, 1000000>>;
+using                      millisecond = exact_factor<std::ratio<1, 1000>>;
+using                      centisecond = exact_factor<std::ratio<1, 100>>;
+using                       decisecond = exact_factor<std::ratio<1, 10>>;
+using                       decasecond = exact_factor<std::ratio<10, 1>>;
+using                      hectosecond = exact_factor<std::ratio<100, 1>>;
+using                       kilosecond = exact_factor<std::ratio<1000, 1>>;
+using                       megasecond = exact_factor<std::ratio<1000000, 1>>;
+using                       gigasecond = exact_factor<std::ratio<1000000000, 1>>;
+using                       terasecond = exact_factor<std::ratio<1000000000000, 1>>;
+using                       petasecond = exact_factor<std::ratio<1000000000000000, 1>>;
+using                      femtoampere = exact_factor<std::ratio<1, 1000000000000000>>;
+using                       picoampere = exact_factor<std::ratio<1, 1000000000000>>;
+using                       nanoampere = exact_factor<std::ratio<1, 1000000000>>;
+using                      microampere = exact_factor<std::ratio<1, 1000000>>;
+using                      milliampere = exact_factor<std::ratio<1, 1000>>;
+using                      centiampere = exact_factor<std::ratio<1, 100>>;
+using                       deciampere = exact_factor<std::ratio<1, 10>>;
+using                       decaampere = exact_factor<std::ratio<10, 1>>;
+using                      hectoampere = exact_factor<std::ratio<100, 1>>;
+using                       kiloampere = exact_factor<std::ratio<1000, 1>>;
+using                       megaampere = exact_factor<std::ratio<1000000, 1>>;
+using                       gigaampere = exact_factor<std::ratio<1000000000, 1>>;
+using                       teraampere = exact_factor<std::ratio<1000000000000, 1>>;
+using                       petaampere = exact_factor<std::ratio<1000000000000000, 1>>;
+using                      femtokelvin = exact_factor<std::ratio<1, 1000000000000000>>;
+using                       picokelvin = exact_factor<std::ratio<1, 1000000000000>>;
+using                       nanokelvin = exact_factor<std::ratio<1, 1000000000>>;
+using                      microkelvin = exact_factor<std::ratio<1, 1000000>>;
+using                      millikelvin = exact_factor<std::ratio<1, 1000>>;
+using                      centikelvin = exact_factor<std::ratio<1, 100>>;
+using                       decikelvin = exact_factor<std::ratio<1, 10>>;
+using                       decakelvin = exact_factor<std::ratio<10, 1>>;
+using                      hectokelvin = exact_factor<std::ratio<100, 1>>;
+using                       kilokelvin = exact_factor<std::ratio<1000, 1>>;
+using                       megakelvin = exact_factor<std::ratio<1000000, 1>>;
+using                       gigakelvin = exact_factor<std::ratio<1000000000, 1>>;
+using                       terakelvin = exact_factor<std::ratio<1000000000000, 1>>;
+using                       petakelvin = exact_factor<std::ratio<1000000000000000, 1>>;
+using                        femtomole = exact_factor<std::ratio<1, 1000000000000000>>;
+using                         picomole = exact_factor<std::ratio<1, 1000000000000>>;
+using                         nanomole = exact_factor<std::ratio<1, 1000000000>>;
+using                        micromole = exact_factor<std::ratio<1, 1000000>>;
+using                        millimole = exact_factor<std::ratio<1, 1000>>;
+using                        centimole = exact_factor<std::ratio<1, 100>>;
+using                         decimole = exact_factor<std::ratio<1, 10>>;
+using                         decamole = exact_factor<std::ratio<10, 1>>;
+using                        hectomole = exact_factor<std::ratio<100, 1>>;
+using                         kilomole = exact_factor<std::ratio<1000, 1>>;
+using                         megamole = exact_factor<std::ratio<1000000, 1>>;
+using                         gigamole = exact_factor<std::ratio<1000000000, 1>>;
+using                         teramole = exact_factor<std::ratio<1000000000000, 1>>;
+using                         petamole = exact_factor<std::ratio<1000000000000000, 1>>;
+using                     femtocandela = exact_factor<std::ratio<1, 1000000000000000>>;
+using                      picocandela = exact_factor<std::ratio<1, 1000000000000>>;
+using                      nanocandela = exact_factor<std::ratio<1, 1000000000>>;
+using                     microcandela = exact_factor<std::ratio<1, 1000000>>;
+using                     millicandela = exact_factor<std::ratio<1, 1000>>;
+using                     centicandela = exact_factor<std::ratio<1, 100>>;
+using                      decicandela = exact_factor<std::ratio<1, 10>>;
+using                      decacandela = exact_factor<std::ratio<10, 1>>;
+using                     hectocandela = exact_factor<std::ratio<100, 1>>;
+using                      kilocandela = exact_factor<std::ratio<1000, 1>>;
+using                      megacandela = exact_factor<std::ratio<1000000, 1>>;
+using                      gigacandela = exact_factor<std::ratio<1000000000, 1>>;
+using                      teracandela = exact_factor<std::ratio<1000000000000, 1>>;
+using                      petacandela = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtohertz = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picohertz = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanohertz = exact_factor<std::ratio<1, 1000000000>>;
+using                       microhertz = exact_factor<std::ratio<1, 1000000>>;
+using                       millihertz = exact_factor<std::ratio<1, 1000>>;
+using                       centihertz = exact_factor<std::ratio<1, 100>>;
+using                        decihertz = exact_factor<std::ratio<1, 10>>;
+using                        decahertz = exact_factor<std::ratio<10, 1>>;
+using                       hectohertz = exact_factor<std::ratio<100, 1>>;
+using                        kilohertz = exact_factor<std::ratio<1000, 1>>;
+using                        megahertz = exact_factor<std::ratio<1000000, 1>>;
+using                        gigahertz = exact_factor<std::ratio<1000000000, 1>>;
+using                        terahertz = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petahertz = exact_factor<std::ratio<1000000000000000, 1>>;
+using                      femtonewton = exact_factor<std::ratio<1, 1000000000000000>>;
+using                       piconewton = exact_factor<std::ratio<1, 1000000000000>>;
+using                       nanonewton = exact_factor<std::ratio<1, 1000000000>>;
+using                      micronewton = exact_factor<std::ratio<1, 1000000>>;
+using                      millinewton = exact_factor<std::ratio<1, 1000>>;
+using                      centinewton = exact_factor<std::ratio<1, 100>>;
+using                       decinewton = exact_factor<std::ratio<1, 10>>;
+using                       decanewton = exact_factor<std::ratio<10, 1>>;
+using                      hectonewton = exact_factor<std::ratio<100, 1>>;
+using                       kilonewton = exact_factor<std::ratio<1000, 1>>;
+using                       meganewton = exact_factor<std::ratio<1000000, 1>>;
+using                       giganewton = exact_factor<std::ratio<1000000000, 1>>;
+using                       teranewton = exact_factor<std::ratio<1000000000000, 1>>;
+using                       petanewton = exact_factor<std::ratio<1000000000000000, 1>>;
+using                      femtopascal = exact_factor<std::ratio<1, 1000000000000000>>;
+using                       picopascal = exact_factor<std::ratio<1, 1000000000000>>;
+using                       nanopascal = exact_factor<std::ratio<1, 1000000000>>;
+using                      micropascal = exact_factor<std::ratio<1, 1000000>>;
+using                      millipascal = exact_factor<std::ratio<1, 1000>>;
+using                      centipascal = exact_factor<std::ratio<1, 100>>;
+using                       decipascal = exact_factor<std::ratio<1, 10>>;
+using                       decapascal = exact_factor<std::ratio<10, 1>>;
+using                      hectopascal = exact_factor<std::ratio<100, 1>>;
+using                       kilopascal = exact_factor<std::ratio<1000, 1>>;
+using                       megapascal = exact_factor<std::ratio<1000000, 1>>;
+using                       gigapascal = exact_factor<std::ratio<1000000000, 1>>;
+using                       terapascal = exact_factor<std::ratio<1000000000000, 1>>;
+using                       petapascal = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtojoule = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picojoule = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanojoule = exact_factor<std::ratio<1, 1000000000>>;
+using                       microjoule = exact_factor<std::ratio<1, 1000000>>;
+using                       millijoule = exact_factor<std::ratio<1, 1000>>;
+using                       centijoule = exact_factor<std::ratio<1, 100>>;
+using                        decijoule = exact_factor<std::ratio<1, 10>>;
+using                        decajoule = exact_factor<std::ratio<10, 1>>;
+using                       hectojoule = exact_factor<std::ratio<100, 1>>;
+using                        kilojoule = exact_factor<std::ratio<1000, 1>>;
+using                        megajoule = exact_factor<std::ratio<1000000, 1>>;
+using                        gigajoule = exact_factor<std::ratio<1000000000, 1>>;
+using                        terajoule = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petajoule = exact_factor<std::ratio<1000000000000000, 1>>;
+using                        femtowatt = exact_factor<std::ratio<1, 1000000000000000>>;
+using                         picowatt = exact_factor<std::ratio<1, 1000000000000>>;
+using                         nanowatt = exact_factor<std::ratio<1, 1000000000>>;
+using                        microwatt = exact_factor<std::ratio<1, 1000000>>;
+using                        milliwatt = exact_factor<std::ratio<1, 1000>>;
+using                        centiwatt = exact_factor<std::ratio<1, 100>>;
+using                         deciwatt = exact_factor<std::ratio<1, 10>>;
+using                         decawatt = exact_factor<std::ratio<10, 1>>;
+using                        hectowatt = exact_factor<std::ratio<100, 1>>;
+using                         kilowatt = exact_factor<std::ratio<1000, 1>>;
+using                         megawatt = exact_factor<std::ratio<1000000, 1>>;
+using                         gigawatt = exact_factor<std::ratio<1000000000, 1>>;
+using                         terawatt = exact_factor<std::ratio<1000000000000, 1>>;
+using                         petawatt = exact_factor<std::ratio<1000000000000000, 1>>;
+using                     femtocoulomb = exact_factor<std::ratio<1, 1000000000000000>>;
+using                      picocoulomb = exact_factor<std::ratio<1, 1000000000000>>;
+using                      nanocoulomb = exact_factor<std::ratio<1, 1000000000>>;
+using                     microcoulomb = exact_factor<std::ratio<1, 1000000>>;
+using                     millicoulomb = exact_factor<std::ratio<1, 1000>>;
+using                     centicoulomb = exact_factor<std::ratio<1, 100>>;
+using                      decicoulomb = exact_factor<std::ratio<1, 10>>;
+using                      decacoulomb = exact_factor<std::ratio<10, 1>>;
+using                     hectocoulomb = exact_factor<std::ratio<100, 1>>;
+using                      kilocoulomb = exact_factor<std::ratio<1000, 1>>;
+using                      megacoulomb = exact_factor<std::ratio<1000000, 1>>;
+using                      gigacoulomb = exact_factor<std::ratio<1000000000, 1>>;
+using                      teracoulomb = exact_factor<std::ratio<1000000000000, 1>>;
+using                      petacoulomb = exact_factor<std::ratio<1000000000000000, 1>>;
+using                        femtovolt = exact_factor<std::ratio<1, 1000000000000000>>;
+using                         picovolt = exact_factor<std::ratio<1, 1000000000000>>;
+using                         nanovolt = exact_factor<std::ratio<1, 1000000000>>;
+using                        microvolt = exact_factor<std::ratio<1, 1000000>>;
+using                        millivolt = exact_factor<std::ratio<1, 1000>>;
+using                        centivolt = exact_factor<std::ratio<1, 100>>;
+using                         decivolt = exact_factor<std::ratio<1, 10>>;
+using                         decavolt = exact_factor<std::ratio<10, 1>>;
+using                        hectovolt = exact_factor<std::ratio<100, 1>>;
+using                         kilovolt = exact_factor<std::ratio<1000, 1>>;
+using                         megavolt = exact_factor<std::ratio<1000000, 1>>;
+using                         gigavolt = exact_factor<std::ratio<1000000000, 1>>;
+using                         teravolt = exact_factor<std::ratio<1000000000000, 1>>;
+using                         petavolt = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtofarad = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picofarad = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanofarad = exact_factor<std::ratio<1, 1000000000>>;
+using                       microfarad = exact_factor<std::ratio<1, 1000000>>;
+using                       millifarad = exact_factor<std::ratio<1, 1000>>;
+using                       centifarad = exact_factor<std::ratio<1, 100>>;
+using                        decifarad = exact_factor<std::ratio<1, 10>>;
+using                        decafarad = exact_factor<std::ratio<10, 1>>;
+using                       hectofarad = exact_factor<std::ratio<100, 1>>;
+using                        kilofarad = exact_factor<std::ratio<1000, 1>>;
+using                        megafarad = exact_factor<std::ratio<1000000, 1>>;
+using                        gigafarad = exact_factor<std::ratio<1000000000, 1>>;
+using                        terafarad = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petafarad = exact_factor<std::ratio<1000000000000000, 1>>;
+using                         femtoohm = exact_factor<std::ratio<1, 1000000000000000>>;
+using                          picoohm = exact_factor<std::ratio<1, 1000000000000>>;
+using                          nanoohm = exact_factor<std::ratio<1, 1000000000>>;
+using                         microohm = exact_factor<std::ratio<1, 1000000>>;
+using                         milliohm = exact_factor<std::ratio<1, 1000>>;
+using                         centiohm = exact_factor<std::ratio<1, 100>>;
+using                          deciohm = exact_factor<std::ratio<1, 10>>;
+using                          decaohm = exact_factor<std::ratio<10, 1>>;
+using                         hectoohm = exact_factor<std::ratio<100, 1>>;
+using                          kiloohm = exact_factor<std::ratio<1000, 1>>;
+using                          megaohm = exact_factor<std::ratio<1000000, 1>>;
+using                          gigaohm = exact_factor<std::ratio<1000000000, 1>>;
+using                          teraohm = exact_factor<std::ratio<1000000000000, 1>>;
+using                          petaohm = exact_factor<std::ratio<1000000000000000, 1>>;
+using                     femtosiemens = exact_factor<std::ratio<1, 1000000000000000>>;
+using                      picosiemens = exact_factor<std::ratio<1, 1000000000000>>;
+using                      nanosiemens = exact_factor<std::ratio<1, 1000000000>>;
+using                     microsiemens = exact_factor<std::ratio<1, 1000000>>;
+using                     millisiemens = exact_factor<std::ratio<1, 1000>>;
+using                     centisiemens = exact_factor<std::ratio<1, 100>>;
+using                      decisiemens = exact_factor<std::ratio<1, 10>>;
+using                      decasiemens = exact_factor<std::ratio<10, 1>>;
+using                     hectosiemens = exact_factor<std::ratio<100, 1>>;
+using                      kilosiemens = exact_factor<std::ratio<1000, 1>>;
+using                      megasiemens = exact_factor<std::ratio<1000000, 1>>;
+using                      gigasiemens = exact_factor<std::ratio<1000000000, 1>>;
+using                      terasiemens = exact_factor<std::ratio<1000000000000, 1>>;
+using                      petasiemens = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtoweber = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picoweber = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanoweber = exact_factor<std::ratio<1, 1000000000>>;
+using                       microweber = exact_factor<std::ratio<1, 1000000>>;
+using                       milliweber = exact_factor<std::ratio<1, 1000>>;
+using                       centiweber = exact_factor<std::ratio<1, 100>>;
+using                        deciweber = exact_factor<std::ratio<1, 10>>;
+using                        decaweber = exact_factor<std::ratio<10, 1>>;
+using                       hectoweber = exact_factor<std::ratio<100, 1>>;
+using                        kiloweber = exact_factor<std::ratio<1000, 1>>;
+using                        megaweber = exact_factor<std::ratio<1000000, 1>>;
+using                        gigaweber = exact_factor<std::ratio<1000000000, 1>>;
+using                        teraweber = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petaweber = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtotesla = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picotesla = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanotesla = exact_factor<std::ratio<1, 1000000000>>;
+using                       microtesla = exact_factor<std::ratio<1, 1000000>>;
+using                       millitesla = exact_factor<std::ratio<1, 1000>>;
+using                       centitesla = exact_factor<std::ratio<1, 100>>;
+using                        decitesla = exact_factor<std::ratio<1, 10>>;
+using                        decatesla = exact_factor<std::ratio<10, 1>>;
+using                       hectotesla = exact_factor<std::ratio<100, 1>>;
+using                        kilotesla = exact_factor<std::ratio<1000, 1>>;
+using                        megatesla = exact_factor<std::ratio<1000000, 1>>;
+using                        gigatesla = exact_factor<std::ratio<1000000000, 1>>;
+using                        teratesla = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petatesla = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtohenry = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picohenry = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanohenry = exact_factor<std::ratio<1, 1000000000>>;
+using                       microhenry = exact_factor<std::ratio<1, 1000000>>;
+using                       millihenry = exact_factor<std::ratio<1, 1000>>;
+using                       centihenry = exact_factor<std::ratio<1, 100>>;
+using                        decihenry = exact_factor<std::ratio<1, 10>>;
+using                        decahenry = exact_factor<std::ratio<10, 1>>;
+using                       hectohenry = exact_factor<std::ratio<100, 1>>;
+using                        kilohenry = exact_factor<std::ratio<1000, 1>>;
+using                        megahenry = exact_factor<std::ratio<1000000, 1>>;
+using                        gigahenry = exact_factor<std::ratio<1000000000, 1>>;
+using                        terahenry = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petahenry = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtolumen = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picolumen = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanolumen = exact_factor<std::ratio<1, 1000000000>>;
+using                       microlumen = exact_factor<std::ratio<1, 1000000>>;
+using                       millilumen = exact_factor<std::ratio<1, 1000>>;
+using                       centilumen = exact_factor<std::ratio<1, 100>>;
+using                        decilumen = exact_factor<std::ratio<1, 10>>;
+using                        decalumen = exact_factor<std::ratio<10, 1>>;
+using                       hectolumen = exact_factor<std::ratio<100, 1>>;
+using                        kilolumen = exact_factor<std::ratio<1000, 1>>;
+using                        megalumen = exact_factor<std::ratio<1000000, 1>>;
+using                        gigalumen = exact_factor<std::ratio<1000000000, 1>>;
+using                        teralumen = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petalumen = exact_factor<std::ratio<1000000000000000, 1>>;
+using                         femtolux = exact_factor<std::ratio<1, 1000000000000000>>;
+using                          picolux = exact_factor<std::ratio<1, 1000000000000>>;
+using                          nanolux = exact_factor<std::ratio<1, 1000000000>>;
+using                         microlux = exact_factor<std::ratio<1, 1000000>>;
+using                         millilux = exact_factor<std::ratio<1, 1000>>;
+using                         centilux = exact_factor<std::ratio<1, 100>>;
+using                          decilux = exact_factor<std::ratio<1, 10>>;
+using                          decalux = exact_factor<std::ratio<10, 1>>;
+using                         hectolux = exact_factor<std::ratio<100, 1>>;
+using                          kilolux = exact_factor<std::ratio<1000, 1>>;
+using                          megalux = exact_factor<std::ratio<1000000, 1>>;
+using                          gigalux = exact_factor<std::ratio<1000000000, 1>>;
+using                          teralux = exact_factor<std::ratio<1000000000000, 1>>;
+using                          petalux = exact_factor<std::ratio<1000000000000000, 1>>;
+using                   femtobecquerel = exact_factor<std::ratio<1, 1000000000000000>>;
+using                    picobecquerel = exact_factor<std::ratio<1, 1000000000000>>;
+using                    nanobecquerel = exact_factor<std::ratio<1, 1000000000>>;
+using                   microbecquerel = exact_factor<std::ratio<1, 1000000>>;
+using                   millibecquerel = exact_factor<std::ratio<1, 1000>>;
+using                   centibecquerel = exact_factor<std::ratio<1, 100>>;
+using                    decibecquerel = exact_factor<std::ratio<1, 10>>;
+using                    decabecquerel = exact_factor<std::ratio<10, 1>>;
+using                   hectobecquerel = exact_factor<std::ratio<100, 1>>;
+using                    kilobecquerel = exact_factor<std::ratio<1000, 1>>;
+using                    megabecquerel = exact_factor<std::ratio<1000000, 1>>;
+using                    gigabecquerel = exact_factor<std::ratio<1000000000, 1>>;
+using                    terabecquerel = exact_factor<std::ratio<1000000000000, 1>>;
+using                    petabecquerel = exact_factor<std::ratio<1000000000000000, 1>>;
+using                        femtogray = exact_factor<std::ratio<1, 1000000000000000>>;
+using                         picogray = exact_factor<std::ratio<1, 1000000000000>>;
+using                         nanogray = exact_factor<std::ratio<1, 1000000000>>;
+using                        microgray = exact_factor<std::ratio<1, 1000000>>;
+using                        milligray = exact_factor<std::ratio<1, 1000>>;
+using                        centigray = exact_factor<std::ratio<1, 100>>;
+using                         decigray = exact_factor<std::ratio<1, 10>>;
+using                         decagray = exact_factor<std::ratio<10, 1>>;
+using                        hectogray = exact_factor<std::ratio<100, 1>>;
+using                         kilogray = exact_factor<std::ratio<1000, 1>>;
+using                         megagray = exact_factor<std::ratio<1000000, 1>>;
+using                         gigagray = exact_factor<std::ratio<1000000000, 1>>;
+using                         teragray = exact_factor<std::ratio<1000000000000, 1>>;
+using                         petagray = exact_factor<std::ratio<1000000000000000, 1>>;
+using                     femtosievert = exact_factor<std::ratio<1, 1000000000000000>>;
+using                      picosievert = exact_factor<std::ratio<1, 1000000000000>>;
+using                      nanosievert = exact_factor<std::ratio<1, 1000000000>>;
+using                     microsievert = exact_factor<std::ratio<1, 1000000>>;
+using                     millisievert = exact_factor<std::ratio<1, 1000>>;
+using                     centisievert = exact_factor<std::ratio<1, 100>>;
+using                      decisievert = exact_factor<std::ratio<1, 10>>;
+using                      decasievert = exact_factor<std::ratio<10, 1>>;
+using                     hectosievert = exact_factor<std::ratio<100, 1>>;
+using                      kilosievert = exact_factor<std::ratio<1000, 1>>;
+using                      megasievert = exact_factor<std::ratio<1000000, 1>>;
+using                      gigasievert = exact_factor<std::ratio<1000000000, 1>>;
+using                      terasievert = exact_factor<std::ratio<1000000000000, 1>>;
+using                      petasievert = exact_factor<std::ratio<1000000000000000, 1>>;
+using                       femtokatal = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        picokatal = exact_factor<std::ratio<1, 1000000000000>>;
+using                        nanokatal = exact_factor<std::ratio<1, 1000000000>>;
+using                       microkatal = exact_factor<std::ratio<1, 1000000>>;
+using                       millikatal = exact_factor<std::ratio<1, 1000>>;
+using                       centikatal = exact_factor<std::ratio<1, 100>>;
+using                        decikatal = exact_factor<std::ratio<1, 10>>;
+using                        decakatal = exact_factor<std::ratio<10, 1>>;
+using                       hectokatal = exact_factor<std::ratio<100, 1>>;
+using                        kilokatal = exact_factor<std::ratio<1000, 1>>;
+using                        megakatal = exact_factor<std::ratio<1000000, 1>>;
+using                        gigakatal = exact_factor<std::ratio<1000000000, 1>>;
+using                        terakatal = exact_factor<std::ratio<1000000000000, 1>>;
+using                        petakatal = exact_factor<std::ratio<1000000000000000, 1>>;
+using                         angstrom = exact_factor<std::ratio<1, 10000000000>>;
+using                           micron = exact_factor<std::ratio<1, 1000000>>;
+using                             inch = exact_factor<std::ratio<127, 5000>>;
+using                             foot = exact_factor<std::ratio<381, 1250>>;
+using                             yard = exact_factor<std::ratio<1143, 1250>>;
+using                             mile = exact_factor<std::ratio<201168, 125>>;
+using                              mil = exact_factor<std::ratio<127, 5000000>>;
+using                            point = exact_factor<std::ratio<127, 360000>>;
+using                             pica = exact_factor<std::ratio<127, 30000>>;
+using                           fathom = exact_factor<std::ratio<1143, 625>>;
+using                            chain = exact_factor<std::ratio<12573, 625>>;
+using                          furlong = exact_factor<std::ratio<25146, 125>>;
+using                              rod = exact_factor<std::ratio<12573, 2500>>;
+using                      survey_foot = exact_factor<std::ratio<1200, 3937>>;
+using                      survey_mile = exact_factor<std::ratio<6336000, 3937>>;
+using                    nautical_mile = exact_factor<std::ratio<1852, 1>>;
+using                astronomical_unit = exact_factor<std::ratio<149597870700, 1>>;
+using                       light_year = exact_factor<std::ratio<9460730472580800, 1>>;
+using                           parsec = exact_factor<std::ratio<30856775814913673, 1>>;
+using                              are = exact_factor<std::ratio<100, 1>>;
+using                          hectare = exact_factor<std::ratio<10000, 1>>;
+using                             acre = exact_factor<std::ratio<316160658, 78125>>;
+using                      square_inch = exact_factor<std::ratio<16129, 25000000>>;
+using                      square_foot = exact_factor<std::ratio<145161, 1562500>>;
+using                      square_yard = exact_factor<std::ratio<1306449, 1562500>>;
+using                      square_mile = exact_factor<std::ratio<40468564224, 15625>>;
+using                             barn = exact_factor<std::ratio<1, 1000000000000000000>, -10>;
+using                            liter = exact_factor<std::ratio<1, 1000>>;
+using                       femtoliter = exact_factor<std::ratio<1, 1000000000000000000>>;
+using                        picoliter = exact_factor<std::ratio<1, 1000000000000000>>;
+using                        nanoliter = exact_factor<std::ratio<1, 1000000000000>>;
+using                       microliter = exact_factor<std::ratio<1, 1000000000>>;
+using                       milliliter = exact_factor<std::ratio<1, 1000000>>;
+using                       centiliter = exact_factor<std::ratio<1, 100000>>;
+using                        deciliter = exact_factor<std::ratio<1, 10000>>;
+using                        decaliter = exact_factor<std::ratio<1, 100>>;
+using                       hectoliter = exact_factor<std::ratio<1, 10>>;
+using                        megaliter = exact_factor<std::ratio<1000, 1>>;
+using                        gigaliter = exact_factor<std::ratio<1000000, 1>>;
+using                        teraliter = exact_factor<std::ratio<1000000000, 1>>;
+using                        petaliter = exact_factor<std::ratio<1000000000000, 1>>;
+using                       cubic_inch = exact_factor<std::ratio<2048383, 125000000000>>;
+using                       cubic_foot = exact_factor<std::ratio<55306341, 1953125000>>;
+using                       cubic_yard = exact_factor<std::ratio<1493271207, 1953125000>>;
+using                           gallon = exact_factor<std::ratio<473176473, 125000000000>>;
+using                            quart = exact_factor<std::ratio<473176473, 500000000000>>;
+using                             pint = exact_factor<std::ratio<473176473, 1000000000000>>;
+using                              cup = exact_factor<std::ratio<473176473, 2000000000000>>;
+using                      fluid_ounce = exact_factor<std::ratio<473176473, 16000000000000>>;
+using                       tablespoon = exact_factor<std::ratio<473176473, 32000000000000>>;
+using                         teaspoon = exact_factor<std::ratio<157725491, 32000000000000>>;
+using                           barrel = exact_factor<std::ratio<9936705933, 62500000000>>;
+using                  imperial_gallon = exact_factor<std::ratio<454609, 100000000>>;
+using                    imperial_pint = exact_factor<std::ratio<454609, 800000000>>;
+using                        acre_foot = exact_factor<std::ratio<60228605349, 48828125>>;
+using                            pound = exact_factor<std::ratio<45359237, 100000000>>;
+using                            ounce = exact_factor<std::ratio<45359237, 1600000000>>;
+using                            grain = exact_factor<std::ratio<6479891, 100000000000>>;
+using                             dram = exact_factor<std::ratio<45359237, 25600000000>>;
+using                            stone = exact_factor<std::ratio<317514659, 50000000>>;
+using                        short_ton = exact_factor<std::ratio<45359237, 50000>>;
+using                         long_ton = exact_factor<std::ratio<317514659, 312500>>;
+using                            tonne = exact_factor<std::ratio<1000, 1>>;
+using                       troy_ounce = exact_factor<std::ratio<19439673, 625000000>>;
+using                       troy_pound = exact_factor<std::ratio<58319019, 156250000>>;
+using                            carat = exact_factor<std::ratio<1, 5000>>;
+using                 atomic_mass_unit = exact_factor<std::ratio<8302695333, 500000000000000000>, -19>;
+using                           dalton = exact_factor<std::ratio<8302695333, 500000000000000000>, -19>;
+using                           minute = exact_factor<std::ratio<60, 1>>;
+using                             hour = exact_factor<std::ratio<3600, 1>>;
+using                              day = exact_factor<std::ratio<86400, 1>>;
+using                             week = exact_factor<std::ratio<604800, 1>>;
+using                        fortnight = exact_factor<std::ratio<1209600, 1>>;
+using                      julian_year = exact_factor<std::ratio<31557600, 1>>;
+using                            shake = exact_factor<std::ratio<1, 100000000>>;
+using               kilometer_per_hour = exact_factor<std::ratio<5, 18>>;
+using                    mile_per_hour = exact_factor<std::ratio<1397, 3125>>;
+using                  foot_per_second = exact_factor<std::ratio<381, 1250>>;
+using                             knot = exact_factor<std::ratio<463, 900>>;
+using                 standard_gravity = exact_factor<std::ratio<196133, 20000>>;
+using                          galileo = exact_factor<std::ratio<1, 100>>;
+using                             dyne = exact_factor<std::ratio<1, 100000>>;
+using                      pound_force = exact_factor<std::ratio<8896443230521, 2000000000000>>;
+using                      ounce_force = exact_factor<std::ratio<8896443230521, 32000000000000>>;
+using                   kilogram_force = exact_factor<std::ratio<196133, 20000>>;
+using                              kip = exact_factor<std::ratio<8896443230521, 2000000000>>;
+using                          poundal = exact_factor<std::ratio<17281869297, 125000000000>>;
+using                        ton_force = exact_factor<std::ratio<8896443230521, 1000000000>>;
+using                             slug = exact_factor<std::ratio<8896443230521, 609600000000>>;
+using                              bar = exact_factor<std::ratio<100000, 1>>;
+using                         femtobar = exact_factor<std::ratio<1, 10000000000>>;
+using                          picobar = exact_factor<std::ratio<1, 10000000>>;
+using                          nanobar = exact_factor<std::ratio<1, 10000>>;
+using                         microbar = exact_factor<std::ratio<1, 10>>;
+using                         millibar = exact_factor<std::ratio<100, 1>>;
+using                         centibar = exact_factor<std::ratio<1000, 1>>;
+using                          decibar = exact_factor<std::ratio<10000, 1>>;
+using                          decabar = exact_factor<std::ratio<1000000, 1>>;
+using                         hectobar = exact_factor<std::ratio<10000000, 1>>;
+using                          kilobar = exact_factor<std::ratio<100000000, 1>>;
+using                          megabar = exact_factor<std::ratio<100000000000, 1>>;
+using                          gigabar = exact_factor<std::ratio<100000000000000, 1>>;
+using                          terabar = exact_factor<std::ratio<100000000000000000, 1>>;
+using                          petabar = exact_factor<std::ratio<1000000000000000000, 1>, 2>;
+using                       atmosphere = exact_factor<std::ratio<101325, 1>>;
+using             technical_atmosphere = exact_factor<std::ratio<196133, 2>>;
+using                             torr = exact_factor<std::ratio<20265, 152>>;
+using            pound_per_square_inch = exact_factor<std::ratio<8896443230521, 1290320000>>;
+using              kip_per_square_inch = exact_factor<std::ratio<8896443230521, 1290320>>;
+using            millimeter_of_mercury = exact_factor<std::ratio<26664477483, 200000000>>;
+using                  inch_of_mercury = exact_factor<std::ratio<3386389, 1000>>;
+using                    inch_of_water = exact_factor<std::ratio<2490889, 10000>>;
+using              centimeter_of_water = exact_factor<std::ratio<196133, 2000>>;
+using                     electronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -10>;
+using                femtoelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -25>;
+using                 picoelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -22>;
+using                 nanoelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -19>;
+using                microelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -16>;
+using                millielectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -13>;
+using                centielectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -12>;
+using                 decielectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -11>;
+using                 decaelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -9>;
+using                hectoelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -8>;
+using                 kiloelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -7>;
+using                 megaelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -4>;
+using                 gigaelectronvolt = exact_factor<std::ratio<801088317, 500000000000000000>, -1>;
+using                 teraelectronvolt = exact_factor<std::ratio<801088317, 5000000000000000>>;
+using                 petaelectronvolt = exact_factor<std::ratio<801088317, 5000000000000>>;
+using                              erg = exact_factor<std::ratio<1, 10000000>>;
+using                          calorie = exact_factor<std::ratio<523, 125>>;
+using                     femtocalorie = exact_factor<std::ratio<523, 125000000000000000>>;
+using                      picocalorie = exact_factor<std::ratio<523, 125000000000000>>;
+using                      nanocalorie = exact_factor<std::ratio<523, 125000000000>>;
+using                     microcalorie = exact_factor<std::ratio<523, 125000000>>;
+using                     millicalorie = exact_factor<std::ratio<523, 125000>>;
+using                     centicalorie = exact_factor<std::ratio<523, 12500>>;
+using                      decicalorie = exact_factor<std::ratio<523, 1250>>;
+using                      decacalorie = exact_factor<std::ratio<1046, 25>>;
+using                     hectocalorie = exact_factor<std::ratio<2092, 5>>;
+using                      kilocalorie = exact_factor<std::ratio<4184, 1>>;
+using                      megacalorie = exact_factor<std::ratio<4184000, 1>>;
+using                      gigacalorie = exact_factor<std::ratio<4184000000, 1>>;
+using                      teracalorie = exact_factor<std::ratio<4184000000000, 1>>;
+using                      petacalorie = exact_factor<std::ratio<4184000000000000, 1>>;
+using            international_calorie = exact_factor<std::ratio<10467, 2500>>;
+using             british_thermal_unit = exact_factor<std::ratio<52752792631, 50000000>>;
+using                            therm = exact_factor<std::ratio<105480400, 1>>;
+using                        watt_hour = exact_factor<std::ratio<3600, 1>>;
+using                   femtowatt_hour = exact_factor<std::ratio<9, 2500000000000>>;
+using                    picowatt_hour = exact_factor<std::ratio<9, 2500000000>>;
+using                    nanowatt_hour = exact_factor<std::ratio<9, 2500000>>;
+using                   microwatt_hour = exact_factor<std::ratio<9, 2500>>;
+using                   milliwatt_hour = exact_factor<std::ratio<18, 5>>;
+using                   centiwatt_hour = exact_factor<std::ratio<36, 1>>;
+using                    deciwatt_hour = exact_factor<std::ratio<360, 1>>;
+using                    decawatt_hour = exact_factor<std::ratio<36000, 1>>;
+using                   hectowatt_hour = exact_factor<std::ratio<360000, 1>>;
+using                    kilowatt_hour = exact_factor<std::ratio<3600000, 1>>;
+using                    megawatt_hour = exact_factor<std::ratio<3600000000, 1>>;
+using                    gigawatt_hour = exact_factor<std::ratio<3600000000000, 1>>;
+using                    terawatt_hour = exact_factor<std::ratio<3600000000000000, 1>>;
+using                    petawatt_hour = exact_factor<std::ratio<3600000000000000000, 1>>;
+using                 foot_pound_force = exact_factor<std::ratio<3389544870828501, 2500000000000000>>;
+using                       ton_of_tnt = exact_factor<std::ratio<4184000000, 1>>;
+using                             quad = exact_factor<std::ratio<1055055852620000000, 1>>;
+using                       horsepower = exact_factor<std::ratio<37284993579113511, 50000000000000>>;
+using                metric_horsepower = exact_factor<std::ratio<588399, 800>>;
+using              electric_horsepower = exact_factor<std::ratio<746, 1>>;
+using             ton_of_refrigeration = exact_factor<std::ratio<52752792631, 15000000>>;
+using                            poise = exact_factor<std::ratio<1, 10>>;
+using                       centipoise = exact_factor<std::ratio<1, 1000>>;
+using                           stokes = exact_factor<std::ratio<1, 10000>>;
+using                            gauss = exact_factor<std::ratio<1, 10000>>;
+using                          maxwell = exact_factor<std::ratio<1, 100000000>>;
+using                         abampere = exact_factor<std::ratio<10, 1>>;
+using                         statvolt = exact_factor<std::ratio<149896229, 500000>>;
+using                            curie = exact_factor<std::ratio<37000000000, 1>>;
+using                              rad = exact_factor<std::ratio<1, 100>>;
+using                              rem = exact_factor<std::ratio<1, 100>>;
+using                             phot = exact_factor<std::ratio<10000, 1>>;
+using                      foot_candle = exact_factor<std::ratio<1562500, 145161>>;
+using                          percent = exact_factor<std::ratio<1, 100>>;
+using                         permille = exact_factor<std::ratio<1, 1000>>;
+using                parts_per_million = exact_factor<std::ratio<1, 1000000>>;
+using                parts_per_billion = exact_factor<std::ratio<1, 1000000000>>;
+using                           degree = exact_factor<std::ratio<3490658503988659, 200000000000000000>>;
+using                       revolution = exact_factor<std::ratio<3141592653589793, 500000000000000>>;
+using                   degree_rankine = exact_factor<std::ratio<5, 9>>;
+
+}// namespace exact
+
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       femtometer{1e-15}; // fm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        picometer{1e-12}; // pm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        nanometer{1e-9}; // nm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       micrometer{1e-6}; // um
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       millimeter{0.001}; // mm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       centimeter{0.01}; // cm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        decimeter{0.1}; // dm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        decameter{10.0}; // dam
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       hectometer{100.0}; // hm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        kilometer{1000.0}; // km
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        megameter{1000000.0}; // Mm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        gigameter{1000000000.0}; // Gm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        terameter{1000000000000.0}; // Tm
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                        petameter{1000000000000000.0}; // Pm
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                             gram{0.001}; // g
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        femtogram{1e-18}; // fg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         picogram{1e-15}; // pg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         nanogram{1e-12}; // ng
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        microgram{1e-9}; // ug
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        milligram{1e-6}; // mg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        centigram{0.00001}; // cg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         decigram{0.0001}; // dg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         decagram{0.01}; // dag
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        hectogram{0.1}; // hg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         megagram{1000.0}; // Mg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         gigagram{1000000.0}; // Gg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         teragram{1000000000.0}; // Tg
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         petagram{1000000000000.0}; // Pg
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      femtosecond{1e-15}; // fs
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       picosecond{1e-12}; // ps
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       nanosecond{1e-9}; // ns
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      microsecond{1e-6}; // us
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      millisecond{0.001}; // ms
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      centisecond{0.01}; // cs
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       decisecond{0.1}; // ds
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       decasecond{10.0}; // das
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      hectosecond{100.0}; // hs
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       kilosecond{1000.0}; // ks
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       megasecond{1000000.0}; // Ms
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       gigasecond{1000000000.0}; // Gs
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       terasecond{1000000000000.0}; // Ts
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                       petasecond{1000000000000000.0}; // Ps
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                      femtoampere{1e-15}; // fA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       picoampere{1e-12}; // pA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       nanoampere{1e-9}; // nA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                      microampere{1e-6}; // uA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                      milliampere{0.001}; // mA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                      centiampere{0.01}; // cA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       deciampere{0.1}; // dA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       decaampere{10.0}; // daA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                      hectoampere{100.0}; // hA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       kiloampere{1000.0}; // kA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       megaampere{1000000.0}; // MA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       gigaampere{1000000000.0}; // GA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       teraampere{1000000000000.0}; // TA
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                       petaampere{1000000000000000.0}; // PA
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      femtokelvin{1e-15}; // fK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       picokelvin{1e-12}; // pK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       nanokelvin{1e-9}; // nK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      microkelvin{1e-6}; // uK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      millikelvin{0.001}; // mK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      centikelvin{0.01}; // cK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       decikelvin{0.1}; // dK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       decakelvin{10.0}; // daK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      hectokelvin{100.0}; // hK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       kilokelvin{1000.0}; // kK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       megakelvin{1000000.0}; // MK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       gigakelvin{1000000000.0}; // GK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       terakelvin{1000000000000.0}; // TK
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                       petakelvin{1000000000000000.0}; // PK
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                        femtomole{1e-15}; // fmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         picomole{1e-12}; // pmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         nanomole{1e-9}; // nmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                        micromole{1e-6}; // umol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                        millimole{0.001}; // mmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                        centimole{0.01}; // cmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         decimole{0.1}; // dmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         decamole{10.0}; // damol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                        hectomole{100.0}; // hmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         kilomole{1000.0}; // kmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         megamole{1000000.0}; // Mmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         gigamole{1000000000.0}; // Gmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         teramole{1000000000000.0}; // Tmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 1, 0>>                         petamole{1000000000000000.0}; // Pmol
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                     femtocandela{1e-15}; // fcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      picocandela{1e-12}; // pcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      nanocandela{1e-9}; // ncd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                     microcandela{1e-6}; // ucd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                     millicandela{0.001}; // mcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                     centicandela{0.01}; // ccd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      decicandela{0.1}; // dcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      decacandela{10.0}; // dacd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                     hectocandela{100.0}; // hcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      kilocandela{1000.0}; // kcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      megacandela{1000000.0}; // Mcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      gigacandela{1000000000.0}; // Gcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      teracandela{1000000000000.0}; // Tcd
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                      petacandela{1000000000000000.0}; // Pcd
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       femtohertz{1e-15}; // fHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        picohertz{1e-12}; // pHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        nanohertz{1e-9}; // nHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       microhertz{1e-6}; // uHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       millihertz{0.001}; // mHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       centihertz{0.01}; // cHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        decihertz{0.1}; // dHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        decahertz{10.0}; // daHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       hectohertz{100.0}; // hHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        kilohertz{1000.0}; // kHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        megahertz{1000000.0}; // MHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        gigahertz{1000000000.0}; // GHz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        terahertz{1000000000000.0}; // THz
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                        petahertz{1000000000000000.0}; // PHz
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      femtonewton{1e-15}; // fN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       piconewton{1e-12}; // pN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       nanonewton{1e-9}; // nN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      micronewton{1e-6}; // uN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      millinewton{0.001}; // mN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      centinewton{0.01}; // cN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       decinewton{0.1}; // dN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       decanewton{10.0}; // daN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      hectonewton{100.0}; // hN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       kilonewton{1000.0}; // kN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       meganewton{1000000.0}; // MN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       giganewton{1000000000.0}; // GN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       teranewton{1000000000000.0}; // TN
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                       petanewton{1000000000000000.0}; // PN
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                      femtopascal{1e-15}; // fPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       picopascal{1e-12}; // pPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       nanopascal{1e-9}; // nPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                      micropascal{1e-6}; // uPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                      millipascal{0.001}; // mPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                      centipascal{0.01}; // cPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       decipascal{0.1}; // dPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       decapascal{10.0}; // daPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                      hectopascal{100.0}; // hPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       kilopascal{1000.0}; // kPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       megapascal{1000000.0}; // MPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       gigapascal{1000000000.0}; // GPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       terapascal{1000000000000.0}; // TPa
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       petapascal{1000000000000000.0}; // PPa
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       femtojoule{1e-15}; // fJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        picojoule{1e-12}; // pJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        nanojoule{1e-9}; // nJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       microjoule{1e-6}; // uJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       millijoule{0.001}; // mJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       centijoule{0.01}; // cJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        decijoule{0.1}; // dJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        decajoule{10.0}; // daJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       hectojoule{100.0}; // hJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        kilojoule{1000.0}; // kJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        megajoule{1000000.0}; // MJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        gigajoule{1000000000.0}; // GJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        terajoule{1000000000000.0}; // TJ
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        petajoule{1000000000000000.0}; // PJ
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                        femtowatt{1e-15}; // fW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         picowatt{1e-12}; // pW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         nanowatt{1e-9}; // nW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                        microwatt{1e-6}; // uW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                        milliwatt{0.001}; // mW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                        centiwatt{0.01}; // cW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         deciwatt{0.1}; // dW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         decawatt{10.0}; // daW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                        hectowatt{100.0}; // hW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         kilowatt{1000.0}; // kW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         megawatt{1000000.0}; // MW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         gigawatt{1000000000.0}; // GW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         terawatt{1000000000000.0}; // TW
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                         petawatt{1000000000000000.0}; // PW
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                     femtocoulomb{1e-15}; // fC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      picocoulomb{1e-12}; // pC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      nanocoulomb{1e-9}; // nC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                     microcoulomb{1e-6}; // uC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                     millicoulomb{0.001}; // mC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                     centicoulomb{0.01}; // cC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      decicoulomb{0.1}; // dC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      decacoulomb{10.0}; // daC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                     hectocoulomb{100.0}; // hC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      kilocoulomb{1000.0}; // kC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      megacoulomb{1000000.0}; // MC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      gigacoulomb{1000000000.0}; // GC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      teracoulomb{1000000000000.0}; // TC
+constexpr Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                      petacoulomb{1000000000000000.0}; // PC
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                        femtovolt{1e-15}; // fV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         picovolt{1e-12}; // pV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         nanovolt{1e-9}; // nV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                        microvolt{1e-6}; // uV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                        millivolt{0.001}; // mV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                        centivolt{0.01}; // cV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         decivolt{0.1}; // dV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         decavolt{10.0}; // daV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                        hectovolt{100.0}; // hV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         kilovolt{1000.0}; // kV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         megavolt{1000000.0}; // MV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         gigavolt{1000000000.0}; // GV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         teravolt{1000000000000.0}; // TV
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         petavolt{1000000000000000.0}; // PV
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                       femtofarad{1e-15}; // fF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        picofarad{1e-12}; // pF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        nanofarad{1e-9}; // nF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                       microfarad{1e-6}; // uF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                       millifarad{0.001}; // mF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                       centifarad{0.01}; // cF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        decifarad{0.1}; // dF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        decafarad{10.0}; // daF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                       hectofarad{100.0}; // hF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        kilofarad{1000.0}; // kF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        megafarad{1000000.0}; // MF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        gigafarad{1000000000.0}; // GF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        terafarad{1000000000000.0}; // TF
+constexpr Quantity<Unit<-2, -1, 4, 2, 0, 0, 0>>                        petafarad{1000000000000000.0}; // PF
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         femtoohm{1e-15}; // fOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          picoohm{1e-12}; // pOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          nanoohm{1e-9}; // nOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         microohm{1e-6}; // uOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         milliohm{0.001}; // mOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         centiohm{0.01}; // cOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          deciohm{0.1}; // dOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          decaohm{10.0}; // daOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         hectoohm{100.0}; // hOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          kiloohm{1000.0}; // kOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          megaohm{1000000.0}; // MOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          gigaohm{1000000000.0}; // GOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          teraohm{1000000000000.0}; // TOhm
+constexpr Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                          petaohm{1000000000000000.0}; // POhm
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                     femtosiemens{1e-15}; // fS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      picosiemens{1e-12}; // pS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      nanosiemens{1e-9}; // nS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                     microsiemens{1e-6}; // uS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                     millisiemens{0.001}; // mS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                     centisiemens{0.01}; // cS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      decisiemens{0.1}; // dS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      decasiemens{10.0}; // daS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                     hectosiemens{100.0}; // hS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      kilosiemens{1000.0}; // kS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      megasiemens{1000000.0}; // MS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      gigasiemens{1000000000.0}; // GS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      terasiemens{1000000000000.0}; // TS
+constexpr Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                      petasiemens{1000000000000000.0}; // PS
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                       femtoweber{1e-15}; // fWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        picoweber{1e-12}; // pWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        nanoweber{1e-9}; // nWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                       microweber{1e-6}; // uWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                       milliweber{0.001}; // mWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                       centiweber{0.01}; // cWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        deciweber{0.1}; // dWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        decaweber{10.0}; // daWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                       hectoweber{100.0}; // hWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        kiloweber{1000.0}; // kWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        megaweber{1000000.0}; // MWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        gigaweber{1000000000.0}; // GWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        teraweber{1000000000000.0}; // TWb
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                        petaweber{1000000000000000.0}; // PWb
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                       femtotesla{1e-15}; // fT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        picotesla{1e-12}; // pT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        nanotesla{1e-9}; // nT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                       microtesla{1e-6}; // uT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                       millitesla{0.001}; // mT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                       centitesla{0.01}; // cT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        decitesla{0.1}; // dT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        decatesla{10.0}; // daT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                       hectotesla{100.0}; // hT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        kilotesla{1000.0}; // kT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        megatesla{1000000.0}; // MT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        gigatesla{1000000000.0}; // GT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        teratesla{1000000000000.0}; // TT
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        petatesla{1000000000000000.0}; // PT
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                       femtohenry{1e-15}; // fH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        picohenry{1e-12}; // pH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        nanohenry{1e-9}; // nH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                       microhenry{1e-6}; // uH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                       millihenry{0.001}; // mH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                       centihenry{0.01}; // cH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        decihenry{0.1}; // dH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        decahenry{10.0}; // daH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                       hectohenry{100.0}; // hH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        kilohenry{1000.0}; // kH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        megahenry{1000000.0}; // MH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        gigahenry{1000000000.0}; // GH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        terahenry{1000000000000.0}; // TH
+constexpr Quantity<Unit<2, 1, -2, -2, 0, 0, 0>>                        petahenry{1000000000000000.0}; // PH
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                       femtolumen{1e-15}; // flm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        picolumen{1e-12}; // plm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        nanolumen{1e-9}; // nlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                       microlumen{1e-6}; // ulm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                       millilumen{0.001}; // mlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                       centilumen{0.01}; // clm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        decilumen{0.1}; // dlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        decalumen{10.0}; // dalm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                       hectolumen{100.0}; // hlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        kilolumen{1000.0}; // klm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        megalumen{1000000.0}; // Mlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        gigalumen{1000000000.0}; // Glm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        teralumen{1000000000000.0}; // Tlm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 1>>                        petalumen{1000000000000000.0}; // Plm
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                         femtolux{1e-15}; // flx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          picolux{1e-12}; // plx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          nanolux{1e-9}; // nlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                         microlux{1e-6}; // ulx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                         millilux{0.001}; // mlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                         centilux{0.01}; // clx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          decilux{0.1}; // dlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          decalux{10.0}; // dalx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                         hectolux{100.0}; // hlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          kilolux{1000.0}; // klx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          megalux{1000000.0}; // Mlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          gigalux{1000000000.0}; // Glx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          teralux{1000000000000.0}; // Tlx
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                          petalux{1000000000000000.0}; // Plx
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                   femtobecquerel{1e-15}; // fBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    picobecquerel{1e-12}; // pBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    nanobecquerel{1e-9}; // nBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                   microbecquerel{1e-6}; // uBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                   millibecquerel{0.001}; // mBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                   centibecquerel{0.01}; // cBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    decibecquerel{0.1}; // dBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    decabecquerel{10.0}; // daBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                   hectobecquerel{100.0}; // hBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    kilobecquerel{1000.0}; // kBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    megabecquerel{1000000.0}; // MBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    gigabecquerel{1000000000.0}; // GBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    terabecquerel{1000000000000.0}; // TBq
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    petabecquerel{1000000000000000.0}; // PBq
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                        femtogray{1e-15}; // fGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         picogray{1e-12}; // pGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         nanogray{1e-9}; // nGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                        microgray{1e-6}; // uGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                        milligray{0.001}; // mGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                        centigray{0.01}; // cGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         decigray{0.1}; // dGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         decagray{10.0}; // daGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                        hectogray{100.0}; // hGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         kilogray{1000.0}; // kGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         megagray{1000000.0}; // MGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         gigagray{1000000000.0}; // GGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         teragray{1000000000000.0}; // TGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                         petagray{1000000000000000.0}; // PGy
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                     femtosievert{1e-15}; // fSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      picosievert{1e-12}; // pSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      nanosievert{1e-9}; // nSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                     microsievert{1e-6}; // uSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                     millisievert{0.001}; // mSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                     centisievert{0.01}; // cSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      decisievert{0.1}; // dSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      decasievert{10.0}; // daSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                     hectosievert{100.0}; // hSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      kilosievert{1000.0}; // kSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      megasievert{1000000.0}; // MSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      gigasievert{1000000000.0}; // GSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      terasievert{1000000000000.0}; // TSv
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                      petasievert{1000000000000000.0}; // PSv
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                       femtokatal{1e-15}; // fkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        picokatal{1e-12}; // pkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        nanokatal{1e-9}; // nkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                       microkatal{1e-6}; // ukat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                       millikatal{0.001}; // mkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                       centikatal{0.01}; // ckat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        decikatal{0.1}; // dkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        decakatal{10.0}; // dakat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                       hectokatal{100.0}; // hkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        kilokatal{1000.0}; // kkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        megakatal{1000000.0}; // Mkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        gigakatal{1000000000.0}; // Gkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        terakatal{1000000000000.0}; // Tkat
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 1, 0>>                        petakatal{1000000000000000.0}; // Pkat
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                         angstrom{1e-10};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           micron{1e-6};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             inch{0.0254}; // in
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             foot{0.3048}; // ft
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             yard{0.9144}; // yd
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             mile{1609.344}; // mi
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              mil{0.0000254};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                            point{0.00035277777777777776};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             pica{0.004233333333333334};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           fathom{1.8288};
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                            chain{20.1168}; // ch
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                          furlong{201.168}; // fur
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              rod{5.0292}; // rd
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      survey_foot{0.3048006096012192}; // ftUS
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      survey_mile{1609.3472186944373}; // miUS
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                    nautical_mile{1852.0}; // nmi
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                astronomical_unit{149597870700.0}; // au
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       light_year{9460730472580800.0}; // ly
+constexpr Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           parsec{30856775814913672.0}; // pc
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                              are{100.0};
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                          hectare{10000.0}; // ha
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                             acre{4046.8564224}; // ac
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                      square_inch{0.00064516}; // sqin
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                      square_foot{0.09290304}; // sqft
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                      square_yard{0.83612736}; // sqyd
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                      square_mile{2589988.110336}; // sqmi
+constexpr Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                             barn{1e-28}; // b
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                            liter{0.001}; // L
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       femtoliter{1e-18}; // fL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        picoliter{1e-15}; // pL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        nanoliter{1e-12}; // nL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       microliter{1e-9}; // uL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       milliliter{1e-6}; // mL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       centiliter{0.00001}; // cL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        deciliter{0.0001}; // dL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        decaliter{0.01}; // daL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       hectoliter{0.1}; // hL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        megaliter{1000.0}; // ML
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        gigaliter{1000000.0}; // GL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        teraliter{1000000000.0}; // TL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        petaliter{1000000000000.0}; // PL
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       cubic_inch{0.000016387064}; // cuin
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       cubic_foot{0.028316846592}; // cuft
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       cubic_yard{0.764554857984}; // cuyd
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                           gallon{0.003785411784}; // gal
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                            quart{0.000946352946}; // qt
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                             pint{0.000473176473}; // pt
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                              cup{0.0002365882365};
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                      fluid_ounce{0.0000295735295625}; // floz
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                       tablespoon{0.00001478676478125}; // tbsp
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                         teaspoon{4.92892159375e-6}; // tsp
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                           barrel{0.158987294928}; // bbl
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                  imperial_gallon{0.00454609}; // galUK
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                    imperial_pint{0.00056826125}; // ptUK
+constexpr Quantity<Unit<3, 0, 0, 0, 0, 0, 0>>                        acre_foot{1233.48183754752};
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            pound{0.45359237}; // lb
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            ounce{0.028349523125}; // oz
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            grain{0.00006479891}; // gr
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                             dram{0.0017718451953125}; // dr
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            stone{6.35029318}; // st
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                        short_ton{907.18474}; // ton
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                         long_ton{1016.0469088};
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            tonne{1000.0}; // t
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                       troy_ounce{0.0311034768}; // ozt
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                       troy_pound{0.3732417216}; // lbt
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            carat{0.0002}; // ct
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 atomic_mass_unit{1.6605390666e-27}; // u
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                           dalton{1.6605390666e-27}; // Da
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                           minute{60.0}; // min
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                             hour{3600.0}; // h
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                              day{86400.0}; // d
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                             week{604800.0}; // wk
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                        fortnight{1209600.0};
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                      julian_year{31557600.0}; // a
+constexpr Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                            shake{1e-8};
+constexpr Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>               kilometer_per_hour{0.2777777777777778}; // km/h
+constexpr Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                    mile_per_hour{0.44704}; // mph
+constexpr Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                  foot_per_second{0.3048}; // fps
+constexpr Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                             knot{0.5144444444444445}; // kn
+constexpr Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                 standard_gravity{9.80665}; // gn
+constexpr Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                          galileo{0.01}; // Gal
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                             dyne{0.00001}; // dyn
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      pound_force{4.4482216152605}; // lbf
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                      ounce_force{0.2780138509537812}; // ozf
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                   kilogram_force{9.80665}; // kgf
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                              kip{4448.2216152605};
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                          poundal{0.138254954376}; // pdl
+constexpr Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                        ton_force{8896.443230521}; // tonf
+constexpr Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                             slug{14.593902937206364};
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                              bar{100000.0}; // bar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                         femtobar{1e-10}; // fbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          picobar{1e-7}; // pbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          nanobar{0.0001}; // nbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                         microbar{0.1}; // ubar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                         millibar{100.0}; // mbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                         centibar{1000.0}; // cbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          decibar{10000.0}; // dbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          decabar{1000000.0}; // dabar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                         hectobar{10000000.0}; // hbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          kilobar{100000000.0}; // kbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          megabar{100000000000.0}; // Mbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          gigabar{100000000000000.0}; // Gbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          terabar{100000000000000000.0}; // Tbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                          petabar{100000000000000000000.0}; // Pbar
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                       atmosphere{101325.0}; // atm
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>             technical_atmosphere{98066.5}; // at
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                             torr{133.32236842105263}; // Torr
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>            pound_per_square_inch{6894.757293168362}; // psi
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>              kip_per_square_inch{6894757.293168361}; // ksi
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>            millimeter_of_mercury{133.322387415}; // mmHg
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                  inch_of_mercury{3386.389}; // inHg
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                    inch_of_water{249.0889}; // inH2O
+constexpr Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>              centimeter_of_water{98.0665}; // cmH2O
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     electronvolt{1.602176634e-19}; // eV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                femtoelectronvolt{1.602176634e-34}; // feV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 picoelectronvolt{1.602176634e-31}; // peV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 nanoelectronvolt{1.602176634e-28}; // neV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                microelectronvolt{1.602176634e-25}; // ueV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                millielectronvolt{1.602176634e-22}; // meV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                centielectronvolt{1.602176634e-21}; // ceV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 decielectronvolt{1.602176634e-20}; // deV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 decaelectronvolt{1.602176634e-18}; // daeV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                hectoelectronvolt{1.602176634e-17}; // heV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 kiloelectronvolt{1.602176634e-16}; // keV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 megaelectronvolt{1.602176634e-13}; // MeV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 gigaelectronvolt{1.602176634e-10}; // GeV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 teraelectronvolt{1.602176634e-7}; // TeV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 petaelectronvolt{0.0001602176634}; // PeV
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                              erg{1e-7};
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          calorie{4.184}; // cal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     femtocalorie{4.184e-15}; // fcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      picocalorie{4.184e-12}; // pcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      nanocalorie{4.184e-9}; // ncal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     microcalorie{4.184e-6}; // ucal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     millicalorie{0.004184}; // mcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     centicalorie{0.04184}; // ccal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      decicalorie{0.4184}; // dcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      decacalorie{41.84}; // dacal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     hectocalorie{418.4}; // hcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      kilocalorie{4184.0}; // kcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      megacalorie{4184000.0}; // Mcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      gigacalorie{4184000000.0}; // Gcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      teracalorie{4184000000000.0}; // Tcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      petacalorie{4184000000000000.0}; // Pcal
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>            international_calorie{4.1868}; // calIT
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>             british_thermal_unit{1055.05585262}; // BTU
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            therm{105480400.0}; // thm
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        watt_hour{3600.0}; // Wh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   femtowatt_hour{3.6e-12}; // fWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    picowatt_hour{3.6e-9}; // pWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    nanowatt_hour{3.6e-6}; // nWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   microwatt_hour{0.0036}; // uWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   milliwatt_hour{3.6}; // mWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   centiwatt_hour{36.0}; // cWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    deciwatt_hour{360.0}; // dWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    decawatt_hour{36000.0}; // daWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   hectowatt_hour{360000.0}; // hWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    kilowatt_hour{3600000.0}; // kWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    megawatt_hour{3600000000.0}; // MWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    gigawatt_hour{3600000000000.0}; // GWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    terawatt_hour{3600000000000000.0}; // TWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    petawatt_hour{3600000000000000000.0}; // PWh
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 foot_pound_force{1.3558179483314003}; // ftlbf
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       ton_of_tnt{4184000000.0}; // tTNT
+constexpr Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             quad{1055055852620000000.0};
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                       horsepower{745.6998715822702}; // hp
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>                metric_horsepower{735.49875};
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>              electric_horsepower{746.0}; // hpE
+constexpr Quantity<Unit<2, 1, -3, 0, 0, 0, 0>>             ton_of_refrigeration{3516.8528420666667}; // TR
+constexpr Quantity<Unit<-1, 1, -1, 0, 0, 0, 0>>                            poise{0.1}; // P
+constexpr Quantity<Unit<-1, 1, -1, 0, 0, 0, 0>>                       centipoise{0.001}; // cP
+constexpr Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                           stokes{0.0001}; // St
+constexpr Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                            gauss{0.0001}; // G
+constexpr Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                          maxwell{1e-8}; // Mx
+constexpr Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                         abampere{10.0}; // abA
+constexpr Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                         statvolt{299.792458};
+constexpr Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                            curie{37000000000.0}; // Ci
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                              rad{0.01};
+constexpr Quantity<Unit<2, 0, -2, 0, 0, 0, 0>>                              rem{0.01};
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                             phot{10000.0}; // ph
+constexpr Quantity<Unit<-2, 0, 0, 0, 0, 0, 1>>                      foot_candle{10.763910416709722}; // fc
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          percent{0.01}; // %
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         permille{0.001};
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                parts_per_million{1e-6}; // ppm
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                parts_per_billion{1e-9}; // ppb
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           degree{0.017453292519943295}; // deg
+constexpr Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                       revolution{6.283185307179586}; // rev
+constexpr Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                   degree_rankine{0.5555555555555556}; // R
+
+}// namespace conversion
+}// namespace unit
@@ -0,0 +1,8 @@
+SOURCES +=  \
+    $$PWD/UnitCatalogGenerator.cpp
+
+
+HEADERS += \
+    $$PWD/UnitCatalogGenerator.h \
+    $$PWD/generated/unitConversions.h \
+    $$PWD/generated/unitConversionTable.h
@@ -2,694 +2,12 @@
 
 /**********************generated from http://physics.nist.gov/constants**********************/
 
-#include <src/quantity/quantityDefinitionsSI.h>
-//#include "units.h"
-
-
-namespace unit {
-namespace physicalConstant{
-
-using namespace literals;
-
-constexpr auto                        c_220_lattice_spacing_of_silicon =      192.0155714e-12_n * meter;
-constexpr auto                      alpha_particle_electron_mass_ratio =        7294.29954136_n;
-constexpr auto                                     alpha_particle_mass =      6.644657230e-27_n * kilogram;
-constexpr auto                   alpha_particle_mass_energy_equivalent =      5.971920097e-10_n * joule;
-constexpr auto                               alpha_particle_molar_mass =    4.001506179127e-3_n * kilogram / mole;
-constexpr auto                        alpha_particle_proton_mass_ratio =        3.97259968907_n;
-constexpr auto                                           Angstrom_star =       1.00001495e-10_n * meter;
-constexpr auto                                    atomic_mass_constant =      1.660539040e-27_n * kilogram;
-constexpr auto                  atomic_mass_constant_energy_equivalent =      1.492418062e-10_n * joule;
-constexpr auto                     atomic_mass_unit_hertz_relationship =      2.2523427206e23_n * hertz;
-constexpr auto             atomic_mass_unit_inverse_meter_relationship =      7.5130066166e14_n / meter;
-constexpr auto                     atomic_mass_unit_joule_relationship =      1.492418062e-10_n * joule;
-constexpr auto                    atomic_mass_unit_kelvin_relationship =        1.08095438e13_n * kelvin;
-constexpr auto                  atomic_mass_unit_kilogram_relationship =      1.660539040e-27_n * kilogram;
-constexpr auto                  atomic_unit_of_1st_hyperpolarizability =      3.206361329e-53_n * cube( coulomb ) * cube( meter ) / square( joule );
-constexpr auto                  atomic_unit_of_2nd_hyperpolarizability =      6.235380085e-65_n * pow<std::ratio<4>>( coulomb ) * pow<std::ratio<4>>( meter ) / cube( joule );
-constexpr auto                                   atomic_unit_of_action =      1.054571800e-34_n * joule * second;
-constexpr auto                                   atomic_unit_of_charge =     1.6021766208e-19_n * coulomb;
-constexpr auto                           atomic_unit_of_charge_density =      1.0812023770e12_n * coulomb / cube( meter );
-constexpr auto                                  atomic_unit_of_current =       6.623618183e-3_n * ampere;
-constexpr auto                      atomic_unit_of_electric_dipole_mom =      8.478353552e-30_n * coulomb * meter;
-constexpr auto                           atomic_unit_of_electric_field =       5.142206707e11_n * volt / meter;
-constexpr auto                  atomic_unit_of_electric_field_gradient =       9.717362356e21_n * volt / square( meter );
-constexpr auto                  atomic_unit_of_electric_polarizability =     1.6487772731e-41_n * square( coulomb ) * square( meter ) / joule;
-constexpr auto                       atomic_unit_of_electric_potential =          27.21138602_n * volt;
-constexpr auto                  atomic_unit_of_electric_quadrupole_mom =      4.486551484e-40_n * coulomb * square( meter );
-constexpr auto                                   atomic_unit_of_energy =      4.359744650e-18_n * joule;
-constexpr auto                                    atomic_unit_of_force =        8.23872336e-8_n * newton;
-constexpr auto                                   atomic_unit_of_length =    0.52917721067e-10_n * meter;
-constexpr auto                           atomic_unit_of_mag_dipole_mom =      1.854801999e-23_n * joule / tesla;
-constexpr auto                         atomic_unit_of_mag_flux_density =        2.350517550e5_n * tesla;
-constexpr auto                          atomic_unit_of_magnetizability =     7.8910365886e-29_n * joule / square( tesla );
-constexpr auto                                     atomic_unit_of_mass =       9.10938356e-31_n * kilogram;
-constexpr auto                                   atomic_unit_of_mom_um =      1.992851882e-24_n * kilogram * meter / second;
-constexpr auto                             atomic_unit_of_permittivity =      1.112650056e-10_n * farad / meter;
-constexpr auto                                     atomic_unit_of_time =   2.418884326509e-17_n * second;
-constexpr auto                                 atomic_unit_of_velocity =      2.18769126277e6_n * meter / second;
-constexpr auto                                       Avogadro_constant =       6.022140857e23_n / mole;
-constexpr auto                                           Bohr_magneton =      927.4009994e-26_n * joule / tesla;
-constexpr auto                               Bohr_magneton_in_Hz_per_T =       13.996245042e9_n * hertz / tesla;
-constexpr auto               Bohr_magneton_in_inverse_meters_per_tesla =          46.68644814_n / meter / tesla;
-constexpr auto                                Bohr_magneton_in_K_per_T =           0.67171405_n * kelvin / tesla;
-constexpr auto                                             Bohr_radius =    0.52917721067e-10_n * meter;
-constexpr auto                                      Boltzmann_constant =       1.38064852e-23_n * joule / kelvin;
-constexpr auto                          Boltzmann_constant_in_Hz_per_K =         2.0836612e10_n * hertz / kelvin;
-constexpr auto         Boltzmann_constant_in_inverse_meters_per_kelvin =            69.503457_n / meter / kelvin;
-constexpr auto                      characteristic_impedance_of_vacuum =        376.730313461_n * ohm;
-constexpr auto                               classical_electron_radius =     2.8179403227e-15_n * meter;
-constexpr auto                                      Compton_wavelength =     2.4263102367e-12_n * meter;
-constexpr auto                            Compton_wavelength_over_2_pi =     386.15926764e-15_n * meter;
-constexpr auto                                     conductance_quantum =      7.7480917310e-5_n * siemens;
-constexpr auto                conventional_value_of_Josephson_constant =           483597.9e9_n * hertz / volt;
-constexpr auto             conventional_value_of_von_Klitzing_constant =            25812.807_n * ohm;
-constexpr auto                                               Cu_x_unit =       1.00207697e-13_n * meter;
-constexpr auto                         deuteron_electron_mag_mom_ratio =      -4.664345535e-4_n;
-constexpr auto                            deuteron_electron_mass_ratio =        3670.48296785_n;
-constexpr auto                                       deuteron_g_factor =         0.8574382311_n;
-constexpr auto                                        deuteron_mag_mom =     0.4330735040e-26_n * joule / tesla;
-constexpr auto                 deuteron_mag_mom_to_Bohr_magneton_ratio =      0.4669754554e-3_n;
-constexpr auto              deuteron_mag_mom_to_nuclear_magneton_ratio =         0.8574382311_n;
-constexpr auto                                           deuteron_mass =      3.343583719e-27_n * kilogram;
-constexpr auto                         deuteron_mass_energy_equivalent =      3.005063183e-10_n * joule;
-constexpr auto                                     deuteron_molar_mass =    2.013553212745e-3_n * kilogram / mole;
-constexpr auto                          deuteron_neutron_mag_mom_ratio =          -0.44820652_n;
-constexpr auto                           deuteron_proton_mag_mom_ratio =         0.3070122077_n;
-constexpr auto                              deuteron_proton_mass_ratio =        1.99900750087_n;
-constexpr auto                              deuteron_rms_charge_radius =           2.1413e-15_n * meter;
-constexpr auto                                       electric_constant =      8.854187817e-12_n * farad / meter;
-constexpr auto                        electron_charge_to_mass_quotient =      -1.758820024e11_n * coulomb / kilogram;
-constexpr auto                         electron_deuteron_mag_mom_ratio =         -2143.923499_n;
-constexpr auto                            electron_deuteron_mass_ratio =    2.724437107484e-4_n;
-constexpr auto                                       electron_g_factor =    -2.00231930436182_n;
-constexpr auto                                  electron_gyromag_ratio =       1.760859644e11_n / second / tesla;
-constexpr auto                        electron_gyromag_ratio_over_2_pi =          28024.95164_n * mega(hertz) / tesla;
-constexpr auto                              electron_helion_mass_ratio =    1.819543074854e-4_n;
-constexpr auto                                        electron_mag_mom =     -928.4764620e-26_n * joule / tesla;
-constexpr auto                                electron_mag_mom_anomaly =     1.15965218091e-3_n;
-constexpr auto                 electron_mag_mom_to_Bohr_magneton_ratio =    -1.00115965218091_n;
-constexpr auto              electron_mag_mom_to_nuclear_magneton_ratio =       -1838.28197234_n;
-constexpr auto                                           electron_mass =       9.10938356e-31_n * kilogram;
-constexpr auto                         electron_mass_energy_equivalent =       8.18710565e-14_n * joule;
-constexpr auto                                     electron_molar_mass =     5.48579909070e-7_n * kilogram / mole;
-constexpr auto                             electron_muon_mag_mom_ratio =          206.7669880_n;
-constexpr auto                                electron_muon_mass_ratio =        4.83633170e-3_n;
-constexpr auto                          electron_neutron_mag_mom_ratio =            960.92050_n;
-constexpr auto                             electron_neutron_mass_ratio =      5.4386734428e-4_n;
-constexpr auto                           electron_proton_mag_mom_ratio =         -658.2106866_n;
-constexpr auto                              electron_proton_mass_ratio =     5.44617021352e-4_n;
-constexpr auto                                 electron_tau_mass_ratio =           2.87592e-4_n;
-constexpr auto                   electron_to_alpha_particle_mass_ratio =    1.370933554798e-4_n;
-constexpr auto               electron_to_shielded_helion_mag_mom_ratio =           864.058257_n;
-constexpr auto               electron_to_shielded_proton_mag_mom_ratio =         -658.2275971_n;
-constexpr auto                              electron_triton_mass_ratio =    1.819200062203e-4_n;
-constexpr auto                                           electron_volt =     1.6021766208e-19_n * joule;
-constexpr auto            alpha_particle_mass_energy_equivalent_in_MeV =          3727.379378_n * mega(electron_volt);
-constexpr auto           atomic_mass_constant_energy_equivalent_in_MeV =          931.4940954_n * mega(electron_volt);
-constexpr auto             atomic_mass_unit_electron_volt_relationship =        931.4940954e6_n * electron_volt;
-constexpr auto                               Bohr_magneton_in_eV_per_T =      5.7883818012e-5_n * electron_volt / tesla;
-constexpr auto                          Boltzmann_constant_in_eV_per_K =         8.6173303e-5_n * electron_volt / kelvin;
-constexpr auto                  deuteron_mass_energy_equivalent_in_MeV =          1875.612928_n * mega(electron_volt);
-constexpr auto                  electron_mass_energy_equivalent_in_MeV =         0.5109989461_n * mega(electron_volt);
-constexpr auto                        electron_volt_hertz_relationship =       2.417989262e14_n * hertz;
-constexpr auto                electron_volt_inverse_meter_relationship =        8.065544005e5_n / meter;
-constexpr auto                        electron_volt_joule_relationship =     1.6021766208e-19_n * joule;
-constexpr auto                       electron_volt_kelvin_relationship =         1.16045221e4_n * kelvin;
-constexpr auto                     electron_volt_kilogram_relationship =      1.782661907e-36_n * kilogram;
-constexpr auto                                       elementary_charge =     1.6021766208e-19_n * coulomb;
-constexpr auto                                elementary_charge_over_h =       2.417989262e14_n * ampere / joule;
-constexpr auto                                        Faraday_constant =          96485.33289_n * coulomb / mole;
-constexpr auto      Faraday_constant_for_conventional_electric_current =           96485.3251_n * coulomb / mole / mole;
-constexpr auto                                 Fermi_coupling_constant =         1.1663787e-5_n / square( giga(electron_volt) );
-constexpr auto                                 fine_structure_constant =      7.2973525664e-3_n;
-constexpr auto                                first_radiation_constant =      3.741771790e-16_n * watt * square( meter );
-constexpr auto          first_radiation_constant_for_spectral_radiance =      1.191042953e-16_n * watt * square( meter ) / steradian;
-constexpr auto                      hartree_electron_volt_relationship =          27.21138602_n * electron_volt;
-constexpr auto                   atomic_mass_unit_hartree_relationship =       3.4231776902e7_n * hartree_electron_volt_relationship;
-constexpr auto                      electron_volt_hartree_relationship =       3.674932248e-2_n * hartree_electron_volt_relationship;
-constexpr auto                                          Hartree_energy =      4.359744650e-18_n * joule;
-constexpr auto                                    Hartree_energy_in_eV =          27.21138602_n * electron_volt;
-constexpr auto                              hartree_hertz_relationship =    6.579683920711e15_n * hertz;
-constexpr auto                      hartree_inverse_meter_relationship =     2.194746313702e7_n / meter;
-constexpr auto                              hartree_joule_relationship =      4.359744650e-18_n * joule;
-constexpr auto                             hartree_kelvin_relationship =          3.1577513e5_n * kelvin;
-constexpr auto                           hartree_kilogram_relationship =      4.850870129e-35_n * kilogram;
-constexpr auto                              helion_electron_mass_ratio =        5495.88527922_n;
-constexpr auto                                         helion_g_factor =         -4.255250616_n;
-constexpr auto                                          helion_mag_mom =     -1.074617522e-26_n * joule / tesla;
-constexpr auto                   helion_mag_mom_to_Bohr_magneton_ratio =      -1.158740958e-3_n;
-constexpr auto                helion_mag_mom_to_nuclear_magneton_ratio =         -2.127625308_n;
-constexpr auto                                             helion_mass =      5.006412700e-27_n * kilogram;
-constexpr auto                           helion_mass_energy_equivalent =      4.499539341e-10_n * joule;
-constexpr auto                    helion_mass_energy_equivalent_in_MeV =          2808.391586_n * mega(electron_volt);
-constexpr auto                                       helion_molar_mass =     3.01493224673e-3_n * kilogram / mole;
-constexpr auto                                helion_proton_mass_ratio =        2.99315267046_n;
-constexpr auto                        hertz_electron_volt_relationship =      4.135667662e-15_n * electron_volt;
-constexpr auto                              hertz_hartree_relationship =  1.5198298460088e-16_n * hartree_electron_volt_relationship;
-constexpr auto                        hertz_inverse_meter_relationship =       3.335640951e-9_n / meter;
-constexpr auto                                hertz_joule_relationship =      6.626070040e-34_n * joule;
-constexpr auto                               hertz_kelvin_relationship =        4.7992447e-11_n * kelvin;
-constexpr auto                             hertz_kilogram_relationship =      7.372497201e-51_n * kilogram;
-constexpr auto                         inverse_fine_structure_constant =        137.035999139_n;
-constexpr auto                inverse_meter_electron_volt_relationship =      1.2398419739e-6_n * electron_volt;
-constexpr auto                      inverse_meter_hartree_relationship =    4.556335252767e-8_n * hartree_electron_volt_relationship;
-constexpr auto                        inverse_meter_hertz_relationship =          299792458.0_n * hertz;
-constexpr auto                        inverse_meter_joule_relationship =      1.986445824e-25_n * joule;
-constexpr auto                       inverse_meter_kelvin_relationship =        1.43877736e-2_n * kelvin;
-constexpr auto                     inverse_meter_kilogram_relationship =      2.210219057e-42_n * kilogram;
-constexpr auto                          inverse_of_conductance_quantum =        12906.4037278_n * ohm;
-constexpr auto                                      Josephson_constant =        483597.8525e9_n * hertz / volt;
-constexpr auto                        joule_electron_volt_relationship =       6.241509126e18_n * electron_volt;
-constexpr auto                              joule_hartree_relationship =       2.293712317e17_n * hartree_electron_volt_relationship;
-constexpr auto                                joule_hertz_relationship =       1.509190205e33_n * hertz;
-constexpr auto                        joule_inverse_meter_relationship =       5.034116651e24_n / meter;
-constexpr auto                               joule_kelvin_relationship =         7.2429731e22_n * kelvin;
-constexpr auto                             joule_kilogram_relationship =      1.112650056e-17_n * kilogram;
-constexpr auto                       kelvin_electron_volt_relationship =         8.6173303e-5_n * electron_volt;
-constexpr auto                             kelvin_hartree_relationship =         3.1668105e-6_n * hartree_electron_volt_relationship;
-constexpr auto                               kelvin_hertz_relationship =         2.0836612e10_n * hertz;
-constexpr auto                       kelvin_inverse_meter_relationship =            69.503457_n / meter;
-constexpr auto                               kelvin_joule_relationship =       1.38064852e-23_n * joule;
-constexpr auto                            kelvin_kilogram_relationship =       1.53617865e-40_n * kilogram;
-constexpr auto                     kilogram_electron_volt_relationship =       5.609588650e35_n * electron_volt;
-constexpr auto                           kilogram_hartree_relationship =       2.061485823e34_n * hartree_electron_volt_relationship;
-constexpr auto                             kilogram_hertz_relationship =       1.356392512e50_n * hertz;
-constexpr auto                     kilogram_inverse_meter_relationship =       4.524438411e41_n / meter;
-constexpr auto                             kilogram_joule_relationship =       8.987551787e16_n * joule;
-constexpr auto                            kilogram_kelvin_relationship =         6.5096595e39_n * kelvin;
-constexpr auto                            lattice_parameter_of_silicon =      543.1020504e-12_n * meter;
-constexpr auto                     Loschmidt_constant_273_15_K_100_kPa =         2.6516467e25_n / cube( meter );
-constexpr auto                 Loschmidt_constant_273_15_K_101_325_kPa =         2.6867811e25_n / cube( meter );
-constexpr auto                                            mag_constant =      12.566370614e-7_n * newton / square( ampere );
-constexpr auto                                        mag_flux_quantum =      2.067833831e-15_n * weber;
-constexpr auto                                      molar_gas_constant =            8.3144598_n * joule / mole / kelvin;
-constexpr auto                                     molar_mass_constant =                 1e-3_n * kilogram / mole;
-constexpr auto                                 molar_mass_of_carbon_12 =                12e-3_n * kilogram / mole;
-constexpr auto                                   molar_Planck_constant =     3.9903127110e-10_n * joule * second / mole;
-constexpr auto                           molar_Planck_constant_times_c =       0.119626565582_n * joule * meter / mole;
-constexpr auto              molar_volume_of_ideal_gas_273_15_K_100_kPa =         22.710947e-3_n * cube( meter ) / mole;
-constexpr auto          molar_volume_of_ideal_gas_273_15_K_101_325_kPa =         22.413962e-3_n * cube( meter ) / mole;
-constexpr auto                                 molar_volume_of_silicon =       12.05883214e-6_n * cube( meter ) / mole;
-constexpr auto                                               Mo_x_unit =       1.00209952e-13_n * meter;
-constexpr auto                                 muon_Compton_wavelength =      11.73444111e-15_n * meter;
-constexpr auto                       muon_Compton_wavelength_over_2_pi =      1.867594308e-15_n * meter;
-constexpr auto                                muon_electron_mass_ratio =          206.7682826_n;
-constexpr auto                                           muon_g_factor =        -2.0023318418_n;
-constexpr auto                                            muon_mag_mom =      -4.49044826e-26_n * joule / tesla;
-constexpr auto                                    muon_mag_mom_anomaly =        1.16592089e-3_n;
-constexpr auto                     muon_mag_mom_to_Bohr_magneton_ratio =       -4.84197048e-3_n;
-constexpr auto                  muon_mag_mom_to_nuclear_magneton_ratio =          -8.89059705_n;
-constexpr auto                                               muon_mass =      1.883531594e-28_n * kilogram;
-constexpr auto                             muon_mass_energy_equivalent =      1.692833774e-11_n * joule;
-constexpr auto                      muon_mass_energy_equivalent_in_MeV =          105.6583745_n * mega(electron_volt);
-constexpr auto                                         muon_molar_mass =      0.1134289257e-3_n * kilogram / mole;
-constexpr auto                                 muon_neutron_mass_ratio =         0.1124545167_n;
-constexpr auto                               muon_proton_mag_mom_ratio =         -3.183345142_n;
-constexpr auto                                  muon_proton_mass_ratio =         0.1126095262_n;
-constexpr auto                                     muon_tau_mass_ratio =           5.94649e-2_n;
-constexpr auto                                  natural_unit_of_action =      1.054571800e-34_n * joule * second;
-constexpr auto                          natural_unit_of_action_in_eV_s =      6.582119514e-16_n * electron_volt * second;
-constexpr auto                                  natural_unit_of_energy =       8.18710565e-14_n * joule;
-constexpr auto                           natural_unit_of_energy_in_MeV =         0.5109989461_n * mega(electron_volt);
-constexpr auto                                  natural_unit_of_length =     386.15926764e-15_n * meter;
-constexpr auto                                    natural_unit_of_mass =       9.10938356e-31_n * kilogram;
-constexpr auto                                  natural_unit_of_mom_um =      2.730924488e-22_n * kilogram * meter / second;
-constexpr auto                                    natural_unit_of_time =    1.28808866712e-21_n * second;
-constexpr auto                                natural_unit_of_velocity =          299792458.0_n * meter / second;
-constexpr auto                              neutron_Compton_wavelength =    1.31959090481e-15_n * meter;
-constexpr auto                    neutron_Compton_wavelength_over_2_pi =    0.21001941536e-15_n * meter;
-constexpr auto                          neutron_electron_mag_mom_ratio =        1.04066882e-3_n;
-constexpr auto                             neutron_electron_mass_ratio =        1838.68366158_n;
-constexpr auto                                        neutron_g_factor =          -3.82608545_n;
-constexpr auto                                   neutron_gyromag_ratio =         1.83247172e8_n / second / tesla;
-constexpr auto                         neutron_gyromag_ratio_over_2_pi =           29.1646933_n * mega(hertz) / tesla;
-constexpr auto                                         neutron_mag_mom =      -0.96623650e-26_n * joule / tesla;
-constexpr auto                  neutron_mag_mom_to_Bohr_magneton_ratio =       -1.04187563e-3_n;
-constexpr auto               neutron_mag_mom_to_nuclear_magneton_ratio =          -1.91304273_n;
-constexpr auto                                            neutron_mass =      1.674927471e-27_n * kilogram;
-constexpr auto                          neutron_mass_energy_equivalent =      1.505349739e-10_n * joule;
-constexpr auto                   neutron_mass_energy_equivalent_in_MeV =          939.5654133_n * mega(electron_volt);
-constexpr auto                                      neutron_molar_mass =     1.00866491588e-3_n * kilogram / mole;
-constexpr auto                                 neutron_muon_mass_ratio =           8.89248408_n;
-constexpr auto                            neutron_proton_mag_mom_ratio =          -0.68497934_n;
-constexpr auto                          neutron_proton_mass_difference =       2.30557377e-30_n;
-constexpr auto        neutron_proton_mass_difference_energy_equivalent =       2.07214637e-13_n;
-constexpr auto neutron_proton_mass_difference_energy_equivalent_in_MeV =           1.29333205_n;
-constexpr auto                     neutron_proton_mass_difference_in_u =        0.00138844900_n;
-constexpr auto                               neutron_proton_mass_ratio =        1.00137841898_n;
-constexpr auto                                  neutron_tau_mass_ratio =             0.528790_n;
-constexpr auto                neutron_to_shielded_proton_mag_mom_ratio =          -0.68499694_n;
-constexpr auto                       Newtonian_constant_of_gravitation =          6.67408e-11_n * cube( meter ) / kilogram / square( second );
-constexpr auto                                        nuclear_magneton =      5.050783699e-27_n * joule / tesla;
-constexpr auto                            nuclear_magneton_in_eV_per_T =      3.1524512550e-8_n * electron_volt / tesla;
-constexpr auto            nuclear_magneton_in_inverse_meters_per_tesla =       2.542623432e-2_n / meter / tesla;
-constexpr auto                             nuclear_magneton_in_K_per_T =         3.6582690e-4_n * kelvin / tesla;
-constexpr auto                           nuclear_magneton_in_MHz_per_T =          7.622593285_n * mega(hertz) / tesla;
-constexpr auto                                         Planck_constant =      6.626070040e-34_n * joule * second;
-constexpr auto                                 Planck_constant_in_eV_s =      4.135667662e-15_n * electron_volt * second;
-constexpr auto                               Planck_constant_over_2_pi =      1.054571800e-34_n * joule * second;
-constexpr auto                       Planck_constant_over_2_pi_in_eV_s =      6.582119514e-16_n * electron_volt * second;
-constexpr auto             Planck_constant_over_2_pi_times_c_in_MeV_fm =          197.3269788_n * mega(electron_volt) * femto(meter);
-constexpr auto                                           Planck_length =         1.616229e-35_n * meter;
-constexpr auto                                             Planck_mass =          2.176470e-8_n * kilogram;
-constexpr auto                    Planck_mass_energy_equivalent_in_GeV =          1.220910e19_n * giga(electron_volt);
-constexpr auto                                      Planck_temperature =          1.416808e32_n * kelvin;
-constexpr auto                                             Planck_time =          5.39116e-44_n * second;
-constexpr auto                          proton_charge_to_mass_quotient =        9.578833226e7_n * coulomb / kilogram;
-constexpr auto                               proton_Compton_wavelength =    1.32140985396e-15_n * meter;
-constexpr auto                     proton_Compton_wavelength_over_2_pi =   0.210308910109e-15_n * meter;
-constexpr auto                              proton_electron_mass_ratio =        1836.15267389_n;
-constexpr auto                                         proton_g_factor =          5.585694702_n;
-constexpr auto                                    proton_gyromag_ratio =        2.675221900e8_n / second / tesla;
-constexpr auto                          proton_gyromag_ratio_over_2_pi =          42.57747892_n * mega(hertz) / tesla;
-constexpr auto                                          proton_mag_mom =     1.4106067873e-26_n * joule / tesla;
-constexpr auto                   proton_mag_mom_to_Bohr_magneton_ratio =      1.5210322053e-3_n;
-constexpr auto                proton_mag_mom_to_nuclear_magneton_ratio =         2.7928473508_n;
-constexpr auto                         proton_mag_shielding_correction =            25.691e-6_n;
-constexpr auto                                             proton_mass =      1.672621898e-27_n * kilogram;
-constexpr auto                           proton_mass_energy_equivalent =      1.503277593e-10_n * joule;
-constexpr auto                    proton_mass_energy_equivalent_in_MeV =          938.2720813_n * mega(electron_volt);
-constexpr auto                                       proton_molar_mass =    1.007276466879e-3_n * kilogram / mole;
-constexpr auto                                  proton_muon_mass_ratio =           8.88024338_n;
-constexpr auto                            proton_neutron_mag_mom_ratio =          -1.45989805_n;
-constexpr auto                               proton_neutron_mass_ratio =        0.99862347844_n;
-constexpr auto                                proton_rms_charge_radius =           0.8751e-15_n * meter;
-constexpr auto                                   proton_tau_mass_ratio =             0.528063_n;
-constexpr auto                                  quantum_of_circulation =      3.6369475486e-4_n * square( meter ) / second;
-constexpr auto                          quantum_of_circulation_times_2 =      7.2738950972e-4_n * square( meter ) / second;
-constexpr auto                                        Rydberg_constant =      10973731.568508_n / meter;
-constexpr auto                          Rydberg_constant_times_c_in_Hz =    3.289841960355e15_n * hertz;
-constexpr auto                         Rydberg_constant_times_hc_in_eV =         13.605693009_n * electron_volt;
-constexpr auto                          Rydberg_constant_times_hc_in_J =      2.179872325e-18_n * joule;
-constexpr auto                     Sackur_Tetrode_constant_1_K_100_kPa =           -1.1517084_n;
-constexpr auto                 Sackur_Tetrode_constant_1_K_101_325_kPa =           -1.1648714_n;
-constexpr auto                               second_radiation_constant =        1.43877736e-2_n * meter * kelvin;
-constexpr auto                           shielded_helion_gyromag_ratio =        2.037894585e8_n / second / tesla;
-constexpr auto                 shielded_helion_gyromag_ratio_over_2_pi =          32.43409966_n * mega(hertz) / tesla;
-constexpr auto                                 shielded_helion_mag_mom =     -1.074553080e-26_n * joule / tesla;
-constexpr auto          shielded_helion_mag_mom_to_Bohr_magneton_ratio =      -1.158671471e-3_n;
-constexpr auto       shielded_helion_mag_mom_to_nuclear_magneton_ratio =         -2.127497720_n;
-constexpr auto                 shielded_helion_to_proton_mag_mom_ratio =        -0.7617665603_n;
-constexpr auto        shielded_helion_to_shielded_proton_mag_mom_ratio =        -0.7617861313_n;
-constexpr auto                           shielded_proton_gyromag_ratio =        2.675153171e8_n / second / tesla;
-constexpr auto                 shielded_proton_gyromag_ratio_over_2_pi =          42.57638507_n * mega(hertz) / tesla;
-constexpr auto                                 shielded_proton_mag_mom =      1.410570547e-26_n * joule / tesla;
-constexpr auto          shielded_proton_mag_mom_to_Bohr_magneton_ratio =       1.520993128e-3_n;
-constexpr auto       shielded_proton_mag_mom_to_nuclear_magneton_ratio =          2.792775600_n;
-constexpr auto                                speed_of_light_in_vacuum =          299792458.0_n * meter / second;
-constexpr auto                     natural_unit_of_mom_um_in_MeV_per_c =         0.5109989461_n * mega(electron_volt) / speed_of_light_in_vacuum;
-constexpr auto          Newtonian_constant_of_gravitation_over_h_bar_c =          6.70861e-39_n * pow<std::ratio<4>>( speed_of_light_in_vacuum ) / square( giga(electron_volt) );
-constexpr auto                        standard_acceleration_of_gravity =              9.80665_n * meter / square( second );
-constexpr auto                                     standard_atmosphere =             101325.0_n * pascal;
-constexpr auto                                 standard_state_pressure =             100000.0_n * pascal;
-constexpr auto                               Stefan_Boltzmann_constant =          5.670367e-8_n * watt / square( meter ) / pow<std::ratio<4>>( kelvin );
-constexpr auto                                  tau_Compton_wavelength =         0.697787e-15_n * meter;
-constexpr auto                        tau_Compton_wavelength_over_2_pi =         0.111056e-15_n * meter;
-constexpr auto                                 tau_electron_mass_ratio =              3477.15_n;
-constexpr auto                                                tau_mass =          3.16747e-27_n * kilogram;
-constexpr auto                              tau_mass_energy_equivalent =          2.84678e-10_n * joule;
-constexpr auto                       tau_mass_energy_equivalent_in_MeV =              1776.82_n * mega(electron_volt);
-constexpr auto                                          tau_molar_mass =           1.90749e-3_n * kilogram / mole;
-constexpr auto                                     tau_muon_mass_ratio =              16.8167_n;
-constexpr auto                                  tau_neutron_mass_ratio =              1.89111_n;
-constexpr auto                                   tau_proton_mass_ratio =              1.89372_n;
-constexpr auto                                   Thomson_cross_section =    0.66524587158e-28_n * square( meter );
-constexpr auto                              triton_electron_mass_ratio =        5496.92153588_n;
-constexpr auto                                         triton_g_factor =          5.957924920_n;
-constexpr auto                                          triton_mag_mom =      1.504609503e-26_n * joule / tesla;
-constexpr auto                   triton_mag_mom_to_Bohr_magneton_ratio =      1.6223936616e-3_n;
-constexpr auto                triton_mag_mom_to_nuclear_magneton_ratio =          2.978962460_n;
-constexpr auto                                             triton_mass =      5.007356665e-27_n * kilogram;
-constexpr auto                           triton_mass_energy_equivalent =      4.500387735e-10_n * joule;
-constexpr auto                    triton_mass_energy_equivalent_in_MeV =          2808.921112_n * mega(electron_volt);
-constexpr auto                                       triton_molar_mass =     3.01550071632e-3_n * kilogram / mole;
-constexpr auto                                triton_proton_mass_ratio =        2.99371703348_n;
-constexpr auto                                unified_atomic_mass_unit =      1.660539040e-27_n * kilogram;
-constexpr auto                                alpha_particle_mass_in_u =       4.001506179127_n * unified_atomic_mass_unit;
-constexpr auto                                      deuteron_mass_in_u =       2.013553212745_n * unified_atomic_mass_unit;
-constexpr auto                                      electron_mass_in_u =     5.48579909070e-4_n * unified_atomic_mass_unit;
-constexpr auto             electron_volt_atomic_mass_unit_relationship =      1.0735441105e-9_n * unified_atomic_mass_unit;
-constexpr auto                   hartree_atomic_mass_unit_relationship =      2.9212623197e-8_n * unified_atomic_mass_unit;
-constexpr auto                                        helion_mass_in_u =        3.01493224673_n * unified_atomic_mass_unit;
-constexpr auto                     hertz_atomic_mass_unit_relationship =     4.4398216616e-24_n * unified_atomic_mass_unit;
-constexpr auto             inverse_meter_atomic_mass_unit_relationship =    1.33102504900e-15_n * unified_atomic_mass_unit;
-constexpr auto                     joule_atomic_mass_unit_relationship =        6.700535363e9_n * unified_atomic_mass_unit;
-constexpr auto                    kelvin_atomic_mass_unit_relationship =        9.2510842e-14_n * unified_atomic_mass_unit;
-constexpr auto                  kilogram_atomic_mass_unit_relationship =       6.022140857e26_n * unified_atomic_mass_unit;
-constexpr auto                                          muon_mass_in_u =         0.1134289257_n * unified_atomic_mass_unit;
-constexpr auto                                       neutron_mass_in_u =        1.00866491588_n * unified_atomic_mass_unit;
-constexpr auto                                        proton_mass_in_u =       1.007276466879_n * unified_atomic_mass_unit;
-constexpr auto                                           tau_mass_in_u =              1.90749_n * unified_atomic_mass_unit;
-constexpr auto                                        triton_mass_in_u =        3.01550071632_n * unified_atomic_mass_unit;
-constexpr auto                                   von_Klitzing_constant =        25812.8074555_n * ohm;
-constexpr auto                                       weak_mixing_angle =               0.2223_n;
-constexpr auto                Wien_frequency_displacement_law_constant =         5.8789238e10_n * hertz / kelvin;
-constexpr auto               Wien_wavelength_displacement_law_constant =         2.8977729e-3_n * meter * kelvin;
-
-
-namespace uncertaintiy{
-
-constexpr auto                        c_220_lattice_spacing_of_silicon =        0.0000032e-12_n * decltype(physicalConstant::c_220_lattice_spacing_of_silicon)::classtype{1};
-constexpr auto                      alpha_particle_electron_mass_ratio =           0.00000024_n;
-constexpr auto                                     alpha_particle_mass =      0.000000082e-27_n * decltype(physicalConstant::alpha_particle_mass)::classtype{1};
-constexpr auto                   alpha_particle_mass_energy_equivalent =      0.000000073e-10_n * decltype(physicalConstant::alpha_particle_mass_energy_equivalent)::classtype{1};
-constexpr auto                               alpha_particle_molar_mass =    0.000000000063e-3_n * decltype(physicalConstant::alpha_particle_molar_mass)::classtype{1};
-constexpr auto                        alpha_particle_proton_mass_ratio =        0.00000000036_n;
-constexpr auto                                           Angstrom_star =       0.00000090e-10_n * decltype(physicalConstant::Angstrom_star)::classtype{1};
-constexpr auto                                    atomic_mass_constant =      0.000000020e-27_n * decltype(physicalConstant::atomic_mass_constant)::classtype{1};
-constexpr auto                  atomic_mass_constant_energy_equivalent =      0.000000018e-10_n * decltype(physicalConstant::atomic_mass_constant_energy_equivalent)::classtype{1};
-constexpr auto                     atomic_mass_unit_hertz_relationship =      0.0000000010e23_n * decltype(physicalConstant::atomic_mass_unit_hertz_relationship)::classtype{1};
-constexpr auto             atomic_mass_unit_inverse_meter_relationship =      0.0000000034e14_n * decltype(physicalConstant::atomic_mass_unit_inverse_meter_relationship)::classtype{1};
-constexpr auto                     atomic_mass_unit_joule_relationship =      0.000000018e-10_n * decltype(physicalConstant::atomic_mass_unit_joule_relationship)::classtype{1};
-constexpr auto                    atomic_mass_unit_kelvin_relationship =        0.00000062e13_n * decltype(physicalConstant::atomic_mass_unit_kelvin_relationship)::classtype{1};
-constexpr auto                  atomic_mass_unit_kilogram_relationship =      0.000000020e-27_n * decltype(physicalConstant::atomic_mass_unit_kilogram_relationship)::classtype{1};
-constexpr auto                  atomic_unit_of_1st_hyperpolarizability =      0.000000020e-53_n * decltype(physicalConstant::atomic_unit_of_1st_hyperpolarizability)::classtype{1};
-constexpr auto                  atomic_unit_of_2nd_hyperpolarizability =      0.000000077e-65_n * decltype(physicalConstant::atomic_unit_of_2nd_hyperpolarizability)::classtype{1};
-constexpr auto                                   atomic_unit_of_action =      0.000000013e-34_n * decltype(physicalConstant::atomic_unit_of_action)::classtype{1};
-constexpr auto                                   atomic_unit_of_charge =     0.0000000098e-19_n * decltype(physicalConstant::atomic_unit_of_charge)::classtype{1};
-constexpr auto                           atomic_unit_of_charge_density =      0.0000000067e12_n * decltype(physicalConstant::atomic_unit_of_charge_density)::classtype{1};
-constexpr auto                                  atomic_unit_of_current =       0.000000041e-3_n * decltype(physicalConstant::atomic_unit_of_current)::classtype{1};
-constexpr auto                      atomic_unit_of_electric_dipole_mom =      0.000000052e-30_n * decltype(physicalConstant::atomic_unit_of_electric_dipole_mom)::classtype{1};
-constexpr auto                           atomic_unit_of_electric_field =       0.000000032e11_n * decltype(physicalConstant::atomic_unit_of_electric_field)::classtype{1};
-constexpr auto                  atomic_unit_of_electric_field_gradient =       0.000000060e21_n * decltype(physicalConstant::atomic_unit_of_electric_field_gradient)::classtype{1};
-constexpr auto                  atomic_unit_of_electric_polarizability =     0.0000000011e-41_n * decltype(physicalConstant::atomic_unit_of_electric_polarizability)::classtype{1};
-constexpr auto                       atomic_unit_of_electric_potential =           0.00000017_n * decltype(physicalConstant::atomic_unit_of_electric_potential)::classtype{1};
-constexpr auto                  atomic_unit_of_electric_quadrupole_mom =      0.000000028e-40_n * decltype(physicalConstant::atomic_unit_of_electric_quadrupole_mom)::classtype{1};
-constexpr auto                                   atomic_unit_of_energy =      0.000000054e-18_n * decltype(physicalConstant::atomic_unit_of_energy)::classtype{1};
-constexpr auto                                    atomic_unit_of_force =        0.00000010e-8_n * decltype(physicalConstant::atomic_unit_of_force)::classtype{1};
-constexpr auto                                   atomic_unit_of_length =    0.00000000012e-10_n * decltype(physicalConstant::atomic_unit_of_length)::classtype{1};
-constexpr auto                           atomic_unit_of_mag_dipole_mom =      0.000000011e-23_n * decltype(physicalConstant::atomic_unit_of_mag_dipole_mom)::classtype{1};
-constexpr auto                         atomic_unit_of_mag_flux_density =        0.000000014e5_n * decltype(physicalConstant::atomic_unit_of_mag_flux_density)::classtype{1};
-constexpr auto                          atomic_unit_of_magnetizability =     0.0000000090e-29_n * decltype(physicalConstant::atomic_unit_of_magnetizability)::classtype{1};
-constexpr auto                                     atomic_unit_of_mass =       0.00000011e-31_n * decltype(physicalConstant::atomic_unit_of_mass)::classtype{1};
-constexpr auto                                   atomic_unit_of_mom_um =      0.000000024e-24_n * decltype(physicalConstant::atomic_unit_of_mom_um)::classtype{1};
-constexpr auto                             atomic_unit_of_permittivity =                  0.0_n * decltype(physicalConstant::atomic_unit_of_permittivity)::classtype{1};
-constexpr auto                                     atomic_unit_of_time =   0.000000000014e-17_n * decltype(physicalConstant::atomic_unit_of_time)::classtype{1};
-constexpr auto                                 atomic_unit_of_velocity =      0.00000000050e6_n * decltype(physicalConstant::atomic_unit_of_velocity)::classtype{1};
-constexpr auto                                       Avogadro_constant =       0.000000074e23_n * decltype(physicalConstant::Avogadro_constant)::classtype{1};
-constexpr auto                                           Bohr_magneton =        0.0000057e-26_n * decltype(physicalConstant::Bohr_magneton)::classtype{1};
-constexpr auto                               Bohr_magneton_in_Hz_per_T =        0.000000086e9_n * decltype(physicalConstant::Bohr_magneton_in_Hz_per_T)::classtype{1};
-constexpr auto               Bohr_magneton_in_inverse_meters_per_tesla =           0.00000029_n * decltype(physicalConstant::Bohr_magneton_in_inverse_meters_per_tesla)::classtype{1};
-constexpr auto                                Bohr_magneton_in_K_per_T =           0.00000039_n * decltype(physicalConstant::Bohr_magneton_in_K_per_T)::classtype{1};
-constexpr auto                                             Bohr_radius =    0.00000000012e-10_n * decltype(physicalConstant::Bohr_radius)::classtype{1};
-constexpr auto                                      Boltzmann_constant =       0.00000079e-23_n * decltype(physicalConstant::Boltzmann_constant)::classtype{1};
-constexpr auto                          Boltzmann_constant_in_Hz_per_K =         0.0000012e10_n * decltype(physicalConstant::Boltzmann_constant_in_Hz_per_K)::classtype{1};
-constexpr auto         Boltzmann_constant_in_inverse_meters_per_kelvin =             0.000040_n * decltype(physicalConstant::Boltzmann_constant_in_inverse_meters_per_kelvin)::classtype{1};
-constexpr auto                      characteristic_impedance_of_vacuum =                  0.0_n * decltype(physicalConstant::characteristic_impedance_of_vacuum)::classtype{1};
-constexpr auto                               classical_electron_radius =     0.0000000019e-15_n * decltype(physicalConstant::classical_electron_radius)::classtype{1};
-constexpr auto                                      Compton_wavelength =     0.0000000011e-12_n * decltype(physicalConstant::Compton_wavelength)::classtype{1};
-constexpr auto                            Compton_wavelength_over_2_pi =       0.00000018e-15_n * decltype(physicalConstant::Compton_wavelength_over_2_pi)::classtype{1};
-constexpr auto                                     conductance_quantum =      0.0000000018e-5_n * decltype(physicalConstant::conductance_quantum)::classtype{1};
-constexpr auto                conventional_value_of_Josephson_constant =                  0.0_n * decltype(physicalConstant::conventional_value_of_Josephson_constant)::classtype{1};
-constexpr auto             conventional_value_of_von_Klitzing_constant =                  0.0_n * decltype(physicalConstant::conventional_value_of_von_Klitzing_constant)::classtype{1};
-constexpr auto                                               Cu_x_unit =       0.00000028e-13_n * decltype(physicalConstant::Cu_x_unit)::classtype{1};
-constexpr auto                         deuteron_electron_mag_mom_ratio =       0.000000026e-4_n;
-constexpr auto                            deuteron_electron_mass_ratio =           0.00000013_n;
-constexpr auto                                       deuteron_g_factor =         0.0000000048_n;
-constexpr auto                                        deuteron_mag_mom =     0.0000000036e-26_n * decltype(physicalConstant::deuteron_mag_mom)::classtype{1};
-constexpr auto                 deuteron_mag_mom_to_Bohr_magneton_ratio =      0.0000000026e-3_n;
-constexpr auto              deuteron_mag_mom_to_nuclear_magneton_ratio =         0.0000000048_n;
-constexpr auto                                           deuteron_mass =      0.000000041e-27_n * decltype(physicalConstant::deuteron_mass)::classtype{1};
-constexpr auto                         deuteron_mass_energy_equivalent =      0.000000037e-10_n * decltype(physicalConstant::deuteron_mass_energy_equivalent)::classtype{1};
-constexpr auto                                     deuteron_molar_mass =    0.000000000040e-3_n * decltype(physicalConstant::deuteron_molar_mass)::classtype{1};
-constexpr auto                          deuteron_neutron_mag_mom_ratio =           0.00000011_n;
-constexpr auto                           deuteron_proton_mag_mom_ratio =         0.0000000015_n;
-constexpr auto                              deuteron_proton_mass_ratio =        0.00000000019_n;
-constexpr auto                              deuteron_rms_charge_radius =           0.0025e-15_n * decltype(physicalConstant::deuteron_rms_charge_radius)::classtype{1};
-constexpr auto                                       electric_constant =                  0.0_n * decltype(physicalConstant::electric_constant)::classtype{1};
-constexpr auto                        electron_charge_to_mass_quotient =       0.000000011e11_n * decltype(physicalConstant::electron_charge_to_mass_quotient)::classtype{1};
-constexpr auto                         electron_deuteron_mag_mom_ratio =             0.000012_n;
-constexpr auto                            electron_deuteron_mass_ratio =    0.000000000096e-4_n;
-constexpr auto                                       electron_g_factor =     0.00000000000052_n;
-constexpr auto                                  electron_gyromag_ratio =       0.000000011e11_n * decltype(physicalConstant::electron_gyromag_ratio)::classtype{1};
-constexpr auto                        electron_gyromag_ratio_over_2_pi =              0.00017_n * decltype(physicalConstant::electron_gyromag_ratio_over_2_pi)::classtype{1};
-constexpr auto                              electron_helion_mass_ratio =    0.000000000088e-4_n;
-constexpr auto                                        electron_mag_mom =        0.0000057e-26_n * decltype(physicalConstant::electron_mag_mom)::classtype{1};
-constexpr auto                                electron_mag_mom_anomaly =     0.00000000026e-3_n;
-constexpr auto                 electron_mag_mom_to_Bohr_magneton_ratio =     0.00000000000026_n;
-constexpr auto              electron_mag_mom_to_nuclear_magneton_ratio =           0.00000017_n;
-constexpr auto                                           electron_mass =       0.00000011e-31_n * decltype(physicalConstant::electron_mass)::classtype{1};
-constexpr auto                         electron_mass_energy_equivalent =       0.00000010e-14_n * decltype(physicalConstant::electron_mass_energy_equivalent)::classtype{1};
-constexpr auto                                     electron_molar_mass =     0.00000000016e-7_n * decltype(physicalConstant::electron_molar_mass)::classtype{1};
-constexpr auto                             electron_muon_mag_mom_ratio =            0.0000046_n;
-constexpr auto                                electron_muon_mass_ratio =        0.00000011e-3_n;
-constexpr auto                          electron_neutron_mag_mom_ratio =              0.00023_n;
-constexpr auto                             electron_neutron_mass_ratio =      0.0000000027e-4_n;
-constexpr auto                           electron_proton_mag_mom_ratio =            0.0000020_n;
-constexpr auto                              electron_proton_mass_ratio =     0.00000000052e-4_n;
-constexpr auto                                 electron_tau_mass_ratio =           0.00026e-4_n;
-constexpr auto                   electron_to_alpha_particle_mass_ratio =    0.000000000045e-4_n;
-constexpr auto               electron_to_shielded_helion_mag_mom_ratio =             0.000010_n;
-constexpr auto               electron_to_shielded_proton_mag_mom_ratio =            0.0000072_n;
-constexpr auto                              electron_triton_mass_ratio =    0.000000000084e-4_n;
-constexpr auto                                           electron_volt =     0.0000000098e-19_n * decltype(physicalConstant::electron_volt)::classtype{1};
-constexpr auto            alpha_particle_mass_energy_equivalent_in_MeV =             0.000023_n * decltype(physicalConstant::alpha_particle_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto           atomic_mass_constant_energy_equivalent_in_MeV =            0.0000057_n * decltype(physicalConstant::atomic_mass_constant_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto             atomic_mass_unit_electron_volt_relationship =          0.0000057e6_n * decltype(physicalConstant::atomic_mass_unit_electron_volt_relationship)::classtype{1};
-constexpr auto                               Bohr_magneton_in_eV_per_T =      0.0000000026e-5_n * decltype(physicalConstant::Bohr_magneton_in_eV_per_T)::classtype{1};
-constexpr auto                          Boltzmann_constant_in_eV_per_K =         0.0000050e-5_n * decltype(physicalConstant::Boltzmann_constant_in_eV_per_K)::classtype{1};
-constexpr auto                  deuteron_mass_energy_equivalent_in_MeV =             0.000012_n * decltype(physicalConstant::deuteron_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                  electron_mass_energy_equivalent_in_MeV =         0.0000000031_n * decltype(physicalConstant::electron_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                        electron_volt_hertz_relationship =       0.000000015e14_n * decltype(physicalConstant::electron_volt_hertz_relationship)::classtype{1};
-constexpr auto                electron_volt_inverse_meter_relationship =        0.000000050e5_n * decltype(physicalConstant::electron_volt_inverse_meter_relationship)::classtype{1};
-constexpr auto                        electron_volt_joule_relationship =     0.0000000098e-19_n * decltype(physicalConstant::electron_volt_joule_relationship)::classtype{1};
-constexpr auto                       electron_volt_kelvin_relationship =         0.00000067e4_n * decltype(physicalConstant::electron_volt_kelvin_relationship)::classtype{1};
-constexpr auto                     electron_volt_kilogram_relationship =      0.000000011e-36_n * decltype(physicalConstant::electron_volt_kilogram_relationship)::classtype{1};
-constexpr auto                                       elementary_charge =     0.0000000098e-19_n * decltype(physicalConstant::elementary_charge)::classtype{1};
-constexpr auto                                elementary_charge_over_h =       0.000000015e14_n * decltype(physicalConstant::elementary_charge_over_h)::classtype{1};
-constexpr auto                                        Faraday_constant =              0.00059_n * decltype(physicalConstant::Faraday_constant)::classtype{1};
-constexpr auto      Faraday_constant_for_conventional_electric_current =               0.0012_n * decltype(physicalConstant::Faraday_constant_for_conventional_electric_current)::classtype{1};
-constexpr auto                                 Fermi_coupling_constant =         0.0000006e-5_n * decltype(physicalConstant::Fermi_coupling_constant)::classtype{1};
-constexpr auto                                 fine_structure_constant =      0.0000000017e-3_n;
-constexpr auto                                first_radiation_constant =      0.000000046e-16_n * decltype(physicalConstant::first_radiation_constant)::classtype{1};
-constexpr auto          first_radiation_constant_for_spectral_radiance =      0.000000015e-16_n * decltype(physicalConstant::first_radiation_constant_for_spectral_radiance)::classtype{1};
-constexpr auto                      hartree_electron_volt_relationship =           0.00000017_n * decltype(physicalConstant::hartree_electron_volt_relationship)::classtype{1};
-constexpr auto                   atomic_mass_unit_hartree_relationship =       0.0000000016e7_n * decltype(physicalConstant::atomic_mass_unit_hartree_relationship)::classtype{1};
-constexpr auto                      electron_volt_hartree_relationship =       0.000000023e-2_n * decltype(physicalConstant::electron_volt_hartree_relationship)::classtype{1};
-constexpr auto                                          Hartree_energy =      0.000000054e-18_n * decltype(physicalConstant::Hartree_energy)::classtype{1};
-constexpr auto                                    Hartree_energy_in_eV =           0.00000017_n * decltype(physicalConstant::Hartree_energy_in_eV)::classtype{1};
-constexpr auto                              hartree_hertz_relationship =    0.000000000039e15_n * decltype(physicalConstant::hartree_hertz_relationship)::classtype{1};
-constexpr auto                      hartree_inverse_meter_relationship =     0.000000000013e7_n * decltype(physicalConstant::hartree_inverse_meter_relationship)::classtype{1};
-constexpr auto                              hartree_joule_relationship =      0.000000054e-18_n * decltype(physicalConstant::hartree_joule_relationship)::classtype{1};
-constexpr auto                             hartree_kelvin_relationship =          0.0000018e5_n * decltype(physicalConstant::hartree_kelvin_relationship)::classtype{1};
-constexpr auto                           hartree_kilogram_relationship =      0.000000060e-35_n * decltype(physicalConstant::hartree_kilogram_relationship)::classtype{1};
-constexpr auto                              helion_electron_mass_ratio =           0.00000027_n;
-constexpr auto                                         helion_g_factor =          0.000000050_n;
-constexpr auto                                          helion_mag_mom =      0.000000014e-26_n * decltype(physicalConstant::helion_mag_mom)::classtype{1};
-constexpr auto                   helion_mag_mom_to_Bohr_magneton_ratio =       0.000000014e-3_n;
-constexpr auto                helion_mag_mom_to_nuclear_magneton_ratio =          0.000000025_n;
-constexpr auto                                             helion_mass =      0.000000062e-27_n * decltype(physicalConstant::helion_mass)::classtype{1};
-constexpr auto                           helion_mass_energy_equivalent =      0.000000055e-10_n * decltype(physicalConstant::helion_mass_energy_equivalent)::classtype{1};
-constexpr auto                    helion_mass_energy_equivalent_in_MeV =             0.000017_n * decltype(physicalConstant::helion_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                       helion_molar_mass =     0.00000000012e-3_n * decltype(physicalConstant::helion_molar_mass)::classtype{1};
-constexpr auto                                helion_proton_mass_ratio =        0.00000000029_n;
-constexpr auto                        hertz_electron_volt_relationship =      0.000000025e-15_n * decltype(physicalConstant::hertz_electron_volt_relationship)::classtype{1};
-constexpr auto                              hertz_hartree_relationship =  0.0000000000090e-16_n * decltype(physicalConstant::hertz_hartree_relationship)::classtype{1};
-constexpr auto                        hertz_inverse_meter_relationship =                  0.0_n * decltype(physicalConstant::hertz_inverse_meter_relationship)::classtype{1};
-constexpr auto                                hertz_joule_relationship =      0.000000081e-34_n * decltype(physicalConstant::hertz_joule_relationship)::classtype{1};
-constexpr auto                               hertz_kelvin_relationship =        0.0000028e-11_n * decltype(physicalConstant::hertz_kelvin_relationship)::classtype{1};
-constexpr auto                             hertz_kilogram_relationship =      0.000000091e-51_n * decltype(physicalConstant::hertz_kilogram_relationship)::classtype{1};
-constexpr auto                         inverse_fine_structure_constant =          0.000000031_n;
-constexpr auto                inverse_meter_electron_volt_relationship =      0.0000000076e-6_n * decltype(physicalConstant::inverse_meter_electron_volt_relationship)::classtype{1};
-constexpr auto                      inverse_meter_hartree_relationship =    0.000000000027e-8_n * decltype(physicalConstant::inverse_meter_hartree_relationship)::classtype{1};
-constexpr auto                        inverse_meter_hertz_relationship =                  0.0_n * decltype(physicalConstant::inverse_meter_hertz_relationship)::classtype{1};
-constexpr auto                        inverse_meter_joule_relationship =      0.000000024e-25_n * decltype(physicalConstant::inverse_meter_joule_relationship)::classtype{1};
-constexpr auto                       inverse_meter_kelvin_relationship =        0.00000083e-2_n * decltype(physicalConstant::inverse_meter_kelvin_relationship)::classtype{1};
-constexpr auto                     inverse_meter_kilogram_relationship =      0.000000027e-42_n * decltype(physicalConstant::inverse_meter_kilogram_relationship)::classtype{1};
-constexpr auto                          inverse_of_conductance_quantum =            0.0000029_n * decltype(physicalConstant::inverse_of_conductance_quantum)::classtype{1};
-constexpr auto                                      Josephson_constant =             0.0030e9_n * decltype(physicalConstant::Josephson_constant)::classtype{1};
-constexpr auto                        joule_electron_volt_relationship =       0.000000038e18_n * decltype(physicalConstant::joule_electron_volt_relationship)::classtype{1};
-constexpr auto                              joule_hartree_relationship =       0.000000028e17_n * decltype(physicalConstant::joule_hartree_relationship)::classtype{1};
-constexpr auto                                joule_hertz_relationship =       0.000000019e33_n * decltype(physicalConstant::joule_hertz_relationship)::classtype{1};
-constexpr auto                        joule_inverse_meter_relationship =       0.000000062e24_n * decltype(physicalConstant::joule_inverse_meter_relationship)::classtype{1};
-constexpr auto                               joule_kelvin_relationship =         0.0000042e22_n * decltype(physicalConstant::joule_kelvin_relationship)::classtype{1};
-constexpr auto                             joule_kilogram_relationship =                  0.0_n * decltype(physicalConstant::joule_kilogram_relationship)::classtype{1};
-constexpr auto                       kelvin_electron_volt_relationship =         0.0000050e-5_n * decltype(physicalConstant::kelvin_electron_volt_relationship)::classtype{1};
-constexpr auto                             kelvin_hartree_relationship =         0.0000018e-6_n * decltype(physicalConstant::kelvin_hartree_relationship)::classtype{1};
-constexpr auto                               kelvin_hertz_relationship =         0.0000012e10_n * decltype(physicalConstant::kelvin_hertz_relationship)::classtype{1};
-constexpr auto                       kelvin_inverse_meter_relationship =             0.000040_n * decltype(physicalConstant::kelvin_inverse_meter_relationship)::classtype{1};
-constexpr auto                               kelvin_joule_relationship =       0.00000079e-23_n * decltype(physicalConstant::kelvin_joule_relationship)::classtype{1};
-constexpr auto                            kelvin_kilogram_relationship =       0.00000088e-40_n * decltype(physicalConstant::kelvin_kilogram_relationship)::classtype{1};
-constexpr auto                     kilogram_electron_volt_relationship =       0.000000034e35_n * decltype(physicalConstant::kilogram_electron_volt_relationship)::classtype{1};
-constexpr auto                           kilogram_hartree_relationship =       0.000000025e34_n * decltype(physicalConstant::kilogram_hartree_relationship)::classtype{1};
-constexpr auto                             kilogram_hertz_relationship =       0.000000017e50_n * decltype(physicalConstant::kilogram_hertz_relationship)::classtype{1};
-constexpr auto                     kilogram_inverse_meter_relationship =       0.000000056e41_n * decltype(physicalConstant::kilogram_inverse_meter_relationship)::classtype{1};
-constexpr auto                             kilogram_joule_relationship =                  0.0_n * decltype(physicalConstant::kilogram_joule_relationship)::classtype{1};
-constexpr auto                            kilogram_kelvin_relationship =         0.0000037e39_n * decltype(physicalConstant::kilogram_kelvin_relationship)::classtype{1};
-constexpr auto                            lattice_parameter_of_silicon =        0.0000089e-12_n * decltype(physicalConstant::lattice_parameter_of_silicon)::classtype{1};
-constexpr auto                     Loschmidt_constant_273_15_K_100_kPa =         0.0000015e25_n * decltype(physicalConstant::Loschmidt_constant_273_15_K_100_kPa)::classtype{1};
-constexpr auto                 Loschmidt_constant_273_15_K_101_325_kPa =         0.0000015e25_n * decltype(physicalConstant::Loschmidt_constant_273_15_K_101_325_kPa)::classtype{1};
-constexpr auto                                            mag_constant =                  0.0_n * decltype(physicalConstant::mag_constant)::classtype{1};
-constexpr auto                                        mag_flux_quantum =      0.000000013e-15_n * decltype(physicalConstant::mag_flux_quantum)::classtype{1};
-constexpr auto                                      molar_gas_constant =            0.0000048_n * decltype(physicalConstant::molar_gas_constant)::classtype{1};
-constexpr auto                                     molar_mass_constant =                  0.0_n * decltype(physicalConstant::molar_mass_constant)::classtype{1};
-constexpr auto                                 molar_mass_of_carbon_12 =                  0.0_n * decltype(physicalConstant::molar_mass_of_carbon_12)::classtype{1};
-constexpr auto                                   molar_Planck_constant =     0.0000000018e-10_n * decltype(physicalConstant::molar_Planck_constant)::classtype{1};
-constexpr auto                           molar_Planck_constant_times_c =       0.000000000054_n * decltype(physicalConstant::molar_Planck_constant_times_c)::classtype{1};
-constexpr auto              molar_volume_of_ideal_gas_273_15_K_100_kPa =          0.000013e-3_n * decltype(physicalConstant::molar_volume_of_ideal_gas_273_15_K_100_kPa)::classtype{1};
-constexpr auto          molar_volume_of_ideal_gas_273_15_K_101_325_kPa =          0.000013e-3_n * decltype(physicalConstant::molar_volume_of_ideal_gas_273_15_K_101_325_kPa)::classtype{1};
-constexpr auto                                 molar_volume_of_silicon =        0.00000061e-6_n * decltype(physicalConstant::molar_volume_of_silicon)::classtype{1};
-constexpr auto                                               Mo_x_unit =       0.00000053e-13_n * decltype(physicalConstant::Mo_x_unit)::classtype{1};
-constexpr auto                                 muon_Compton_wavelength =       0.00000026e-15_n * decltype(physicalConstant::muon_Compton_wavelength)::classtype{1};
-constexpr auto                       muon_Compton_wavelength_over_2_pi =      0.000000042e-15_n * decltype(physicalConstant::muon_Compton_wavelength_over_2_pi)::classtype{1};
-constexpr auto                                muon_electron_mass_ratio =            0.0000046_n;
-constexpr auto                                           muon_g_factor =         0.0000000013_n;
-constexpr auto                                            muon_mag_mom =       0.00000010e-26_n * decltype(physicalConstant::muon_mag_mom)::classtype{1};
-constexpr auto                                    muon_mag_mom_anomaly =        0.00000063e-3_n;
-constexpr auto                     muon_mag_mom_to_Bohr_magneton_ratio =        0.00000011e-3_n;
-constexpr auto                  muon_mag_mom_to_nuclear_magneton_ratio =           0.00000020_n;
-constexpr auto                                               muon_mass =      0.000000048e-28_n * decltype(physicalConstant::muon_mass)::classtype{1};
-constexpr auto                             muon_mass_energy_equivalent =      0.000000043e-11_n * decltype(physicalConstant::muon_mass_energy_equivalent)::classtype{1};
-constexpr auto                      muon_mass_energy_equivalent_in_MeV =            0.0000024_n * decltype(physicalConstant::muon_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                         muon_molar_mass =      0.0000000025e-3_n * decltype(physicalConstant::muon_molar_mass)::classtype{1};
-constexpr auto                                 muon_neutron_mass_ratio =         0.0000000025_n;
-constexpr auto                               muon_proton_mag_mom_ratio =          0.000000071_n;
-constexpr auto                                  muon_proton_mass_ratio =         0.0000000025_n;
-constexpr auto                                     muon_tau_mass_ratio =           0.00054e-2_n;
-constexpr auto                                  natural_unit_of_action =      0.000000013e-34_n * decltype(physicalConstant::natural_unit_of_action)::classtype{1};
-constexpr auto                          natural_unit_of_action_in_eV_s =      0.000000040e-16_n * decltype(physicalConstant::natural_unit_of_action_in_eV_s)::classtype{1};
-constexpr auto                                  natural_unit_of_energy =       0.00000010e-14_n * decltype(physicalConstant::natural_unit_of_energy)::classtype{1};
-constexpr auto                           natural_unit_of_energy_in_MeV =         0.0000000031_n * decltype(physicalConstant::natural_unit_of_energy_in_MeV)::classtype{1};
-constexpr auto                                  natural_unit_of_length =       0.00000018e-15_n * decltype(physicalConstant::natural_unit_of_length)::classtype{1};
-constexpr auto                                    natural_unit_of_mass =       0.00000011e-31_n * decltype(physicalConstant::natural_unit_of_mass)::classtype{1};
-constexpr auto                                  natural_unit_of_mom_um =      0.000000034e-22_n * decltype(physicalConstant::natural_unit_of_mom_um)::classtype{1};
-constexpr auto                                    natural_unit_of_time =    0.00000000058e-21_n * decltype(physicalConstant::natural_unit_of_time)::classtype{1};
-constexpr auto                                natural_unit_of_velocity =                  0.0_n * decltype(physicalConstant::natural_unit_of_velocity)::classtype{1};
-constexpr auto                              neutron_Compton_wavelength =    0.00000000088e-15_n * decltype(physicalConstant::neutron_Compton_wavelength)::classtype{1};
-constexpr auto                    neutron_Compton_wavelength_over_2_pi =    0.00000000014e-15_n * decltype(physicalConstant::neutron_Compton_wavelength_over_2_pi)::classtype{1};
-constexpr auto                          neutron_electron_mag_mom_ratio =        0.00000025e-3_n;
-constexpr auto                             neutron_electron_mass_ratio =           0.00000090_n;
-constexpr auto                                        neutron_g_factor =           0.00000090_n;
-constexpr auto                                   neutron_gyromag_ratio =         0.00000043e8_n * decltype(physicalConstant::neutron_gyromag_ratio)::classtype{1};
-constexpr auto                         neutron_gyromag_ratio_over_2_pi =            0.0000069_n * decltype(physicalConstant::neutron_gyromag_ratio_over_2_pi)::classtype{1};
-constexpr auto                                         neutron_mag_mom =       0.00000023e-26_n * decltype(physicalConstant::neutron_mag_mom)::classtype{1};
-constexpr auto                  neutron_mag_mom_to_Bohr_magneton_ratio =        0.00000025e-3_n;
-constexpr auto               neutron_mag_mom_to_nuclear_magneton_ratio =           0.00000045_n;
-constexpr auto                                            neutron_mass =      0.000000021e-27_n * decltype(physicalConstant::neutron_mass)::classtype{1};
-constexpr auto                          neutron_mass_energy_equivalent =      0.000000019e-10_n * decltype(physicalConstant::neutron_mass_energy_equivalent)::classtype{1};
-constexpr auto                   neutron_mass_energy_equivalent_in_MeV =            0.0000058_n * decltype(physicalConstant::neutron_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                      neutron_molar_mass =     0.00000000049e-3_n * decltype(physicalConstant::neutron_molar_mass)::classtype{1};
-constexpr auto                                 neutron_muon_mass_ratio =           0.00000020_n;
-constexpr auto                            neutron_proton_mag_mom_ratio =           0.00000016_n;
-constexpr auto                          neutron_proton_mass_difference =       0.00000085e-30_n;
-constexpr auto        neutron_proton_mass_difference_energy_equivalent =       0.00000076e-13_n;
-constexpr auto neutron_proton_mass_difference_energy_equivalent_in_MeV =           0.00000048_n;
-constexpr auto                     neutron_proton_mass_difference_in_u =        0.00000000051_n;
-constexpr auto                               neutron_proton_mass_ratio =        0.00000000051_n;
-constexpr auto                                  neutron_tau_mass_ratio =             0.000048_n;
-constexpr auto                neutron_to_shielded_proton_mag_mom_ratio =           0.00000016_n;
-constexpr auto                       Newtonian_constant_of_gravitation =          0.00031e-11_n * decltype(physicalConstant::Newtonian_constant_of_gravitation)::classtype{1};
-constexpr auto                                        nuclear_magneton =      0.000000031e-27_n * decltype(physicalConstant::nuclear_magneton)::classtype{1};
-constexpr auto                            nuclear_magneton_in_eV_per_T =      0.0000000015e-8_n * decltype(physicalConstant::nuclear_magneton_in_eV_per_T)::classtype{1};
-constexpr auto            nuclear_magneton_in_inverse_meters_per_tesla =       0.000000016e-2_n * decltype(physicalConstant::nuclear_magneton_in_inverse_meters_per_tesla)::classtype{1};
-constexpr auto                             nuclear_magneton_in_K_per_T =         0.0000021e-4_n * decltype(physicalConstant::nuclear_magneton_in_K_per_T)::classtype{1};
-constexpr auto                           nuclear_magneton_in_MHz_per_T =          0.000000047_n * decltype(physicalConstant::nuclear_magneton_in_MHz_per_T)::classtype{1};
-constexpr auto                                         Planck_constant =      0.000000081e-34_n * decltype(physicalConstant::Planck_constant)::classtype{1};
-constexpr auto                                 Planck_constant_in_eV_s =      0.000000025e-15_n * decltype(physicalConstant::Planck_constant_in_eV_s)::classtype{1};
-constexpr auto                               Planck_constant_over_2_pi =      0.000000013e-34_n * decltype(physicalConstant::Planck_constant_over_2_pi)::classtype{1};
-constexpr auto                       Planck_constant_over_2_pi_in_eV_s =      0.000000040e-16_n * decltype(physicalConstant::Planck_constant_over_2_pi_in_eV_s)::classtype{1};
-constexpr auto             Planck_constant_over_2_pi_times_c_in_MeV_fm =            0.0000012_n * decltype(physicalConstant::Planck_constant_over_2_pi_times_c_in_MeV_fm)::classtype{1};
-constexpr auto                                           Planck_length =         0.000038e-35_n * decltype(physicalConstant::Planck_length)::classtype{1};
-constexpr auto                                             Planck_mass =          0.000051e-8_n * decltype(physicalConstant::Planck_mass)::classtype{1};
-constexpr auto                    Planck_mass_energy_equivalent_in_GeV =          0.000029e19_n * decltype(physicalConstant::Planck_mass_energy_equivalent_in_GeV)::classtype{1};
-constexpr auto                                      Planck_temperature =          0.000033e32_n * decltype(physicalConstant::Planck_temperature)::classtype{1};
-constexpr auto                                             Planck_time =          0.00013e-44_n * decltype(physicalConstant::Planck_time)::classtype{1};
-constexpr auto                          proton_charge_to_mass_quotient =        0.000000059e7_n * decltype(physicalConstant::proton_charge_to_mass_quotient)::classtype{1};
-constexpr auto                               proton_Compton_wavelength =    0.00000000061e-15_n * decltype(physicalConstant::proton_Compton_wavelength)::classtype{1};
-constexpr auto                     proton_Compton_wavelength_over_2_pi =   0.000000000097e-15_n * decltype(physicalConstant::proton_Compton_wavelength_over_2_pi)::classtype{1};
-constexpr auto                              proton_electron_mass_ratio =           0.00000017_n;
-constexpr auto                                         proton_g_factor =          0.000000017_n;
-constexpr auto                                    proton_gyromag_ratio =        0.000000018e8_n * decltype(physicalConstant::proton_gyromag_ratio)::classtype{1};
-constexpr auto                          proton_gyromag_ratio_over_2_pi =           0.00000029_n * decltype(physicalConstant::proton_gyromag_ratio_over_2_pi)::classtype{1};
-constexpr auto                                          proton_mag_mom =     0.0000000097e-26_n * decltype(physicalConstant::proton_mag_mom)::classtype{1};
-constexpr auto                   proton_mag_mom_to_Bohr_magneton_ratio =      0.0000000046e-3_n;
-constexpr auto                proton_mag_mom_to_nuclear_magneton_ratio =         0.0000000085_n;
-constexpr auto                         proton_mag_shielding_correction =             0.011e-6_n;
-constexpr auto                                             proton_mass =      0.000000021e-27_n * decltype(physicalConstant::proton_mass)::classtype{1};
-constexpr auto                           proton_mass_energy_equivalent =      0.000000018e-10_n * decltype(physicalConstant::proton_mass_energy_equivalent)::classtype{1};
-constexpr auto                    proton_mass_energy_equivalent_in_MeV =            0.0000058_n * decltype(physicalConstant::proton_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                       proton_molar_mass =    0.000000000091e-3_n * decltype(physicalConstant::proton_molar_mass)::classtype{1};
-constexpr auto                                  proton_muon_mass_ratio =           0.00000020_n;
-constexpr auto                            proton_neutron_mag_mom_ratio =           0.00000034_n;
-constexpr auto                               proton_neutron_mass_ratio =        0.00000000051_n;
-constexpr auto                                proton_rms_charge_radius =           0.0061e-15_n * decltype(physicalConstant::proton_rms_charge_radius)::classtype{1};
-constexpr auto                                   proton_tau_mass_ratio =             0.000048_n;
-constexpr auto                                  quantum_of_circulation =      0.0000000017e-4_n * decltype(physicalConstant::quantum_of_circulation)::classtype{1};
-constexpr auto                          quantum_of_circulation_times_2 =      0.0000000033e-4_n * decltype(physicalConstant::quantum_of_circulation_times_2)::classtype{1};
-constexpr auto                                        Rydberg_constant =             0.000065_n * decltype(physicalConstant::Rydberg_constant)::classtype{1};
-constexpr auto                          Rydberg_constant_times_c_in_Hz =    0.000000000019e15_n * decltype(physicalConstant::Rydberg_constant_times_c_in_Hz)::classtype{1};
-constexpr auto                         Rydberg_constant_times_hc_in_eV =          0.000000084_n * decltype(physicalConstant::Rydberg_constant_times_hc_in_eV)::classtype{1};
-constexpr auto                          Rydberg_constant_times_hc_in_J =      0.000000027e-18_n * decltype(physicalConstant::Rydberg_constant_times_hc_in_J)::classtype{1};
-constexpr auto                     Sackur_Tetrode_constant_1_K_100_kPa =            0.0000014_n;
-constexpr auto                 Sackur_Tetrode_constant_1_K_101_325_kPa =            0.0000014_n;
-constexpr auto                               second_radiation_constant =        0.00000083e-2_n * decltype(physicalConstant::second_radiation_constant)::classtype{1};
-constexpr auto                           shielded_helion_gyromag_ratio =        0.000000027e8_n * decltype(physicalConstant::shielded_helion_gyromag_ratio)::classtype{1};
-constexpr auto                 shielded_helion_gyromag_ratio_over_2_pi =           0.00000043_n * decltype(physicalConstant::shielded_helion_gyromag_ratio_over_2_pi)::classtype{1};
-constexpr auto                                 shielded_helion_mag_mom =      0.000000014e-26_n * decltype(physicalConstant::shielded_helion_mag_mom)::classtype{1};
-constexpr auto          shielded_helion_mag_mom_to_Bohr_magneton_ratio =       0.000000014e-3_n;
-constexpr auto       shielded_helion_mag_mom_to_nuclear_magneton_ratio =          0.000000025_n;
-constexpr auto                 shielded_helion_to_proton_mag_mom_ratio =         0.0000000092_n;
-constexpr auto        shielded_helion_to_shielded_proton_mag_mom_ratio =         0.0000000033_n;
-constexpr auto                           shielded_proton_gyromag_ratio =        0.000000033e8_n * decltype(physicalConstant::shielded_proton_gyromag_ratio)::classtype{1};
-constexpr auto                 shielded_proton_gyromag_ratio_over_2_pi =           0.00000053_n * decltype(physicalConstant::shielded_proton_gyromag_ratio_over_2_pi)::classtype{1};
-constexpr auto                                 shielded_proton_mag_mom =      0.000000018e-26_n * decltype(physicalConstant::shielded_proton_mag_mom)::classtype{1};
-constexpr auto          shielded_proton_mag_mom_to_Bohr_magneton_ratio =       0.000000017e-3_n;
-constexpr auto       shielded_proton_mag_mom_to_nuclear_magneton_ratio =          0.000000030_n;
-constexpr auto                                speed_of_light_in_vacuum =                  0.0_n * decltype(physicalConstant::speed_of_light_in_vacuum)::classtype{1};
-constexpr auto                     natural_unit_of_mom_um_in_MeV_per_c =         0.0000000031_n * decltype(physicalConstant::natural_unit_of_mom_um_in_MeV_per_c)::classtype{1};
-constexpr auto          Newtonian_constant_of_gravitation_over_h_bar_c =          0.00031e-39_n * decltype(physicalConstant::Newtonian_constant_of_gravitation_over_h_bar_c)::classtype{1};
-constexpr auto                        standard_acceleration_of_gravity =                  0.0_n * decltype(physicalConstant::standard_acceleration_of_gravity)::classtype{1};
-constexpr auto                                     standard_atmosphere =                  0.0_n * decltype(physicalConstant::standard_atmosphere)::classtype{1};
-constexpr auto                                 standard_state_pressure =                  0.0_n * decltype(physicalConstant::standard_state_pressure)::classtype{1};
-constexpr auto                               Stefan_Boltzmann_constant =          0.000013e-8_n * decltype(physicalConstant::Stefan_Boltzmann_constant)::classtype{1};
-constexpr auto                                  tau_Compton_wavelength =         0.000063e-15_n * decltype(physicalConstant::tau_Compton_wavelength)::classtype{1};
-constexpr auto                        tau_Compton_wavelength_over_2_pi =         0.000010e-15_n * decltype(physicalConstant::tau_Compton_wavelength_over_2_pi)::classtype{1};
-constexpr auto                                 tau_electron_mass_ratio =                 0.31_n;
-constexpr auto                                                tau_mass =          0.00029e-27_n * decltype(physicalConstant::tau_mass)::classtype{1};
-constexpr auto                              tau_mass_energy_equivalent =          0.00026e-10_n * decltype(physicalConstant::tau_mass_energy_equivalent)::classtype{1};
-constexpr auto                       tau_mass_energy_equivalent_in_MeV =                 0.16_n * decltype(physicalConstant::tau_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                          tau_molar_mass =           0.00017e-3_n * decltype(physicalConstant::tau_molar_mass)::classtype{1};
-constexpr auto                                     tau_muon_mass_ratio =               0.0015_n;
-constexpr auto                                  tau_neutron_mass_ratio =              0.00017_n;
-constexpr auto                                   tau_proton_mass_ratio =              0.00017_n;
-constexpr auto                                   Thomson_cross_section =    0.00000000091e-28_n * decltype(physicalConstant::Thomson_cross_section)::classtype{1};
-constexpr auto                              triton_electron_mass_ratio =           0.00000026_n;
-constexpr auto                                         triton_g_factor =          0.000000028_n;
-constexpr auto                                          triton_mag_mom =      0.000000012e-26_n * decltype(physicalConstant::triton_mag_mom)::classtype{1};
-constexpr auto                   triton_mag_mom_to_Bohr_magneton_ratio =      0.0000000076e-3_n;
-constexpr auto                triton_mag_mom_to_nuclear_magneton_ratio =          0.000000014_n;
-constexpr auto                                             triton_mass =      0.000000062e-27_n * decltype(physicalConstant::triton_mass)::classtype{1};
-constexpr auto                           triton_mass_energy_equivalent =      0.000000055e-10_n * decltype(physicalConstant::triton_mass_energy_equivalent)::classtype{1};
-constexpr auto                    triton_mass_energy_equivalent_in_MeV =             0.000017_n * decltype(physicalConstant::triton_mass_energy_equivalent_in_MeV)::classtype{1};
-constexpr auto                                       triton_molar_mass =     0.00000000011e-3_n * decltype(physicalConstant::triton_molar_mass)::classtype{1};
-constexpr auto                                triton_proton_mass_ratio =        0.00000000022_n;
-constexpr auto                                unified_atomic_mass_unit =      0.000000020e-27_n * decltype(physicalConstant::unified_atomic_mass_unit)::classtype{1};
-constexpr auto                                alpha_particle_mass_in_u =       0.000000000063_n * decltype(physicalConstant::alpha_particle_mass_in_u)::classtype{1};
-constexpr auto                                      deuteron_mass_in_u =       0.000000000040_n * decltype(physicalConstant::deuteron_mass_in_u)::classtype{1};
-constexpr auto                                      electron_mass_in_u =     0.00000000016e-4_n * decltype(physicalConstant::electron_mass_in_u)::classtype{1};
-constexpr auto             electron_volt_atomic_mass_unit_relationship =      0.0000000066e-9_n * decltype(physicalConstant::electron_volt_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                   hartree_atomic_mass_unit_relationship =      0.0000000013e-8_n * decltype(physicalConstant::hartree_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                                        helion_mass_in_u =        0.00000000012_n * decltype(physicalConstant::helion_mass_in_u)::classtype{1};
-constexpr auto                     hertz_atomic_mass_unit_relationship =     0.0000000020e-24_n * decltype(physicalConstant::hertz_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto             inverse_meter_atomic_mass_unit_relationship =    0.00000000061e-15_n * decltype(physicalConstant::inverse_meter_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                     joule_atomic_mass_unit_relationship =        0.000000082e9_n * decltype(physicalConstant::joule_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                    kelvin_atomic_mass_unit_relationship =        0.0000053e-14_n * decltype(physicalConstant::kelvin_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                  kilogram_atomic_mass_unit_relationship =       0.000000074e26_n * decltype(physicalConstant::kilogram_atomic_mass_unit_relationship)::classtype{1};
-constexpr auto                                          muon_mass_in_u =         0.0000000025_n * decltype(physicalConstant::muon_mass_in_u)::classtype{1};
-constexpr auto                                       neutron_mass_in_u =        0.00000000049_n * decltype(physicalConstant::neutron_mass_in_u)::classtype{1};
-constexpr auto                                        proton_mass_in_u =       0.000000000091_n * decltype(physicalConstant::proton_mass_in_u)::classtype{1};
-constexpr auto                                           tau_mass_in_u =              0.00017_n * decltype(physicalConstant::tau_mass_in_u)::classtype{1};
-constexpr auto                                        triton_mass_in_u =        0.00000000011_n * decltype(physicalConstant::triton_mass_in_u)::classtype{1};
-constexpr auto                                   von_Klitzing_constant =            0.0000059_n * decltype(physicalConstant::von_Klitzing_constant)::classtype{1};
-constexpr auto                                       weak_mixing_angle =               0.0021_n;
-constexpr auto                Wien_frequency_displacement_law_constant =         0.0000034e10_n * decltype(physicalConstant::Wien_frequency_displacement_law_constant)::classtype{1};
-constexpr auto               Wien_wavelength_displacement_law_constant =         0.0000017e-3_n * decltype(physicalConstant::Wien_wavelength_displacement_law_constant)::classtype{1};
-
-
-}// namespace uncertaintiy
-
-
-}// namespace physicalConstant
-}// namespace unit
+// all constants, include the headers of single domains to compile less
 
+#include <src/quantity/quantityDefinitionsSI.h>
+#include "physicalConstantsUniversal.h"
+#include "physicalConstantsElectromagnetic.h"
+#include "physicalConstantsAtomic.h"
+#include "physicalConstantsNuclear.h"
+#include "physicalConstantsRelationships.h"
+#include "physicalConstantsUncertainties.h"
@@ -0,0 +1,40 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                          Bohr_magneton{9.274009994e-24}; // 927.4009994e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                              Bohr_magneton_in_Hz_per_T{13996245042.0}; // 13.996245042e9 Hz T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>              Bohr_magneton_in_inverse_meters_per_tesla{46.68644814}; // 46.68644814 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                               Bohr_magneton_in_K_per_T{0.67171405}; // 0.67171405 K T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                     characteristic_impedance_of_vacuum{376.730313461}; // 376.730313461 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                                    conductance_quantum{0.00007748091731}; // 7.7480917310e-5 S
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>               conventional_value_of_Josephson_constant{483597900000000.0}; // 483597.9e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>            conventional_value_of_von_Klitzing_constant{25812.807}; // 25812.807 ohm
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                                      electric_constant{8.854187817e-12}; // 8.854187817e-12 F m^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                              Bohr_magneton_in_eV_per_T{9.274009994146833e-24}; // 5.7883818012e-5 eV T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                      elementary_charge{1.6021766208e-19}; // 1.6021766208e-19 C
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                               elementary_charge_over_h{241798926200000.0}; // 2.417989262e14 A J^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -1, 0>>                                       Faraday_constant{96485.33289}; // 96485.33289 C mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -2, 0>>     Faraday_constant_for_conventional_electric_current{96485.3251}; // 96485.3251 C_90 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         inverse_of_conductance_quantum{12906.4037278}; // 12906.4037278 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                                     Josephson_constant{483597852500000.0}; // 483597.8525e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, -2, 0, 0, 0>>                                           mag_constant{1.2566370614e-6}; // 12.566370614e-7 N A^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                                       mag_flux_quantum{2.067833831e-15}; // 2.067833831e-15 Wb
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       nuclear_magneton{5.050783699e-27}; // 5.050783699e-27 J T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                           nuclear_magneton_in_eV_per_T{5.050783698972619e-27}; // 3.1524512550e-8 eV T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>           nuclear_magneton_in_inverse_meters_per_tesla{0.02542623432}; // 2.542623432e-2 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                            nuclear_magneton_in_K_per_T{0.0003658269}; // 3.6582690e-4 K T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          nuclear_magneton_in_MHz_per_T{7622593.285}; // 7.622593285 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                                  von_Klitzing_constant{25812.8074555}; // 25812.8074555 ohm
+
+
+}// namespace physicalConstant
+}// namespace unit
+
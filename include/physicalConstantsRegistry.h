@@ -0,0 +1,489 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+
+namespace unit {
+namespace physicalConstant{
+namespace registry{
+
+// exponents of meter, kilogram, second, ampere, kelvin, mole and candela, 8 bit each from the lowest byte on
+using packed_exponents = std::uint64_t;
+
+// a constant in coherent si units
+struct entry {
+    char const* name;
+    double magnitude;
+    double uncertainty;
+    packed_exponents exponents;
+
+    int exponent(std::size_t i) const { return static_cast<std::int8_t>((exponents >> (8 * i)) & 0xff); }
+};
+
+}// namespace registry
+}// namespace physicalConstant
+
+namespace helper {
+namespace constantsRegistry {
+
+constexpr std::size_t entryCount = 335;
+constexpr std::size_t seedCount = 84;
+
+// fnv-1a, the generator finds the seeds with the same function
+inline std::uint32_t hash(char const* name, std::size_t length, std::uint32_t seed) {
+    std::uint32_t h = 2166136261u ^ seed;
+    for (std::size_t i = 0; i < length; ++i) {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// sorted by name
+inline physicalConstant::registry::entry const* entries() {
+    static const physicalConstant::registry::entry e[entryCount] = {
+        {"Angstrom_star", 1.00001495e-10, 9e-17, 0x00000000000001},
+        {"Avogadro_constant", 6.022140857e+23, 7400000000000000.0, 0x00ff0000000000},
+        {"Bohr_magneton", 9.274009994e-24, 5.7e-32, 0x00000001000002},
+        {"Bohr_magneton_in_Hz_per_T", 13996245042.0, 86.0, 0x0000000101ff00},
+        {"Bohr_magneton_in_K_per_T", 0.67171405, 3.9e-7, 0x0000010102ff00},
+        {"Bohr_magneton_in_eV_per_T", 9.274009994146833e-24, 4.16565921408e-33, 0x00000001000002},
+        {"Bohr_magneton_in_inverse_meters_per_tesla", 46.68644814, 2.9e-7, 0x0000000102ffff},
+        {"Bohr_radius", 5.2917721067e-11, 1.2e-20, 0x00000000000001},
+        {"Boltzmann_constant", 1.38064852e-23, 7.9e-30, 0x0000ff00fe0102},
+        {"Boltzmann_constant_in_Hz_per_K", 20836612000.0, 12000.0, 0x0000ff00ff0000},
+        {"Boltzmann_constant_in_eV_per_K", 1.380648514037145e-23, 8.010883104e-30, 0x0000ff00fe0102},
+        {"Boltzmann_constant_in_inverse_meters_per_kelvin", 69.503457, 0.00004, 0x0000ff000000ff},
+        {"Compton_wavelength", 2.4263102367e-12, 1.1e-21, 0x00000000000001},
+        {"Compton_wavelength_over_2_pi", 3.8615926764e-13, 1.8e-22, 0x00000000000001},
+        {"Cu_x_unit", 1.00207697e-13, 2.8e-20, 0x00000000000001},
+        {"Faraday_constant", 96485.33289, 0.00059, 0x00ff0001010000},
+        {"Faraday_constant_for_conventional_electric_current", 96485.3251, 0.0012, 0x00fe0001010000},
+        {"Fermi_coupling_constant", 454379573748293.4, 233738617.01090395, 0x0000000004fefc},
+        {"Hartree_energy", 4.35974465e-18, 5.4e-26, 0x00000000fe0102},
+        {"Hartree_energy_in_eV", 4.359744650080796e-18, 2.72370025536e-26, 0x00000000fe0102},
+        {"Josephson_constant", 483597852500000.0, 3000000.0, 0x0000000102fffe},
+        {"Loschmidt_constant_273_15_K_100_kPa", 2.6516467e+25, 15000000000000000000.0, 0x000000000000fd},
+        {"Loschmidt_constant_273_15_K_101_325_kPa", 2.6867811e+25, 15000000000000000000.0, 0x000000000000fd},
+        {"Mo_x_unit", 1.00209952e-13, 5.3e-20, 0x00000000000001},
+        {"Newtonian_constant_of_gravitation", 6.67408e-11, 3.1e-15, 0x00000000feff03},
+        {"Newtonian_constant_of_gravitation_over_h_bar_c", 2111030833546752.5, 97549202949.56679, 0x0000000000fe00},
+        {"Planck_constant", 6.62607004e-34, 8.1e-42, 0x00000000ff0102},
+        {"Planck_constant_in_eV_s", 6.626070039454996e-34, 4.005441552e-42, 0x00000000ff0102},
+        {"Planck_constant_over_2_pi", 1.0545718e-34, 1.3e-42, 0x00000000ff0102},
+        {"Planck_constant_over_2_pi_in_eV_s", 1.054571800064226e-34, 6.4087064832e-43, 0x00000000ff0102},
+        {"Planck_constant_over_2_pi_times_c_in_MeV_fm", 3.1615267208645725e-26, 1.92261194496e-34, 0x00000000fe0103},
+        {"Planck_length", 1.616229e-35, 3.8e-40, 0x00000000000001},
+        {"Planck_mass", 2.17647e-8, 5.1e-13, 0x00000000000100},
+        {"Planck_mass_energy_equivalent_in_GeV", 1956113458.100928, 46463.1220032, 0x00000000fe0102},
+        {"Planck_temperature", 1.416808e+32, 3.3e+27, 0x00000100000000},
+        {"Planck_time", 5.39116e-44, 1.3e-48, 0x00000000010000},
+        {"Rydberg_constant", 10973731.568508, 0.000065, 0x000000000000ff},
+        {"Rydberg_constant_times_c_in_Hz", 3289841960355000.0, 19000.0, 0x00000000ff0000},
+        {"Rydberg_constant_times_hc_in_J", 2.179872325e-18, 2.7e-26, 0x00000000fe0102},
+        {"Rydberg_constant_times_hc_in_eV", 2.1798723248801804e-18, 1.345828361472e-26, 0x00000000fe0102},
+        {"Sackur_Tetrode_constant_1_K_100_kPa", -1.1517084, 1.4e-6, 0x00000000000000},
+        {"Sackur_Tetrode_constant_1_K_101_325_kPa", -1.1648714, 1.4e-6, 0x00000000000000},
+        {"Stefan_Boltzmann_constant", 5.670367e-8, 1.3e-13, 0x0000fc00fd0100},
+        {"Thomson_cross_section", 6.6524587158e-29, 9.1e-38, 0x00000000000002},
+        {"Wien_frequency_displacement_law_constant", 58789238000.0, 34000.0, 0x0000ff00ff0000},
+        {"Wien_wavelength_displacement_law_constant", 0.0028977729, 1.7e-9, 0x00000100000001},
+        {"alpha_particle_electron_mass_ratio", 7294.29954136, 2.4e-7, 0x00000000000000},
+        {"alpha_particle_mass", 6.64465723e-27, 8.2e-35, 0x00000000000100},
+        {"alpha_particle_mass_energy_equivalent", 5.971920097e-10, 7.3e-18, 0x00000000fe0102},
+        {"alpha_particle_mass_energy_equivalent_in_MeV", 5.971920096283645e-10, 3.68500622784e-18, 0x00000000fe0102},
+        {"alpha_particle_mass_in_u", 6.644657229241617e-27, 1.0461395952e-37, 0x00000000000100},
+        {"alpha_particle_molar_mass", 0.004001506179127, 6.3e-14, 0x00ff0000000100},
+        {"alpha_particle_proton_mass_ratio", 3.97259968907, 3.6e-10, 0x00000000000000},
+        {"atomic_mass_constant", 1.66053904e-27, 2e-35, 0x00000000000100},
+        {"atomic_mass_constant_energy_equivalent", 1.492418062e-10, 1.8e-18, 0x00000000fe0102},
+        {"atomic_mass_constant_energy_equivalent_in_MeV", 1.4924180620631248e-10, 9.13240673856e-19, 0x00000000fe0102},
+        {"atomic_mass_unit_electron_volt_relationship", 1.4924180620631248e-10, 9.13240673856e-19, 0x00000000fe0102},
+        {"atomic_mass_unit_hartree_relationship", 1.4924180621125388e-10, 6.975591440129274e-20, 0x00000000fe0102},
+        {"atomic_mass_unit_hertz_relationship", 2.2523427206e+23, 100000000000000.0, 0x00000000ff0000},
+        {"atomic_mass_unit_inverse_meter_relationship", 751300661660000.0, 340000.0, 0x000000000000ff},
+        {"atomic_mass_unit_joule_relationship", 1.492418062e-10, 1.8e-18, 0x00000000fe0102},
+        {"atomic_mass_unit_kelvin_relationship", 10809543800000.0, 6200000.0, 0x00000100000000},
+        {"atomic_mass_unit_kilogram_relationship", 1.66053904e-27, 2e-35, 0x00000000000100},
+        {"atomic_unit_of_1st_hyperpolarizability", 3.206361329e-53, 2e-61, 0x0000000307feff},
+        {"atomic_unit_of_2nd_hyperpolarizability", 6.235380085e-65, 7.7e-73, 0x000000040afdfe},
+        {"atomic_unit_of_action", 1.0545718e-34, 1.3e-42, 0x00000000ff0102},
+        {"atomic_unit_of_charge", 1.6021766208e-19, 9.8e-28, 0x00000001010000},
+        {"atomic_unit_of_charge_density", 1081202377000.0, 6700.0, 0x000000010100fd},
+        {"atomic_unit_of_current", 0.006623618183, 4.1e-11, 0x00000001000000},
+        {"atomic_unit_of_electric_dipole_mom", 8.478353552e-30, 5.2e-38, 0x00000001010001},
+        {"atomic_unit_of_electric_field", 514220670700.0, 3200.0, 0x000000fffd0101},
+        {"atomic_unit_of_electric_field_gradient", 9.717362356e+21, 60000000000000.0, 0x000000fffd0100},
+        {"atomic_unit_of_electric_polarizability", 1.6487772731e-41, 1.1e-50, 0x0000000204ff00},
+        {"atomic_unit_of_electric_potential", 27.21138602, 1.7e-7, 0x000000fffd0102},
+        {"atomic_unit_of_electric_quadrupole_mom", 4.486551484e-40, 2.8e-48, 0x00000001010002},
+        {"atomic_unit_of_energy", 4.35974465e-18, 5.4e-26, 0x00000000fe0102},
+        {"atomic_unit_of_force", 8.23872336e-8, 1e-15, 0x00000000fe0101},
+        {"atomic_unit_of_length", 5.2917721067e-11, 1.2e-20, 0x00000000000001},
+        {"atomic_unit_of_mag_dipole_mom", 1.854801999e-23, 1.1e-31, 0x00000001000002},
+        {"atomic_unit_of_mag_flux_density", 235051.755, 0.0014, 0x000000fffe0100},
+        {"atomic_unit_of_magnetizability", 7.8910365886e-29, 9e-38, 0x0000000202ff02},
+        {"atomic_unit_of_mass", 9.10938356e-31, 1.1e-38, 0x00000000000100},
+        {"atomic_unit_of_mom_um", 1.992851882e-24, 2.4e-32, 0x00000000ff0101},
+        {"atomic_unit_of_permittivity", 1.112650056e-10, 0.0, 0x0000000204fffd},
+        {"atomic_unit_of_time", 2.418884326509e-17, 1.4e-28, 0x00000000010000},
+        {"atomic_unit_of_velocity", 2187691.26277, 0.0005, 0x00000000ff0001},
+        {"c_220_lattice_spacing_of_silicon", 1.920155714e-10, 3.2e-18, 0x00000000000001},
+        {"characteristic_impedance_of_vacuum", 376.730313461, 0.0, 0x000000fefd0102},
+        {"classical_electron_radius", 2.8179403227e-15, 1.9e-24, 0x00000000000001},
+        {"conductance_quantum", 0.00007748091731, 1.8e-14, 0x0000000203fffe},
+        {"conventional_value_of_Josephson_constant", 483597900000000.0, 0.0, 0x0000000102fffe},
+        {"conventional_value_of_von_Klitzing_constant", 25812.807, 0.0, 0x000000fefd0102},
+        {"deuteron_electron_mag_mom_ratio", -0.0004664345535, 2.6e-12, 0x00000000000000},
+        {"deuteron_electron_mass_ratio", 3670.48296785, 1.3e-7, 0x00000000000000},
+        {"deuteron_g_factor", 0.8574382311, 4.8e-9, 0x00000000000000},
+        {"deuteron_mag_mom", 4.33073504e-27, 3.6e-35, 0x00000001000002},
+        {"deuteron_mag_mom_to_Bohr_magneton_ratio", 0.0004669754554, 2.6e-12, 0x00000000000000},
+        {"deuteron_mag_mom_to_nuclear_magneton_ratio", 0.8574382311, 4.8e-9, 0x00000000000000},
+        {"deuteron_mass", 3.343583719e-27, 4.1e-35, 0x00000000000100},
+        {"deuteron_mass_energy_equivalent", 3.005063183e-10, 3.7e-18, 0x00000000fe0102},
+        {"deuteron_mass_energy_equivalent_in_MeV", 3.005063182911834e-10, 1.92261194496e-18, 0x00000000fe0102},
+        {"deuteron_mass_in_u", 3.3435837188804984e-27, 6.64215616e-38, 0x00000000000100},
+        {"deuteron_molar_mass", 0.002013553212745, 4e-14, 0x00ff0000000100},
+        {"deuteron_neutron_mag_mom_ratio", -0.44820652, 1.1e-7, 0x00000000000000},
+        {"deuteron_proton_mag_mom_ratio", 0.3070122077, 1.5e-9, 0x00000000000000},
+        {"deuteron_proton_mass_ratio", 1.99900750087, 1.9e-10, 0x00000000000000},
+        {"deuteron_rms_charge_radius", 2.1413e-15, 2.5e-18, 0x00000000000001},
+        {"electric_constant", 8.854187817e-12, 0.0, 0x0000000204fffd},
+        {"electron_charge_to_mass_quotient", -175882002400.0, 1100.0, 0x0000000101ff00},
+        {"electron_deuteron_mag_mom_ratio", -2143.923499, 0.000012, 0x00000000000000},
+        {"electron_deuteron_mass_ratio", 0.0002724437107484, 9.6e-15, 0x00000000000000},
+        {"electron_g_factor", -2.00231930436182, 5.2e-13, 0x00000000000000},
+        {"electron_gyromag_ratio", 176085964400.0, 1100.0, 0x0000000101ff00},
+        {"electron_gyromag_ratio_over_2_pi", 28024951640.0, 170.0, 0x0000000101ff00},
+        {"electron_helion_mass_ratio", 0.0001819543074854, 8.8e-15, 0x00000000000000},
+        {"electron_mag_mom", -9.28476462e-24, 5.7e-32, 0x00000001000002},
+        {"electron_mag_mom_anomaly", 0.00115965218091, 2.6e-13, 0x00000000000000},
+        {"electron_mag_mom_to_Bohr_magneton_ratio", -1.00115965218091, 2.6e-13, 0x00000000000000},
+        {"electron_mag_mom_to_nuclear_magneton_ratio", -1838.28197234, 1.7e-7, 0x00000000000000},
+        {"electron_mass", 9.10938356e-31, 1.1e-38, 0x00000000000100},
+        {"electron_mass_energy_equivalent", 8.18710565e-14, 1e-21, 0x00000000fe0102},
+        {"electron_mass_energy_equivalent_in_MeV", 8.187105646948593e-14, 4.96674752448e-22, 0x00000000fe0102},
+        {"electron_mass_in_u", 9.109383555703852e-31, 2.656862464e-41, 0x00000000000100},
+        {"electron_molar_mass", 5.4857990907e-7, 1.6e-17, 0x00ff0000000100},
+        {"electron_muon_mag_mom_ratio", 206.766988, 4.6e-6, 0x00000000000000},
+        {"electron_muon_mass_ratio", 0.0048363317, 1.1e-10, 0x00000000000000},
+        {"electron_neutron_mag_mom_ratio", 960.9205, 0.00023, 0x00000000000000},
+        {"electron_neutron_mass_ratio", 0.00054386734428, 2.7e-13, 0x00000000000000},
+        {"electron_proton_mag_mom_ratio", -658.2106866, 2e-6, 0x00000000000000},
+        {"electron_proton_mass_ratio", 0.000544617021352, 5.2e-14, 0x00000000000000},
+        {"electron_tau_mass_ratio", 0.000287592, 2.6e-8, 0x00000000000000},
+        {"electron_to_alpha_particle_mass_ratio", 0.0001370933554798, 4.5e-15, 0x00000000000000},
+        {"electron_to_shielded_helion_mag_mom_ratio", 864.058257, 0.00001, 0x00000000000000},
+        {"electron_to_shielded_proton_mag_mom_ratio", -658.2275971, 7.2e-6, 0x00000000000000},
+        {"electron_triton_mass_ratio", 0.0001819200062203, 8.4e-15, 0x00000000000000},
+        {"electron_volt", 1.6021766208e-19, 9.8e-28, 0x00000000fe0102},
+        {"electron_volt_atomic_mass_unit_relationship", 1.782661906647324e-36, 1.0959557664e-44, 0x00000000000100},
+        {"electron_volt_hartree_relationship", 1.6021766207627394e-19, 1.0027412695185831e-27, 0x00000000fe0102},
+        {"electron_volt_hertz_relationship", 241798926200000.0, 1500000.0, 0x00000000ff0000},
+        {"electron_volt_inverse_meter_relationship", 806554.4005, 0.005, 0x000000000000ff},
+        {"electron_volt_joule_relationship", 1.6021766208e-19, 9.8e-28, 0x00000000fe0102},
+        {"electron_volt_kelvin_relationship", 11604.5221, 0.0067, 0x00000100000000},
+        {"electron_volt_kilogram_relationship", 1.782661907e-36, 1.1e-44, 0x00000000000100},
+        {"elementary_charge", 1.6021766208e-19, 9.8e-28, 0x00000001010000},
+        {"elementary_charge_over_h", 241798926200000.0, 1500000.0, 0x0000000102fffe},
+        {"fine_structure_constant", 0.0072973525664, 1.7e-12, 0x00000000000000},
+        {"first_radiation_constant", 3.74177179e-16, 4.6e-24, 0x00000000fd0104},
+        {"first_radiation_constant_for_spectral_radiance", 1.191042953e-16, 1.5e-24, 0x00000000fd0104},
+        {"hartree_atomic_mass_unit_relationship", 4.850870127942811e-35, 2.158700752e-44, 0x00000000000100},
+        {"hartree_electron_volt_relationship", 4.359744650080796e-18, 2.72370025536e-26, 0x00000000fe0102},
+        {"hartree_hertz_relationship", 6579683920711000.0, 39000.0, 0x00000000ff0000},
+        {"hartree_inverse_meter_relationship", 21947463.13702, 0.00013, 0x000000000000ff},
+        {"hartree_joule_relationship", 4.35974465e-18, 5.4e-26, 0x00000000fe0102},
+        {"hartree_kelvin_relationship", 315775.13, 0.18, 0x00000100000000},
+        {"hartree_kilogram_relationship", 4.850870129e-35, 6e-43, 0x00000000000100},
+        {"helion_electron_mass_ratio", 5495.88527922, 2.7e-7, 0x00000000000000},
+        {"helion_g_factor", -4.255250616, 5e-8, 0x00000000000000},
+        {"helion_mag_mom", -1.074617522e-26, 1.4e-34, 0x00000001000002},
+        {"helion_mag_mom_to_Bohr_magneton_ratio", -0.001158740958, 1.4e-11, 0x00000000000000},
+        {"helion_mag_mom_to_nuclear_magneton_ratio", -2.127625308, 2.5e-8, 0x00000000000000},
+        {"helion_mass", 5.0064127e-27, 6.2e-35, 0x00000000000100},
+        {"helion_mass_energy_equivalent", 4.499539341e-10, 5.5e-18, 0x00000000fe0102},
+        {"helion_mass_energy_equivalent_in_MeV", 4.4995393411406323e-10, 2.72370025536e-18, 0x00000000fe0102},
+        {"helion_mass_in_u", 5.0064126986500775e-27, 1.992646848e-37, 0x00000000000100},
+        {"helion_molar_mass", 0.00301493224673, 1.2e-13, 0x00ff0000000100},
+        {"helion_proton_mass_ratio", 2.99315267046, 2.9e-10, 0x00000000000000},
+        {"hertz_atomic_mass_unit_relationship", 7.372497199724469e-51, 3.32107808e-60, 0x00000000000100},
+        {"hertz_electron_volt_relationship", 6.626070039454996e-34, 4.005441552e-42, 0x00000000fe0102},
+        {"hertz_hartree_relationship", 6.626070040169986e-34, 3.923770185072716e-45, 0x00000000fe0102},
+        {"hertz_inverse_meter_relationship", 3.335640951e-9, 0.0, 0x000000000000ff},
+        {"hertz_joule_relationship", 6.62607004e-34, 8.1e-42, 0x00000000fe0102},
+        {"hertz_kelvin_relationship", 4.7992447e-11, 2.8e-17, 0x00000100000000},
+        {"hertz_kilogram_relationship", 7.372497201e-51, 9.1e-59, 0x00000000000100},
+        {"inverse_fine_structure_constant", 137.035999139, 3.1e-8, 0x00000000000000},
+        {"inverse_meter_atomic_mass_unit_relationship", 2.210219057082413e-42, 1.0129288144e-51, 0x00000000000100},
+        {"inverse_meter_electron_volt_relationship", 1.9864458240691038e-25, 1.217654231808e-33, 0x00000000fe0102},
+        {"inverse_meter_hartree_relationship", 1.986445824222546e-25, 1.177131055521815e-36, 0x00000000fe0102},
+        {"inverse_meter_hertz_relationship", 299792458.0, 0.0, 0x00000000ff0000},
+        {"inverse_meter_joule_relationship", 1.986445824e-25, 2.4e-33, 0x00000000fe0102},
+        {"inverse_meter_kelvin_relationship", 0.0143877736, 8.3e-9, 0x00000100000000},
+        {"inverse_meter_kilogram_relationship", 2.210219057e-42, 2.7e-50, 0x00000000000100},
+        {"inverse_of_conductance_quantum", 12906.4037278, 2.9e-6, 0x000000fefd0102},
+        {"joule_atomic_mass_unit_relationship", 1.1126500559162071e-17, 1.3616420128e-25, 0x00000000000100},
+        {"joule_electron_volt_relationship", 1.0000000000187041, 6.08827115904e-9, 0x00000000fe0102},
+        {"joule_hartree_relationship", 1.0000000002865177, 1.220728502022623e-8, 0x00000000fe0102},
+        {"joule_hertz_relationship", 1.509190205e+33, 1.9e+25, 0x00000000ff0000},
+        {"joule_inverse_meter_relationship", 5.034116651e+24, 62000000000000000.0, 0x000000000000ff},
+        {"joule_kelvin_relationship", 7.2429731e+22, 42000000000000000.0, 0x00000100000000},
+        {"joule_kilogram_relationship", 1.112650056e-17, 0.0, 0x00000000000100},
+        {"kelvin_atomic_mass_unit_relationship", 1.5361786476427168e-40, 8.800856912e-47, 0x00000000000100},
+        {"kelvin_electron_volt_relationship", 1.380648514037145e-23, 8.010883104e-30, 0x00000000fe0102},
+        {"kelvin_hartree_relationship", 1.3806485135194692e-23, 7.847540370145433e-30, 0x00000000fe0102},
+        {"kelvin_hertz_relationship", 20836612000.0, 12000.0, 0x00000000ff0000},
+        {"kelvin_inverse_meter_relationship", 69.503457, 0.00004, 0x000000000000ff},
+        {"kelvin_joule_relationship", 1.38064852e-23, 7.9e-30, 0x00000000fe0102},
+        {"kelvin_kilogram_relationship", 1.53617865e-40, 8.8e-47, 0x00000000000100},
+        {"kilogram_atomic_mass_unit_relationship", 0.9999999997427558, 1.2287988896e-8, 0x00000000000100},
+        {"kilogram_electron_volt_relationship", 89875517873350340.0, 544740051.072, 0x00000000fe0102},
+        {"kilogram_hartree_relationship", 89875517880416580.0, 1089936162.520199, 0x00000000fe0102},
+        {"kilogram_hertz_relationship", 1.356392512e+50, 1.7e+42, 0x00000000ff0000},
+        {"kilogram_inverse_meter_relationship", 4.524438411e+41, 5.6e+33, 0x000000000000ff},
+        {"kilogram_joule_relationship", 89875517870000000.0, 0.0, 0x00000000fe0102},
+        {"kilogram_kelvin_relationship", 6.5096595e+39, 3.7e+33, 0x00000100000000},
+        {"lattice_parameter_of_silicon", 5.431020504e-10, 8.9e-18, 0x00000000000001},
+        {"mag_constant", 1.2566370614e-6, 0.0, 0x000000fefe0101},
+        {"mag_flux_quantum", 2.067833831e-15, 1.3e-23, 0x000000fffe0102},
+        {"molar_Planck_constant", 3.990312711e-10, 1.8e-19, 0x00ff0000ff0102},
+        {"molar_Planck_constant_times_c", 0.119626565582, 5.4e-11, 0x00ff0000fe0103},
+        {"molar_gas_constant", 8.3144598, 4.8e-6, 0x00ffff00fe0102},
+        {"molar_mass_constant", 0.001, 0.0, 0x00ff0000000100},
+        {"molar_mass_of_carbon_12", 0.012, 0.0, 0x00ff0000000100},
+        {"molar_volume_of_ideal_gas_273_15_K_100_kPa", 0.022710947, 1.3e-8, 0x00ff0000000003},
+        {"molar_volume_of_ideal_gas_273_15_K_101_325_kPa", 0.022413962, 1.3e-8, 0x00ff0000000003},
+        {"molar_volume_of_silicon", 0.00001205883214, 6.1e-13, 0x00ff0000000003},
+        {"muon_Compton_wavelength", 1.173444111e-14, 2.6e-22, 0x00000000000001},
+        {"muon_Compton_wavelength_over_2_pi", 1.867594308e-15, 4.2e-23, 0x00000000000001},
+        {"muon_electron_mass_ratio", 206.7682826, 4.6e-6, 0x00000000000000},
+        {"muon_g_factor", -2.0023318418, 1.3e-9, 0x00000000000000},
+        {"muon_mag_mom", -4.49044826e-26, 1e-33, 0x00000001000002},
+        {"muon_mag_mom_anomaly", 0.00116592089, 6.3e-10, 0x00000000000000},
+        {"muon_mag_mom_to_Bohr_magneton_ratio", -0.00484197048, 1.1e-10, 0x00000000000000},
+        {"muon_mag_mom_to_nuclear_magneton_ratio", -8.89059705, 2e-7, 0x00000000000000},
+        {"muon_mass", 1.883531594e-28, 4.8e-36, 0x00000000000100},
+        {"muon_mass_energy_equivalent", 1.692833774e-11, 4.3e-19, 0x00000000fe0102},
+        {"muon_mass_energy_equivalent_in_MeV", 1.692833774156309e-11, 3.84522388992e-19, 0x00000000fe0102},
+        {"muon_mass_in_u", 1.8835315939010934e-28, 4.1513476e-36, 0x00000000000100},
+        {"muon_molar_mass", 0.0001134289257, 2.5e-12, 0x00ff0000000100},
+        {"muon_neutron_mass_ratio", 0.1124545167, 2.5e-9, 0x00000000000000},
+        {"muon_proton_mag_mom_ratio", -3.183345142, 7.1e-8, 0x00000000000000},
+        {"muon_proton_mass_ratio", 0.1126095262, 2.5e-9, 0x00000000000000},
+        {"muon_tau_mass_ratio", 0.0594649, 5.4e-6, 0x00000000000000},
+        {"natural_unit_of_action", 1.0545718e-34, 1.3e-42, 0x00000000ff0102},
+        {"natural_unit_of_action_in_eV_s", 1.054571800064226e-34, 6.4087064832e-43, 0x00000000ff0102},
+        {"natural_unit_of_energy", 8.18710565e-14, 1e-21, 0x00000000fe0102},
+        {"natural_unit_of_energy_in_MeV", 8.187105646948593e-14, 4.96674752448e-22, 0x00000000fe0102},
+        {"natural_unit_of_length", 3.8615926764e-13, 1.8e-22, 0x00000000000001},
+        {"natural_unit_of_mass", 9.10938356e-31, 1.1e-38, 0x00000000000100},
+        {"natural_unit_of_mom_um", 2.730924488e-22, 3.4e-30, 0x00000000ff0101},
+        {"natural_unit_of_mom_um_in_MeV_per_c", 2.7309244874160887e-22, 1.6567286440808328e-30, 0x00000000ff0101},
+        {"natural_unit_of_time", 1.28808866712e-21, 5.8e-31, 0x00000000010000},
+        {"natural_unit_of_velocity", 299792458.0, 0.0, 0x00000000ff0001},
+        {"neutron_Compton_wavelength", 1.31959090481e-15, 8.8e-25, 0x00000000000001},
+        {"neutron_Compton_wavelength_over_2_pi", 2.1001941536e-16, 1.4e-25, 0x00000000000001},
+        {"neutron_electron_mag_mom_ratio", 0.00104066882, 2.5e-10, 0x00000000000000},
+        {"neutron_electron_mass_ratio", 1838.68366158, 9e-7, 0x00000000000000},
+        {"neutron_g_factor", -3.82608545, 9e-7, 0x00000000000000},
+        {"neutron_gyromag_ratio", 183247172.0, 43.0, 0x0000000101ff00},
+        {"neutron_gyromag_ratio_over_2_pi", 29164693.3, 6.9, 0x0000000101ff00},
+        {"neutron_mag_mom", -9.662365e-27, 2.3e-33, 0x00000001000002},
+        {"neutron_mag_mom_to_Bohr_magneton_ratio", -0.00104187563, 2.5e-10, 0x00000000000000},
+        {"neutron_mag_mom_to_nuclear_magneton_ratio", -1.91304273, 4.5e-7, 0x00000000000000},
+        {"neutron_mass", 1.674927471e-27, 2.1e-35, 0x00000000000100},
+        {"neutron_mass_energy_equivalent", 1.505349739e-10, 1.9e-18, 0x00000000fe0102},
+        {"neutron_mass_energy_equivalent_in_MeV", 1.5053497389015495e-10, 9.29262440064e-19, 0x00000000fe0102},
+        {"neutron_mass_in_u", 1.674927471097056e-27, 8.136641296e-37, 0x00000000000100},
+        {"neutron_molar_mass", 0.00100866491588, 4.9e-13, 0x00ff0000000100},
+        {"neutron_muon_mass_ratio", 8.89248408, 2e-7, 0x00000000000000},
+        {"neutron_proton_mag_mom_ratio", -0.68497934, 1.6e-7, 0x00000000000000},
+        {"neutron_proton_mass_difference", 2.30557377e-30, 8.5e-37, 0x00000000000000},
+        {"neutron_proton_mass_difference_energy_equivalent", 2.07214637e-13, 7.6e-20, 0x00000000000000},
+        {"neutron_proton_mass_difference_energy_equivalent_in_MeV", 1.29333205, 4.8e-7, 0x00000000000000},
+        {"neutron_proton_mass_difference_in_u", 0.001388449, 5.1e-10, 0x00000000000000},
+        {"neutron_proton_mass_ratio", 1.00137841898, 5.1e-10, 0x00000000000000},
+        {"neutron_tau_mass_ratio", 0.52879, 0.000048, 0x00000000000000},
+        {"neutron_to_shielded_proton_mag_mom_ratio", -0.68499694, 1.6e-7, 0x00000000000000},
+        {"nuclear_magneton", 5.050783699e-27, 3.1e-35, 0x00000001000002},
+        {"nuclear_magneton_in_K_per_T", 0.0003658269, 2.1e-10, 0x0000010102ff00},
+        {"nuclear_magneton_in_MHz_per_T", 7622593.285, 0.047, 0x0000000101ff00},
+        {"nuclear_magneton_in_eV_per_T", 5.050783698972619e-27, 2.4032649312e-36, 0x00000001000002},
+        {"nuclear_magneton_in_inverse_meters_per_tesla", 0.02542623432, 1.6e-10, 0x0000000102ffff},
+        {"proton_Compton_wavelength", 1.32140985396e-15, 6.1e-25, 0x00000000000001},
+        {"proton_Compton_wavelength_over_2_pi", 2.10308910109e-16, 9.7e-26, 0x00000000000001},
+        {"proton_charge_to_mass_quotient", 95788332.26, 0.59, 0x0000000101ff00},
+        {"proton_electron_mass_ratio", 1836.15267389, 1.7e-7, 0x00000000000000},
+        {"proton_g_factor", 5.585694702, 1.7e-8, 0x00000000000000},
+        {"proton_gyromag_ratio", 267522190.0, 1.8, 0x0000000101ff00},
+        {"proton_gyromag_ratio_over_2_pi", 42577478.92, 0.29, 0x0000000101ff00},
+        {"proton_mag_mom", 1.4106067873e-26, 9.7e-35, 0x00000001000002},
+        {"proton_mag_mom_to_Bohr_magneton_ratio", 0.0015210322053, 4.6e-12, 0x00000000000000},
+        {"proton_mag_mom_to_nuclear_magneton_ratio", 2.7928473508, 8.5e-9, 0x00000000000000},
+        {"proton_mag_shielding_correction", 0.000025691, 1.1e-8, 0x00000000000000},
+        {"proton_mass", 1.672621898e-27, 2.1e-35, 0x00000000000100},
+        {"proton_mass_energy_equivalent", 1.503277593e-10, 1.8e-18, 0x00000000fe0102},
+        {"proton_mass_energy_equivalent_in_MeV", 1.503277592608217e-10, 9.29262440064e-19, 0x00000000fe0102},
+        {"proton_mass_in_u", 1.6726218973258465e-27, 1.5110905264e-37, 0x00000000000100},
+        {"proton_molar_mass", 0.001007276466879, 9.1e-14, 0x00ff0000000100},
+        {"proton_muon_mass_ratio", 8.88024338, 2e-7, 0x00000000000000},
+        {"proton_neutron_mag_mom_ratio", -1.45989805, 3.4e-7, 0x00000000000000},
+        {"proton_neutron_mass_ratio", 0.99862347844, 5.1e-10, 0x00000000000000},
+        {"proton_rms_charge_radius", 8.751e-16, 6.1e-18, 0x00000000000001},
+        {"proton_tau_mass_ratio", 0.528063, 0.000048, 0x00000000000000},
+        {"quantum_of_circulation", 0.00036369475486, 1.7e-13, 0x00000000ff0002},
+        {"quantum_of_circulation_times_2", 0.00072738950972, 3.3e-13, 0x00000000ff0002},
+        {"second_radiation_constant", 0.0143877736, 8.3e-9, 0x00000100000001},
+        {"shielded_helion_gyromag_ratio", 203789458.5, 2.7, 0x0000000101ff00},
+        {"shielded_helion_gyromag_ratio_over_2_pi", 32434099.66, 0.43, 0x0000000101ff00},
+        {"shielded_helion_mag_mom", -1.07455308e-26, 1.4e-34, 0x00000001000002},
+        {"shielded_helion_mag_mom_to_Bohr_magneton_ratio", -0.001158671471, 1.4e-11, 0x00000000000000},
+        {"shielded_helion_mag_mom_to_nuclear_magneton_ratio", -2.12749772, 2.5e-8, 0x00000000000000},
+        {"shielded_helion_to_proton_mag_mom_ratio", -0.7617665603, 9.2e-9, 0x00000000000000},
+        {"shielded_helion_to_shielded_proton_mag_mom_ratio", -0.7617861313, 3.3e-9, 0x00000000000000},
+        {"shielded_proton_gyromag_ratio", 267515317.1, 3.3, 0x0000000101ff00},
+        {"shielded_proton_gyromag_ratio_over_2_pi", 42576385.07, 0.53, 0x0000000101ff00},
+        {"shielded_proton_mag_mom", 1.410570547e-26, 1.8e-34, 0x00000001000002},
+        {"shielded_proton_mag_mom_to_Bohr_magneton_ratio", 0.001520993128, 1.7e-11, 0x00000000000000},
+        {"shielded_proton_mag_mom_to_nuclear_magneton_ratio", 2.7927756, 3e-8, 0x00000000000000},
+        {"speed_of_light_in_vacuum", 299792458.0, 0.0, 0x00000000ff0001},
+        {"standard_acceleration_of_gravity", 9.80665, 0.0, 0x00000000fe0001},
+        {"standard_atmosphere", 101325.0, 0.0, 0x00000000fe01ff},
+        {"standard_state_pressure", 100000.0, 0.0, 0x00000000fe01ff},
+        {"tau_Compton_wavelength", 6.97787e-16, 6.3e-20, 0x00000000000001},
+        {"tau_Compton_wavelength_over_2_pi", 1.11056e-16, 1e-20, 0x00000000000001},
+        {"tau_electron_mass_ratio", 3477.15, 0.31, 0x00000000000000},
+        {"tau_mass", 3.16747e-27, 2.9e-31, 0x00000000000100},
+        {"tau_mass_energy_equivalent", 2.84678e-10, 2.6e-14, 0x00000000fe0102},
+        {"tau_mass_energy_equivalent_in_MeV", 2.846779463369856e-10, 2.56348259328e-14, 0x00000000fe0102},
+        {"tau_mass_in_u", 3.1674616134096e-27, 2.822916368e-31, 0x00000000000100},
+        {"tau_molar_mass", 0.00190749, 1.7e-7, 0x00ff0000000100},
+        {"tau_muon_mass_ratio", 16.8167, 0.0015, 0x00000000000000},
+        {"tau_neutron_mass_ratio", 1.89111, 0.00017, 0x00000000000000},
+        {"tau_proton_mass_ratio", 1.89372, 0.00017, 0x00000000000000},
+        {"triton_electron_mass_ratio", 5496.92153588, 2.6e-7, 0x00000000000000},
+        {"triton_g_factor", 5.95792492, 2.8e-8, 0x00000000000000},
+        {"triton_mag_mom", 1.504609503e-26, 1.2e-34, 0x00000001000002},
+        {"triton_mag_mom_to_Bohr_magneton_ratio", 0.0016223936616, 7.6e-12, 0x00000000000000},
+        {"triton_mag_mom_to_nuclear_magneton_ratio", 2.97896246, 1.4e-8, 0x00000000000000},
+        {"triton_mass", 5.0073566649999996e-27, 6.2e-35, 0x00000000000100},
+        {"triton_mass_energy_equivalent", 4.500387735e-10, 5.5e-18, 0x00000000fe0102},
+        {"triton_mass_energy_equivalent_in_MeV", 4.500387735317938e-10, 2.72370025536e-18, 0x00000000fe0102},
+        {"triton_mass_in_u", 5.0073566645973254e-27, 1.826592944e-37, 0x00000000000100},
+        {"triton_molar_mass", 0.00301550071632, 1.1e-13, 0x00ff0000000100},
+        {"triton_proton_mass_ratio", 2.99371703348, 2.2e-10, 0x00000000000000},
+        {"unified_atomic_mass_unit", 1.66053904e-27, 2e-35, 0x00000000000100},
+        {"von_Klitzing_constant", 25812.8074555, 5.9e-6, 0x000000fefd0102},
+        {"weak_mixing_angle", 0.2223, 0.0021, 0x00000000000000},
+    };
+    return e;
+}
+
+inline std::uint32_t const* seeds() {
+    static const std::uint32_t d[seedCount] = {
+        6, 1, 139, 18, 23, 762, 9, 5, 211, 6, 580, 934,
+        10, 51, 24, 4, 24, 17, 35, 72, 3, 1, 108, 6,
+        8, 2, 24, 27, 280, 1, 1, 51, 289, 1, 3, 39,
+        16, 65, 2, 1, 385, 1, 267, 8, 501, 37, 75, 3,
+        190, 4, 1, 3796, 1, 260, 61, 2, 389, 197, 3, 232,
+        9, 20, 12, 1, 207, 277, 13, 124, 0, 125, 11, 894,
+        1, 60, 967, 721, 64, 1279, 54, 2514, 1823, 17, 3, 92,
+    };
+    return d;
+}
+
+// index into entries() for every hash slot
+inline std::uint16_t const* slots() {
+    static const std::uint16_t d[entryCount] = {
+        12, 306, 124, 206, 191, 202, 184, 166, 16, 56, 334, 28, 330, 204, 163, 242,
+        170, 98, 219, 140, 137, 180, 59, 187, 165, 72, 107, 252, 208, 159, 126, 4,
+        123, 230, 71, 194, 201, 195, 135, 101, 161, 174, 327, 148, 251, 293, 190, 295,
+        74, 117, 22, 193, 136, 296, 240, 270, 189, 213, 108, 278, 255, 138, 62, 169,
+        52, 245, 111, 122, 142, 141, 261, 121, 254, 276, 15, 155, 147, 17, 25, 139,
+        284, 19, 272, 20, 175, 167, 119, 183, 217, 267, 319, 55, 210, 24, 8, 286,
+        307, 173, 322, 67, 118, 274, 21, 87, 3, 89, 85, 216, 106, 105, 211, 14,
+        199, 244, 329, 215, 263, 237, 269, 115, 227, 92, 116, 192, 79, 291, 93, 214,
+        0, 172, 36, 332, 33, 158, 218, 196, 104, 39, 225, 125, 154, 304, 235, 268,
+        185, 44, 243, 100, 120, 90, 248, 84, 249, 315, 102, 47, 265, 77, 69, 26,
+        239, 60, 57, 41, 176, 262, 153, 114, 31, 179, 226, 50, 128, 310, 76, 221,
+        328, 64, 207, 294, 257, 73, 42, 145, 78, 212, 247, 325, 10, 82, 203, 288,
+        197, 233, 314, 326, 130, 220, 229, 168, 299, 320, 259, 143, 313, 81, 292, 43,
+        289, 164, 18, 224, 2, 285, 96, 280, 181, 150, 80, 61, 88, 308, 27, 232,
+        273, 48, 177, 7, 110, 333, 303, 316, 200, 266, 86, 6, 160, 258, 162, 58,
+        186, 32, 132, 75, 279, 182, 246, 260, 205, 188, 65, 34, 63, 13, 112, 228,
+        290, 312, 11, 321, 127, 300, 1, 97, 301, 253, 133, 49, 46, 91, 323, 178,
+        297, 222, 94, 51, 271, 281, 282, 223, 234, 99, 309, 302, 331, 134, 95, 131,
+        298, 103, 149, 113, 146, 287, 45, 151, 250, 70, 144, 231, 129, 9, 5, 54,
+        198, 171, 256, 209, 157, 236, 53, 152, 109, 275, 317, 40, 264, 83, 238, 68,
+        66, 23, 29, 277, 283, 324, 35, 38, 37, 305, 156, 311, 241, 30, 318,
+    };
+    return d;
+}
+
+template <typename U, std::size_t i = 0, bool = (i < U::exponent_count())>
+struct Packed {
+    static_assert(U::exponent_count() <= 7, "the registry knows the seven si base units only");
+    static constexpr physicalConstant::registry::packed_exponents value =
+        (physicalConstant::registry::packed_exponents{static_cast<std::uint8_t>(U::template exponent_value<i>())} << (8 * i)) | Packed<U, i + 1>::value;
+};
+
+template <typename U, std::size_t i>
+struct Packed<U, i, false> {
+    static constexpr physicalConstant::registry::packed_exponents value = 0;
+};
+}
+}
+
+namespace physicalConstant{
+namespace registry{
+
+inline std::size_t size() { return helper::constantsRegistry::entryCount; }
+inline entry const* begin() { return helper::constantsRegistry::entries(); }
+inline entry const* end() { return begin() + size(); }
+
+/**
+ * the constant with the given name or nullptr, in constant time:
+ *
+ *     entry const* c = registry::find("speed_of_light_in_vacuum");
+ */
+inline entry const* find(char const* name, std::size_t length) {
+    namespace r = helper::constantsRegistry;
+    const std::uint32_t seed = r::seeds()[r::hash(name, length, 0) % r::seedCount];
+    entry const& e = r::entries()[r::slots()[r::hash(name, length, seed) % r::entryCount]];
+    return std::strlen(e.name) == length && std::memcmp(e.name, name, length) == 0 ? &e : nullptr;
+}
+
+inline entry const* find(std::string const& name) { return find(name.data(), name.length()); }
+
+template <typename U>
+constexpr packed_exponents pack() {
+    return helper::constantsRegistry::Packed<U>::value;
+}
+
+/**
+ * the constant as quantity, false if it is unknown or has another unit. q is unchanged then.
+ *
+ *     Quantity<Unit<1, 0, -1, 0, 0, 0, 0>> c;
+ *     bool found = registry::get("speed_of_light_in_vacuum", c);
+ */
+template <typename U, typename T>
+bool get(std::string const& name, Quantity<U, T>& q) {
+    entry const* e = find(name);
+    if (e == nullptr || e->exponents != pack<U>()) return false;
+    q = Quantity<U, T>{static_cast<T>(e->magnitude)};
+    return true;
+}
+
+}// namespace registry
+}// namespace physicalConstant
+}// namespace unit
@@ -0,0 +1,72 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    atomic_mass_unit_hertz_relationship{2.2523427206e+23}; // 2.2523427206e23 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>            atomic_mass_unit_inverse_meter_relationship{751300661660000.0}; // 7.5130066166e14 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    atomic_mass_unit_joule_relationship{1.492418062e-10}; // 1.492418062e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                   atomic_mass_unit_kelvin_relationship{10809543800000.0}; // 1.08095438e13 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 atomic_mass_unit_kilogram_relationship{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>            atomic_mass_unit_electron_volt_relationship{1.4924180620631248e-10}; // 931.4940954e6 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       electron_volt_hertz_relationship{241798926200000.0}; // 2.417989262e14 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>               electron_volt_inverse_meter_relationship{806554.4005}; // 8.065544005e5 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       electron_volt_joule_relationship{1.6021766208e-19}; // 1.6021766208e-19 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      electron_volt_kelvin_relationship{11604.5221}; // 1.16045221e4 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    electron_volt_kilogram_relationship{1.782661907e-36}; // 1.782661907e-36 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     hartree_electron_volt_relationship{4.359744650080796e-18}; // 27.21138602 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  atomic_mass_unit_hartree_relationship{1.4924180621125388e-10}; // 3.4231776902e7 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     electron_volt_hartree_relationship{1.6021766207627394e-19}; // 3.674932248e-2 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                             hartree_hertz_relationship{6579683920711000.0}; // 6.579683920711e15 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                     hartree_inverse_meter_relationship{21947463.13702}; // 2.194746313702e7 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hartree_joule_relationship{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                            hartree_kelvin_relationship{315775.13}; // 3.1577513e5 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                          hartree_kilogram_relationship{4.850870129e-35}; // 4.850870129e-35 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       hertz_electron_volt_relationship{6.626070039454996e-34}; // 4.135667662e-15 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hertz_hartree_relationship{6.626070040169986e-34}; // 1.5198298460088e-16 E_h
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       hertz_inverse_meter_relationship{3.335640951e-9}; // 3.335640951e-9 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                               hertz_joule_relationship{6.62607004e-34}; // 6.626070040e-34 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              hertz_kelvin_relationship{4.7992447e-11}; // 4.7992447e-11 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            hertz_kilogram_relationship{7.372497201e-51}; // 7.372497201e-51 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>               inverse_meter_electron_volt_relationship{1.9864458240691038e-25}; // 1.2398419739e-6 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     inverse_meter_hartree_relationship{1.986445824222546e-25}; // 4.556335252767e-8 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       inverse_meter_hertz_relationship{299792458.0}; // 299792458.0 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       inverse_meter_joule_relationship{1.986445824e-25}; // 1.986445824e-25 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      inverse_meter_kelvin_relationship{0.0143877736}; // 1.43877736e-2 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    inverse_meter_kilogram_relationship{2.210219057e-42}; // 2.210219057e-42 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       joule_electron_volt_relationship{1.0000000000187041}; // 6.241509126e18 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             joule_hartree_relationship{1.0000000002865177}; // 2.293712317e17 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                               joule_hertz_relationship{1.509190205e+33}; // 1.509190205e33 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       joule_inverse_meter_relationship{5.034116651e+24}; // 5.034116651e24 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              joule_kelvin_relationship{7.2429731e+22}; // 7.2429731e22 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            joule_kilogram_relationship{1.112650056e-17}; // 1.112650056e-17 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      kelvin_electron_volt_relationship{1.380648514037145e-23}; // 8.6173303e-5 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kelvin_hartree_relationship{1.3806485135194692e-23}; // 3.1668105e-6 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                              kelvin_hertz_relationship{20836612000.0}; // 2.0836612e10 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                      kelvin_inverse_meter_relationship{69.503457}; // 69.503457 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                              kelvin_joule_relationship{1.38064852e-23}; // 1.38064852e-23 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                           kelvin_kilogram_relationship{1.53617865e-40}; // 1.53617865e-40 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    kilogram_electron_volt_relationship{89875517873350340.0}; // 5.609588650e35 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          kilogram_hartree_relationship{89875517880416580.0}; // 2.061485823e34 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                            kilogram_hertz_relationship{1.356392512e+50}; // 1.356392512e50 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                    kilogram_inverse_meter_relationship{4.524438411e+41}; // 4.524438411e41 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kilogram_joule_relationship{89875517870000000.0}; // 8.987551787e16 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                           kilogram_kelvin_relationship{6.5096595e+39}; // 6.5096595e39 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            electron_volt_atomic_mass_unit_relationship{1.782661906647324e-36}; // 1.0735441105e-9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                  hartree_atomic_mass_unit_relationship{4.850870127942811e-35}; // 2.9212623197e-8 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    hertz_atomic_mass_unit_relationship{7.372497199724469e-51}; // 4.4398216616e-24 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            inverse_meter_atomic_mass_unit_relationship{2.210219057082413e-42}; // 1.33102504900e-15 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    joule_atomic_mass_unit_relationship{1.1126500559162071e-17}; // 6.700535363e9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                   kelvin_atomic_mass_unit_relationship{1.5361786476427168e-40}; // 9.2510842e-14 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 kilogram_atomic_mass_unit_relationship{0.9999999997427558}; // 6.022140857e26 u
+
+
+}// namespace physicalConstant
+}// namespace unit
+
@@ -0,0 +1,358 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+
+
+namespace uncertaintiy{
+
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       c_220_lattice_spacing_of_silicon{3.2e-18}; // 0.0000032e-12 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                     alpha_particle_electron_mass_ratio{2.4e-7}; // 0.00000024
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    alpha_particle_mass{8.2e-35}; // 0.000000082e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  alpha_particle_mass_energy_equivalent{7.3e-18}; // 0.000000073e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                              alpha_particle_molar_mass{6.3e-14}; // 0.000000000063e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                       alpha_particle_proton_mass_ratio{3.6e-10}; // 0.00000000036
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Angstrom_star{9e-17}; // 0.00000090e-10 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   atomic_mass_constant{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 atomic_mass_constant_energy_equivalent{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    atomic_mass_unit_hertz_relationship{100000000000000.0}; // 0.0000000010e23 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>            atomic_mass_unit_inverse_meter_relationship{340000.0}; // 0.0000000034e14 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    atomic_mass_unit_joule_relationship{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                   atomic_mass_unit_kelvin_relationship{6200000.0}; // 0.00000062e13 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 atomic_mass_unit_kilogram_relationship{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<-1, -2, 7, 3, 0, 0, 0>>                 atomic_unit_of_1st_hyperpolarizability{2e-61}; // 0.000000020e-53 C^3 m^3 J^-2
+UNIT_CONSTANT Quantity<Unit<-2, -3, 10, 4, 0, 0, 0>>                 atomic_unit_of_2nd_hyperpolarizability{7.7e-73}; // 0.000000077e-65 C^4 m^4 J^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_action{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                  atomic_unit_of_charge{9.8e-28}; // 0.0000000098e-19 C
+UNIT_CONSTANT Quantity<Unit<-3, 0, 1, 1, 0, 0, 0>>                          atomic_unit_of_charge_density{6700.0}; // 0.0000000067e12 C m^-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                                 atomic_unit_of_current{4.1e-11}; // 0.000000041e-3 A
+UNIT_CONSTANT Quantity<Unit<1, 0, 1, 1, 0, 0, 0>>                     atomic_unit_of_electric_dipole_mom{5.2e-38}; // 0.000000052e-30 C m
+UNIT_CONSTANT Quantity<Unit<1, 1, -3, -1, 0, 0, 0>>                          atomic_unit_of_electric_field{3200.0}; // 0.000000032e11 V m^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, -1, 0, 0, 0>>                 atomic_unit_of_electric_field_gradient{60000000000000.0}; // 0.000000060e21 V m^-2
+UNIT_CONSTANT Quantity<Unit<0, -1, 4, 2, 0, 0, 0>>                 atomic_unit_of_electric_polarizability{1.1e-50}; // 0.0000000011e-41 C^2 m^2 J^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                      atomic_unit_of_electric_potential{1.7e-7}; // 0.00000017 V
+UNIT_CONSTANT Quantity<Unit<2, 0, 1, 1, 0, 0, 0>>                 atomic_unit_of_electric_quadrupole_mom{2.8e-48}; // 0.000000028e-40 C m^2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                  atomic_unit_of_energy{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                                   atomic_unit_of_force{1e-15}; // 0.00000010e-8 N
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                  atomic_unit_of_length{1.2e-20}; // 0.00000000012e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                          atomic_unit_of_mag_dipole_mom{1.1e-31}; // 0.000000011e-23 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        atomic_unit_of_mag_flux_density{0.0014}; // 0.000000014e5 T
+UNIT_CONSTANT Quantity<Unit<2, -1, 2, 2, 0, 0, 0>>                         atomic_unit_of_magnetizability{9e-38}; // 0.0000000090e-29 J T^-2
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    atomic_unit_of_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_mom_um{2.4e-32}; // 0.000000024e-24 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                            atomic_unit_of_permittivity{0.0}; // 0.0 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                    atomic_unit_of_time{1.4e-28}; // 0.000000000014e-17 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                                atomic_unit_of_velocity{0.0005}; // 0.00000000050e6 m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, -1, 0>>                                      Avogadro_constant{7400000000000000.0}; // 0.000000074e23 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                          Bohr_magneton{5.7e-32}; // 0.0000057e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                              Bohr_magneton_in_Hz_per_T{86.0}; // 0.000000086e9 Hz T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>              Bohr_magneton_in_inverse_meters_per_tesla{2.9e-7}; // 0.00000029 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                               Bohr_magneton_in_K_per_T{3.9e-7}; // 0.00000039 K T^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                            Bohr_radius{1.2e-20}; // 0.00000000012e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                                     Boltzmann_constant{7.9e-30}; // 0.00000079e-23 J K^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>                         Boltzmann_constant_in_Hz_per_K{12000.0}; // 0.0000012e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, -1, 0, 0>>        Boltzmann_constant_in_inverse_meters_per_kelvin{0.00004}; // 0.000040 m^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                     characteristic_impedance_of_vacuum{0.0}; // 0.0 ohm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              classical_electron_radius{1.9e-24}; // 0.0000000019e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                     Compton_wavelength{1.1e-21}; // 0.0000000011e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           Compton_wavelength_over_2_pi{1.8e-22}; // 0.00000018e-15 m
+UNIT_CONSTANT Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                                    conductance_quantum{1.8e-14}; // 0.0000000018e-5 S
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>               conventional_value_of_Josephson_constant{0.0}; // 0.0 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>            conventional_value_of_von_Klitzing_constant{0.0}; // 0.0 ohm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Cu_x_unit{2.8e-20}; // 0.00000028e-13 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        deuteron_electron_mag_mom_ratio{2.6e-12}; // 0.000000026e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           deuteron_electron_mass_ratio{1.3e-7}; // 0.00000013
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      deuteron_g_factor{4.8e-9}; // 0.0000000048
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       deuteron_mag_mom{3.6e-35}; // 0.0000000036e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                deuteron_mag_mom_to_Bohr_magneton_ratio{2.6e-12}; // 0.0000000026e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             deuteron_mag_mom_to_nuclear_magneton_ratio{4.8e-9}; // 0.0000000048
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          deuteron_mass{4.1e-35}; // 0.000000041e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        deuteron_mass_energy_equivalent{3.7e-18}; // 0.000000037e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    deuteron_molar_mass{4e-14}; // 0.000000000040e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         deuteron_neutron_mag_mom_ratio{1.1e-7}; // 0.00000011
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          deuteron_proton_mag_mom_ratio{1.5e-9}; // 0.0000000015
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             deuteron_proton_mass_ratio{1.9e-10}; // 0.00000000019
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             deuteron_rms_charge_radius{2.5e-18}; // 0.0025e-15 m
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                                      electric_constant{0.0}; // 0.0 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_charge_to_mass_quotient{1100.0}; // 0.000000011e11 C kg^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        electron_deuteron_mag_mom_ratio{0.000012}; // 0.000012
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           electron_deuteron_mass_ratio{9.6e-15}; // 0.000000000096e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      electron_g_factor{5.2e-13}; // 0.00000000000052
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                 electron_gyromag_ratio{1100.0}; // 0.000000011e11 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_gyromag_ratio_over_2_pi{170.0}; // 0.00017 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_helion_mass_ratio{8.8e-15}; // 0.000000000088e-4
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       electron_mag_mom{5.7e-32}; // 0.0000057e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_mag_mom_anomaly{2.6e-13}; // 0.00000000026e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                electron_mag_mom_to_Bohr_magneton_ratio{2.6e-13}; // 0.00000000000026
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             electron_mag_mom_to_nuclear_magneton_ratio{1.7e-7}; // 0.00000017
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          electron_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        electron_mass_energy_equivalent{1e-21}; // 0.00000010e-14 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    electron_molar_mass{1.6e-17}; // 0.00000000016e-7 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_muon_mag_mom_ratio{4.6e-6}; // 0.0000046
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_muon_mass_ratio{1.1e-10}; // 0.00000011e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         electron_neutron_mag_mom_ratio{0.00023}; // 0.00023
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_neutron_mass_ratio{2.7e-13}; // 0.0000000027e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          electron_proton_mag_mom_ratio{2e-6}; // 0.0000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_proton_mass_ratio{5.2e-14}; // 0.00000000052e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                electron_tau_mass_ratio{2.6e-8}; // 0.00026e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  electron_to_alpha_particle_mass_ratio{4.5e-15}; // 0.000000000045e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_helion_mag_mom_ratio{0.00001}; // 0.000010
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_proton_mag_mom_ratio{7.2e-6}; // 0.0000072
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_triton_mass_ratio{8.4e-15}; // 0.000000000084e-4
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                          electron_volt{9.8e-28}; // 0.0000000098e-19 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>           alpha_particle_mass_energy_equivalent_in_MeV{3.68500622784e-18}; // 0.000023 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>          atomic_mass_constant_energy_equivalent_in_MeV{9.13240673856e-19}; // 0.0000057 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>            atomic_mass_unit_electron_volt_relationship{9.13240673856e-19}; // 0.0000057e6 eV
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                              Bohr_magneton_in_eV_per_T{4.16565921408e-33}; // 0.0000000026e-5 eV T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                         Boltzmann_constant_in_eV_per_K{8.010883104e-30}; // 0.0000050e-5 eV K^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 deuteron_mass_energy_equivalent_in_MeV{1.92261194496e-18}; // 0.000012 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 electron_mass_energy_equivalent_in_MeV{4.96674752448e-22}; // 0.0000000031 MeV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       electron_volt_hertz_relationship{1500000.0}; // 0.000000015e14 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>               electron_volt_inverse_meter_relationship{0.005}; // 0.000000050e5 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       electron_volt_joule_relationship{9.8e-28}; // 0.0000000098e-19 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      electron_volt_kelvin_relationship{0.0067}; // 0.00000067e4 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    electron_volt_kilogram_relationship{1.1e-44}; // 0.000000011e-36 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                      elementary_charge{9.8e-28}; // 0.0000000098e-19 C
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                               elementary_charge_over_h{1500000.0}; // 0.000000015e14 A J^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -1, 0>>                                       Faraday_constant{0.00059}; // 0.00059 C mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -2, 0>>     Faraday_constant_for_conventional_electric_current{0.0012}; // 0.0012 C_90 mol^-1
+UNIT_CONSTANT Quantity<Unit<-4, -2, 4, 0, 0, 0, 0>>                                Fermi_coupling_constant{233738617.01090395}; // 0.0000006e-5 GeV^-2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                fine_structure_constant{1.7e-12}; // 0.0000000017e-3
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>                               first_radiation_constant{4.6e-24}; // 0.000000046e-16 W m^2
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>         first_radiation_constant_for_spectral_radiance{1.5e-24}; // 0.000000015e-16 W m^2 sr^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     hartree_electron_volt_relationship{2.72370025536e-26}; // 0.00000017 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  atomic_mass_unit_hartree_relationship{6.975591440129274e-20}; // 0.0000000016e7 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     electron_volt_hartree_relationship{1.0027412695185831e-27}; // 0.000000023e-2 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                         Hartree_energy{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                   Hartree_energy_in_eV{2.72370025536e-26}; // 0.00000017 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                             hartree_hertz_relationship{39000.0}; // 0.000000000039e15 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                     hartree_inverse_meter_relationship{0.00013}; // 0.000000000013e7 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hartree_joule_relationship{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                            hartree_kelvin_relationship{0.18}; // 0.0000018e5 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                          hartree_kilogram_relationship{6e-43}; // 0.000000060e-35 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             helion_electron_mass_ratio{2.7e-7}; // 0.00000027
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        helion_g_factor{5e-8}; // 0.000000050
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         helion_mag_mom{1.4e-34}; // 0.000000014e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  helion_mag_mom_to_Bohr_magneton_ratio{1.4e-11}; // 0.000000014e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               helion_mag_mom_to_nuclear_magneton_ratio{2.5e-8}; // 0.000000025
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            helion_mass{6.2e-35}; // 0.000000062e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          helion_mass_energy_equivalent{5.5e-18}; // 0.000000055e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   helion_mass_energy_equivalent_in_MeV{2.72370025536e-18}; // 0.000017 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      helion_molar_mass{1.2e-13}; // 0.00000000012e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               helion_proton_mass_ratio{2.9e-10}; // 0.00000000029
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       hertz_electron_volt_relationship{4.005441552e-42}; // 0.000000025e-15 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hertz_hartree_relationship{3.923770185072716e-45}; // 0.0000000000090e-16 E_h
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       hertz_inverse_meter_relationship{0.0}; // 0.0 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                               hertz_joule_relationship{8.1e-42}; // 0.000000081e-34 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              hertz_kelvin_relationship{2.8e-17}; // 0.0000028e-11 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            hertz_kilogram_relationship{9.1e-59}; // 0.000000091e-51 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        inverse_fine_structure_constant{3.1e-8}; // 0.000000031
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>               inverse_meter_electron_volt_relationship{1.217654231808e-33}; // 0.0000000076e-6 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     inverse_meter_hartree_relationship{1.177131055521815e-36}; // 0.000000000027e-8 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       inverse_meter_hertz_relationship{0.0}; // 0.0 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       inverse_meter_joule_relationship{2.4e-33}; // 0.000000024e-25 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      inverse_meter_kelvin_relationship{8.3e-9}; // 0.00000083e-2 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    inverse_meter_kilogram_relationship{2.7e-50}; // 0.000000027e-42 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         inverse_of_conductance_quantum{2.9e-6}; // 0.0000029 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                                     Josephson_constant{3000000.0}; // 0.0030e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       joule_electron_volt_relationship{6.08827115904e-9}; // 0.000000038e18 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             joule_hartree_relationship{1.220728502022623e-8}; // 0.000000028e17 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                               joule_hertz_relationship{1.9e+25}; // 0.000000019e33 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       joule_inverse_meter_relationship{62000000000000000.0}; // 0.000000062e24 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              joule_kelvin_relationship{42000000000000000.0}; // 0.0000042e22 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            joule_kilogram_relationship{0.0}; // 0.0 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      kelvin_electron_volt_relationship{8.010883104e-30}; // 0.0000050e-5 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kelvin_hartree_relationship{7.847540370145433e-30}; // 0.0000018e-6 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                              kelvin_hertz_relationship{12000.0}; // 0.0000012e10 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                      kelvin_inverse_meter_relationship{0.00004}; // 0.000040 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                              kelvin_joule_relationship{7.9e-30}; // 0.00000079e-23 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                           kelvin_kilogram_relationship{8.8e-47}; // 0.00000088e-40 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    kilogram_electron_volt_relationship{544740051.072}; // 0.000000034e35 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          kilogram_hartree_relationship{1089936162.520199}; // 0.000000025e34 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                            kilogram_hertz_relationship{1.7e+42}; // 0.000000017e50 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                    kilogram_inverse_meter_relationship{5.6e+33}; // 0.000000056e41 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kilogram_joule_relationship{0.0}; // 0.0 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                           kilogram_kelvin_relationship{3.7e+33}; // 0.0000037e39 K
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           lattice_parameter_of_silicon{8.9e-18}; // 0.0000089e-12 m
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                    Loschmidt_constant_273_15_K_100_kPa{15000000000000000000.0}; // 0.0000015e25 m^-3
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                Loschmidt_constant_273_15_K_101_325_kPa{15000000000000000000.0}; // 0.0000015e25 m^-3
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, -2, 0, 0, 0>>                                           mag_constant{0.0}; // 0.0 N A^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                                       mag_flux_quantum{1.3e-23}; // 0.000000013e-15 Wb
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, -1, 0>>                                     molar_gas_constant{4.8e-6}; // 0.0000048 J mol^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    molar_mass_constant{0.0}; // 0.0 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                molar_mass_of_carbon_12{0.0}; // 0.0 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, -1, 0>>                                  molar_Planck_constant{1.8e-19}; // 0.0000000018e-10 J s mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, -1, 0>>                          molar_Planck_constant_times_c{5.4e-11}; // 0.000000000054 J m mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>             molar_volume_of_ideal_gas_273_15_K_100_kPa{1.3e-8}; // 0.000013e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>         molar_volume_of_ideal_gas_273_15_K_101_325_kPa{1.3e-8}; // 0.000013e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>                                molar_volume_of_silicon{6.1e-13}; // 0.00000061e-6 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Mo_x_unit{5.3e-20}; // 0.00000053e-13 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                muon_Compton_wavelength{2.6e-22}; // 0.00000026e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      muon_Compton_wavelength_over_2_pi{4.2e-23}; // 0.000000042e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               muon_electron_mass_ratio{4.6e-6}; // 0.0000046
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                          muon_g_factor{1.3e-9}; // 0.0000000013
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                           muon_mag_mom{1e-33}; // 0.00000010e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                   muon_mag_mom_anomaly{6.3e-10}; // 0.00000063e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    muon_mag_mom_to_Bohr_magneton_ratio{1.1e-10}; // 0.00000011e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 muon_mag_mom_to_nuclear_magneton_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                              muon_mass{4.8e-36}; // 0.000000048e-28 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            muon_mass_energy_equivalent{4.3e-19}; // 0.000000043e-11 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     muon_mass_energy_equivalent_in_MeV{3.84522388992e-19}; // 0.0000024 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                        muon_molar_mass{2.5e-12}; // 0.0000000025e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                muon_neutron_mass_ratio{2.5e-9}; // 0.0000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              muon_proton_mag_mom_ratio{7.1e-8}; // 0.000000071
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 muon_proton_mass_ratio{2.5e-9}; // 0.0000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    muon_tau_mass_ratio{5.4e-6}; // 0.00054e-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_action{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                         natural_unit_of_action_in_eV_s{6.4087064832e-43}; // 0.000000040e-16 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                 natural_unit_of_energy{1e-21}; // 0.00000010e-14 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          natural_unit_of_energy_in_MeV{4.96674752448e-22}; // 0.0000000031 MeV
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 natural_unit_of_length{1.8e-22}; // 0.00000018e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   natural_unit_of_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_mom_um{3.4e-30}; // 0.000000034e-22 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                   natural_unit_of_time{5.8e-31}; // 0.00000000058e-21 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               natural_unit_of_velocity{0.0}; // 0.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             neutron_Compton_wavelength{8.8e-25}; // 0.00000000088e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                   neutron_Compton_wavelength_over_2_pi{1.4e-25}; // 0.00000000014e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_electron_mag_mom_ratio{2.5e-10}; // 0.00000025e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            neutron_electron_mass_ratio{9e-7}; // 0.00000090
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                       neutron_g_factor{9e-7}; // 0.00000090
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                  neutron_gyromag_ratio{43.0}; // 0.00000043e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                        neutron_gyromag_ratio_over_2_pi{6.9}; // 0.0000069 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                        neutron_mag_mom{2.3e-33}; // 0.00000023e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 neutron_mag_mom_to_Bohr_magneton_ratio{2.5e-10}; // 0.00000025e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              neutron_mag_mom_to_nuclear_magneton_ratio{4.5e-7}; // 0.00000045
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                           neutron_mass{2.1e-35}; // 0.000000021e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         neutron_mass_energy_equivalent{1.9e-18}; // 0.000000019e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  neutron_mass_energy_equivalent_in_MeV{9.29262440064e-19}; // 0.0000058 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                     neutron_molar_mass{4.9e-13}; // 0.00000000049e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                neutron_muon_mass_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           neutron_proton_mag_mom_ratio{1.6e-7}; // 0.00000016
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_proton_mass_difference{8.5e-37}; // 0.00000085e-30
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       neutron_proton_mass_difference_energy_equivalent{7.6e-20}; // 0.00000076e-13
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>neutron_proton_mass_difference_energy_equivalent_in_MeV{4.8e-7}; // 0.00000048
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    neutron_proton_mass_difference_in_u{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              neutron_proton_mass_ratio{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 neutron_tau_mass_ratio{0.000048}; // 0.000048
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               neutron_to_shielded_proton_mag_mom_ratio{1.6e-7}; // 0.00000016
+UNIT_CONSTANT Quantity<Unit<3, -1, -2, 0, 0, 0, 0>>                      Newtonian_constant_of_gravitation{3.1e-15}; // 0.00031e-11 m^3 kg^-1 s^-2
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       nuclear_magneton{3.1e-35}; // 0.000000031e-27 J T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                           nuclear_magneton_in_eV_per_T{2.4032649312e-36}; // 0.0000000015e-8 eV T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>           nuclear_magneton_in_inverse_meters_per_tesla{1.6e-10}; // 0.000000016e-2 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                            nuclear_magneton_in_K_per_T{2.1e-10}; // 0.0000021e-4 K T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          nuclear_magneton_in_MHz_per_T{0.047}; // 0.000000047 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                        Planck_constant{8.1e-42}; // 0.000000081e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                Planck_constant_in_eV_s{4.005441552e-42}; // 0.000000025e-15 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                              Planck_constant_over_2_pi{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                      Planck_constant_over_2_pi_in_eV_s{6.4087064832e-43}; // 0.000000040e-16 eV s
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, 0, 0>>            Planck_constant_over_2_pi_times_c_in_MeV_fm{1.92261194496e-34}; // 0.0000012 MeV fm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Planck_length{3.8e-40}; // 0.000038e-35 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            Planck_mass{5.1e-13}; // 0.000051e-8 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   Planck_mass_energy_equivalent_in_GeV{46463.1220032}; // 0.000029e19 GeV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                                     Planck_temperature{3.3e+27}; // 0.000033e32 K
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                            Planck_time{1.3e-48}; // 0.00013e-44 s
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_charge_to_mass_quotient{0.59}; // 0.000000059e7 C kg^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              proton_Compton_wavelength{6.1e-25}; // 0.00000000061e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                    proton_Compton_wavelength_over_2_pi{9.7e-26}; // 0.000000000097e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             proton_electron_mass_ratio{1.7e-7}; // 0.00000017
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        proton_g_factor{1.7e-8}; // 0.000000017
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                   proton_gyromag_ratio{1.8}; // 0.000000018e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_gyromag_ratio_over_2_pi{0.29}; // 0.00000029 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         proton_mag_mom{9.7e-35}; // 0.0000000097e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  proton_mag_mom_to_Bohr_magneton_ratio{4.6e-12}; // 0.0000000046e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               proton_mag_mom_to_nuclear_magneton_ratio{8.5e-9}; // 0.0000000085
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        proton_mag_shielding_correction{1.1e-8}; // 0.011e-6
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            proton_mass{2.1e-35}; // 0.000000021e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          proton_mass_energy_equivalent{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   proton_mass_energy_equivalent_in_MeV{9.29262440064e-19}; // 0.0000058 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      proton_molar_mass{9.1e-14}; // 0.000000000091e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 proton_muon_mass_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           proton_neutron_mag_mom_ratio{3.4e-7}; // 0.00000034
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              proton_neutron_mass_ratio{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                               proton_rms_charge_radius{6.1e-18}; // 0.0061e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  proton_tau_mass_ratio{0.000048}; // 0.000048
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                                 quantum_of_circulation{1.7e-13}; // 0.0000000017e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                         quantum_of_circulation_times_2{3.3e-13}; // 0.0000000033e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                                       Rydberg_constant{0.000065}; // 0.000065 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                         Rydberg_constant_times_c_in_Hz{19000.0}; // 0.000000000019e15 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        Rydberg_constant_times_hc_in_eV{1.345828361472e-26}; // 0.000000084 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         Rydberg_constant_times_hc_in_J{2.7e-26}; // 0.000000027e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    Sackur_Tetrode_constant_1_K_100_kPa{1.4e-6}; // 0.0000014
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                Sackur_Tetrode_constant_1_K_101_325_kPa{1.4e-6}; // 0.0000014
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>                              second_radiation_constant{8.3e-9}; // 0.00000083e-2 m K
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_helion_gyromag_ratio{2.7}; // 0.000000027e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_helion_gyromag_ratio_over_2_pi{0.43}; // 0.00000043 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_helion_mag_mom{1.4e-34}; // 0.000000014e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_helion_mag_mom_to_Bohr_magneton_ratio{1.4e-11}; // 0.000000014e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_helion_mag_mom_to_nuclear_magneton_ratio{2.5e-8}; // 0.000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                shielded_helion_to_proton_mag_mom_ratio{9.2e-9}; // 0.0000000092
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       shielded_helion_to_shielded_proton_mag_mom_ratio{3.3e-9}; // 0.0000000033
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_proton_gyromag_ratio{3.3}; // 0.000000033e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_proton_gyromag_ratio_over_2_pi{0.53}; // 0.00000053 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_proton_mag_mom{1.8e-34}; // 0.000000018e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_proton_mag_mom_to_Bohr_magneton_ratio{1.7e-11}; // 0.000000017e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_proton_mag_mom_to_nuclear_magneton_ratio{3e-8}; // 0.000000030
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               speed_of_light_in_vacuum{0.0}; // 0.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                    natural_unit_of_mom_um_in_MeV_per_c{1.6567286440808328e-30}; // 0.0000000031 MeV/c
+UNIT_CONSTANT Quantity<Unit<0, -2, 0, 0, 0, 0, 0>>         Newtonian_constant_of_gravitation_over_h_bar_c{97549202949.56679}; // 0.00031e-39 (GeV/c^2)^-2
+UNIT_CONSTANT Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                       standard_acceleration_of_gravity{0.0}; // 0.0 m s^-2
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                    standard_atmosphere{0.0}; // 0.0 Pa
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                standard_state_pressure{0.0}; // 0.0 Pa
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, 0, -4, 0, 0>>                              Stefan_Boltzmann_constant{1.3e-13}; // 0.000013e-8 W m^-2 K^-4
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 tau_Compton_wavelength{6.3e-20}; // 0.000063e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       tau_Compton_wavelength_over_2_pi{1e-20}; // 0.000010e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                tau_electron_mass_ratio{0.31}; // 0.31
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                               tau_mass{2.9e-31}; // 0.00029e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             tau_mass_energy_equivalent{2.6e-14}; // 0.00026e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      tau_mass_energy_equivalent_in_MeV{2.56348259328e-14}; // 0.16 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                         tau_molar_mass{1.7e-7}; // 0.00017e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    tau_muon_mass_ratio{0.0015}; // 0.0015
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 tau_neutron_mass_ratio{0.00017}; // 0.00017
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  tau_proton_mass_ratio{0.00017}; // 0.00017
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                                  Thomson_cross_section{9.1e-38}; // 0.00000000091e-28 m^2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             triton_electron_mass_ratio{2.6e-7}; // 0.00000026
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        triton_g_factor{2.8e-8}; // 0.000000028
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         triton_mag_mom{1.2e-34}; // 0.000000012e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  triton_mag_mom_to_Bohr_magneton_ratio{7.6e-12}; // 0.0000000076e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               triton_mag_mom_to_nuclear_magneton_ratio{1.4e-8}; // 0.000000014
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            triton_mass{6.2e-35}; // 0.000000062e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          triton_mass_energy_equivalent{5.5e-18}; // 0.000000055e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   triton_mass_energy_equivalent_in_MeV{2.72370025536e-18}; // 0.000017 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      triton_molar_mass{1.1e-13}; // 0.00000000011e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               triton_proton_mass_ratio{2.2e-10}; // 0.00000000022
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               unified_atomic_mass_unit{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               alpha_particle_mass_in_u{1.0461395952e-37}; // 0.000000000063 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     deuteron_mass_in_u{6.64215616e-38}; // 0.000000000040 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     electron_mass_in_u{2.656862464e-41}; // 0.00000000016e-4 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            electron_volt_atomic_mass_unit_relationship{1.0959557664e-44}; // 0.0000000066e-9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                  hartree_atomic_mass_unit_relationship{2.158700752e-44}; // 0.0000000013e-8 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       helion_mass_in_u{1.992646848e-37}; // 0.00000000012 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    hertz_atomic_mass_unit_relationship{3.32107808e-60}; // 0.0000000020e-24 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            inverse_meter_atomic_mass_unit_relationship{1.0129288144e-51}; // 0.00000000061e-15 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    joule_atomic_mass_unit_relationship{1.3616420128e-25}; // 0.000000082e9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                   kelvin_atomic_mass_unit_relationship{8.800856912e-47}; // 0.0000053e-14 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 kilogram_atomic_mass_unit_relationship{1.2287988896e-8}; // 0.000000074e26 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                         muon_mass_in_u{4.1513476e-36}; // 0.0000000025 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                      neutron_mass_in_u{8.136641296e-37}; // 0.00000000049 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       proton_mass_in_u{1.5110905264e-37}; // 0.000000000091 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          tau_mass_in_u{2.822916368e-31}; // 0.00017 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       triton_mass_in_u{1.826592944e-37}; // 0.00000000011 u
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                                  von_Klitzing_constant{5.9e-6}; // 0.0000059 ohm
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      weak_mixing_angle{0.0021}; // 0.0021
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>               Wien_frequency_displacement_law_constant{34000.0}; // 0.0000034e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>              Wien_wavelength_displacement_law_constant{1.7e-9}; // 0.0000017e-3 m K
+
+
+}// namespace uncertaintiy
+
+
+}// namespace physicalConstant
+}// namespace unit
+
@@ -0,0 +1,74 @@
+#pragma once
+
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+#include <src/quantity/Quantity.h>
+#include <src/unit/Unit.h>
+
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       c_220_lattice_spacing_of_silicon{1.920155714e-10}; // 192.0155714e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Angstrom_star{1.00001495e-10}; // 1.00001495e-10 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, -1, 0>>                                      Avogadro_constant{6.022140857e+23}; // 6.022140857e23 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                                     Boltzmann_constant{1.38064852e-23}; // 1.38064852e-23 J K^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>                         Boltzmann_constant_in_Hz_per_K{20836612000.0}; // 2.0836612e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, -1, 0, 0>>        Boltzmann_constant_in_inverse_meters_per_kelvin{69.503457}; // 69.503457 m^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Cu_x_unit{1.00207697e-13}; // 1.00207697e-13 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                          electron_volt{1.6021766208e-19}; // 1.6021766208e-19 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                         Boltzmann_constant_in_eV_per_K{1.380648514037145e-23}; // 8.6173303e-5 eV K^-1
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>                               first_radiation_constant{3.74177179e-16}; // 3.741771790e-16 W m^2
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>         first_radiation_constant_for_spectral_radiance{1.191042953e-16}; // 1.191042953e-16 W m^2 sr^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           lattice_parameter_of_silicon{5.431020504e-10}; // 543.1020504e-12 m
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                    Loschmidt_constant_273_15_K_100_kPa{2.6516467e+25}; // 2.6516467e25 m^-3
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                Loschmidt_constant_273_15_K_101_325_kPa{2.6867811e+25}; // 2.6867811e25 m^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, -1, 0>>                                     molar_gas_constant{8.3144598}; // 8.3144598 J mol^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    molar_mass_constant{0.001}; // 1e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                molar_mass_of_carbon_12{0.012}; // 12e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, -1, 0>>                                  molar_Planck_constant{3.990312711e-10}; // 3.9903127110e-10 J s mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, -1, 0>>                          molar_Planck_constant_times_c{0.119626565582}; // 0.119626565582 J m mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>             molar_volume_of_ideal_gas_273_15_K_100_kPa{0.022710947}; // 22.710947e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>         molar_volume_of_ideal_gas_273_15_K_101_325_kPa{0.022413962}; // 22.413962e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>                                molar_volume_of_silicon{0.00001205883214}; // 12.05883214e-6 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Mo_x_unit{1.00209952e-13}; // 1.00209952e-13 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_action{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                         natural_unit_of_action_in_eV_s{1.054571800064226e-34}; // 6.582119514e-16 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                 natural_unit_of_energy{8.18710565e-14}; // 8.18710565e-14 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          natural_unit_of_energy_in_MeV{8.187105646948593e-14}; // 0.5109989461 MeV
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 natural_unit_of_length{3.8615926764e-13}; // 386.15926764e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   natural_unit_of_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_mom_um{2.730924488e-22}; // 2.730924488e-22 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                   natural_unit_of_time{1.28808866712e-21}; // 1.28808866712e-21 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               natural_unit_of_velocity{299792458.0}; // 299792458.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<3, -1, -2, 0, 0, 0, 0>>                      Newtonian_constant_of_gravitation{6.67408e-11}; // 6.67408e-11 m^3 kg^-1 s^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                        Planck_constant{6.62607004e-34}; // 6.626070040e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                Planck_constant_in_eV_s{6.626070039454996e-34}; // 4.135667662e-15 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                              Planck_constant_over_2_pi{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                      Planck_constant_over_2_pi_in_eV_s{1.054571800064226e-34}; // 6.582119514e-16 eV s
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, 0, 0>>            Planck_constant_over_2_pi_times_c_in_MeV_fm{3.1615267208645725e-26}; // 197.3269788 MeV fm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Planck_length{1.616229e-35}; // 1.616229e-35 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            Planck_mass{2.17647e-8}; // 2.176470e-8 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   Planck_mass_energy_equivalent_in_GeV{1956113458.100928}; // 1.220910e19 GeV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                                     Planck_temperature{1.416808e+32}; // 1.416808e32 K
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                            Planck_time{5.39116e-44}; // 5.39116e-44 s
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                                 quantum_of_circulation{0.00036369475486}; // 3.6369475486e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                         quantum_of_circulation_times_2{0.00072738950972}; // 7.2738950972e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    Sackur_Tetrode_constant_1_K_100_kPa{-1.1517084}; // -1.1517084
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                Sackur_Tetrode_constant_1_K_101_325_kPa{-1.1648714}; // -1.1648714
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>                              second_radiation_constant{0.0143877736}; // 1.43877736e-2 m K
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               speed_of_light_in_vacuum{299792458.0}; // 299792458.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                    natural_unit_of_mom_um_in_MeV_per_c{2.7309244874160887e-22}; // 0.5109989461 MeV/c
+UNIT_CONSTANT Quantity<Unit<0, -2, 0, 0, 0, 0, 0>>         Newtonian_constant_of_gravitation_over_h_bar_c{2111030833546752.5}; // 6.70861e-39 (GeV/c^2)^-2
+UNIT_CONSTANT Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                       standard_acceleration_of_gravity{9.80665}; // 9.80665 m s^-2
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                    standard_atmosphere{101325.0}; // 101325.0 Pa
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                standard_state_pressure{100000.0}; // 100000.0 Pa
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, 0, -4, 0, 0>>                              Stefan_Boltzmann_constant{5.670367e-8}; // 5.670367e-8 W m^-2 K^-4
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               unified_atomic_mass_unit{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>               Wien_frequency_displacement_law_constant{58789238000.0}; // 5.8789238e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>              Wien_wavelength_displacement_law_constant{0.0028977729}; // 2.8977729e-3 m K
+
+
+}// namespace physicalConstant
+}// namespace unit
+
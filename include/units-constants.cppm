@@ -0,0 +1,758 @@
+// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit
+
+export module units:constants;
+
+import :core;
+
+// macros are not imported
+#ifndef UNIT_BASETYPE
+#define UNIT_BASETYPE double
+#endif
+#if __cplusplus >= 201703L
+#define UNIT_CONSTANT inline constexpr
+#else
+#define UNIT_CONSTANT constexpr
+#endif
+
+export {
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsUniversal.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       c_220_lattice_spacing_of_silicon{1.920155714e-10}; // 192.0155714e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Angstrom_star{1.00001495e-10}; // 1.00001495e-10 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, -1, 0>>                                      Avogadro_constant{6.022140857e+23}; // 6.022140857e23 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                                     Boltzmann_constant{1.38064852e-23}; // 1.38064852e-23 J K^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>                         Boltzmann_constant_in_Hz_per_K{20836612000.0}; // 2.0836612e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, -1, 0, 0>>        Boltzmann_constant_in_inverse_meters_per_kelvin{69.503457}; // 69.503457 m^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Cu_x_unit{1.00207697e-13}; // 1.00207697e-13 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                          electron_volt{1.6021766208e-19}; // 1.6021766208e-19 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                         Boltzmann_constant_in_eV_per_K{1.380648514037145e-23}; // 8.6173303e-5 eV K^-1
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>                               first_radiation_constant{3.74177179e-16}; // 3.741771790e-16 W m^2
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>         first_radiation_constant_for_spectral_radiance{1.191042953e-16}; // 1.191042953e-16 W m^2 sr^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           lattice_parameter_of_silicon{5.431020504e-10}; // 543.1020504e-12 m
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                    Loschmidt_constant_273_15_K_100_kPa{2.6516467e+25}; // 2.6516467e25 m^-3
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                Loschmidt_constant_273_15_K_101_325_kPa{2.6867811e+25}; // 2.6867811e25 m^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, -1, 0>>                                     molar_gas_constant{8.3144598}; // 8.3144598 J mol^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    molar_mass_constant{0.001}; // 1e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                molar_mass_of_carbon_12{0.012}; // 12e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, -1, 0>>                                  molar_Planck_constant{3.990312711e-10}; // 3.9903127110e-10 J s mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, -1, 0>>                          molar_Planck_constant_times_c{0.119626565582}; // 0.119626565582 J m mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>             molar_volume_of_ideal_gas_273_15_K_100_kPa{0.022710947}; // 22.710947e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>         molar_volume_of_ideal_gas_273_15_K_101_325_kPa{0.022413962}; // 22.413962e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>                                molar_volume_of_silicon{0.00001205883214}; // 12.05883214e-6 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Mo_x_unit{1.00209952e-13}; // 1.00209952e-13 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_action{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                         natural_unit_of_action_in_eV_s{1.054571800064226e-34}; // 6.582119514e-16 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                 natural_unit_of_energy{8.18710565e-14}; // 8.18710565e-14 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          natural_unit_of_energy_in_MeV{8.187105646948593e-14}; // 0.5109989461 MeV
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 natural_unit_of_length{3.8615926764e-13}; // 386.15926764e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   natural_unit_of_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_mom_um{2.730924488e-22}; // 2.730924488e-22 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                   natural_unit_of_time{1.28808866712e-21}; // 1.28808866712e-21 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               natural_unit_of_velocity{299792458.0}; // 299792458.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<3, -1, -2, 0, 0, 0, 0>>                      Newtonian_constant_of_gravitation{6.67408e-11}; // 6.67408e-11 m^3 kg^-1 s^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                        Planck_constant{6.62607004e-34}; // 6.626070040e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                Planck_constant_in_eV_s{6.626070039454996e-34}; // 4.135667662e-15 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                              Planck_constant_over_2_pi{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                      Planck_constant_over_2_pi_in_eV_s{1.054571800064226e-34}; // 6.582119514e-16 eV s
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, 0, 0>>            Planck_constant_over_2_pi_times_c_in_MeV_fm{3.1615267208645725e-26}; // 197.3269788 MeV fm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Planck_length{1.616229e-35}; // 1.616229e-35 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            Planck_mass{2.17647e-8}; // 2.176470e-8 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   Planck_mass_energy_equivalent_in_GeV{1956113458.100928}; // 1.220910e19 GeV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                                     Planck_temperature{1.416808e+32}; // 1.416808e32 K
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                            Planck_time{5.39116e-44}; // 5.39116e-44 s
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                                 quantum_of_circulation{0.00036369475486}; // 3.6369475486e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                         quantum_of_circulation_times_2{0.00072738950972}; // 7.2738950972e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    Sackur_Tetrode_constant_1_K_100_kPa{-1.1517084}; // -1.1517084
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                Sackur_Tetrode_constant_1_K_101_325_kPa{-1.1648714}; // -1.1648714
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>                              second_radiation_constant{0.0143877736}; // 1.43877736e-2 m K
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               speed_of_light_in_vacuum{299792458.0}; // 299792458.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                    natural_unit_of_mom_um_in_MeV_per_c{2.7309244874160887e-22}; // 0.5109989461 MeV/c
+UNIT_CONSTANT Quantity<Unit<0, -2, 0, 0, 0, 0, 0>>         Newtonian_constant_of_gravitation_over_h_bar_c{2111030833546752.5}; // 6.70861e-39 (GeV/c^2)^-2
+UNIT_CONSTANT Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                       standard_acceleration_of_gravity{9.80665}; // 9.80665 m s^-2
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                    standard_atmosphere{101325.0}; // 101325.0 Pa
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                standard_state_pressure{100000.0}; // 100000.0 Pa
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, 0, -4, 0, 0>>                              Stefan_Boltzmann_constant{5.670367e-8}; // 5.670367e-8 W m^-2 K^-4
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               unified_atomic_mass_unit{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>               Wien_frequency_displacement_law_constant{58789238000.0}; // 5.8789238e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>              Wien_wavelength_displacement_law_constant{0.0028977729}; // 2.8977729e-3 m K
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsElectromagnetic.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                          Bohr_magneton{9.274009994e-24}; // 927.4009994e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                              Bohr_magneton_in_Hz_per_T{13996245042.0}; // 13.996245042e9 Hz T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>              Bohr_magneton_in_inverse_meters_per_tesla{46.68644814}; // 46.68644814 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                               Bohr_magneton_in_K_per_T{0.67171405}; // 0.67171405 K T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                     characteristic_impedance_of_vacuum{376.730313461}; // 376.730313461 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                                    conductance_quantum{0.00007748091731}; // 7.7480917310e-5 S
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>               conventional_value_of_Josephson_constant{483597900000000.0}; // 483597.9e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>            conventional_value_of_von_Klitzing_constant{25812.807}; // 25812.807 ohm
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                                      electric_constant{8.854187817e-12}; // 8.854187817e-12 F m^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                              Bohr_magneton_in_eV_per_T{9.274009994146833e-24}; // 5.7883818012e-5 eV T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                      elementary_charge{1.6021766208e-19}; // 1.6021766208e-19 C
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                               elementary_charge_over_h{241798926200000.0}; // 2.417989262e14 A J^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -1, 0>>                                       Faraday_constant{96485.33289}; // 96485.33289 C mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -2, 0>>     Faraday_constant_for_conventional_electric_current{96485.3251}; // 96485.3251 C_90 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         inverse_of_conductance_quantum{12906.4037278}; // 12906.4037278 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                                     Josephson_constant{483597852500000.0}; // 483597.8525e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, -2, 0, 0, 0>>                                           mag_constant{1.2566370614e-6}; // 12.566370614e-7 N A^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                                       mag_flux_quantum{2.067833831e-15}; // 2.067833831e-15 Wb
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       nuclear_magneton{5.050783699e-27}; // 5.050783699e-27 J T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                           nuclear_magneton_in_eV_per_T{5.050783698972619e-27}; // 3.1524512550e-8 eV T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>           nuclear_magneton_in_inverse_meters_per_tesla{0.02542623432}; // 2.542623432e-2 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                            nuclear_magneton_in_K_per_T{0.0003658269}; // 3.6582690e-4 K T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          nuclear_magneton_in_MHz_per_T{7622593.285}; // 7.622593285 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                                  von_Klitzing_constant{25812.8074555}; // 25812.8074555 ohm
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsAtomic.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<-1, -2, 7, 3, 0, 0, 0>>                 atomic_unit_of_1st_hyperpolarizability{3.206361329e-53}; // 3.206361329e-53 C^3 m^3 J^-2
+UNIT_CONSTANT Quantity<Unit<-2, -3, 10, 4, 0, 0, 0>>                 atomic_unit_of_2nd_hyperpolarizability{6.235380085e-65}; // 6.235380085e-65 C^4 m^4 J^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_action{1.0545718e-34}; // 1.054571800e-34 J s
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                  atomic_unit_of_charge{1.6021766208e-19}; // 1.6021766208e-19 C
+UNIT_CONSTANT Quantity<Unit<-3, 0, 1, 1, 0, 0, 0>>                          atomic_unit_of_charge_density{1081202377000.0}; // 1.0812023770e12 C m^-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                                 atomic_unit_of_current{0.006623618183}; // 6.623618183e-3 A
+UNIT_CONSTANT Quantity<Unit<1, 0, 1, 1, 0, 0, 0>>                     atomic_unit_of_electric_dipole_mom{8.478353552e-30}; // 8.478353552e-30 C m
+UNIT_CONSTANT Quantity<Unit<1, 1, -3, -1, 0, 0, 0>>                          atomic_unit_of_electric_field{514220670700.0}; // 5.142206707e11 V m^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, -1, 0, 0, 0>>                 atomic_unit_of_electric_field_gradient{9.717362356e+21}; // 9.717362356e21 V m^-2
+UNIT_CONSTANT Quantity<Unit<0, -1, 4, 2, 0, 0, 0>>                 atomic_unit_of_electric_polarizability{1.6487772731e-41}; // 1.6487772731e-41 C^2 m^2 J^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                      atomic_unit_of_electric_potential{27.21138602}; // 27.21138602 V
+UNIT_CONSTANT Quantity<Unit<2, 0, 1, 1, 0, 0, 0>>                 atomic_unit_of_electric_quadrupole_mom{4.486551484e-40}; // 4.486551484e-40 C m^2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                  atomic_unit_of_energy{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                                   atomic_unit_of_force{8.23872336e-8}; // 8.23872336e-8 N
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                  atomic_unit_of_length{5.2917721067e-11}; // 0.52917721067e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                          atomic_unit_of_mag_dipole_mom{1.854801999e-23}; // 1.854801999e-23 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        atomic_unit_of_mag_flux_density{235051.755}; // 2.350517550e5 T
+UNIT_CONSTANT Quantity<Unit<2, -1, 2, 2, 0, 0, 0>>                         atomic_unit_of_magnetizability{7.8910365886e-29}; // 7.8910365886e-29 J T^-2
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    atomic_unit_of_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_mom_um{1.992851882e-24}; // 1.992851882e-24 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                            atomic_unit_of_permittivity{1.112650056e-10}; // 1.112650056e-10 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                    atomic_unit_of_time{2.418884326509e-17}; // 2.418884326509e-17 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                                atomic_unit_of_velocity{2187691.26277}; // 2.18769126277e6 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                            Bohr_radius{5.2917721067e-11}; // 0.52917721067e-10 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              classical_electron_radius{2.8179403227e-15}; // 2.8179403227e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                fine_structure_constant{0.0072973525664}; // 7.2973525664e-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                         Hartree_energy{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                   Hartree_energy_in_eV{4.359744650080796e-18}; // 27.21138602 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        inverse_fine_structure_constant{137.035999139}; // 137.035999139
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                                       Rydberg_constant{10973731.568508}; // 10973731.568508 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                         Rydberg_constant_times_c_in_Hz{3289841960355000.0}; // 3.289841960355e15 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        Rydberg_constant_times_hc_in_eV{2.1798723248801804e-18}; // 13.605693009 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         Rydberg_constant_times_hc_in_J{2.179872325e-18}; // 2.179872325e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                                  Thomson_cross_section{6.6524587158e-29}; // 0.66524587158e-28 m^2
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsNuclear.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                     alpha_particle_electron_mass_ratio{7294.29954136}; // 7294.29954136
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    alpha_particle_mass{6.64465723e-27}; // 6.644657230e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  alpha_particle_mass_energy_equivalent{5.971920097e-10}; // 5.971920097e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                              alpha_particle_molar_mass{0.004001506179127}; // 4.001506179127e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                       alpha_particle_proton_mass_ratio{3.97259968907}; // 3.97259968907
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   atomic_mass_constant{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 atomic_mass_constant_energy_equivalent{1.492418062e-10}; // 1.492418062e-10 J
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                     Compton_wavelength{2.4263102367e-12}; // 2.4263102367e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           Compton_wavelength_over_2_pi{3.8615926764e-13}; // 386.15926764e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        deuteron_electron_mag_mom_ratio{-0.0004664345535}; // -4.664345535e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           deuteron_electron_mass_ratio{3670.48296785}; // 3670.48296785
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      deuteron_g_factor{0.8574382311}; // 0.8574382311
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       deuteron_mag_mom{4.33073504e-27}; // 0.4330735040e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                deuteron_mag_mom_to_Bohr_magneton_ratio{0.0004669754554}; // 0.4669754554e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             deuteron_mag_mom_to_nuclear_magneton_ratio{0.8574382311}; // 0.8574382311
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          deuteron_mass{3.343583719e-27}; // 3.343583719e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        deuteron_mass_energy_equivalent{3.005063183e-10}; // 3.005063183e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    deuteron_molar_mass{0.002013553212745}; // 2.013553212745e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         deuteron_neutron_mag_mom_ratio{-0.44820652}; // -0.44820652
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          deuteron_proton_mag_mom_ratio{0.3070122077}; // 0.3070122077
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             deuteron_proton_mass_ratio{1.99900750087}; // 1.99900750087
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             deuteron_rms_charge_radius{2.1413e-15}; // 2.1413e-15 m
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_charge_to_mass_quotient{-175882002400.0}; // -1.758820024e11 C kg^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        electron_deuteron_mag_mom_ratio{-2143.923499}; // -2143.923499
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           electron_deuteron_mass_ratio{0.0002724437107484}; // 2.724437107484e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      electron_g_factor{-2.00231930436182}; // -2.00231930436182
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                 electron_gyromag_ratio{176085964400.0}; // 1.760859644e11 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_gyromag_ratio_over_2_pi{28024951640.0}; // 28024.95164 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_helion_mass_ratio{0.0001819543074854}; // 1.819543074854e-4
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       electron_mag_mom{-9.28476462e-24}; // -928.4764620e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_mag_mom_anomaly{0.00115965218091}; // 1.15965218091e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                electron_mag_mom_to_Bohr_magneton_ratio{-1.00115965218091}; // -1.00115965218091
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             electron_mag_mom_to_nuclear_magneton_ratio{-1838.28197234}; // -1838.28197234
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          electron_mass{9.10938356e-31}; // 9.10938356e-31 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        electron_mass_energy_equivalent{8.18710565e-14}; // 8.18710565e-14 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    electron_molar_mass{5.4857990907e-7}; // 5.48579909070e-7 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_muon_mag_mom_ratio{206.766988}; // 206.7669880
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_muon_mass_ratio{0.0048363317}; // 4.83633170e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         electron_neutron_mag_mom_ratio{960.9205}; // 960.92050
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_neutron_mass_ratio{0.00054386734428}; // 5.4386734428e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          electron_proton_mag_mom_ratio{-658.2106866}; // -658.2106866
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_proton_mass_ratio{0.000544617021352}; // 5.44617021352e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                electron_tau_mass_ratio{0.000287592}; // 2.87592e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  electron_to_alpha_particle_mass_ratio{0.0001370933554798}; // 1.370933554798e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_helion_mag_mom_ratio{864.058257}; // 864.058257
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_proton_mag_mom_ratio{-658.2275971}; // -658.2275971
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_triton_mass_ratio{0.0001819200062203}; // 1.819200062203e-4
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>           alpha_particle_mass_energy_equivalent_in_MeV{5.971920096283645e-10}; // 3727.379378 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>          atomic_mass_constant_energy_equivalent_in_MeV{1.4924180620631248e-10}; // 931.4940954 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 deuteron_mass_energy_equivalent_in_MeV{3.005063182911834e-10}; // 1875.612928 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 electron_mass_energy_equivalent_in_MeV{8.187105646948593e-14}; // 0.5109989461 MeV
+UNIT_CONSTANT Quantity<Unit<-4, -2, 4, 0, 0, 0, 0>>                                Fermi_coupling_constant{454379573748293.4}; // 1.1663787e-5 GeV^-2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             helion_electron_mass_ratio{5495.88527922}; // 5495.88527922
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        helion_g_factor{-4.255250616}; // -4.255250616
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         helion_mag_mom{-1.074617522e-26}; // -1.074617522e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  helion_mag_mom_to_Bohr_magneton_ratio{-0.001158740958}; // -1.158740958e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               helion_mag_mom_to_nuclear_magneton_ratio{-2.127625308}; // -2.127625308
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            helion_mass{5.0064127e-27}; // 5.006412700e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          helion_mass_energy_equivalent{4.499539341e-10}; // 4.499539341e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   helion_mass_energy_equivalent_in_MeV{4.4995393411406323e-10}; // 2808.391586 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      helion_molar_mass{0.00301493224673}; // 3.01493224673e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               helion_proton_mass_ratio{2.99315267046}; // 2.99315267046
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                muon_Compton_wavelength{1.173444111e-14}; // 11.73444111e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      muon_Compton_wavelength_over_2_pi{1.867594308e-15}; // 1.867594308e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               muon_electron_mass_ratio{206.7682826}; // 206.7682826
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                          muon_g_factor{-2.0023318418}; // -2.0023318418
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                           muon_mag_mom{-4.49044826e-26}; // -4.49044826e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                   muon_mag_mom_anomaly{0.00116592089}; // 1.16592089e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    muon_mag_mom_to_Bohr_magneton_ratio{-0.00484197048}; // -4.84197048e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 muon_mag_mom_to_nuclear_magneton_ratio{-8.89059705}; // -8.89059705
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                              muon_mass{1.883531594e-28}; // 1.883531594e-28 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            muon_mass_energy_equivalent{1.692833774e-11}; // 1.692833774e-11 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     muon_mass_energy_equivalent_in_MeV{1.692833774156309e-11}; // 105.6583745 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                        muon_molar_mass{0.0001134289257}; // 0.1134289257e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                muon_neutron_mass_ratio{0.1124545167}; // 0.1124545167
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              muon_proton_mag_mom_ratio{-3.183345142}; // -3.183345142
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 muon_proton_mass_ratio{0.1126095262}; // 0.1126095262
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    muon_tau_mass_ratio{0.0594649}; // 5.94649e-2
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             neutron_Compton_wavelength{1.31959090481e-15}; // 1.31959090481e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                   neutron_Compton_wavelength_over_2_pi{2.1001941536e-16}; // 0.21001941536e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_electron_mag_mom_ratio{0.00104066882}; // 1.04066882e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            neutron_electron_mass_ratio{1838.68366158}; // 1838.68366158
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                       neutron_g_factor{-3.82608545}; // -3.82608545
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                  neutron_gyromag_ratio{183247172.0}; // 1.83247172e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                        neutron_gyromag_ratio_over_2_pi{29164693.3}; // 29.1646933 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                        neutron_mag_mom{-9.662365e-27}; // -0.96623650e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 neutron_mag_mom_to_Bohr_magneton_ratio{-0.00104187563}; // -1.04187563e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              neutron_mag_mom_to_nuclear_magneton_ratio{-1.91304273}; // -1.91304273
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                           neutron_mass{1.674927471e-27}; // 1.674927471e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         neutron_mass_energy_equivalent{1.505349739e-10}; // 1.505349739e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  neutron_mass_energy_equivalent_in_MeV{1.5053497389015495e-10}; // 939.5654133 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                     neutron_molar_mass{0.00100866491588}; // 1.00866491588e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                neutron_muon_mass_ratio{8.89248408}; // 8.89248408
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           neutron_proton_mag_mom_ratio{-0.68497934}; // -0.68497934
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_proton_mass_difference{2.30557377e-30}; // 2.30557377e-30
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       neutron_proton_mass_difference_energy_equivalent{2.07214637e-13}; // 2.07214637e-13
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>neutron_proton_mass_difference_energy_equivalent_in_MeV{1.29333205}; // 1.29333205
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    neutron_proton_mass_difference_in_u{0.001388449}; // 0.00138844900
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              neutron_proton_mass_ratio{1.00137841898}; // 1.00137841898
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 neutron_tau_mass_ratio{0.52879}; // 0.528790
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               neutron_to_shielded_proton_mag_mom_ratio{-0.68499694}; // -0.68499694
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_charge_to_mass_quotient{95788332.26}; // 9.578833226e7 C kg^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              proton_Compton_wavelength{1.32140985396e-15}; // 1.32140985396e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                    proton_Compton_wavelength_over_2_pi{2.10308910109e-16}; // 0.210308910109e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             proton_electron_mass_ratio{1836.15267389}; // 1836.15267389
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        proton_g_factor{5.585694702}; // 5.585694702
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                   proton_gyromag_ratio{267522190.0}; // 2.675221900e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_gyromag_ratio_over_2_pi{42577478.92}; // 42.57747892 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         proton_mag_mom{1.4106067873e-26}; // 1.4106067873e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  proton_mag_mom_to_Bohr_magneton_ratio{0.0015210322053}; // 1.5210322053e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               proton_mag_mom_to_nuclear_magneton_ratio{2.7928473508}; // 2.7928473508
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        proton_mag_shielding_correction{0.000025691}; // 25.691e-6
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            proton_mass{1.672621898e-27}; // 1.672621898e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          proton_mass_energy_equivalent{1.503277593e-10}; // 1.503277593e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   proton_mass_energy_equivalent_in_MeV{1.503277592608217e-10}; // 938.2720813 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      proton_molar_mass{0.001007276466879}; // 1.007276466879e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 proton_muon_mass_ratio{8.88024338}; // 8.88024338
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           proton_neutron_mag_mom_ratio{-1.45989805}; // -1.45989805
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              proton_neutron_mass_ratio{0.99862347844}; // 0.99862347844
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                               proton_rms_charge_radius{8.751e-16}; // 0.8751e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  proton_tau_mass_ratio{0.528063}; // 0.528063
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_helion_gyromag_ratio{203789458.5}; // 2.037894585e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_helion_gyromag_ratio_over_2_pi{32434099.66}; // 32.43409966 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_helion_mag_mom{-1.07455308e-26}; // -1.074553080e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_helion_mag_mom_to_Bohr_magneton_ratio{-0.001158671471}; // -1.158671471e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_helion_mag_mom_to_nuclear_magneton_ratio{-2.12749772}; // -2.127497720
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                shielded_helion_to_proton_mag_mom_ratio{-0.7617665603}; // -0.7617665603
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       shielded_helion_to_shielded_proton_mag_mom_ratio{-0.7617861313}; // -0.7617861313
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_proton_gyromag_ratio{267515317.1}; // 2.675153171e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_proton_gyromag_ratio_over_2_pi{42576385.07}; // 42.57638507 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_proton_mag_mom{1.410570547e-26}; // 1.410570547e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_proton_mag_mom_to_Bohr_magneton_ratio{0.001520993128}; // 1.520993128e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_proton_mag_mom_to_nuclear_magneton_ratio{2.7927756}; // 2.792775600
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 tau_Compton_wavelength{6.97787e-16}; // 0.697787e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       tau_Compton_wavelength_over_2_pi{1.11056e-16}; // 0.111056e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                tau_electron_mass_ratio{3477.15}; // 3477.15
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                               tau_mass{3.16747e-27}; // 3.16747e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             tau_mass_energy_equivalent{2.84678e-10}; // 2.84678e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      tau_mass_energy_equivalent_in_MeV{2.846779463369856e-10}; // 1776.82 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                         tau_molar_mass{0.00190749}; // 1.90749e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    tau_muon_mass_ratio{16.8167}; // 16.8167
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 tau_neutron_mass_ratio{1.89111}; // 1.89111
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  tau_proton_mass_ratio{1.89372}; // 1.89372
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             triton_electron_mass_ratio{5496.92153588}; // 5496.92153588
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        triton_g_factor{5.95792492}; // 5.957924920
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         triton_mag_mom{1.504609503e-26}; // 1.504609503e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  triton_mag_mom_to_Bohr_magneton_ratio{0.0016223936616}; // 1.6223936616e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               triton_mag_mom_to_nuclear_magneton_ratio{2.97896246}; // 2.978962460
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            triton_mass{5.0073566649999996e-27}; // 5.007356665e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          triton_mass_energy_equivalent{4.500387735e-10}; // 4.500387735e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   triton_mass_energy_equivalent_in_MeV{4.500387735317938e-10}; // 2808.921112 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      triton_molar_mass{0.00301550071632}; // 3.01550071632e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               triton_proton_mass_ratio{2.99371703348}; // 2.99371703348
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               alpha_particle_mass_in_u{6.644657229241617e-27}; // 4.001506179127 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     deuteron_mass_in_u{3.3435837188804984e-27}; // 2.013553212745 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     electron_mass_in_u{9.109383555703852e-31}; // 5.48579909070e-4 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       helion_mass_in_u{5.0064126986500775e-27}; // 3.01493224673 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                         muon_mass_in_u{1.8835315939010934e-28}; // 0.1134289257 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                      neutron_mass_in_u{1.674927471097056e-27}; // 1.00866491588 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       proton_mass_in_u{1.6726218973258465e-27}; // 1.007276466879 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          tau_mass_in_u{3.1674616134096e-27}; // 1.90749 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       triton_mass_in_u{5.0073566645973254e-27}; // 3.01550071632 u
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      weak_mixing_angle{0.2223}; // 0.2223
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsRelationships.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    atomic_mass_unit_hertz_relationship{2.2523427206e+23}; // 2.2523427206e23 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>            atomic_mass_unit_inverse_meter_relationship{751300661660000.0}; // 7.5130066166e14 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    atomic_mass_unit_joule_relationship{1.492418062e-10}; // 1.492418062e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                   atomic_mass_unit_kelvin_relationship{10809543800000.0}; // 1.08095438e13 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 atomic_mass_unit_kilogram_relationship{1.66053904e-27}; // 1.660539040e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>            atomic_mass_unit_electron_volt_relationship{1.4924180620631248e-10}; // 931.4940954e6 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       electron_volt_hertz_relationship{241798926200000.0}; // 2.417989262e14 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>               electron_volt_inverse_meter_relationship{806554.4005}; // 8.065544005e5 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       electron_volt_joule_relationship{1.6021766208e-19}; // 1.6021766208e-19 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      electron_volt_kelvin_relationship{11604.5221}; // 1.16045221e4 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    electron_volt_kilogram_relationship{1.782661907e-36}; // 1.782661907e-36 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     hartree_electron_volt_relationship{4.359744650080796e-18}; // 27.21138602 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  atomic_mass_unit_hartree_relationship{1.4924180621125388e-10}; // 3.4231776902e7 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     electron_volt_hartree_relationship{1.6021766207627394e-19}; // 3.674932248e-2 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                             hartree_hertz_relationship{6579683920711000.0}; // 6.579683920711e15 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                     hartree_inverse_meter_relationship{21947463.13702}; // 2.194746313702e7 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hartree_joule_relationship{4.35974465e-18}; // 4.359744650e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                            hartree_kelvin_relationship{315775.13}; // 3.1577513e5 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                          hartree_kilogram_relationship{4.850870129e-35}; // 4.850870129e-35 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       hertz_electron_volt_relationship{6.626070039454996e-34}; // 4.135667662e-15 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hertz_hartree_relationship{6.626070040169986e-34}; // 1.5198298460088e-16 E_h
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       hertz_inverse_meter_relationship{3.335640951e-9}; // 3.335640951e-9 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                               hertz_joule_relationship{6.62607004e-34}; // 6.626070040e-34 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              hertz_kelvin_relationship{4.7992447e-11}; // 4.7992447e-11 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            hertz_kilogram_relationship{7.372497201e-51}; // 7.372497201e-51 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>               inverse_meter_electron_volt_relationship{1.9864458240691038e-25}; // 1.2398419739e-6 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     inverse_meter_hartree_relationship{1.986445824222546e-25}; // 4.556335252767e-8 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       inverse_meter_hertz_relationship{299792458.0}; // 299792458.0 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       inverse_meter_joule_relationship{1.986445824e-25}; // 1.986445824e-25 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      inverse_meter_kelvin_relationship{0.0143877736}; // 1.43877736e-2 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    inverse_meter_kilogram_relationship{2.210219057e-42}; // 2.210219057e-42 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       joule_electron_volt_relationship{1.0000000000187041}; // 6.241509126e18 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             joule_hartree_relationship{1.0000000002865177}; // 2.293712317e17 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                               joule_hertz_relationship{1.509190205e+33}; // 1.509190205e33 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       joule_inverse_meter_relationship{5.034116651e+24}; // 5.034116651e24 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              joule_kelvin_relationship{7.2429731e+22}; // 7.2429731e22 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            joule_kilogram_relationship{1.112650056e-17}; // 1.112650056e-17 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      kelvin_electron_volt_relationship{1.380648514037145e-23}; // 8.6173303e-5 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kelvin_hartree_relationship{1.3806485135194692e-23}; // 3.1668105e-6 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                              kelvin_hertz_relationship{20836612000.0}; // 2.0836612e10 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                      kelvin_inverse_meter_relationship{69.503457}; // 69.503457 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                              kelvin_joule_relationship{1.38064852e-23}; // 1.38064852e-23 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                           kelvin_kilogram_relationship{1.53617865e-40}; // 1.53617865e-40 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    kilogram_electron_volt_relationship{89875517873350340.0}; // 5.609588650e35 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          kilogram_hartree_relationship{89875517880416580.0}; // 2.061485823e34 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                            kilogram_hertz_relationship{1.356392512e+50}; // 1.356392512e50 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                    kilogram_inverse_meter_relationship{4.524438411e+41}; // 4.524438411e41 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kilogram_joule_relationship{89875517870000000.0}; // 8.987551787e16 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                           kilogram_kelvin_relationship{6.5096595e+39}; // 6.5096595e39 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            electron_volt_atomic_mass_unit_relationship{1.782661906647324e-36}; // 1.0735441105e-9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                  hartree_atomic_mass_unit_relationship{4.850870127942811e-35}; // 2.9212623197e-8 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    hertz_atomic_mass_unit_relationship{7.372497199724469e-51}; // 4.4398216616e-24 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            inverse_meter_atomic_mass_unit_relationship{2.210219057082413e-42}; // 1.33102504900e-15 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    joule_atomic_mass_unit_relationship{1.1126500559162071e-17}; // 6.700535363e9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                   kelvin_atomic_mass_unit_relationship{1.5361786476427168e-40}; // 9.2510842e-14 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 kilogram_atomic_mass_unit_relationship{0.9999999997427558}; // 6.022140857e26 u
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstantsUncertainties.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+namespace unit {
+namespace physicalConstant{
+
+namespace uncertaintiy{
+
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       c_220_lattice_spacing_of_silicon{3.2e-18}; // 0.0000032e-12 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                     alpha_particle_electron_mass_ratio{2.4e-7}; // 0.00000024
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    alpha_particle_mass{8.2e-35}; // 0.000000082e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  alpha_particle_mass_energy_equivalent{7.3e-18}; // 0.000000073e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                              alpha_particle_molar_mass{6.3e-14}; // 0.000000000063e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                       alpha_particle_proton_mass_ratio{3.6e-10}; // 0.00000000036
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Angstrom_star{9e-17}; // 0.00000090e-10 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   atomic_mass_constant{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 atomic_mass_constant_energy_equivalent{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                    atomic_mass_unit_hertz_relationship{100000000000000.0}; // 0.0000000010e23 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>            atomic_mass_unit_inverse_meter_relationship{340000.0}; // 0.0000000034e14 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    atomic_mass_unit_joule_relationship{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                   atomic_mass_unit_kelvin_relationship{6200000.0}; // 0.00000062e13 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 atomic_mass_unit_kilogram_relationship{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<-1, -2, 7, 3, 0, 0, 0>>                 atomic_unit_of_1st_hyperpolarizability{2e-61}; // 0.000000020e-53 C^3 m^3 J^-2
+UNIT_CONSTANT Quantity<Unit<-2, -3, 10, 4, 0, 0, 0>>                 atomic_unit_of_2nd_hyperpolarizability{7.7e-73}; // 0.000000077e-65 C^4 m^4 J^-3
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_action{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                  atomic_unit_of_charge{9.8e-28}; // 0.0000000098e-19 C
+UNIT_CONSTANT Quantity<Unit<-3, 0, 1, 1, 0, 0, 0>>                          atomic_unit_of_charge_density{6700.0}; // 0.0000000067e12 C m^-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 1, 0, 0, 0>>                                 atomic_unit_of_current{4.1e-11}; // 0.000000041e-3 A
+UNIT_CONSTANT Quantity<Unit<1, 0, 1, 1, 0, 0, 0>>                     atomic_unit_of_electric_dipole_mom{5.2e-38}; // 0.000000052e-30 C m
+UNIT_CONSTANT Quantity<Unit<1, 1, -3, -1, 0, 0, 0>>                          atomic_unit_of_electric_field{3200.0}; // 0.000000032e11 V m^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, -1, 0, 0, 0>>                 atomic_unit_of_electric_field_gradient{60000000000000.0}; // 0.000000060e21 V m^-2
+UNIT_CONSTANT Quantity<Unit<0, -1, 4, 2, 0, 0, 0>>                 atomic_unit_of_electric_polarizability{1.1e-50}; // 0.0000000011e-41 C^2 m^2 J^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -1, 0, 0, 0>>                      atomic_unit_of_electric_potential{1.7e-7}; // 0.00000017 V
+UNIT_CONSTANT Quantity<Unit<2, 0, 1, 1, 0, 0, 0>>                 atomic_unit_of_electric_quadrupole_mom{2.8e-48}; // 0.000000028e-40 C m^2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                  atomic_unit_of_energy{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, 0, 0, 0, 0>>                                   atomic_unit_of_force{1e-15}; // 0.00000010e-8 N
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                  atomic_unit_of_length{1.2e-20}; // 0.00000000012e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                          atomic_unit_of_mag_dipole_mom{1.1e-31}; // 0.000000011e-23 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, -2, -1, 0, 0, 0>>                        atomic_unit_of_mag_flux_density{0.0014}; // 0.000000014e5 T
+UNIT_CONSTANT Quantity<Unit<2, -1, 2, 2, 0, 0, 0>>                         atomic_unit_of_magnetizability{9e-38}; // 0.0000000090e-29 J T^-2
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                    atomic_unit_of_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                  atomic_unit_of_mom_um{2.4e-32}; // 0.000000024e-24 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                            atomic_unit_of_permittivity{0.0}; // 0.0 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                    atomic_unit_of_time{1.4e-28}; // 0.000000000014e-17 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                                atomic_unit_of_velocity{0.0005}; // 0.00000000050e6 m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, -1, 0>>                                      Avogadro_constant{7400000000000000.0}; // 0.000000074e23 mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                          Bohr_magneton{5.7e-32}; // 0.0000057e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                              Bohr_magneton_in_Hz_per_T{86.0}; // 0.000000086e9 Hz T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>              Bohr_magneton_in_inverse_meters_per_tesla{2.9e-7}; // 0.00000029 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                               Bohr_magneton_in_K_per_T{3.9e-7}; // 0.00000039 K T^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                            Bohr_radius{1.2e-20}; // 0.00000000012e-10 m
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                                     Boltzmann_constant{7.9e-30}; // 0.00000079e-23 J K^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>                         Boltzmann_constant_in_Hz_per_K{12000.0}; // 0.0000012e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, -1, 0, 0>>        Boltzmann_constant_in_inverse_meters_per_kelvin{0.00004}; // 0.000040 m^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                     characteristic_impedance_of_vacuum{0.0}; // 0.0 ohm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              classical_electron_radius{1.9e-24}; // 0.0000000019e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                     Compton_wavelength{1.1e-21}; // 0.0000000011e-12 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           Compton_wavelength_over_2_pi{1.8e-22}; // 0.00000018e-15 m
+UNIT_CONSTANT Quantity<Unit<-2, -1, 3, 2, 0, 0, 0>>                                    conductance_quantum{1.8e-14}; // 0.0000000018e-5 S
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>               conventional_value_of_Josephson_constant{0.0}; // 0.0 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>            conventional_value_of_von_Klitzing_constant{0.0}; // 0.0 ohm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Cu_x_unit{2.8e-20}; // 0.00000028e-13 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        deuteron_electron_mag_mom_ratio{2.6e-12}; // 0.000000026e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           deuteron_electron_mass_ratio{1.3e-7}; // 0.00000013
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      deuteron_g_factor{4.8e-9}; // 0.0000000048
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       deuteron_mag_mom{3.6e-35}; // 0.0000000036e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                deuteron_mag_mom_to_Bohr_magneton_ratio{2.6e-12}; // 0.0000000026e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             deuteron_mag_mom_to_nuclear_magneton_ratio{4.8e-9}; // 0.0000000048
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          deuteron_mass{4.1e-35}; // 0.000000041e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        deuteron_mass_energy_equivalent{3.7e-18}; // 0.000000037e-10 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    deuteron_molar_mass{4e-14}; // 0.000000000040e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         deuteron_neutron_mag_mom_ratio{1.1e-7}; // 0.00000011
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          deuteron_proton_mag_mom_ratio{1.5e-9}; // 0.0000000015
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             deuteron_proton_mass_ratio{1.9e-10}; // 0.00000000019
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             deuteron_rms_charge_radius{2.5e-18}; // 0.0025e-15 m
+UNIT_CONSTANT Quantity<Unit<-3, -1, 4, 2, 0, 0, 0>>                                      electric_constant{0.0}; // 0.0 F m^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_charge_to_mass_quotient{1100.0}; // 0.000000011e11 C kg^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        electron_deuteron_mag_mom_ratio{0.000012}; // 0.000012
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           electron_deuteron_mass_ratio{9.6e-15}; // 0.000000000096e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      electron_g_factor{5.2e-13}; // 0.00000000000052
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                 electron_gyromag_ratio{1100.0}; // 0.000000011e11 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                       electron_gyromag_ratio_over_2_pi{170.0}; // 0.00017 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_helion_mass_ratio{8.8e-15}; // 0.000000000088e-4
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       electron_mag_mom{5.7e-32}; // 0.0000057e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_mag_mom_anomaly{2.6e-13}; // 0.00000000026e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                electron_mag_mom_to_Bohr_magneton_ratio{2.6e-13}; // 0.00000000000026
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>             electron_mag_mom_to_nuclear_magneton_ratio{1.7e-7}; // 0.00000017
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          electron_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        electron_mass_energy_equivalent{1e-21}; // 0.00000010e-14 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    electron_molar_mass{1.6e-17}; // 0.00000000016e-7 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_muon_mag_mom_ratio{4.6e-6}; // 0.0000046
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               electron_muon_mass_ratio{1.1e-10}; // 0.00000011e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         electron_neutron_mag_mom_ratio{0.00023}; // 0.00023
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            electron_neutron_mass_ratio{2.7e-13}; // 0.0000000027e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                          electron_proton_mag_mom_ratio{2e-6}; // 0.0000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_proton_mass_ratio{5.2e-14}; // 0.00000000052e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                electron_tau_mass_ratio{2.6e-8}; // 0.00026e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  electron_to_alpha_particle_mass_ratio{4.5e-15}; // 0.000000000045e-4
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_helion_mag_mom_ratio{0.00001}; // 0.000010
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              electron_to_shielded_proton_mag_mom_ratio{7.2e-6}; // 0.0000072
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             electron_triton_mass_ratio{8.4e-15}; // 0.000000000084e-4
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                          electron_volt{9.8e-28}; // 0.0000000098e-19 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>           alpha_particle_mass_energy_equivalent_in_MeV{3.68500622784e-18}; // 0.000023 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>          atomic_mass_constant_energy_equivalent_in_MeV{9.13240673856e-19}; // 0.0000057 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>            atomic_mass_unit_electron_volt_relationship{9.13240673856e-19}; // 0.0000057e6 eV
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                              Bohr_magneton_in_eV_per_T{4.16565921408e-33}; // 0.0000000026e-5 eV T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, 0, 0>>                         Boltzmann_constant_in_eV_per_K{8.010883104e-30}; // 0.0000050e-5 eV K^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 deuteron_mass_energy_equivalent_in_MeV{1.92261194496e-18}; // 0.000012 MeV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                 electron_mass_energy_equivalent_in_MeV{4.96674752448e-22}; // 0.0000000031 MeV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       electron_volt_hertz_relationship{1500000.0}; // 0.000000015e14 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>               electron_volt_inverse_meter_relationship{0.005}; // 0.000000050e5 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       electron_volt_joule_relationship{9.8e-28}; // 0.0000000098e-19 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      electron_volt_kelvin_relationship{0.0067}; // 0.00000067e4 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    electron_volt_kilogram_relationship{1.1e-44}; // 0.000000011e-36 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, 0, 0>>                                      elementary_charge{9.8e-28}; // 0.0000000098e-19 C
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                               elementary_charge_over_h{1500000.0}; // 0.000000015e14 A J^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -1, 0>>                                       Faraday_constant{0.00059}; // 0.00059 C mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 1, 0, -2, 0>>     Faraday_constant_for_conventional_electric_current{0.0012}; // 0.0012 C_90 mol^-1
+UNIT_CONSTANT Quantity<Unit<-4, -2, 4, 0, 0, 0, 0>>                                Fermi_coupling_constant{233738617.01090395}; // 0.0000006e-5 GeV^-2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                fine_structure_constant{1.7e-12}; // 0.0000000017e-3
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>                               first_radiation_constant{4.6e-24}; // 0.000000046e-16 W m^2
+UNIT_CONSTANT Quantity<Unit<4, 1, -3, 0, 0, 0, 0>>         first_radiation_constant_for_spectral_radiance{1.5e-24}; // 0.000000015e-16 W m^2 sr^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     hartree_electron_volt_relationship{2.72370025536e-26}; // 0.00000017 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  atomic_mass_unit_hartree_relationship{6.975591440129274e-20}; // 0.0000000016e7 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     electron_volt_hartree_relationship{1.0027412695185831e-27}; // 0.000000023e-2 E_h
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                         Hartree_energy{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                   Hartree_energy_in_eV{2.72370025536e-26}; // 0.00000017 eV
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                             hartree_hertz_relationship{39000.0}; // 0.000000000039e15 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                     hartree_inverse_meter_relationship{0.00013}; // 0.000000000013e7 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hartree_joule_relationship{5.4e-26}; // 0.000000054e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                            hartree_kelvin_relationship{0.18}; // 0.0000018e5 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                          hartree_kilogram_relationship{6e-43}; // 0.000000060e-35 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             helion_electron_mass_ratio{2.7e-7}; // 0.00000027
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        helion_g_factor{5e-8}; // 0.000000050
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         helion_mag_mom{1.4e-34}; // 0.000000014e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  helion_mag_mom_to_Bohr_magneton_ratio{1.4e-11}; // 0.000000014e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               helion_mag_mom_to_nuclear_magneton_ratio{2.5e-8}; // 0.000000025
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            helion_mass{6.2e-35}; // 0.000000062e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          helion_mass_energy_equivalent{5.5e-18}; // 0.000000055e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   helion_mass_energy_equivalent_in_MeV{2.72370025536e-18}; // 0.000017 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      helion_molar_mass{1.2e-13}; // 0.00000000012e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               helion_proton_mass_ratio{2.9e-10}; // 0.00000000029
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       hertz_electron_volt_relationship{4.005441552e-42}; // 0.000000025e-15 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             hertz_hartree_relationship{3.923770185072716e-45}; // 0.0000000000090e-16 E_h
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       hertz_inverse_meter_relationship{0.0}; // 0.0 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                               hertz_joule_relationship{8.1e-42}; // 0.000000081e-34 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              hertz_kelvin_relationship{2.8e-17}; // 0.0000028e-11 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            hertz_kilogram_relationship{9.1e-59}; // 0.000000091e-51 kg
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        inverse_fine_structure_constant{3.1e-8}; // 0.000000031
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>               inverse_meter_electron_volt_relationship{1.217654231808e-33}; // 0.0000000076e-6 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     inverse_meter_hartree_relationship{1.177131055521815e-36}; // 0.000000000027e-8 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                       inverse_meter_hertz_relationship{0.0}; // 0.0 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       inverse_meter_joule_relationship{2.4e-33}; // 0.000000024e-25 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                      inverse_meter_kelvin_relationship{8.3e-9}; // 0.00000083e-2 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    inverse_meter_kilogram_relationship{2.7e-50}; // 0.000000027e-42 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                         inverse_of_conductance_quantum{2.9e-6}; // 0.0000029 ohm
+UNIT_CONSTANT Quantity<Unit<-2, -1, 2, 1, 0, 0, 0>>                                     Josephson_constant{3000000.0}; // 0.0030e9 Hz V^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                       joule_electron_volt_relationship{6.08827115904e-9}; // 0.000000038e18 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             joule_hartree_relationship{1.220728502022623e-8}; // 0.000000028e17 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                               joule_hertz_relationship{1.9e+25}; // 0.000000019e33 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                       joule_inverse_meter_relationship{62000000000000000.0}; // 0.000000062e24 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                              joule_kelvin_relationship{42000000000000000.0}; // 0.0000042e22 K
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                            joule_kilogram_relationship{0.0}; // 0.0 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      kelvin_electron_volt_relationship{8.010883104e-30}; // 0.0000050e-5 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kelvin_hartree_relationship{7.847540370145433e-30}; // 0.0000018e-6 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                              kelvin_hertz_relationship{12000.0}; // 0.0000012e10 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                      kelvin_inverse_meter_relationship{0.00004}; // 0.000040 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                              kelvin_joule_relationship{7.9e-30}; // 0.00000079e-23 J
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                           kelvin_kilogram_relationship{8.8e-47}; // 0.00000088e-40 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                    kilogram_electron_volt_relationship{544740051.072}; // 0.000000034e35 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          kilogram_hartree_relationship{1089936162.520199}; // 0.000000025e34 E_h
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                            kilogram_hertz_relationship{1.7e+42}; // 0.000000017e50 Hz
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                    kilogram_inverse_meter_relationship{5.6e+33}; // 0.000000056e41 m^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            kilogram_joule_relationship{0.0}; // 0.0 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                           kilogram_kelvin_relationship{3.7e+33}; // 0.0000037e39 K
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                           lattice_parameter_of_silicon{8.9e-18}; // 0.0000089e-12 m
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                    Loschmidt_constant_273_15_K_100_kPa{15000000000000000000.0}; // 0.0000015e25 m^-3
+UNIT_CONSTANT Quantity<Unit<-3, 0, 0, 0, 0, 0, 0>>                Loschmidt_constant_273_15_K_101_325_kPa{15000000000000000000.0}; // 0.0000015e25 m^-3
+UNIT_CONSTANT Quantity<Unit<1, 1, -2, -2, 0, 0, 0>>                                           mag_constant{0.0}; // 0.0 N A^-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, -1, 0, 0, 0>>                                       mag_flux_quantum{1.3e-23}; // 0.000000013e-15 Wb
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, -1, -1, 0>>                                     molar_gas_constant{4.8e-6}; // 0.0000048 J mol^-1 K^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                    molar_mass_constant{0.0}; // 0.0 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                molar_mass_of_carbon_12{0.0}; // 0.0 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, -1, 0>>                                  molar_Planck_constant{1.8e-19}; // 0.0000000018e-10 J s mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, -1, 0>>                          molar_Planck_constant_times_c{5.4e-11}; // 0.000000000054 J m mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>             molar_volume_of_ideal_gas_273_15_K_100_kPa{1.3e-8}; // 0.000013e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>         molar_volume_of_ideal_gas_273_15_K_101_325_kPa{1.3e-8}; // 0.000013e-3 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<3, 0, 0, 0, 0, -1, 0>>                                molar_volume_of_silicon{6.1e-13}; // 0.00000061e-6 m^3 mol^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                              Mo_x_unit{5.3e-20}; // 0.00000053e-13 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                muon_Compton_wavelength{2.6e-22}; // 0.00000026e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                      muon_Compton_wavelength_over_2_pi{4.2e-23}; // 0.000000042e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               muon_electron_mass_ratio{4.6e-6}; // 0.0000046
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                          muon_g_factor{1.3e-9}; // 0.0000000013
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                           muon_mag_mom{1e-33}; // 0.00000010e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                   muon_mag_mom_anomaly{6.3e-10}; // 0.00000063e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    muon_mag_mom_to_Bohr_magneton_ratio{1.1e-10}; // 0.00000011e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 muon_mag_mom_to_nuclear_magneton_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                              muon_mass{4.8e-36}; // 0.000000048e-28 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                            muon_mass_energy_equivalent{4.3e-19}; // 0.000000043e-11 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                     muon_mass_energy_equivalent_in_MeV{3.84522388992e-19}; // 0.0000024 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                        muon_molar_mass{2.5e-12}; // 0.0000000025e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                muon_neutron_mass_ratio{2.5e-9}; // 0.0000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              muon_proton_mag_mom_ratio{7.1e-8}; // 0.000000071
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 muon_proton_mass_ratio{2.5e-9}; // 0.0000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    muon_tau_mass_ratio{5.4e-6}; // 0.00054e-2
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_action{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                         natural_unit_of_action_in_eV_s{6.4087064832e-43}; // 0.000000040e-16 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                                 natural_unit_of_energy{1e-21}; // 0.00000010e-14 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          natural_unit_of_energy_in_MeV{4.96674752448e-22}; // 0.0000000031 MeV
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 natural_unit_of_length{1.8e-22}; // 0.00000018e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                   natural_unit_of_mass{1.1e-38}; // 0.00000011e-31 kg
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                                 natural_unit_of_mom_um{3.4e-30}; // 0.000000034e-22 kg m s^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                   natural_unit_of_time{5.8e-31}; // 0.00000000058e-21 s
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               natural_unit_of_velocity{0.0}; // 0.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                             neutron_Compton_wavelength{8.8e-25}; // 0.00000000088e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                   neutron_Compton_wavelength_over_2_pi{1.4e-25}; // 0.00000000014e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_electron_mag_mom_ratio{2.5e-10}; // 0.00000025e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                            neutron_electron_mass_ratio{9e-7}; // 0.00000090
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                       neutron_g_factor{9e-7}; // 0.00000090
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                  neutron_gyromag_ratio{43.0}; // 0.00000043e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                        neutron_gyromag_ratio_over_2_pi{6.9}; // 0.0000069 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                        neutron_mag_mom{2.3e-33}; // 0.00000023e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                 neutron_mag_mom_to_Bohr_magneton_ratio{2.5e-10}; // 0.00000025e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>              neutron_mag_mom_to_nuclear_magneton_ratio{4.5e-7}; // 0.00000045
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                           neutron_mass{2.1e-35}; // 0.000000021e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         neutron_mass_energy_equivalent{1.9e-18}; // 0.000000019e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                  neutron_mass_energy_equivalent_in_MeV{9.29262440064e-19}; // 0.0000058 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                     neutron_molar_mass{4.9e-13}; // 0.00000000049e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                neutron_muon_mass_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           neutron_proton_mag_mom_ratio{1.6e-7}; // 0.00000016
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                         neutron_proton_mass_difference{8.5e-37}; // 0.00000085e-30
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       neutron_proton_mass_difference_energy_equivalent{7.6e-20}; // 0.00000076e-13
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>neutron_proton_mass_difference_energy_equivalent_in_MeV{4.8e-7}; // 0.00000048
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    neutron_proton_mass_difference_in_u{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              neutron_proton_mass_ratio{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 neutron_tau_mass_ratio{0.000048}; // 0.000048
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               neutron_to_shielded_proton_mag_mom_ratio{1.6e-7}; // 0.00000016
+UNIT_CONSTANT Quantity<Unit<3, -1, -2, 0, 0, 0, 0>>                      Newtonian_constant_of_gravitation{3.1e-15}; // 0.00031e-11 m^3 kg^-1 s^-2
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                       nuclear_magneton{3.1e-35}; // 0.000000031e-27 J T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                           nuclear_magneton_in_eV_per_T{2.4032649312e-36}; // 0.0000000015e-8 eV T^-1
+UNIT_CONSTANT Quantity<Unit<-1, -1, 2, 1, 0, 0, 0>>           nuclear_magneton_in_inverse_meters_per_tesla{1.6e-10}; // 0.000000016e-2 m^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 2, 1, 1, 0, 0>>                            nuclear_magneton_in_K_per_T{2.1e-10}; // 0.0000021e-4 K T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          nuclear_magneton_in_MHz_per_T{0.047}; // 0.000000047 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                        Planck_constant{8.1e-42}; // 0.000000081e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                                Planck_constant_in_eV_s{4.005441552e-42}; // 0.000000025e-15 eV s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                              Planck_constant_over_2_pi{1.3e-42}; // 0.000000013e-34 J s
+UNIT_CONSTANT Quantity<Unit<2, 1, -1, 0, 0, 0, 0>>                      Planck_constant_over_2_pi_in_eV_s{6.4087064832e-43}; // 0.000000040e-16 eV s
+UNIT_CONSTANT Quantity<Unit<3, 1, -2, 0, 0, 0, 0>>            Planck_constant_over_2_pi_times_c_in_MeV_fm{1.92261194496e-34}; // 0.0000012 MeV fm
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                          Planck_length{3.8e-40}; // 0.000038e-35 m
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            Planck_mass{5.1e-13}; // 0.000051e-8 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   Planck_mass_energy_equivalent_in_GeV{46463.1220032}; // 0.000029e19 GeV
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 1, 0, 0>>                                     Planck_temperature{3.3e+27}; // 0.000033e32 K
+UNIT_CONSTANT Quantity<Unit<0, 0, 1, 0, 0, 0, 0>>                                            Planck_time{1.3e-48}; // 0.00013e-44 s
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_charge_to_mass_quotient{0.59}; // 0.000000059e7 C kg^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                              proton_Compton_wavelength{6.1e-25}; // 0.00000000061e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                    proton_Compton_wavelength_over_2_pi{9.7e-26}; // 0.000000000097e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             proton_electron_mass_ratio{1.7e-7}; // 0.00000017
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        proton_g_factor{1.7e-8}; // 0.000000017
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                                   proton_gyromag_ratio{1.8}; // 0.000000018e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                         proton_gyromag_ratio_over_2_pi{0.29}; // 0.00000029 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         proton_mag_mom{9.7e-35}; // 0.0000000097e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  proton_mag_mom_to_Bohr_magneton_ratio{4.6e-12}; // 0.0000000046e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               proton_mag_mom_to_nuclear_magneton_ratio{8.5e-9}; // 0.0000000085
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                        proton_mag_shielding_correction{1.1e-8}; // 0.011e-6
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            proton_mass{2.1e-35}; // 0.000000021e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          proton_mass_energy_equivalent{1.8e-18}; // 0.000000018e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   proton_mass_energy_equivalent_in_MeV{9.29262440064e-19}; // 0.0000058 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      proton_molar_mass{9.1e-14}; // 0.000000000091e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 proton_muon_mass_ratio{2e-7}; // 0.00000020
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                           proton_neutron_mag_mom_ratio{3.4e-7}; // 0.00000034
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                              proton_neutron_mass_ratio{5.1e-10}; // 0.00000000051
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                               proton_rms_charge_radius{6.1e-18}; // 0.0061e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  proton_tau_mass_ratio{0.000048}; // 0.000048
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                                 quantum_of_circulation{1.7e-13}; // 0.0000000017e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, -1, 0, 0, 0, 0>>                         quantum_of_circulation_times_2{3.3e-13}; // 0.0000000033e-4 m^2 s^-1
+UNIT_CONSTANT Quantity<Unit<-1, 0, 0, 0, 0, 0, 0>>                                       Rydberg_constant{0.000065}; // 0.000065 m^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, 0, 0, 0>>                         Rydberg_constant_times_c_in_Hz{19000.0}; // 0.000000000019e15 Hz
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                        Rydberg_constant_times_hc_in_eV{1.345828361472e-26}; // 0.000000084 eV
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                         Rydberg_constant_times_hc_in_J{2.7e-26}; // 0.000000027e-18 J
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                    Sackur_Tetrode_constant_1_K_100_kPa{1.4e-6}; // 0.0000014
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                Sackur_Tetrode_constant_1_K_101_325_kPa{1.4e-6}; // 0.0000014
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>                              second_radiation_constant{8.3e-9}; // 0.00000083e-2 m K
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_helion_gyromag_ratio{2.7}; // 0.000000027e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_helion_gyromag_ratio_over_2_pi{0.43}; // 0.00000043 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_helion_mag_mom{1.4e-34}; // 0.000000014e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_helion_mag_mom_to_Bohr_magneton_ratio{1.4e-11}; // 0.000000014e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_helion_mag_mom_to_nuclear_magneton_ratio{2.5e-8}; // 0.000000025
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                shielded_helion_to_proton_mag_mom_ratio{9.2e-9}; // 0.0000000092
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>       shielded_helion_to_shielded_proton_mag_mom_ratio{3.3e-9}; // 0.0000000033
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                          shielded_proton_gyromag_ratio{3.3}; // 0.000000033e8 s^-1 T^-1
+UNIT_CONSTANT Quantity<Unit<0, -1, 1, 1, 0, 0, 0>>                shielded_proton_gyromag_ratio_over_2_pi{0.53}; // 0.00000053 MHz T^-1
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                shielded_proton_mag_mom{1.8e-34}; // 0.000000018e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>         shielded_proton_mag_mom_to_Bohr_magneton_ratio{1.7e-11}; // 0.000000017e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>      shielded_proton_mag_mom_to_nuclear_magneton_ratio{3e-8}; // 0.000000030
+UNIT_CONSTANT Quantity<Unit<1, 0, -1, 0, 0, 0, 0>>                               speed_of_light_in_vacuum{0.0}; // 0.0 m s^-1
+UNIT_CONSTANT Quantity<Unit<1, 1, -1, 0, 0, 0, 0>>                    natural_unit_of_mom_um_in_MeV_per_c{1.6567286440808328e-30}; // 0.0000000031 MeV/c
+UNIT_CONSTANT Quantity<Unit<0, -2, 0, 0, 0, 0, 0>>         Newtonian_constant_of_gravitation_over_h_bar_c{97549202949.56679}; // 0.00031e-39 (GeV/c^2)^-2
+UNIT_CONSTANT Quantity<Unit<1, 0, -2, 0, 0, 0, 0>>                       standard_acceleration_of_gravity{0.0}; // 0.0 m s^-2
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                    standard_atmosphere{0.0}; // 0.0 Pa
+UNIT_CONSTANT Quantity<Unit<-1, 1, -2, 0, 0, 0, 0>>                                standard_state_pressure{0.0}; // 0.0 Pa
+UNIT_CONSTANT Quantity<Unit<0, 1, -3, 0, -4, 0, 0>>                              Stefan_Boltzmann_constant{1.3e-13}; // 0.000013e-8 W m^-2 K^-4
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                                 tau_Compton_wavelength{6.3e-20}; // 0.000063e-15 m
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 0, 0, 0>>                       tau_Compton_wavelength_over_2_pi{1e-20}; // 0.000010e-15 m
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                tau_electron_mass_ratio{0.31}; // 0.31
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                               tau_mass{2.9e-31}; // 0.00029e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                             tau_mass_energy_equivalent{2.6e-14}; // 0.00026e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                      tau_mass_energy_equivalent_in_MeV{2.56348259328e-14}; // 0.16 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                         tau_molar_mass{1.7e-7}; // 0.00017e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                    tau_muon_mass_ratio{0.0015}; // 0.0015
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                 tau_neutron_mass_ratio{0.00017}; // 0.00017
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                  tau_proton_mass_ratio{0.00017}; // 0.00017
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 0, 0, 0, 0>>                                  Thomson_cross_section{9.1e-38}; // 0.00000000091e-28 m^2
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                             triton_electron_mass_ratio{2.6e-7}; // 0.00000026
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                        triton_g_factor{2.8e-8}; // 0.000000028
+UNIT_CONSTANT Quantity<Unit<2, 0, 0, 1, 0, 0, 0>>                                         triton_mag_mom{1.2e-34}; // 0.000000012e-26 J T^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                  triton_mag_mom_to_Bohr_magneton_ratio{7.6e-12}; // 0.0000000076e-3
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>               triton_mag_mom_to_nuclear_magneton_ratio{1.4e-8}; // 0.000000014
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                            triton_mass{6.2e-35}; // 0.000000062e-27 kg
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                          triton_mass_energy_equivalent{5.5e-18}; // 0.000000055e-10 J
+UNIT_CONSTANT Quantity<Unit<2, 1, -2, 0, 0, 0, 0>>                   triton_mass_energy_equivalent_in_MeV{2.72370025536e-18}; // 0.000017 MeV
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, -1, 0>>                                      triton_molar_mass{1.1e-13}; // 0.00000000011e-3 kg mol^-1
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                               triton_proton_mass_ratio{2.2e-10}; // 0.00000000022
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               unified_atomic_mass_unit{2e-35}; // 0.000000020e-27 kg
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                               alpha_particle_mass_in_u{1.0461395952e-37}; // 0.000000000063 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     deuteron_mass_in_u{6.64215616e-38}; // 0.000000000040 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                     electron_mass_in_u{2.656862464e-41}; // 0.00000000016e-4 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            electron_volt_atomic_mass_unit_relationship{1.0959557664e-44}; // 0.0000000066e-9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                  hartree_atomic_mass_unit_relationship{2.158700752e-44}; // 0.0000000013e-8 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       helion_mass_in_u{1.992646848e-37}; // 0.00000000012 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    hertz_atomic_mass_unit_relationship{3.32107808e-60}; // 0.0000000020e-24 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>            inverse_meter_atomic_mass_unit_relationship{1.0129288144e-51}; // 0.00000000061e-15 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                    joule_atomic_mass_unit_relationship{1.3616420128e-25}; // 0.000000082e9 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                   kelvin_atomic_mass_unit_relationship{8.800856912e-47}; // 0.0000053e-14 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                 kilogram_atomic_mass_unit_relationship{1.2287988896e-8}; // 0.000000074e26 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                         muon_mass_in_u{4.1513476e-36}; // 0.0000000025 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                      neutron_mass_in_u{8.136641296e-37}; // 0.00000000049 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       proton_mass_in_u{1.5110905264e-37}; // 0.000000000091 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                          tau_mass_in_u{2.822916368e-31}; // 0.00017 u
+UNIT_CONSTANT Quantity<Unit<0, 1, 0, 0, 0, 0, 0>>                                       triton_mass_in_u{1.826592944e-37}; // 0.00000000011 u
+UNIT_CONSTANT Quantity<Unit<2, 1, -3, -2, 0, 0, 0>>                                  von_Klitzing_constant{5.9e-6}; // 0.0000059 ohm
+UNIT_CONSTANT Quantity<Unit<0, 0, 0, 0, 0, 0, 0>>                                      weak_mixing_angle{0.0021}; // 0.0021
+UNIT_CONSTANT Quantity<Unit<0, 0, -1, 0, -1, 0, 0>>               Wien_frequency_displacement_law_constant{34000.0}; // 0.0000034e10 Hz K^-1
+UNIT_CONSTANT Quantity<Unit<1, 0, 0, 0, 1, 0, 0>>              Wien_wavelength_displacement_law_constant{1.7e-9}; // 0.0000017e-3 m K
+
+}// namespace uncertaintiy
+
+}// namespace physicalConstant
+}// namespace unit
+
+// tools/pysConstsantsGeneration/generated/physicalConstants.h
+/**********************generated from http://physics.nist.gov/constants**********************/
+
+// all constants, include the headers of single domains to compile less
+
+}
@@ -0,0 +1,1612 @@
+// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit
+
+export module units:core;
+
+import <complex>;
+import <cstddef>;
+import <cstdint>;
+import <cstring>;
+import <ctgmath>;
+import <ostream>;
+import <ratio>;
+import <type_traits>;
+import <utility>;
+
+export {
+
+// src/unit/unitTypes.h
+namespace unit {
+
+using TExponent = int;
+using ExponentIndex = int;  // cannot be unsigned since UnitOperator uses -1 for recursion abortion
+using DimensionIndex = int;
+}
+
+// src/unit/unitHelper.h
+namespace unit {
+
+template <TExponent... dimensionExponents>
+struct Unit;
+
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit;
+
+namespace helper {
+
+// helper to shorten access
+template <typename Unit, ExponentIndex i>
+constexpr TExponent exponent() {
+    return Unit::template exponent_value<i>();
+}
+
+constexpr TExponent gcd(TExponent a, TExponent b) {
+    return b == 0 ? (a < 0 ? -a : a) : gcd(b, a % b);
+}
+
+namespace nthElement {
+
+using Index = unsigned int;
+
+template <Index n, TExponent Arg, TExponent... Args>
+struct NthElement {
+    static constexpr int value() { return NthElement<n - 1, Args...>::value(); }
+};
+
+template <TExponent Arg, TExponent... Args>
+struct NthElement<0, Arg, Args...> {
+    static constexpr int value() { return Arg; }
+};
+}
+
+namespace rational {
+
+template <TExponent... values>
+struct Gcd {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <TExponent v, TExponent... values>
+struct Gcd<v, values...> {
+    static constexpr TExponent value() { return gcd(v, Gcd<values...>::value()); }
+};
+}
+
+namespace baseunit {
+
+template <DimensionIndex it, DimensionIndex index, TExponent... exponents>
+struct BaseUnitGen {
+    using type = typename BaseUnitGen<it - 1, index, it == index ? 1 : 0, exponents...>::type;
+};
+
+template <DimensionIndex index, TExponent... exponents>
+struct BaseUnitGen<-1, index, exponents...> {
+    using type = Unit<exponents...>;
+};
+
+// the base unit of dimension index in the unit system of U, specialized by other unit representations
+template <typename U, DimensionIndex index>
+struct BaseUnitOf {
+    using type = typename BaseUnitGen<U::exponent_count() - 1, index>::type;
+};
+}
+
+// U as Unit<exponents...>, specialized by other unit representations
+template <typename U>
+struct DenseUnit;
+
+template <TExponent... exponents>
+struct DenseUnit<Unit<exponents...>> {
+    using type = Unit<exponents...>;
+};
+
+// whether U1 and U2 are different representations of the same unit, eg a SparseUnit and a Unit
+template <typename U1, typename U2>
+struct EquivalentUnits {
+    template <typename A, typename B>
+    static constexpr bool dense(typename DenseUnit<A>::type*, typename DenseUnit<B>::type*) {
+        return std::is_same<typename DenseUnit<A>::type, typename DenseUnit<B>::type>::value;
+    }
+
+    // representations without a DenseUnit, like RationalUnit
+    template <typename A, typename B>
+    static constexpr bool dense(...) {
+        return false;
+    }
+
+    static constexpr bool value() { return !std::is_same<U1, U2>::value && dense<U1, U2>(nullptr, nullptr); }
+};
+
+// the unit whose print_unit prints U, specialized by representations printed like another one
+template <typename U>
+struct PrintedAs {
+    using type = U;
+};
+}
+
+template <int dimension, int lastDimension>
+using BaseUnit = typename helper::baseunit::BaseUnitGen<lastDimension, dimension>::type;
+}
+
+// src/quantity/Quantity.h
+// the default magnitude type, can be defined before the first include
+#ifndef UNIT_BASETYPE
+#define UNIT_BASETYPE double
+#endif
+
+// namespace scope constants, inline since c++17 so that they have external linkage and modules can export them
+#if __cplusplus >= 201703L
+#define UNIT_CONSTANT inline constexpr
+#else
+#define UNIT_CONSTANT constexpr
+#endif
+
+namespace unit {
+
+template <typename Unit, typename MagnitudeRepresentation = UNIT_BASETYPE>
+class Quantity {
+    template <typename, typename>
+    friend class Quantity;
+
+   public:
+    using unit = Unit;
+    using magnitude_type = MagnitudeRepresentation;
+    using classtype = Quantity<unit, magnitude_type>;
+
+    constexpr explicit Quantity() : m_magnitude(0) {}
+    constexpr explicit Quantity(magnitude_type const& v) : m_magnitude(v) {}
+
+    constexpr Quantity(classtype const& v) = default;
+    constexpr Quantity(classtype &&) = default;
+
+    template <typename R>
+    constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    // the same unit in another representation, eg a SparseUnit or a UnitId
+    template <typename U, typename R, typename = typename std::enable_if<helper::EquivalentUnits<U, unit>::value()>::type>
+    constexpr Quantity(Quantity<U, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    classtype& operator=(classtype const& v) = default;
+
+    constexpr magnitude_type const& magnitude() const { return m_magnitude; }
+
+   private:
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator+=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator-=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator*=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator/=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    magnitude_type m_magnitude;
+};
+}
+
+// src/unit/Unit.h
+namespace unit {
+
+template<TExponent ... dimensionExponents >
+struct Unit{
+
+    using classtype = Unit<dimensionExponents...>;
+
+    static constexpr unsigned exponent_count() {return sizeof...(dimensionExponents);}
+
+    template<ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::nthElement::NthElement<i,dimensionExponents...>::value(); }
+};
+
+/**
+ * unit with the rational exponents numerators / denominator, the result of raising a Unit to a
+ * fractional power, eg sqrt of a hertz:
+ *
+ *     raised_unit<Unit<0,0,-1,0,0,0,0>, std::ratio<1, 2>>  // RationalUnit<2, 0,0,-1,0,0,0,0>
+ *
+ * The fraction is reduced and the denominator at least 2, results with integer exponents are
+ * Units again. There is no exponent_value, code that expects integer exponents does not compile.
+ */
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit {
+    static_assert(denominator > 1, "a unit with integer exponents is a Unit");
+    static_assert(helper::rational::Gcd<denominator, numerators...>::value() == 1, "the exponents must be reduced");
+
+    using classtype = RationalUnit<denominator, numerators...>;
+
+    static constexpr unsigned exponent_count() { return sizeof...(numerators); }
+
+    static constexpr TExponent exponent_denominator() { return denominator; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_numerator() { return helper::nthElement::NthElement<i, numerators...>::value(); }
+};
+
+}
+
+// src/unit/unitOperators.h
+namespace unit {
+
+namespace helper {
+
+namespace op {
+
+template <typename U1, typename U2, int index>
+struct sum {
+    static constexpr int value() { return U1::template exponent_value<index>() + U2::template exponent_value<index>(); }
+};
+
+template <typename U1, typename U2, int index>
+struct difference {
+    static constexpr int value() { return U1::template exponent_value<index>() - U2::template exponent_value<index>(); }
+};
+
+template <typename U1, typename fract, int index>
+struct multiply {
+    static_assert(helper::exponent<U1, index>() * fract::num % fract::den == 0,
+                  "rasing a unit to a fractional-power is not allowed");
+    static constexpr int value() { return helper::exponent<U1, index>() * fract::num / fract::den; }
+};
+
+template <ExponentIndex it, typename U1, typename U2, template <class, class, int> class Op, TExponent... exponents>
+struct UnitOperator {
+    using type = typename UnitOperator<it - 1, U1, U2, Op, Op<U1, U2, it>::value(), exponents...>::type;
+};
+
+template <typename U1, typename U2, template <class, class, int> class Op, TExponent... exponents>
+struct UnitOperator<-1, U1, U2, Op, exponents...> {
+    using type = Unit<exponents...>;
+};
+
+template <bool... values>
+struct AllOf {
+    static constexpr bool value() { return std::is_same<AllOf<values...>, AllOf<(values || true)...>>::value; }
+};
+}
+
+namespace rational {
+
+// Unit<numerators / denominator...> for integer exponents, the reduced RationalUnit otherwise
+template <TExponent denominator, TExponent... numerators>
+struct Reduced {
+    static constexpr TExponent g() { return Gcd<denominator, numerators...>::value(); }
+    using type = typename std::conditional<denominator == g(), Unit<numerators / g()...>,
+                                           RationalUnit<denominator / g(), numerators / g()...>>::type;
+};
+
+// the exponents of U as numerators, a Unit used as list, over a common denominator
+template <typename U>
+struct Fraction : Fraction<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct Fraction<Unit<exponents...>> {
+    static constexpr TExponent denominator() { return 1; }
+    using numerators = Unit<exponents...>;
+};
+
+template <TExponent d, TExponent... n>
+struct Fraction<RationalUnit<d, n...>> {
+    static constexpr TExponent denominator() { return d; }
+    using numerators = Unit<n...>;
+};
+
+template <TExponent d1, typename N1, TExponent d2, typename N2, int sign>
+struct Sum;
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2, int sign>
+struct Sum<d1, Unit<n1...>, d2, Unit<n2...>, sign> {
+    static_assert(sizeof...(n1) == sizeof...(n2), "units of different unit systems");
+    using type = typename Reduced<d1 / gcd(d1, d2) * d2, (n1 * (d2 / gcd(d1, d2)) + sign * n2 * (d1 / gcd(d1, d2)))...>::type;
+};
+
+template <typename U1, typename U2, int sign>
+struct Combined : Sum<Fraction<U1>::denominator(), typename Fraction<U1>::numerators,
+                      Fraction<U2>::denominator(), typename Fraction<U2>::numerators, sign> {};
+
+template <TExponent d, typename N, typename fract>
+struct Raise;
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raise<d, Unit<n...>, fract> {
+    using type = typename Reduced<static_cast<TExponent>(d * fract::den), static_cast<TExponent>(n * fract::num)...>::type;
+};
+
+template <typename U, typename fract>
+struct Power : Raise<Fraction<U>::denominator(), typename Fraction<U>::numerators, fract> {};
+
+// whether the primary Raised stays with integer exponents, other representations raise themselves
+template <typename U, typename fract>
+struct IntegerPower {
+    static constexpr bool value() { return true; }
+};
+
+template <TExponent... exponents, typename fract>
+struct IntegerPower<Unit<exponents...>, fract> {
+    static constexpr bool value() { return op::AllOf<(exponents * fract::num % fract::den == 0)...>::value(); }
+};
+}
+
+namespace op {
+
+// the operations on Unit<exponents...>, specialized by other unit representations
+template <typename U1, typename U2>
+struct Product {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, sum>::type;
+};
+
+template <typename U1, typename U2>
+struct Quotient {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, difference>::type;
+};
+
+// fractional powers give a RationalUnit
+template <typename U1, typename fract>
+struct Raised {
+    using type = typename std::conditional<rational::IntegerPower<U1, fract>::value(),
+                                           UnitOperator<U1::exponent_count() - 1, U1, fract, multiply>,
+                                           rational::Power<U1, fract>>::type::type;
+};
+
+// a RationalUnit with a Unit gives a RationalUnit or, for integer exponents, a Unit
+template <TExponent d, TExponent... n, typename U2>
+struct Product<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, 1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Product<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Product<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, 1> {};
+
+template <TExponent d, TExponent... n, typename U2>
+struct Quotient<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, -1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Quotient<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Quotient<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, -1> {};
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raised<RationalUnit<d, n...>, fract> : rational::Power<RationalUnit<d, n...>, fract> {};
+}
+}
+
+template <typename U1, typename U2>
+using product_unit = typename helper::op::Product<U1, U2>::type;
+
+template <typename U1, typename U2>
+using quotient_unit = typename helper::op::Quotient<U1, U2>::type;
+
+template <typename U1, typename fract>
+using raised_unit = typename helper::op::Raised<U1, fract>::type;
+
+template <typename U>
+using sqare_unit = product_unit<U, U>;
+}
+
+// src/quantity/quantityOperators.h
+namespace unit {
+
+/**
+ *  This function casts eg from Quantity<x,double> -> Quantity<x,int>
+ */
+template <typename TDst, typename QSrc>
+constexpr Quantity<typename QSrc::unit, TDst> static_unit_cast(QSrc const& l) {
+    return Quantity<typename QSrc::unit, TDst>{static_cast<TDst>(l.magnitude())};
+}
+
+template <typename U, typename LT, typename RT>
+constexpr Quantity<U, LT>& operator+=(Quantity<U, LT>& l, Quantity<U, RT> const& r) {
+    return l.m_magnitude += r.m_magnitude, l;
+}
+
+template <typename U, typename LT, typename RT>
+constexpr Quantity<U, LT>& operator-=(Quantity<U, LT>& l, Quantity<U, RT> const& r) {
+    return l.m_magnitude -= r.m_magnitude, l;
+}
+
+template <typename U, typename LT, typename RT>
+constexpr Quantity<U, LT>& operator*=(Quantity<U, LT>& l, Quantity<U, RT> const& r) {
+    return l.m_magnitude *= r.m_magnitude, l;
+}
+
+template <typename U, typename LT, typename RT>
+constexpr Quantity<U, LT>& operator/=(Quantity<U, LT>& l, Quantity<U, RT> const& r) {
+    return l.m_magnitude /= r.m_magnitude, l;
+}
+
+template <typename LU, typename LT, typename RU, typename RT>
+constexpr auto operator*(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<product_unit<LU, RU>, decltype(l.magnitude() * r.magnitude())> {
+    return Quantity<product_unit<LU, RU>, decltype(l.magnitude() * r.magnitude())>{l.magnitude() * r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT>
+constexpr auto operator/(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<quotient_unit<LU, RU>, decltype(l.magnitude() / r.magnitude())> {
+    return Quantity<quotient_unit<LU, RU>, decltype(l.magnitude() / r.magnitude())>{l.magnitude() / r.magnitude()};
+}
+
+template <typename U, typename LT, typename RT>
+constexpr auto operator+(Quantity<U, LT> const& l, Quantity<U, RT> const& r)
+    -> Quantity<U, decltype(l.magnitude() + r.magnitude())> {
+    return Quantity<U, decltype(l.magnitude() + r.magnitude())>{l.magnitude() + r.magnitude()};
+}
+
+template <typename U, typename LT, typename RT>
+constexpr auto operator-(Quantity<U, LT> const& l, Quantity<U, RT> const& r)
+    -> Quantity<U, decltype(l.magnitude() - r.magnitude())> {
+    return Quantity<U, decltype(l.magnitude() - r.magnitude())>{l.magnitude() - r.magnitude()};
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator<(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() < r.magnitude();
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator<=(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() <= r.magnitude();
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator>(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() > r.magnitude();
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator>=(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() >= r.magnitude();
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator==(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() == r.magnitude();
+}
+
+template <typename U, typename LT, typename RT>
+constexpr bool operator!=(Quantity<U, LT> const& l, Quantity<U, RT> const& r) {
+    return l.magnitude() != r.magnitude();
+}
+
+template <typename LU, typename LT>
+constexpr Quantity<LU, LT> operator-(Quantity<LU, LT> const& l) {
+    return Quantity<LU, LT>{-l.magnitude()};
+}
+
+namespace helper {
+
+template <typename LU, typename RU>
+using IfEquivalent = typename std::enable_if<EquivalentUnits<LU, RU>::value()>::type;
+}
+
+// the same unit in different representations, results have the representation of the left operand
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator+=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l += Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator-=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l -= Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator+(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() + r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() + r.magnitude())>{l.magnitude() + r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator-(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() - r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() - r.magnitude())>{l.magnitude() - r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() < r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() <= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() > r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() >= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator==(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() == r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator!=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() != r.magnitude();
+}
+}
+
+// src/quantity/quantityMath.h
+namespace unit {
+
+namespace helper {
+
+namespace math {
+
+// brings the std overloads in scope of the unqualified calls below. Without them the
+// trailing return types would pick up eg ::abs(int) for double arguments. Magnitude types
+// from other namespaces are still found by adl.
+using std::abs;
+using std::sqrt;
+using std::pow;
+
+template <typename T>
+constexpr auto abs_impl(T const& v) -> decltype(abs(v)) {
+    return abs(v);
+}
+
+template <typename T>
+constexpr auto sqrt_impl(T const& v) -> decltype(sqrt(v)) {
+    return sqrt(v);
+}
+
+template <typename power, typename T>
+struct Pow {
+    using result_type = decltype(pow(std::declval<T const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static constexpr result_type apply(T const& v) {
+        return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    }
+};
+
+// complex fast paths: std::pow(complex, double) goes through exp and log,
+// small integer and half powers are done by multiplication and sqrt instead.
+// v is already converted to the result type, eg complex<float> to complex<double>
+template <typename C, std::intmax_t num, std::intmax_t den>
+struct ComplexPow {
+    static C apply(C const& v) { return pow(v, static_cast<double>(num) / static_cast<double>(den)); }
+};
+
+template <typename C>
+struct ComplexPow<C, 0, 1> {
+    static C apply(C const&) { return C{1}; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 1> {
+    static C apply(C const& v) { return v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 2, 1> {
+    static C apply(C const& v) { return v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 1> {
+    static C apply(C const& v) { return v * v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 4, 1> {
+    static C apply(C const& v) { return (v * v) * (v * v); }
+};
+
+template <typename C>
+struct ComplexPow<C, -1, 1> {
+    static C apply(C const& v) { return C{1} / v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 2> {
+    static C apply(C const& v) { return sqrt(v); }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 2> {
+    static C apply(C const& v) { return v * sqrt(v); }
+};
+
+template <typename power, typename T>
+struct Pow<power, std::complex<T>> {
+    using result_type = decltype(pow(std::declval<std::complex<T> const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static result_type apply(std::complex<T> const& v) {
+        return ComplexPow<result_type, power::num, power::den>::apply(result_type{v});
+    }
+};
+}
+
+}
+
+template <typename U, typename T>
+constexpr auto
+abs(Quantity<U, T> const& q)
+        -> Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>
+{
+    return Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>{
+                                helper::math::abs_impl(q.magnitude())};
+}
+
+template <typename U, typename T>
+constexpr auto
+sqrt(Quantity<U, T> const& q)
+        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>
+{
+    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>{
+                                                               helper::math::sqrt_impl(q.magnitude())};
+}
+
+namespace helper {
+
+template <typename power, typename T>
+constexpr auto
+pow_impl(T const& v)
+ -> typename math::Pow<power, T>::result_type
+
+{
+    return math::Pow<power, T>::apply(v);
+}
+
+}
+
+template <typename power, typename U, typename T>
+constexpr auto
+pow(Quantity<U, T> const& q)  // cmath pow function has dynamic exponent and therefore dynamic return unit type and therefore cannot be realized by Quantity
+        -> Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>
+{
+    return Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>{
+                                                    helper::pow_impl<power, T>(q.magnitude())};
+}
+
+template <typename U, typename T>
+constexpr auto
+cube(Quantity<U, T> const& q)
+        -> Quantity<product_unit<product_unit<U, U>, U>, decltype((q.magnitude() * q.magnitude()) * q.magnitude())>
+{
+    return Quantity<product_unit<product_unit<U, U>, U>, decltype((q.magnitude() * q.magnitude()) * q.magnitude())>{
+                                                                  (q.magnitude() * q.magnitude()) * q.magnitude()};
+}
+
+template <typename U, typename T>
+constexpr auto
+square(Quantity<U, T> const& q)
+        -> Quantity<product_unit<U, U>, decltype(q.magnitude() * q.magnitude())>
+{
+    return Quantity<product_unit<U, U>, decltype(q.magnitude() * q.magnitude())>{
+                                                 q.magnitude() * q.magnitude()};
+}
+
+}
+
+// src/unit/unitScaling.h
+namespace unit {
+namespace helper {
+
+template <typename ratioIn, typename ratioOut, typename T>
+constexpr T rescale(T const& v) {
+    using r = std::ratio_divide<ratioIn, ratioOut>;
+    return v * T{r::num} / T{r::den};
+}
+
+template <typename ratioIn, typename T>
+constexpr T rescaleTo1(T const& v) {
+    return rescale<ratioIn, std::ratio<1>, T>(v);
+}
+}
+
+template<typename T> constexpr T femto(T const& v) { return helper::rescaleTo1<std::femto>(v); }
+template<typename T> constexpr T pico(T const& v) { return helper::rescaleTo1<std::pico>(v); }
+template<typename T> constexpr T nano(T const& v) { return helper::rescaleTo1<std::nano>(v); }
+template<typename T> constexpr T micro(T const& v) { return helper::rescaleTo1<std::micro>(v); }
+template<typename T> constexpr T milli(T const& v) { return helper::rescaleTo1<std::milli>(v); }
+template<typename T> constexpr T centi(T const& v) { return helper::rescaleTo1<std::centi>(v); }
+template<typename T> constexpr T deci(T const& v) { return helper::rescaleTo1<std::deci>(v); }
+template<typename T> constexpr T deca(T const& v) { return helper::rescaleTo1<std::deca>(v); }
+template<typename T> constexpr T hecto(T const& v) { return helper::rescaleTo1<std::hecto>(v); }
+template<typename T> constexpr T kilo(T const& v) { return helper::rescaleTo1<std::kilo>(v); }
+template<typename T> constexpr T mega(T const& v) { return helper::rescaleTo1<std::mega>(v); }
+template<typename T> constexpr T giga(T const& v) { return helper::rescaleTo1<std::giga>(v); }
+template<typename T> constexpr T tera(T const& v) { return helper::rescaleTo1<std::tera>(v); }
+template<typename T> constexpr T peta(T const& v) { return helper::rescaleTo1<std::peta>(v); }
+
+}
+
+// src/unit/unitHash.h
+namespace unit {
+namespace helper {
+namespace hash {
+
+using THash = std::uint32_t;
+
+constexpr THash rotl(THash x, unsigned r) { return static_cast<THash>((x << r) | (x >> (32 - r))); }
+
+constexpr THash xorShift(THash h, unsigned shift) { return h ^ (h >> shift); }
+
+// murmur3 finalizer
+constexpr THash mix(THash h) {
+    return xorShift(static_cast<THash>(xorShift(static_cast<THash>(xorShift(h, 16) * 0x85ebca6bu), 13) * 0xc2b2ae35u), 16);
+}
+
+namespace murmur {
+
+// up to four characters as little endian word, compilers merge this into a single load
+constexpr THash block(char const* s, std::size_t n) {
+    return n == 0 ? 0 : static_cast<THash>(static_cast<unsigned char>(s[0]) | (block(s + 1, n - 1) << 8));
+}
+
+constexpr THash scramble(THash k) { return static_cast<THash>(rotl(static_cast<THash>(k * 0xcc9e2d51u), 15) * 0x1b873593u); }
+
+constexpr THash body(char const* s, std::size_t n, THash h) {
+    return n < 4 ? (n == 0 ? h : h ^ scramble(block(s, n)))
+                 : body(s + 4, n - 4, static_cast<THash>(rotl(h ^ scramble(block(s, 4)), 13) * 5u + 0xe6546b64u));
+}
+}
+
+/**
+ * murmur3 (32 bit) of the first n characters of s, constexpr so that generated tables can be
+ * checked at compile time. Four characters are consumed per step, which keeps short keys cheap.
+ */
+constexpr THash murmur3(char const* s, std::size_t n, THash seed = 0) {
+    return mix(murmur::body(s, n, seed) ^ static_cast<THash>(n));
+}
+
+constexpr std::size_t length(char const* s) { return *s == '\0' ? 0 : 1 + length(s + 1); }
+
+// rehash of the key hash h, distinct seeds give independent slots for the same key
+constexpr THash seeded(THash h, THash seed) {
+    return mix(h ^ static_cast<THash>(seed * 0x9e3779b9u));
+}
+
+/**
+ * slot of a key hash in a minimal perfect hash table (hash and displace): the bucket of the
+ * key selects a seed which was chosen by the generator of the table such that all keys land
+ * on distinct slots. The string is hashed once only, the seeds just remix its hash.
+ */
+constexpr std::size_t slot(THash h, THash const* displacements, std::size_t buckets, std::size_t size) {
+    return seeded(h, displacements[h % buckets]) % size;
+}
+
+/**
+ * O(1) lookup in a perfect hash table of entries with a member name, unknown keys end up on
+ * some slot and are rejected by a single string comparison
+ */
+template <typename Entry>
+Entry const* find(Entry const* table, std::size_t size, THash const* displacements, std::size_t buckets, char const* key, std::size_t n) {
+    if (size == 0) return nullptr;
+    Entry const& e = table[slot(murmur3(key, n), displacements, buckets, size)];
+    return std::strncmp(e.name, key, n) == 0 && e.name[n] == '\0' ? &e : nullptr;
+}
+
+template <typename Entry, std::size_t size, std::size_t buckets>
+Entry const* find(Entry const (&table)[size], THash const (&displacements)[buckets], char const* key, std::size_t n) {
+    return find(table, size, displacements, buckets, key, n);
+}
+}
+}
+}
+
+// src/unit/unitSymbols.h
+namespace unit {
+
+namespace helper {
+
+namespace conversion {
+
+constexpr double pow10(int e) { return e == 0 ? 1.0 : 10.0 * pow10(e - 1); }
+
+// rounds once only if exp10 is 0 and num and den are exactly representable, otherwise the result can
+// miss the nearest double by an ulp, the generated conversions use correctly rounded literals instead
+constexpr double factor(std::intmax_t num, std::intmax_t den, int exp10) {
+    return exp10 >= 0 ? static_cast<double>(num) * pow10(exp10) / static_cast<double>(den)
+                      : static_cast<double>(num) / (static_cast<double>(den) * pow10(-exp10));
+}
+
+// other unit representations compare as Unit<exponents...>
+template <typename U>
+struct Exponents : Exponents<typename DenseUnit<U>::type> {};
+
+// other are the numerators of exponents over a common denominator
+template <TExponent... exponents>
+struct Exponents<Unit<exponents...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {exponents...};
+        for (std::size_t i = 0; i < sizeof...(exponents); ++i)
+            if (own[i] * denominator != other[i]) return false;
+        return true;
+    }
+};
+
+template <TExponent d, TExponent... numerators>
+struct Exponents<RationalUnit<d, numerators...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {numerators...};
+        for (std::size_t i = 0; i < sizeof...(numerators); ++i)
+            if (own[i] * denominator != other[i] * d) return false;
+        return true;
+    }
+};
+}
+}
+
+/**
+ * exact conversion factor ratio * 10^exp10, the decimal exponent keeps factors like
+ * 1.602176634e-19 exact whose denominator does not fit into std::ratio
+ */
+template <typename ratio, int exp10 = 0>
+struct exact_factor {
+    using type = ratio;
+    static constexpr int decimal_exponent() { return exp10; }
+    static constexpr double value() { return helper::conversion::factor(ratio::num, ratio::den, exp10); }
+};
+
+/**
+ * entry of a runtime conversion table: value in unit name == value * factor in the coherent unit with the given exponents
+ */
+template <std::size_t dimensions>
+struct ConversionEntry {
+    char const* name;
+    double factor;
+    std::intmax_t num;
+    std::intmax_t den;
+    int exp10;
+    TExponent exponents[dimensions];
+};
+
+namespace helper {
+
+namespace conversion {
+
+template <typename U>
+struct EntryOf : EntryOf<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct EntryOf<Unit<exponents...>> {
+    static constexpr ConversionEntry<sizeof...(exponents)> make(char const* name, std::intmax_t num, std::intmax_t den) {
+        return ConversionEntry<sizeof...(exponents)>{name, factor(num, den, 0), num, den, 0, {exponents...}};
+    }
+};
+}
+}
+
+/**
+ * entry of a unit symbol, eg conversion_entry<u::newton>("N") or conversion_entry<u::kilogram>("g", 1, 1000)
+ */
+template <typename U>
+constexpr ConversionEntry<U::exponent_count()> conversion_entry(char const* name, std::intmax_t num = 1, std::intmax_t den = 1) {
+    return helper::conversion::EntryOf<U>::make(name, num, den);
+}
+
+namespace helper {
+
+namespace symbols {
+
+// units named by their print_unit output
+template <typename... U>
+struct Printed {};
+}
+}
+
+/**
+ * symbols of the unit system with the given number of dimensions, used by parsing and reading.
+ * Specialized by the system definition (eg quantityDefinitionsSI.h) with
+ *
+ *     using printed = helper::symbols::Printed<units...>;
+ *     static ConversionEntry<dimensions> const* spellings();
+ *     static std::size_t spelling_count();
+ *
+ * printed lists the units whose print_unit output is a symbol, spellings are further symbols and
+ * scaled units. Systems without symbols only read their printed units.
+ */
+template <std::size_t dimensions>
+struct UnitSymbols {
+    using printed = helper::symbols::Printed<>;
+    static ConversionEntry<dimensions> const* spellings() { return nullptr; }
+    static std::size_t spelling_count() { return 0; }
+};
+}
+
+// src/quantity/quantityConversion.h
+namespace unit {
+
+/**
+ * converts value given in the unit of entry to out, false if there is no entry or its dimension is not the one of U
+ */
+template <typename U, typename T, std::size_t dimensions>
+bool to_quantity(ConversionEntry<dimensions> const* entry, T const& value, Quantity<U, T>& out) {
+    static_assert(U::exponent_count() == dimensions, "conversion table of another unit system");
+    if (entry == nullptr || !helper::conversion::Exponents<U>::equal(entry->exponents)) return false;
+    out = Quantity<U, T>{value * static_cast<T>(entry->factor)};
+    return true;
+}
+}
+
+// src/quantity/quantityDefinitionsSI.h
+namespace unit {
+
+namespace u { //units
+
+//these units are taken from https://en.wikipedia.org/wiki/International_System_of_Units
+
+//base units
+using unitless = BaseUnit<-1,6>;// == Unit<0,...,0>
+
+using    meter = BaseUnit<0,6>; // == Unit<1,0,...,0>
+using kilogram = BaseUnit<1,6>;
+using   second = BaseUnit<2,6>;
+using   ampere = BaseUnit<3,6>;
+using   kelvin = BaseUnit<4,6>;
+using     mole = BaseUnit<5,6>;
+using  candela = BaseUnit<6,6>; // == Unit<0,...,0,1>
+
+//derived units
+using    radian = unitless;
+using steradian = unitless;
+using     hertz = quotient_unit< unitless, second>;
+using    newton = quotient_unit< product_unit<kilogram, meter>, sqare_unit<second>>;
+using    pascal = quotient_unit< newton,  sqare_unit<meter>>;
+using     joule = product_unit<  newton,  meter>;
+using      watt = quotient_unit< joule,   second>;
+using   coulomb = product_unit<  second,  ampere>;
+using      volt = quotient_unit< watt,    ampere>;
+using     farad = quotient_unit< coulomb, volt>;
+using       ohm = quotient_unit< volt,    ampere>;
+using   siemens = quotient_unit< ampere,  volt>;
+using     weber = product_unit<  volt,    second>;
+using     tesla = quotient_unit< weber,   sqare_unit<meter>>;
+using     henry = quotient_unit< weber,   ampere>;
+using     lumen = product_unit<  candela, steradian>;
+using       lux = quotient_unit< lumen,   sqare_unit<meter>>;
+using becquerel = hertz;
+using      gray = quotient_unit< joule,   kilogram>;
+using   sievert = gray;
+using     katal = quotient_unit< mole,    second>;
+
+//useful custom units
+using meter_cubed              = product_unit<  meter, sqare_unit<meter>>;
+using meter_per_second         = quotient_unit< meter, second>;
+using meter_per_second_squared = quotient_unit< meter, sqare_unit<second>>;
+
+using mol_inv   = quotient_unit< unitless, mole>;
+
+}
+
+namespace t { //quantity types
+
+    using def = UNIT_BASETYPE; //default representation
+
+    //base units
+    using unitless = Quantity<u::unitless, def>;
+    using    meter = Quantity<u::meter,    def>;
+    using kilogram = Quantity<u::kilogram, def>;
+    using   second = Quantity<u::second,   def>;
+    using   ampere = Quantity<u::ampere,   def>;
+    using   kelvin = Quantity<u::kelvin,   def>;
+    using     mole = Quantity<u::mole,     def>;
+    using  candela = Quantity<u::candela,  def>;
+
+    //derived units
+    using    radian = Quantity<u::radian,    def>;
+    using steradian = Quantity<u::steradian, def>;
+    using     hertz = Quantity<u::hertz,     def>;
+    using    newton = Quantity<u::newton,    def>;
+    using    pascal = Quantity<u::pascal,    def>;
+    using     joule = Quantity<u::joule,     def>;
+    using      watt = Quantity<u::watt,      def>;
+    using   coulomb = Quantity<u::coulomb,   def>;
+    using      volt = Quantity<u::volt,      def>;
+    using     farad = Quantity<u::farad,     def>;
+    using       ohm = Quantity<u::ohm,       def>;
+    using   siemens = Quantity<u::siemens,   def>;
+    using     weber = Quantity<u::weber,     def>;
+    using     tesla = Quantity<u::tesla,     def>;
+    using     henry = Quantity<u::henry,     def>;
+    using     lumen = Quantity<u::lumen,     def>;
+    using       lux = Quantity<u::lux,       def>;
+    using becquerel = Quantity<u::becquerel, def>;
+    using      gray = Quantity<u::gray,      def>;
+    using   sievert = Quantity<u::sievert,   def>;
+    using     katal = Quantity<u::katal,     def>;
+
+    //custom units
+    using meter_cubed = Quantity<u::meter_cubed, def>;
+}
+
+UNIT_CONSTANT t::unitless unitless{1};
+UNIT_CONSTANT t::unitless number{1};
+UNIT_CONSTANT    t::meter meter{1};
+UNIT_CONSTANT t::kilogram kilogram{1};
+UNIT_CONSTANT   t::second second{1};
+UNIT_CONSTANT   t::ampere ampere{1};
+UNIT_CONSTANT   t::kelvin kelvin{1};
+UNIT_CONSTANT     t::mole mole{1};
+UNIT_CONSTANT  t::candela candela{1};
+
+//derived units
+UNIT_CONSTANT    t::radian radian{1};
+UNIT_CONSTANT t::steradian steradian{1};
+UNIT_CONSTANT     t::hertz hertz{1};
+UNIT_CONSTANT    t::newton newton{1};
+UNIT_CONSTANT    t::pascal pascal{1};
+UNIT_CONSTANT     t::joule joule{1};
+UNIT_CONSTANT      t::watt watt{1};
+UNIT_CONSTANT   t::coulomb coulomb{1};
+UNIT_CONSTANT      t::volt volt{1};
+UNIT_CONSTANT     t::farad farad{1};
+UNIT_CONSTANT       t::ohm ohm{1};
+UNIT_CONSTANT   t::siemens siemens{1};
+UNIT_CONSTANT     t::weber weber{1};
+UNIT_CONSTANT     t::tesla tesla{1};
+UNIT_CONSTANT     t::henry henry{1};
+UNIT_CONSTANT     t::lumen lumen{1};
+UNIT_CONSTANT       t::lux lux{1};
+UNIT_CONSTANT t::becquerel becquerel{1};
+UNIT_CONSTANT      t::gray gray{1};
+UNIT_CONSTANT   t::sievert sievert{1};
+UNIT_CONSTANT     t::katal katal{1};
+
+//according to https://www.nist.gov/sites/default/files/documents/pml/wmd/metric/SP1038.pdf
+UNIT_CONSTANT       t::meter inch{centi(2.54)}; //(ft)
+UNIT_CONSTANT       t::meter food{0.3048}; //(ft)
+UNIT_CONSTANT       t::meter mile{1609.344}; //international (5280 ft)(mi)
+UNIT_CONSTANT       t::meter yard{0.9144}; //(yd)
+UNIT_CONSTANT    t::kilogram pound{0.45359237}; //avoirdupois
+UNIT_CONSTANT    t::kilogram ounce{0.02834952}; //avoirdupois
+UNIT_CONSTANT    t::kilogram gram{helper::rescale<std::ratio<1>,std::kilo>(1.0)};
+UNIT_CONSTANT      t::second minute{60};
+UNIT_CONSTANT      t::second hour{60*60};
+UNIT_CONSTANT      t::second day{60*60*24};
+UNIT_CONSTANT       t::joule calorie{4.184}; //pyhsical unit!
+UNIT_CONSTANT       t::joule watt_hour{3600};
+UNIT_CONSTANT t::meter_cubed liter{0.001};
+UNIT_CONSTANT t::meter_cubed gallon{3.785412 * 0.001};
+UNIT_CONSTANT      t::pascal bar{kilo(100)};
+UNIT_CONSTANT    t::unitless parts_per_million{micro(1.0)};
+UNIT_CONSTANT    t::unitless percent{centi(1.0)};
+
+//temperature
+constexpr    t::kelvin     celsius ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>(v+273.15)};}
+constexpr    t::kelvin  fahrenheit ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>((v+459.67)*5.0/9.0)};}
+
+namespace literals {
+
+constexpr   t::unitless operator"" _unitless ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""   _number ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""        _n ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::newton   operator""   _newton ( long double v )  {return   t::newton {static_cast<UNIT_BASETYPE>(v)};}
+
+}
+
+template<typename U> constexpr const char* unitSymbol();
+template<> inline constexpr const char* unitSymbol<   u::meter>(){ return "m";}
+template<> inline constexpr const char* unitSymbol<u::kilogram>(){ return "kg";}
+template<> inline constexpr const char* unitSymbol<  u::second>(){ return "s";}
+template<> inline constexpr const char* unitSymbol<  u::ampere>(){ return "A";}
+template<> inline constexpr const char* unitSymbol<  u::kelvin>(){ return "K";}
+template<> inline constexpr const char* unitSymbol<    u::mole>(){ return "mol";}
+template<> inline constexpr const char* unitSymbol< u::candela>(){ return "cd";}
+
+//derived units
+
+template<typename U> void print_unit(std::ostream& s);
+//template<> void print_unit<   def::radian>(std::ostream& s){ s<<"rad"; }
+//template<> inline void print_unit<def::steradian>(std::ostream& s){ s<<"sr"; }
+template<> inline void print_unit<    u::hertz>(std::ostream& s){ s<<"Hz"; }
+template<> inline void print_unit<   u::newton>(std::ostream& s){ s<<"N"; }
+template<> inline void print_unit<   u::pascal>(std::ostream& s){ s<<"Pa"; }
+template<> inline void print_unit<    u::joule>(std::ostream& s){ s<<"J"; }
+template<> inline void print_unit<     u::watt>(std::ostream& s){ s<<"W"; }
+template<> inline void print_unit<  u::coulomb>(std::ostream& s){ s<<"C"; }
+template<> inline void print_unit<     u::volt>(std::ostream& s){ s<<"V"; }
+template<> inline void print_unit<    u::farad>(std::ostream& s){ s<<"F"; }
+template<> inline void print_unit<      u::ohm>(std::ostream& s){ s<<"Ohm"; }  //actually "Ω", but encoding problem
+template<> inline void print_unit<  u::siemens>(std::ostream& s){ s<<"S"; }
+template<> inline void print_unit<    u::weber>(std::ostream& s){ s<<"Wb"; }
+template<> inline void print_unit<    u::tesla>(std::ostream& s){ s<<"T"; }
+template<> inline void print_unit<    u::henry>(std::ostream& s){ s<<"H"; }
+template<> inline void print_unit<    u::lumen>(std::ostream& s){ s<<"lm"; }
+template<> inline void print_unit<      u::lux>(std::ostream& s){ s<<"Lx"; }
+//template<> inline void print_unit<becquerel>(std::ostream& s){ s<<"Bq"; }
+template<> inline void print_unit<     u::gray>(std::ostream& s){ s<<"Gy"; }
+//template<> inline void print_unit<  sievert>(std::ostream& s){ s<<"Sv"; }
+template<> inline void print_unit<    u::katal>(std::ostream& s){ s<<"ka"; }
+
+//symbols for parsing, the printed ones and some common spellings
+namespace helper {
+namespace si {
+
+// class template so that the header only table has a single definition
+template <typename = void>
+struct Spellings {
+    static constexpr ConversionEntry<7> entries[] = {
+        conversion_entry< u::candela>("cd"), //printed as lm, the steradian has no dimension
+        conversion_entry<u::kilogram>("g", 1, 1000),
+        conversion_entry<     u::ohm>("\xce\xa9"), //Ω
+        conversion_entry<     u::lux>("lx"),
+        conversion_entry<   u::katal>("kat"),
+        //non-si units accepted for use with the si
+        conversion_entry<      u::second>("min", 60),
+        conversion_entry<      u::second>("h", 3600),
+        conversion_entry<      u::second>("d", 86400),
+        conversion_entry<u::meter_cubed>("L", 1, 1000),
+        conversion_entry<u::meter_cubed>("l", 1, 1000),
+        conversion_entry<    u::kilogram>("t", 1000),
+        conversion_entry<sqare_unit<u::meter>>("ha", 10000),
+    };
+};
+
+template <typename T>
+constexpr ConversionEntry<7> Spellings<T>::entries[];
+}
+}
+
+template<> struct UnitSymbols<7> {
+    using printed = helper::symbols::Printed<u::meter, u::kilogram, u::second, u::ampere, u::kelvin, u::mole,
+        u::hertz, u::newton, u::pascal, u::joule, u::watt, u::coulomb, u::volt, u::farad, u::ohm,
+        u::siemens, u::weber, u::tesla, u::henry, u::lumen, u::lux, u::gray, u::katal>;
+    static ConversionEntry<7> const* spellings() { return helper::si::Spellings<>::entries; }
+    static std::size_t spelling_count() { return sizeof(helper::si::Spellings<>::entries) / sizeof(helper::si::Spellings<>::entries[0]); }
+};
+
+}
+
+// src/unit/SparseUnit.h
+namespace unit {
+
+// a dimension of a SparseUnit with its non-zero exponent
+template <DimensionIndex index, TExponent exponent>
+struct Dimension {};
+
+namespace helper {
+
+namespace sparse {
+
+template <typename... Dimensions>
+struct List {};
+
+template <DimensionIndex i, typename... Dimensions>
+struct Lookup {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <DimensionIndex i, DimensionIndex d, TExponent e, typename... Dimensions>
+struct Lookup<i, Dimension<d, e>, Dimensions...> {
+    static constexpr TExponent value() { return i == d ? e : Lookup<i, Dimensions...>::value(); }
+};
+
+// sorted by index, unique, non-zero and within the unit system
+template <unsigned count, typename... Dimensions>
+struct Canonical {
+    static constexpr bool value() { return true; }
+};
+
+template <unsigned count, DimensionIndex d, TExponent e>
+struct Canonical<count, Dimension<d, e>> {
+    static constexpr bool value() { return d >= 0 && d < static_cast<DimensionIndex>(count) && e != 0; }
+};
+
+template <unsigned count, DimensionIndex d1, TExponent e1, DimensionIndex d2, TExponent e2, typename... Dimensions>
+struct Canonical<count, Dimension<d1, e1>, Dimension<d2, e2>, Dimensions...> {
+    static constexpr bool value() {
+        return d1 >= 0 && d1 < d2 && e1 != 0 && Canonical<count, Dimension<d2, e2>, Dimensions...>::value();
+    }
+};
+
+// appends the dimension unless its exponent is zero
+template <typename L, DimensionIndex d, TExponent e>
+struct Append;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Append<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimensions..., Dimension<d, e>>>::type;
+};
+
+// merges two sorted lists in a single pass, exponents of the same dimension are added
+template <typename L, typename R, typename Result = List<>>
+struct Merge;
+
+template <typename... Rs, typename... Result>
+struct Merge<List<>, List<Rs...>, List<Result...>> {
+    using type = List<Result..., Rs...>;
+};
+
+template <typename L, typename... Ls, typename... Result>
+struct Merge<List<L, Ls...>, List<>, List<Result...>> {
+    using type = List<Result..., L, Ls...>;
+};
+
+template <DimensionIndex a, TExponent x, typename... Ls, DimensionIndex b, TExponent y, typename... Rs, typename Result>
+struct Merge<List<Dimension<a, x>, Ls...>, List<Dimension<b, y>, Rs...>, Result> {
+    using type = typename std::conditional<
+        (a < b), Merge<List<Ls...>, List<Dimension<b, y>, Rs...>, typename Append<Result, a, x>::type>,
+        typename std::conditional<
+            (b < a), Merge<List<Dimension<a, x>, Ls...>, List<Rs...>, typename Append<Result, b, y>::type>,
+            Merge<List<Ls...>, List<Rs...>, typename Append<Result, a, x + y>::type>>::type>::type::type;
+};
+
+template <typename L>
+struct Negate;
+
+template <DimensionIndex... d, TExponent... e>
+struct Negate<List<Dimension<d, e>...>> {
+    using type = List<Dimension<d, -e>...>;
+};
+
+template <typename fract, typename L, typename Result = List<>>
+struct Raise {
+    using type = Result;
+};
+
+template <typename fract, DimensionIndex d, TExponent e, typename... Ls, typename Result>
+struct Raise<fract, List<Dimension<d, e>, Ls...>, Result> {
+    static_assert(e * fract::num % fract::den == 0, "rasing a unit to a fractional-power is not allowed");
+    using type = typename Raise<fract, List<Ls...>, typename Append<Result, d, e * fract::num / fract::den>::type>::type;
+};
+
+template <typename L, DimensionIndex d, TExponent e>
+struct Prepend;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Prepend<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimension<d, e>, Dimensions...>>::type;
+};
+
+template <typename U, ExponentIndex it = U::exponent_count() - 1, typename Result = List<>>
+struct ListOf {
+    using type = typename ListOf<U, it - 1, typename Prepend<Result, it, U::template exponent_value<it>()>::type>::type;
+};
+
+template <typename U, typename Result>
+struct ListOf<U, -1, Result> {
+    using type = Result;
+};
+
+// the non-zero dimensions of any unit representation
+template <typename U>
+struct DimensionsOf {
+    using type = typename ListOf<U>::type;
+};
+
+template <unsigned count, typename L>
+struct ToUnit;
+
+template <typename L>
+struct Canonicalize;
+
+template <typename U1, typename U2>
+struct SameSystem {
+    static_assert(U1::exponent_count() == U2::exponent_count(), "units of different unit systems");
+    static constexpr unsigned count() { return U1::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which stores only the non-zero exponents, eg
+ *
+ *     SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>  // == Unit<1,0,0,0,0,0,0,0,-1,0>
+ *
+ * The dimensions are sorted by index so that equal units are the same type, sparse_unit sorts
+ * them. product_unit, quotient_unit and raised_unit of SparseUnits merge the lists and cost the
+ * number of non-zero exponents instead of the number of dimensions, units with many dimensions
+ * therefore compile faster and have short type names. Everything else reads the exponents
+ * through exponent_value and works with both representations. Quantities of a SparseUnit and of
+ * the equal Unit convert into each other, add and compare.
+ */
+template <unsigned dimensions, typename... Dimensions>
+struct SparseUnit {
+    static_assert(helper::sparse::Canonical<dimensions, Dimensions...>::value(),
+                  "dimensions must be sorted, unique, non-zero and below the dimension count, see sparse_unit");
+
+    using classtype = SparseUnit<dimensions, Dimensions...>;
+
+    static constexpr unsigned exponent_count() { return dimensions; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::sparse::Lookup<i, Dimensions...>::value(); }
+};
+
+namespace helper {
+
+namespace sparse {
+
+template <unsigned count, typename... Dimensions>
+struct ToUnit<count, List<Dimensions...>> {
+    using type = SparseUnit<count, Dimensions...>;
+};
+
+template <unsigned count, typename... Dimensions>
+struct DimensionsOf<SparseUnit<count, Dimensions...>> {
+    using type = List<Dimensions...>;
+};
+
+template <>
+struct Canonicalize<List<>> {
+    using type = List<>;
+};
+
+// sorts by inserting one dimension after the other
+template <DimensionIndex d, TExponent e, typename... Dimensions>
+struct Canonicalize<List<Dimension<d, e>, Dimensions...>> {
+    using type = typename Merge<typename Append<List<>, d, e>::type, typename Canonicalize<List<Dimensions...>>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseProduct {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename DimensionsOf<U2>::type>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseQuotient {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename Negate<typename DimensionsOf<U2>::type>::type>::type>::type;
+};
+}
+
+namespace op {
+
+// a SparseUnit with a Unit gives a SparseUnit
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Product<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseProduct<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Product<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseProduct<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Product<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseProduct<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseQuotient<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Quotient<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseQuotient<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Quotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseQuotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+// and with a RationalUnit a RationalUnit
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Product<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Product<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, 1> {};
+
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Quotient<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, -1> {};
+
+template <unsigned dimensions, typename... Dimensions, typename fract>
+struct Raised<SparseUnit<dimensions, Dimensions...>, fract> {
+    using type = typename sparse::ToUnit<dimensions, typename sparse::Raise<fract, sparse::List<Dimensions...>>::type>::type;
+};
+}
+
+namespace baseunit {
+
+template <unsigned dimensions, typename... Dimensions, DimensionIndex index>
+struct BaseUnitOf<SparseUnit<dimensions, Dimensions...>, index> {
+    using type = SparseUnit<dimensions, Dimension<index, 1>>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <unsigned dimensions, typename... Dimensions>
+struct DenseUnit<SparseUnit<dimensions, Dimensions...>> {
+    using type = typename op::UnitOperator<dimensions - 1, SparseUnit<dimensions, Dimensions...>, std::ratio<1>, op::multiply>::type;
+};
+}
+
+/**
+ * the SparseUnit of the given dimensions in any order, dimensions given twice are added
+ *
+ *     sparse_unit<10, Dimension<8, -1>, Dimension<0, 1>>  // SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>
+ */
+template <unsigned dimensions, typename... Dimensions>
+using sparse_unit = typename helper::sparse::ToUnit<
+    dimensions, typename helper::sparse::Canonicalize<helper::sparse::List<Dimensions...>>::type>::type;
+
+// like BaseUnit, dimension -1 gives the unit without dimensions
+template <int dimension, int lastDimension>
+using SparseBaseUnit = sparse_unit<lastDimension + 1, Dimension<dimension, dimension < 0 ? 0 : 1>>;
+}
+
+// src/unit/UnitId.h
+namespace unit {
+
+namespace helper {
+
+namespace id {
+
+using TPacked = std::uint64_t;
+
+/**
+ * the dimension count in the lowest 3 bits, then 6 bits per exponent, zigzag encoded so that
+ * small exponents of either sign give small numbers (0, -1, 1, -2 ... as 0, 1, 2, 3 ...) and
+ * the ids of common units have few digits
+ */
+constexpr unsigned maxDimensions() { return 7; }
+constexpr unsigned countBits() { return 3; }
+constexpr unsigned exponentBits() { return 6; }
+
+constexpr unsigned count(TPacked p) { return static_cast<unsigned>(p & ((TPacked{1} << countBits()) - 1)); }
+
+constexpr unsigned shift(unsigned i) { return countBits() + exponentBits() * i; }
+
+constexpr TExponent decode(TExponent z) { return z % 2 == 0 ? z / 2 : -(z + 1) / 2; }
+
+constexpr TExponent exponent(TPacked p, unsigned i) {
+    return decode(static_cast<TExponent>((p >> shift(i)) & ((TPacked{1} << exponentBits()) - 1)));
+}
+
+constexpr TPacked field(TExponent e, unsigned i) { return static_cast<TPacked>(e >= 0 ? 2 * e : -2 * e - 1) << shift(i); }
+
+constexpr bool fits(TExponent e) { return e >= -32 && e <= 31; }
+
+// nothing but exponents below the dimension count
+constexpr bool valid(TPacked p) { return count(p) <= maxDimensions() && p >> shift(count(p)) == 0; }
+
+constexpr TPacked sum(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(exponent(a, i) + sign * exponent(b, i), i) | sum(a, b, sign, i + 1);
+}
+
+constexpr bool sumFits(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) || (fits(exponent(a, i) + sign * exponent(b, i)) && sumFits(a, b, sign, i + 1));
+}
+
+constexpr TPacked raise(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(static_cast<TExponent>(exponent(a, i) * num / den), i) | raise(a, num, den, i + 1);
+}
+
+constexpr bool divisible(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num % den == 0 && divisible(a, num, den, i + 1));
+}
+
+constexpr bool raiseFits(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num / den >= -32 && exponent(a, i) * num / den <= 31 && raiseFits(a, num, den, i + 1));
+}
+
+template <typename U, unsigned i = 0, bool = (i < U::exponent_count())>
+struct Pack {
+    static_assert(fits(U::template exponent_value<i>()), "exponents of a UnitId are within [-32, 31]");
+    static constexpr TPacked value() { return field(U::template exponent_value<i>(), i) | Pack<U, i + 1>::value(); }
+};
+
+template <typename U, unsigned i>
+struct Pack<U, i, false> {
+    static_assert(U::exponent_count() <= maxDimensions(), "a UnitId has seven dimensions at most");
+    static constexpr TPacked value() { return U::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which is a single integer, for short symbol names and debug info:
+ *
+ *     Quantity<unit_id<u::newton>>  // Quantity<UnitId<99351ull>>
+ *
+ * instead of Quantity<Unit<1, 1, -2, 0, 0, 0, 0>> for seven dimensions. Equal units have the same
+ * id. product_unit, quotient_unit and raised_unit of UnitIds are UnitIds, as well as the result of
+ * combining a UnitId with another representation except RationalUnit, which stays rational.
+ * Quantities of a UnitId and of its Unit convert into each other, add and compare. UnitIds print
+ * like their Unit, eg "N".
+ */
+template <std::uint64_t packed>
+struct UnitId {
+    static_assert(helper::id::valid(packed), "not a packed unit, see unit_id");
+
+    using classtype = UnitId<packed>;
+
+    static constexpr unsigned exponent_count() { return helper::id::count(packed); }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::id::exponent(packed, i); }
+};
+
+// the UnitId of any unit representation of up to seven dimensions
+template <typename U>
+using unit_id = UnitId<helper::id::Pack<U>::value()>;
+
+namespace helper {
+
+namespace id {
+
+template <typename U1, typename U2, int sign>
+struct Combined {
+    static constexpr TPacked l = Pack<U1>::value();
+    static constexpr TPacked r = Pack<U2>::value();
+    static_assert(count(l) == count(r), "units of different unit systems");
+    static_assert(sumFits(l, r, sign), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<sum(l, r, sign)>;
+};
+
+template <typename U1, typename U2>
+struct IdProduct : Combined<U1, U2, 1> {};
+
+template <typename U1, typename U2>
+struct IdQuotient : Combined<U1, U2, -1> {};
+}
+
+namespace op {
+
+template <std::uint64_t packed, typename U2>
+struct Product<UnitId<packed>, U2> : id::IdProduct<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Product<U1, UnitId<packed>> : id::IdProduct<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Product<UnitId<l>, UnitId<r>> : id::IdProduct<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Product<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdProduct<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Product<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdProduct<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, typename U2>
+struct Quotient<UnitId<packed>, U2> : id::IdQuotient<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Quotient<U1, UnitId<packed>> : id::IdQuotient<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Quotient<UnitId<l>, UnitId<r>> : id::IdQuotient<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdQuotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Quotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdQuotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Product<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Product<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, 1> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Quotient<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Quotient<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, -1> {};
+
+template <std::uint64_t packed, typename fract>
+struct Raised<UnitId<packed>, fract> {
+    static_assert(id::divisible(packed, fract::num, fract::den), "rasing a unit to a fractional-power is not allowed");
+    static_assert(id::raiseFits(packed, fract::num, fract::den), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<id::raise(packed, fract::num, fract::den)>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <std::uint64_t packed>
+struct DenseUnit<UnitId<packed>> {
+    using type = typename op::UnitOperator<id::count(packed) - 1, UnitId<packed>, std::ratio<1>, op::multiply>::type;
+};
+
+template <std::uint64_t packed>
+struct PrintedAs<UnitId<packed>> {
+    using type = typename DenseUnit<UnitId<packed>>::type;
+};
+}
+}
+
+}
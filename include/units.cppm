@@ -0,0 +1,7 @@
+// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit
+
+export module units;
+
+export import :core;
+export import :constants;
+
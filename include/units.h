@@ -1,76 +1,46 @@
 #pragma once
 
-#include <ratio>
-#include <ctgmath>
-
-#ifndef UNIT_BASETYPE
-#define UNIT_BASETYPE double 
-#endif 
+// generated from devel/src by devel/tools/SingleFileGenerator.cpp, do not edit
 
-#ifndef UNIT_NO_STREAMS 
-#define UNIT_HAS_STREAMS
-#endif 
-
-#ifdef UNIT_HAS_STREAMS
-#include <iostream>
-#include <sstream>
-#endif 
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctgmath>
+#include <ostream>
+#include <ratio>
+#include <type_traits>
+#include <utility>
 
+// src/unit/unitTypes.h
 namespace unit {
 
-template <typename Unit, typename MagnitudeRepresentation = UNIT_BASETYPE>
-class Quantity {
-    template <typename, typename>
-    friend class Quantity;
-
-   public:
-    using unit = Unit;
-    using magnitude_type = MagnitudeRepresentation;
-    using classtype = Quantity<unit, magnitude_type>;
-
-    constexpr explicit Quantity() : m_magnitude(0) {}
-    constexpr explicit Quantity(magnitude_type const& v) : m_magnitude(v) {}
-
-    constexpr Quantity(classtype const& v) = default;
-
-    template <typename R>
-    constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
-
-    classtype& operator=(classtype const& v) = default;
-
-    constexpr magnitude_type const& magnitude() const { return m_magnitude; }
-
-   private:
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator+=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator-=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator*=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    template <typename U, typename L, typename R>
-    friend constexpr Quantity<U, L>& operator/=(Quantity<U, L>&, Quantity<U, R> const&);
-
-    magnitude_type m_magnitude;
-};
-
 using TExponent = int;
-using ExponentIndex = int;
+using ExponentIndex = int;  // cannot be unsigned since UnitOperator uses -1 for recursion abortion
 using DimensionIndex = int;
+}
+
+// src/unit/unitHelper.h
+namespace unit {
 
 template <TExponent... dimensionExponents>
 struct Unit;
 
-namespace helper {
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit;
 
+namespace helper {
 
+// helper to shorten access
 template <typename Unit, ExponentIndex i>
 constexpr TExponent exponent() {
     return Unit::template exponent_value<i>();
 }
 
+constexpr TExponent gcd(TExponent a, TExponent b) {
+    return b == 0 ? (a < 0 ? -a : a) : gcd(b, a % b);
+}
+
 namespace nthElement {
 
 using Index = unsigned int;
@@ -86,6 +56,19 @@ struct NthElement<0, Arg, Args...> {
 };
 }
 
+namespace rational {
+
+template <TExponent... values>
+struct Gcd {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <TExponent v, TExponent... values>
+struct Gcd<v, values...> {
+    static constexpr TExponent value() { return gcd(v, Gcd<values...>::value()); }
+};
+}
+
 namespace baseunit {
 
 template <DimensionIndex it, DimensionIndex index, TExponent... exponents>
@@ -97,11 +80,112 @@ template <DimensionIndex index, TExponent... exponents>
 struct BaseUnitGen<-1, index, exponents...> {
     using type = Unit<exponents...>;
 };
+
+// the base unit of dimension index in the unit system of U, specialized by other unit representations
+template <typename U, DimensionIndex index>
+struct BaseUnitOf {
+    using type = typename BaseUnitGen<U::exponent_count() - 1, index>::type;
+};
 }
+
+// U as Unit<exponents...>, specialized by other unit representations
+template <typename U>
+struct DenseUnit;
+
+template <TExponent... exponents>
+struct DenseUnit<Unit<exponents...>> {
+    using type = Unit<exponents...>;
+};
+
+// whether U1 and U2 are different representations of the same unit, eg a SparseUnit and a Unit
+template <typename U1, typename U2>
+struct EquivalentUnits {
+    template <typename A, typename B>
+    static constexpr bool dense(typename DenseUnit<A>::type*, typename DenseUnit<B>::type*) {
+        return std::is_same<typename DenseUnit<A>::type, typename DenseUnit<B>::type>::value;
+    }
+
+    // representations without a DenseUnit, like RationalUnit
+    template <typename A, typename B>
+    static constexpr bool dense(...) {
+        return false;
+    }
+
+    static constexpr bool value() { return !std::is_same<U1, U2>::value && dense<U1, U2>(nullptr, nullptr); }
+};
+
+// the unit whose print_unit prints U, specialized by representations printed like another one
+template <typename U>
+struct PrintedAs {
+    using type = U;
+};
 }
 
 template <int dimension, int lastDimension>
 using BaseUnit = typename helper::baseunit::BaseUnitGen<lastDimension, dimension>::type;
+}
+
+// src/quantity/Quantity.h
+// the default magnitude type, can be defined before the first include
+#ifndef UNIT_BASETYPE
+#define UNIT_BASETYPE double
+#endif
+
+// namespace scope constants, inline since c++17 so that they have external linkage and modules can export them
+#if __cplusplus >= 201703L
+#define UNIT_CONSTANT inline constexpr
+#else
+#define UNIT_CONSTANT constexpr
+#endif
+
+namespace unit {
+
+template <typename Unit, typename MagnitudeRepresentation = UNIT_BASETYPE>
+class Quantity {
+    template <typename, typename>
+    friend class Quantity;
+
+   public:
+    using unit = Unit;
+    using magnitude_type = MagnitudeRepresentation;
+    using classtype = Quantity<unit, magnitude_type>;
+
+    constexpr explicit Quantity() : m_magnitude(0) {}
+    constexpr explicit Quantity(magnitude_type const& v) : m_magnitude(v) {}
+
+    constexpr Quantity(classtype const& v) = default;
+    constexpr Quantity(classtype &&) = default;
+
+    template <typename R>
+    constexpr Quantity(Quantity<unit, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    // the same unit in another representation, eg a SparseUnit or a UnitId
+    template <typename U, typename R, typename = typename std::enable_if<helper::EquivalentUnits<U, unit>::value()>::type>
+    constexpr Quantity(Quantity<U, R> const& v) : m_magnitude(v.m_magnitude) {}
+
+    classtype& operator=(classtype const& v) = default;
+
+    constexpr magnitude_type const& magnitude() const { return m_magnitude; }
+
+   private:
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator+=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator-=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator*=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    template <typename U, typename L, typename R>
+    friend constexpr Quantity<U, L>& operator/=(Quantity<U, L>&, Quantity<U, R> const&);
+
+    magnitude_type m_magnitude;
+};
+}
+
+// src/unit/Unit.h
+namespace unit {
 
 template<TExponent ... dimensionExponents >
 struct Unit{
@@ -114,6 +198,34 @@ struct Unit{
     static constexpr TExponent exponent_value() { return helper::nthElement::NthElement<i,dimensionExponents...>::value(); }
 };
 
+/**
+ * unit with the rational exponents numerators / denominator, the result of raising a Unit to a
+ * fractional power, eg sqrt of a hertz:
+ *
+ *     raised_unit<Unit<0,0,-1,0,0,0,0>, std::ratio<1, 2>>  // RationalUnit<2, 0,0,-1,0,0,0,0>
+ *
+ * The fraction is reduced and the denominator at least 2, results with integer exponents are
+ * Units again. There is no exponent_value, code that expects integer exponents does not compile.
+ */
+template <TExponent denominator, TExponent... numerators>
+struct RationalUnit {
+    static_assert(denominator > 1, "a unit with integer exponents is a Unit");
+    static_assert(helper::rational::Gcd<denominator, numerators...>::value() == 1, "the exponents must be reduced");
+
+    using classtype = RationalUnit<denominator, numerators...>;
+
+    static constexpr unsigned exponent_count() { return sizeof...(numerators); }
+
+    static constexpr TExponent exponent_denominator() { return denominator; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_numerator() { return helper::nthElement::NthElement<i, numerators...>::value(); }
+};
+
+}
+
+// src/unit/unitOperators.h
+namespace unit {
 
 namespace helper {
 
@@ -145,24 +257,139 @@ template <typename U1, typename U2, template <class, class, int> class Op, TExpo
 struct UnitOperator<-1, U1, U2, Op, exponents...> {
     using type = Unit<exponents...>;
 };
+
+template <bool... values>
+struct AllOf {
+    static constexpr bool value() { return std::is_same<AllOf<values...>, AllOf<(values || true)...>>::value; }
+};
+}
+
+namespace rational {
+
+// Unit<numerators / denominator...> for integer exponents, the reduced RationalUnit otherwise
+template <TExponent denominator, TExponent... numerators>
+struct Reduced {
+    static constexpr TExponent g() { return Gcd<denominator, numerators...>::value(); }
+    using type = typename std::conditional<denominator == g(), Unit<numerators / g()...>,
+                                           RationalUnit<denominator / g(), numerators / g()...>>::type;
+};
+
+// the exponents of U as numerators, a Unit used as list, over a common denominator
+template <typename U>
+struct Fraction : Fraction<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct Fraction<Unit<exponents...>> {
+    static constexpr TExponent denominator() { return 1; }
+    using numerators = Unit<exponents...>;
+};
+
+template <TExponent d, TExponent... n>
+struct Fraction<RationalUnit<d, n...>> {
+    static constexpr TExponent denominator() { return d; }
+    using numerators = Unit<n...>;
+};
+
+template <TExponent d1, typename N1, TExponent d2, typename N2, int sign>
+struct Sum;
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2, int sign>
+struct Sum<d1, Unit<n1...>, d2, Unit<n2...>, sign> {
+    static_assert(sizeof...(n1) == sizeof...(n2), "units of different unit systems");
+    using type = typename Reduced<d1 / gcd(d1, d2) * d2, (n1 * (d2 / gcd(d1, d2)) + sign * n2 * (d1 / gcd(d1, d2)))...>::type;
+};
+
+template <typename U1, typename U2, int sign>
+struct Combined : Sum<Fraction<U1>::denominator(), typename Fraction<U1>::numerators,
+                      Fraction<U2>::denominator(), typename Fraction<U2>::numerators, sign> {};
+
+template <TExponent d, typename N, typename fract>
+struct Raise;
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raise<d, Unit<n...>, fract> {
+    using type = typename Reduced<static_cast<TExponent>(d * fract::den), static_cast<TExponent>(n * fract::num)...>::type;
+};
+
+template <typename U, typename fract>
+struct Power : Raise<Fraction<U>::denominator(), typename Fraction<U>::numerators, fract> {};
+
+// whether the primary Raised stays with integer exponents, other representations raise themselves
+template <typename U, typename fract>
+struct IntegerPower {
+    static constexpr bool value() { return true; }
+};
+
+template <TExponent... exponents, typename fract>
+struct IntegerPower<Unit<exponents...>, fract> {
+    static constexpr bool value() { return op::AllOf<(exponents * fract::num % fract::den == 0)...>::value(); }
+};
+}
+
+namespace op {
+
+// the operations on Unit<exponents...>, specialized by other unit representations
+template <typename U1, typename U2>
+struct Product {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, sum>::type;
+};
+
+template <typename U1, typename U2>
+struct Quotient {
+    using type = typename UnitOperator<U1::exponent_count() - 1, U1, U2, difference>::type;
+};
+
+// fractional powers give a RationalUnit
+template <typename U1, typename fract>
+struct Raised {
+    using type = typename std::conditional<rational::IntegerPower<U1, fract>::value(),
+                                           UnitOperator<U1::exponent_count() - 1, U1, fract, multiply>,
+                                           rational::Power<U1, fract>>::type::type;
+};
+
+// a RationalUnit with a Unit gives a RationalUnit or, for integer exponents, a Unit
+template <TExponent d, TExponent... n, typename U2>
+struct Product<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, 1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Product<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Product<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, 1> {};
+
+template <TExponent d, TExponent... n, typename U2>
+struct Quotient<RationalUnit<d, n...>, U2> : rational::Combined<RationalUnit<d, n...>, U2, -1> {};
+
+template <typename U1, TExponent d, TExponent... n>
+struct Quotient<U1, RationalUnit<d, n...>> : rational::Combined<U1, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d1, TExponent... n1, TExponent d2, TExponent... n2>
+struct Quotient<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>> : rational::Combined<RationalUnit<d1, n1...>, RationalUnit<d2, n2...>, -1> {};
+
+template <TExponent d, TExponent... n, typename fract>
+struct Raised<RationalUnit<d, n...>, fract> : rational::Power<RationalUnit<d, n...>, fract> {};
 }
 }
 
 template <typename U1, typename U2>
-using product_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::sum>::type;
+using product_unit = typename helper::op::Product<U1, U2>::type;
 
 template <typename U1, typename U2>
-using quotient_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, U2, helper::op::difference>::type;
+using quotient_unit = typename helper::op::Quotient<U1, U2>::type;
 
 template <typename U1, typename fract>
-using raised_unit = typename helper::op::UnitOperator<U1::exponent_count() - 1, U1, fract, helper::op::multiply>::type;
+using raised_unit = typename helper::op::Raised<U1, fract>::type;
 
 template <typename U>
 using sqare_unit = product_unit<U, U>;
+}
 
+// src/quantity/quantityOperators.h
+namespace unit {
 
-
-
+/**
+ *  This function casts eg from Quantity<x,double> -> Quantity<x,int>
+ */
 template <typename TDst, typename QSrc>
 constexpr Quantity<typename QSrc::unit, TDst> static_unit_cast(QSrc const& l) {
     return Quantity<typename QSrc::unit, TDst>{static_cast<TDst>(l.magnitude())};
@@ -247,25 +474,176 @@ constexpr Quantity<LU, LT> operator-(Quantity<LU, LT> const& l) {
     return Quantity<LU, LT>{-l.magnitude()};
 }
 
+namespace helper {
+
+template <typename LU, typename RU>
+using IfEquivalent = typename std::enable_if<EquivalentUnits<LU, RU>::value()>::type;
+}
+
+// the same unit in different representations, results have the representation of the left operand
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator+=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l += Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr Quantity<LU, LT>& operator-=(Quantity<LU, LT>& l, Quantity<RU, RT> const& r) {
+    return l -= Quantity<LU, RT>{r};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator+(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() + r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() + r.magnitude())>{l.magnitude() + r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr auto operator-(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r)
+    -> Quantity<LU, decltype(l.magnitude() - r.magnitude())> {
+    return Quantity<LU, decltype(l.magnitude() - r.magnitude())>{l.magnitude() - r.magnitude()};
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() < r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator<=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() <= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() > r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator>=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() >= r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator==(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() == r.magnitude();
+}
+
+template <typename LU, typename LT, typename RU, typename RT, typename = helper::IfEquivalent<LU, RU>>
+constexpr bool operator!=(Quantity<LU, LT> const& l, Quantity<RU, RT> const& r) {
+    return l.magnitude() != r.magnitude();
+}
+}
+
+// src/quantity/quantityMath.h
+namespace unit {
+
+namespace helper {
+
+namespace math {
+
+// brings the std overloads in scope of the unqualified calls below. Without them the
+// trailing return types would pick up eg ::abs(int) for double arguments. Magnitude types
+// from other namespaces are still found by adl.
+using std::abs;
+using std::sqrt;
+using std::pow;
+
+template <typename T>
+constexpr auto abs_impl(T const& v) -> decltype(abs(v)) {
+    return abs(v);
+}
+
+template <typename T>
+constexpr auto sqrt_impl(T const& v) -> decltype(sqrt(v)) {
+    return sqrt(v);
+}
+
+template <typename power, typename T>
+struct Pow {
+    using result_type = decltype(pow(std::declval<T const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static constexpr result_type apply(T const& v) {
+        return pow(v, static_cast<double>(power::num) / static_cast<double>(power::den));
+    }
+};
+
+// complex fast paths: std::pow(complex, double) goes through exp and log,
+// small integer and half powers are done by multiplication and sqrt instead.
+// v is already converted to the result type, eg complex<float> to complex<double>
+template <typename C, std::intmax_t num, std::intmax_t den>
+struct ComplexPow {
+    static C apply(C const& v) { return pow(v, static_cast<double>(num) / static_cast<double>(den)); }
+};
+
+template <typename C>
+struct ComplexPow<C, 0, 1> {
+    static C apply(C const&) { return C{1}; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 1> {
+    static C apply(C const& v) { return v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 2, 1> {
+    static C apply(C const& v) { return v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 1> {
+    static C apply(C const& v) { return v * v * v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 4, 1> {
+    static C apply(C const& v) { return (v * v) * (v * v); }
+};
+
+template <typename C>
+struct ComplexPow<C, -1, 1> {
+    static C apply(C const& v) { return C{1} / v; }
+};
+
+template <typename C>
+struct ComplexPow<C, 1, 2> {
+    static C apply(C const& v) { return sqrt(v); }
+};
+
+template <typename C>
+struct ComplexPow<C, 3, 2> {
+    static C apply(C const& v) { return v * sqrt(v); }
+};
+
+template <typename power, typename T>
+struct Pow<power, std::complex<T>> {
+    using result_type = decltype(pow(std::declval<std::complex<T> const&>(), static_cast<double>(power::num) / static_cast<double>(power::den)));
+
+    static result_type apply(std::complex<T> const& v) {
+        return ComplexPow<result_type, power::num, power::den>::apply(result_type{v});
+    }
+};
+}
+
+}
 
 template <typename U, typename T>
 constexpr auto
 abs(Quantity<U, T> const& q)
-        -> Quantity<U, decltype(abs(q.magnitude()))>
+        -> Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>
 {
-    using std::abs;
-    return Quantity<U, decltype(abs(q.magnitude()))>{
-                                abs(q.magnitude())};
+    return Quantity<U, decltype(helper::math::abs_impl(q.magnitude()))>{
+                                helper::math::abs_impl(q.magnitude())};
 }
 
 template <typename U, typename T>
 constexpr auto
 sqrt(Quantity<U, T> const& q)
-        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>
+        -> Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>
 {
-    using std::sqrt;
-    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(sqrt(q.magnitude()))>{
-                                                               sqrt(q.magnitude())};
+    return Quantity<raised_unit<U, std::ratio<1, 2>>, decltype(helper::math::sqrt_impl(q.magnitude()))>{
+                                                               helper::math::sqrt_impl(q.magnitude())};
 }
 
 namespace helper {
@@ -273,18 +651,17 @@ namespace helper {
 template <typename power, typename T>
 constexpr auto
 pow_impl(T const& v)
- -> decltype(pow(v, static_cast<UNIT_BASETYPE>(power::num) / static_cast<UNIT_BASETYPE>(power::den)))
+ -> typename math::Pow<power, T>::result_type
 
 {
-    using std::pow;
-    return pow(v, static_cast<UNIT_BASETYPE>(power::num) / static_cast<UNIT_BASETYPE>(power::den));
+    return math::Pow<power, T>::apply(v);
 }
 
 }
 
 template <typename power, typename U, typename T>
 constexpr auto
-pow(Quantity<U, T> const& q)
+pow(Quantity<U, T> const& q)  // cmath pow function has dynamic exponent and therefore dynamic return unit type and therefore cannot be realized by Quantity
         -> Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>
 {
     return Quantity<raised_unit<U, power>, decltype(helper::pow_impl<power, T>(q.magnitude()))>{
@@ -309,15 +686,953 @@ square(Quantity<U, T> const& q)
                                                  q.magnitude() * q.magnitude()};
 }
 
+}
 
+// src/unit/unitScaling.h
+namespace unit {
+namespace helper {
+
+template <typename ratioIn, typename ratioOut, typename T>
+constexpr T rescale(T const& v) {
+    using r = std::ratio_divide<ratioIn, ratioOut>;
+    return v * T{r::num} / T{r::den};
+}
+
+template <typename ratioIn, typename T>
+constexpr T rescaleTo1(T const& v) {
+    return rescale<ratioIn, std::ratio<1>, T>(v);
+}
+}
+
+template<typename T> constexpr T femto(T const& v) { return helper::rescaleTo1<std::femto>(v); }
+template<typename T> constexpr T pico(T const& v) { return helper::rescaleTo1<std::pico>(v); }
+template<typename T> constexpr T nano(T const& v) { return helper::rescaleTo1<std::nano>(v); }
+template<typename T> constexpr T micro(T const& v) { return helper::rescaleTo1<std::micro>(v); }
+template<typename T> constexpr T milli(T const& v) { return helper::rescaleTo1<std::milli>(v); }
+template<typename T> constexpr T centi(T const& v) { return helper::rescaleTo1<std::centi>(v); }
+template<typename T> constexpr T deci(T const& v) { return helper::rescaleTo1<std::deci>(v); }
+template<typename T> constexpr T deca(T const& v) { return helper::rescaleTo1<std::deca>(v); }
+template<typename T> constexpr T hecto(T const& v) { return helper::rescaleTo1<std::hecto>(v); }
+template<typename T> constexpr T kilo(T const& v) { return helper::rescaleTo1<std::kilo>(v); }
+template<typename T> constexpr T mega(T const& v) { return helper::rescaleTo1<std::mega>(v); }
+template<typename T> constexpr T giga(T const& v) { return helper::rescaleTo1<std::giga>(v); }
+template<typename T> constexpr T tera(T const& v) { return helper::rescaleTo1<std::tera>(v); }
+template<typename T> constexpr T peta(T const& v) { return helper::rescaleTo1<std::peta>(v); }
+
+}
+
+// src/unit/unitHash.h
+namespace unit {
+namespace helper {
+namespace hash {
+
+using THash = std::uint32_t;
+
+constexpr THash rotl(THash x, unsigned r) { return static_cast<THash>((x << r) | (x >> (32 - r))); }
+
+constexpr THash xorShift(THash h, unsigned shift) { return h ^ (h >> shift); }
+
+// murmur3 finalizer
+constexpr THash mix(THash h) {
+    return xorShift(static_cast<THash>(xorShift(static_cast<THash>(xorShift(h, 16) * 0x85ebca6bu), 13) * 0xc2b2ae35u), 16);
+}
+
+namespace murmur {
+
+// up to four characters as little endian word, compilers merge this into a single load
+constexpr THash block(char const* s, std::size_t n) {
+    return n == 0 ? 0 : static_cast<THash>(static_cast<unsigned char>(s[0]) | (block(s + 1, n - 1) << 8));
+}
+
+constexpr THash scramble(THash k) { return static_cast<THash>(rotl(static_cast<THash>(k * 0xcc9e2d51u), 15) * 0x1b873593u); }
+
+constexpr THash body(char const* s, std::size_t n, THash h) {
+    return n < 4 ? (n == 0 ? h : h ^ scramble(block(s, n)))
+                 : body(s + 4, n - 4, static_cast<THash>(rotl(h ^ scramble(block(s, 4)), 13) * 5u + 0xe6546b64u));
+}
+}
+
+/**
+ * murmur3 (32 bit) of the first n characters of s, constexpr so that generated tables can be
+ * checked at compile time. Four characters are consumed per step, which keeps short keys cheap.
+ */
+constexpr THash murmur3(char const* s, std::size_t n, THash seed = 0) {
+    return mix(murmur::body(s, n, seed) ^ static_cast<THash>(n));
+}
+
+constexpr std::size_t length(char const* s) { return *s == '\0' ? 0 : 1 + length(s + 1); }
+
+// rehash of the key hash h, distinct seeds give independent slots for the same key
+constexpr THash seeded(THash h, THash seed) {
+    return mix(h ^ static_cast<THash>(seed * 0x9e3779b9u));
+}
+
+/**
+ * slot of a key hash in a minimal perfect hash table (hash and displace): the bucket of the
+ * key selects a seed which was chosen by the generator of the table such that all keys land
+ * on distinct slots. The string is hashed once only, the seeds just remix its hash.
+ */
+constexpr std::size_t slot(THash h, THash const* displacements, std::size_t buckets, std::size_t size) {
+    return seeded(h, displacements[h % buckets]) % size;
+}
+
+/**
+ * O(1) lookup in a perfect hash table of entries with a member name, unknown keys end up on
+ * some slot and are rejected by a single string comparison
+ */
+template <typename Entry>
+Entry const* find(Entry const* table, std::size_t size, THash const* displacements, std::size_t buckets, char const* key, std::size_t n) {
+    if (size == 0) return nullptr;
+    Entry const& e = table[slot(murmur3(key, n), displacements, buckets, size)];
+    return std::strncmp(e.name, key, n) == 0 && e.name[n] == '\0' ? &e : nullptr;
+}
+
+template <typename Entry, std::size_t size, std::size_t buckets>
+Entry const* find(Entry const (&table)[size], THash const (&displacements)[buckets], char const* key, std::size_t n) {
+    return find(table, size, displacements, buckets, key, n);
+}
+}
+}
+}
+
+// src/unit/unitSymbols.h
+namespace unit {
+
+namespace helper {
+
+namespace conversion {
+
+constexpr double pow10(int e) { return e == 0 ? 1.0 : 10.0 * pow10(e - 1); }
+
+// rounds once only if exp10 is 0 and num and den are exactly representable, otherwise the result can
+// miss the nearest double by an ulp, the generated conversions use correctly rounded literals instead
+constexpr double factor(std::intmax_t num, std::intmax_t den, int exp10) {
+    return exp10 >= 0 ? static_cast<double>(num) * pow10(exp10) / static_cast<double>(den)
+                      : static_cast<double>(num) / (static_cast<double>(den) * pow10(-exp10));
+}
+
+// other unit representations compare as Unit<exponents...>
+template <typename U>
+struct Exponents : Exponents<typename DenseUnit<U>::type> {};
+
+// other are the numerators of exponents over a common denominator
+template <TExponent... exponents>
+struct Exponents<Unit<exponents...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {exponents...};
+        for (std::size_t i = 0; i < sizeof...(exponents); ++i)
+            if (own[i] * denominator != other[i]) return false;
+        return true;
+    }
+};
+
+template <TExponent d, TExponent... numerators>
+struct Exponents<RationalUnit<d, numerators...>> {
+    static bool equal(TExponent const* other, TExponent denominator = 1) {
+        const TExponent own[] = {numerators...};
+        for (std::size_t i = 0; i < sizeof...(numerators); ++i)
+            if (own[i] * denominator != other[i] * d) return false;
+        return true;
+    }
+};
+}
+}
+
+/**
+ * exact conversion factor ratio * 10^exp10, the decimal exponent keeps factors like
+ * 1.602176634e-19 exact whose denominator does not fit into std::ratio
+ */
+template <typename ratio, int exp10 = 0>
+struct exact_factor {
+    using type = ratio;
+    static constexpr int decimal_exponent() { return exp10; }
+    static constexpr double value() { return helper::conversion::factor(ratio::num, ratio::den, exp10); }
+};
+
+/**
+ * entry of a runtime conversion table: value in unit name == value * factor in the coherent unit with the given exponents
+ */
+template <std::size_t dimensions>
+struct ConversionEntry {
+    char const* name;
+    double factor;
+    std::intmax_t num;
+    std::intmax_t den;
+    int exp10;
+    TExponent exponents[dimensions];
+};
+
+namespace helper {
+
+namespace conversion {
+
+template <typename U>
+struct EntryOf : EntryOf<typename DenseUnit<U>::type> {};
+
+template <TExponent... exponents>
+struct EntryOf<Unit<exponents...>> {
+    static constexpr ConversionEntry<sizeof...(exponents)> make(char const* name, std::intmax_t num, std::intmax_t den) {
+        return ConversionEntry<sizeof...(exponents)>{name, factor(num, den, 0), num, den, 0, {exponents...}};
+    }
+};
+}
+}
+
+/**
+ * entry of a unit symbol, eg conversion_entry<u::newton>("N") or conversion_entry<u::kilogram>("g", 1, 1000)
+ */
+template <typename U>
+constexpr ConversionEntry<U::exponent_count()> conversion_entry(char const* name, std::intmax_t num = 1, std::intmax_t den = 1) {
+    return helper::conversion::EntryOf<U>::make(name, num, den);
+}
+
+namespace helper {
+
+namespace symbols {
+
+// units named by their print_unit output
+template <typename... U>
+struct Printed {};
+}
+}
+
+/**
+ * symbols of the unit system with the given number of dimensions, used by parsing and reading.
+ * Specialized by the system definition (eg quantityDefinitionsSI.h) with
+ *
+ *     using printed = helper::symbols::Printed<units...>;
+ *     static ConversionEntry<dimensions> const* spellings();
+ *     static std::size_t spelling_count();
+ *
+ * printed lists the units whose print_unit output is a symbol, spellings are further symbols and
+ * scaled units. Systems without symbols only read their printed units.
+ */
+template <std::size_t dimensions>
+struct UnitSymbols {
+    using printed = helper::symbols::Printed<>;
+    static ConversionEntry<dimensions> const* spellings() { return nullptr; }
+    static std::size_t spelling_count() { return 0; }
+};
+}
+
+// src/quantity/quantityConversion.h
+namespace unit {
+
+/**
+ * converts value given in the unit of entry to out, false if there is no entry or its dimension is not the one of U
+ */
+template <typename U, typename T, std::size_t dimensions>
+bool to_quantity(ConversionEntry<dimensions> const* entry, T const& value, Quantity<U, T>& out) {
+    static_assert(U::exponent_count() == dimensions, "conversion table of another unit system");
+    if (entry == nullptr || !helper::conversion::Exponents<U>::equal(entry->exponents)) return false;
+    out = Quantity<U, T>{value * static_cast<T>(entry->factor)};
+    return true;
+}
+}
+
+// src/quantity/quantityDefinitionsSI.h
+namespace unit {
+
+namespace u { //units
+
+//these units are taken from https://en.wikipedia.org/wiki/International_System_of_Units
+
+//base units
+using unitless = BaseUnit<-1,6>;// == Unit<0,...,0>
+
+using    meter = BaseUnit<0,6>; // == Unit<1,0,...,0>
+using kilogram = BaseUnit<1,6>;
+using   second = BaseUnit<2,6>;
+using   ampere = BaseUnit<3,6>;
+using   kelvin = BaseUnit<4,6>;
+using     mole = BaseUnit<5,6>;
+using  candela = BaseUnit<6,6>; // == Unit<0,...,0,1>
+
+//derived units
+using    radian = unitless;
+using steradian = unitless;
+using     hertz = quotient_unit< unitless, second>;
+using    newton = quotient_unit< product_unit<kilogram, meter>, sqare_unit<second>>;
+using    pascal = quotient_unit< newton,  sqare_unit<meter>>;
+using     joule = product_unit<  newton,  meter>;
+using      watt = quotient_unit< joule,   second>;
+using   coulomb = product_unit<  second,  ampere>;
+using      volt = quotient_unit< watt,    ampere>;
+using     farad = quotient_unit< coulomb, volt>;
+using       ohm = quotient_unit< volt,    ampere>;
+using   siemens = quotient_unit< ampere,  volt>;
+using     weber = product_unit<  volt,    second>;
+using     tesla = quotient_unit< weber,   sqare_unit<meter>>;
+using     henry = quotient_unit< weber,   ampere>;
+using     lumen = product_unit<  candela, steradian>;
+using       lux = quotient_unit< lumen,   sqare_unit<meter>>;
+using becquerel = hertz;
+using      gray = quotient_unit< joule,   kilogram>;
+using   sievert = gray;
+using     katal = quotient_unit< mole,    second>;
+
+//useful custom units
+using meter_cubed              = product_unit<  meter, sqare_unit<meter>>;
+using meter_per_second         = quotient_unit< meter, second>;
+using meter_per_second_squared = quotient_unit< meter, sqare_unit<second>>;
+
+using mol_inv   = quotient_unit< unitless, mole>;
+
+}
+
+namespace t { //quantity types
+
+    using def = UNIT_BASETYPE; //default representation
+
+    //base units
+    using unitless = Quantity<u::unitless, def>;
+    using    meter = Quantity<u::meter,    def>;
+    using kilogram = Quantity<u::kilogram, def>;
+    using   second = Quantity<u::second,   def>;
+    using   ampere = Quantity<u::ampere,   def>;
+    using   kelvin = Quantity<u::kelvin,   def>;
+    using     mole = Quantity<u::mole,     def>;
+    using  candela = Quantity<u::candela,  def>;
+
+    //derived units
+    using    radian = Quantity<u::radian,    def>;
+    using steradian = Quantity<u::steradian, def>;
+    using     hertz = Quantity<u::hertz,     def>;
+    using    newton = Quantity<u::newton,    def>;
+    using    pascal = Quantity<u::pascal,    def>;
+    using     joule = Quantity<u::joule,     def>;
+    using      watt = Quantity<u::watt,      def>;
+    using   coulomb = Quantity<u::coulomb,   def>;
+    using      volt = Quantity<u::volt,      def>;
+    using     farad = Quantity<u::farad,     def>;
+    using       ohm = Quantity<u::ohm,       def>;
+    using   siemens = Quantity<u::siemens,   def>;
+    using     weber = Quantity<u::weber,     def>;
+    using     tesla = Quantity<u::tesla,     def>;
+    using     henry = Quantity<u::henry,     def>;
+    using     lumen = Quantity<u::lumen,     def>;
+    using       lux = Quantity<u::lux,       def>;
+    using becquerel = Quantity<u::becquerel, def>;
+    using      gray = Quantity<u::gray,      def>;
+    using   sievert = Quantity<u::sievert,   def>;
+    using     katal = Quantity<u::katal,     def>;
+
+    //custom units
+    using meter_cubed = Quantity<u::meter_cubed, def>;
+}
+
+UNIT_CONSTANT t::unitless unitless{1};
+UNIT_CONSTANT t::unitless number{1};
+UNIT_CONSTANT    t::meter meter{1};
+UNIT_CONSTANT t::kilogram kilogram{1};
+UNIT_CONSTANT   t::second second{1};
+UNIT_CONSTANT   t::ampere ampere{1};
+UNIT_CONSTANT   t::kelvin kelvin{1};
+UNIT_CONSTANT     t::mole mole{1};
+UNIT_CONSTANT  t::candela candela{1};
+
+//derived units
+UNIT_CONSTANT    t::radian radian{1};
+UNIT_CONSTANT t::steradian steradian{1};
+UNIT_CONSTANT     t::hertz hertz{1};
+UNIT_CONSTANT    t::newton newton{1};
+UNIT_CONSTANT    t::pascal pascal{1};
+UNIT_CONSTANT     t::joule joule{1};
+UNIT_CONSTANT      t::watt watt{1};
+UNIT_CONSTANT   t::coulomb coulomb{1};
+UNIT_CONSTANT      t::volt volt{1};
+UNIT_CONSTANT     t::farad farad{1};
+UNIT_CONSTANT       t::ohm ohm{1};
+UNIT_CONSTANT   t::siemens siemens{1};
+UNIT_CONSTANT     t::weber weber{1};
+UNIT_CONSTANT     t::tesla tesla{1};
+UNIT_CONSTANT     t::henry henry{1};
+UNIT_CONSTANT     t::lumen lumen{1};
+UNIT_CONSTANT       t::lux lux{1};
+UNIT_CONSTANT t::becquerel becquerel{1};
+UNIT_CONSTANT      t::gray gray{1};
+UNIT_CONSTANT   t::sievert sievert{1};
+UNIT_CONSTANT     t::katal katal{1};
+
+//according to https://www.nist.gov/sites/default/files/documents/pml/wmd/metric/SP1038.pdf
+UNIT_CONSTANT       t::meter inch{centi(2.54)}; //(ft)
+UNIT_CONSTANT       t::meter food{0.3048}; //(ft)
+UNIT_CONSTANT       t::meter mile{1609.344}; //international (5280 ft)(mi)
+UNIT_CONSTANT       t::meter yard{0.9144}; //(yd)
+UNIT_CONSTANT    t::kilogram pound{0.45359237}; //avoirdupois
+UNIT_CONSTANT    t::kilogram ounce{0.02834952}; //avoirdupois
+UNIT_CONSTANT    t::kilogram gram{helper::rescale<std::ratio<1>,std::kilo>(1.0)};
+UNIT_CONSTANT      t::second minute{60};
+UNIT_CONSTANT      t::second hour{60*60};
+UNIT_CONSTANT      t::second day{60*60*24};
+UNIT_CONSTANT       t::joule calorie{4.184}; //pyhsical unit!
+UNIT_CONSTANT       t::joule watt_hour{3600};
+UNIT_CONSTANT t::meter_cubed liter{0.001};
+UNIT_CONSTANT t::meter_cubed gallon{3.785412 * 0.001};
+UNIT_CONSTANT      t::pascal bar{kilo(100)};
+UNIT_CONSTANT    t::unitless parts_per_million{micro(1.0)};
+UNIT_CONSTANT    t::unitless percent{centi(1.0)};
+
+//temperature
+constexpr    t::kelvin     celsius ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>(v+273.15)};}
+constexpr    t::kelvin  fahrenheit ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>((v+459.67)*5.0/9.0)};}
+
+namespace literals {
+
+constexpr   t::unitless operator"" _unitless ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""   _number ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::unitless operator""        _n ( long double v )  {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
+constexpr   t::newton   operator""   _newton ( long double v )  {return   t::newton {static_cast<UNIT_BASETYPE>(v)};}
+
+}
+
+template<typename U> constexpr const char* unitSymbol();
+template<> inline constexpr const char* unitSymbol<   u::meter>(){ return "m";}
+template<> inline constexpr const char* unitSymbol<u::kilogram>(){ return "kg";}
+template<> inline constexpr const char* unitSymbol<  u::second>(){ return "s";}
+template<> inline constexpr const char* unitSymbol<  u::ampere>(){ return "A";}
+template<> inline constexpr const char* unitSymbol<  u::kelvin>(){ return "K";}
+template<> inline constexpr const char* unitSymbol<    u::mole>(){ return "mol";}
+template<> inline constexpr const char* unitSymbol< u::candela>(){ return "cd";}
+
+//derived units
+
+template<typename U> void print_unit(std::ostream& s);
+//template<> void print_unit<   def::radian>(std::ostream& s){ s<<"rad"; }
+//template<> inline void print_unit<def::steradian>(std::ostream& s){ s<<"sr"; }
+template<> inline void print_unit<    u::hertz>(std::ostream& s){ s<<"Hz"; }
+template<> inline void print_unit<   u::newton>(std::ostream& s){ s<<"N"; }
+template<> inline void print_unit<   u::pascal>(std::ostream& s){ s<<"Pa"; }
+template<> inline void print_unit<    u::joule>(std::ostream& s){ s<<"J"; }
+template<> inline void print_unit<     u::watt>(std::ostream& s){ s<<"W"; }
+template<> inline void print_unit<  u::coulomb>(std::ostream& s){ s<<"C"; }
+template<> inline void print_unit<     u::volt>(std::ostream& s){ s<<"V"; }
+template<> inline void print_unit<    u::farad>(std::ostream& s){ s<<"F"; }
+template<> inline void print_unit<      u::ohm>(std::ostream& s){ s<<"Ohm"; }  //actually "Ω", but encoding problem
+template<> inline void print_unit<  u::siemens>(std::ostream& s){ s<<"S"; }
+template<> inline void print_unit<    u::weber>(std::ostream& s){ s<<"Wb"; }
+template<> inline void print_unit<    u::tesla>(std::ostream& s){ s<<"T"; }
+template<> inline void print_unit<    u::henry>(std::ostream& s){ s<<"H"; }
+template<> inline void print_unit<    u::lumen>(std::ostream& s){ s<<"lm"; }
+template<> inline void print_unit<      u::lux>(std::ostream& s){ s<<"Lx"; }
+//template<> inline void print_unit<becquerel>(std::ostream& s){ s<<"Bq"; }
+template<> inline void print_unit<     u::gray>(std::ostream& s){ s<<"Gy"; }
+//template<> inline void print_unit<  sievert>(std::ostream& s){ s<<"Sv"; }
+template<> inline void print_unit<    u::katal>(std::ostream& s){ s<<"ka"; }
+
+//symbols for parsing, the printed ones and some common spellings
+namespace helper {
+namespace si {
+
+// class template so that the header only table has a single definition
+template <typename = void>
+struct Spellings {
+    static constexpr ConversionEntry<7> entries[] = {
+        conversion_entry< u::candela>("cd"), //printed as lm, the steradian has no dimension
+        conversion_entry<u::kilogram>("g", 1, 1000),
+        conversion_entry<     u::ohm>("\xce\xa9"), //Ω
+        conversion_entry<     u::lux>("lx"),
+        conversion_entry<   u::katal>("kat"),
+        //non-si units accepted for use with the si
+        conversion_entry<      u::second>("min", 60),
+        conversion_entry<      u::second>("h", 3600),
+        conversion_entry<      u::second>("d", 86400),
+        conversion_entry<u::meter_cubed>("L", 1, 1000),
+        conversion_entry<u::meter_cubed>("l", 1, 1000),
+        conversion_entry<    u::kilogram>("t", 1000),
+        conversion_entry<sqare_unit<u::meter>>("ha", 10000),
+    };
+};
+
+template <typename T>
+constexpr ConversionEntry<7> Spellings<T>::entries[];
+}
+}
+
+template<> struct UnitSymbols<7> {
+    using printed = helper::symbols::Printed<u::meter, u::kilogram, u::second, u::ampere, u::kelvin, u::mole,
+        u::hertz, u::newton, u::pascal, u::joule, u::watt, u::coulomb, u::volt, u::farad, u::ohm,
+        u::siemens, u::weber, u::tesla, u::henry, u::lumen, u::lux, u::gray, u::katal>;
+    static ConversionEntry<7> const* spellings() { return helper::si::Spellings<>::entries; }
+    static std::size_t spelling_count() { return sizeof(helper::si::Spellings<>::entries) / sizeof(helper::si::Spellings<>::entries[0]); }
+};
+
+}
+
+// src/unit/SparseUnit.h
+namespace unit {
+
+// a dimension of a SparseUnit with its non-zero exponent
+template <DimensionIndex index, TExponent exponent>
+struct Dimension {};
+
+namespace helper {
+
+namespace sparse {
+
+template <typename... Dimensions>
+struct List {};
+
+template <DimensionIndex i, typename... Dimensions>
+struct Lookup {
+    static constexpr TExponent value() { return 0; }
+};
+
+template <DimensionIndex i, DimensionIndex d, TExponent e, typename... Dimensions>
+struct Lookup<i, Dimension<d, e>, Dimensions...> {
+    static constexpr TExponent value() { return i == d ? e : Lookup<i, Dimensions...>::value(); }
+};
+
+// sorted by index, unique, non-zero and within the unit system
+template <unsigned count, typename... Dimensions>
+struct Canonical {
+    static constexpr bool value() { return true; }
+};
+
+template <unsigned count, DimensionIndex d, TExponent e>
+struct Canonical<count, Dimension<d, e>> {
+    static constexpr bool value() { return d >= 0 && d < static_cast<DimensionIndex>(count) && e != 0; }
+};
+
+template <unsigned count, DimensionIndex d1, TExponent e1, DimensionIndex d2, TExponent e2, typename... Dimensions>
+struct Canonical<count, Dimension<d1, e1>, Dimension<d2, e2>, Dimensions...> {
+    static constexpr bool value() {
+        return d1 >= 0 && d1 < d2 && e1 != 0 && Canonical<count, Dimension<d2, e2>, Dimensions...>::value();
+    }
+};
+
+// appends the dimension unless its exponent is zero
+template <typename L, DimensionIndex d, TExponent e>
+struct Append;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Append<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimensions..., Dimension<d, e>>>::type;
+};
+
+// merges two sorted lists in a single pass, exponents of the same dimension are added
+template <typename L, typename R, typename Result = List<>>
+struct Merge;
+
+template <typename... Rs, typename... Result>
+struct Merge<List<>, List<Rs...>, List<Result...>> {
+    using type = List<Result..., Rs...>;
+};
+
+template <typename L, typename... Ls, typename... Result>
+struct Merge<List<L, Ls...>, List<>, List<Result...>> {
+    using type = List<Result..., L, Ls...>;
+};
+
+template <DimensionIndex a, TExponent x, typename... Ls, DimensionIndex b, TExponent y, typename... Rs, typename Result>
+struct Merge<List<Dimension<a, x>, Ls...>, List<Dimension<b, y>, Rs...>, Result> {
+    using type = typename std::conditional<
+        (a < b), Merge<List<Ls...>, List<Dimension<b, y>, Rs...>, typename Append<Result, a, x>::type>,
+        typename std::conditional<
+            (b < a), Merge<List<Dimension<a, x>, Ls...>, List<Rs...>, typename Append<Result, b, y>::type>,
+            Merge<List<Ls...>, List<Rs...>, typename Append<Result, a, x + y>::type>>::type>::type::type;
+};
+
+template <typename L>
+struct Negate;
+
+template <DimensionIndex... d, TExponent... e>
+struct Negate<List<Dimension<d, e>...>> {
+    using type = List<Dimension<d, -e>...>;
+};
+
+template <typename fract, typename L, typename Result = List<>>
+struct Raise {
+    using type = Result;
+};
+
+template <typename fract, DimensionIndex d, TExponent e, typename... Ls, typename Result>
+struct Raise<fract, List<Dimension<d, e>, Ls...>, Result> {
+    static_assert(e * fract::num % fract::den == 0, "rasing a unit to a fractional-power is not allowed");
+    using type = typename Raise<fract, List<Ls...>, typename Append<Result, d, e * fract::num / fract::den>::type>::type;
+};
+
+template <typename L, DimensionIndex d, TExponent e>
+struct Prepend;
+
+template <typename... Dimensions, DimensionIndex d, TExponent e>
+struct Prepend<List<Dimensions...>, d, e> {
+    using type = typename std::conditional<e == 0, List<Dimensions...>, List<Dimension<d, e>, Dimensions...>>::type;
+};
+
+template <typename U, ExponentIndex it = U::exponent_count() - 1, typename Result = List<>>
+struct ListOf {
+    using type = typename ListOf<U, it - 1, typename Prepend<Result, it, U::template exponent_value<it>()>::type>::type;
+};
+
+template <typename U, typename Result>
+struct ListOf<U, -1, Result> {
+    using type = Result;
+};
+
+// the non-zero dimensions of any unit representation
+template <typename U>
+struct DimensionsOf {
+    using type = typename ListOf<U>::type;
+};
+
+template <unsigned count, typename L>
+struct ToUnit;
+
+template <typename L>
+struct Canonicalize;
+
+template <typename U1, typename U2>
+struct SameSystem {
+    static_assert(U1::exponent_count() == U2::exponent_count(), "units of different unit systems");
+    static constexpr unsigned count() { return U1::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which stores only the non-zero exponents, eg
+ *
+ *     SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>  // == Unit<1,0,0,0,0,0,0,0,-1,0>
+ *
+ * The dimensions are sorted by index so that equal units are the same type, sparse_unit sorts
+ * them. product_unit, quotient_unit and raised_unit of SparseUnits merge the lists and cost the
+ * number of non-zero exponents instead of the number of dimensions, units with many dimensions
+ * therefore compile faster and have short type names. Everything else reads the exponents
+ * through exponent_value and works with both representations. Quantities of a SparseUnit and of
+ * the equal Unit convert into each other, add and compare.
+ */
+template <unsigned dimensions, typename... Dimensions>
+struct SparseUnit {
+    static_assert(helper::sparse::Canonical<dimensions, Dimensions...>::value(),
+                  "dimensions must be sorted, unique, non-zero and below the dimension count, see sparse_unit");
+
+    using classtype = SparseUnit<dimensions, Dimensions...>;
+
+    static constexpr unsigned exponent_count() { return dimensions; }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::sparse::Lookup<i, Dimensions...>::value(); }
+};
+
+namespace helper {
+
+namespace sparse {
+
+template <unsigned count, typename... Dimensions>
+struct ToUnit<count, List<Dimensions...>> {
+    using type = SparseUnit<count, Dimensions...>;
+};
+
+template <unsigned count, typename... Dimensions>
+struct DimensionsOf<SparseUnit<count, Dimensions...>> {
+    using type = List<Dimensions...>;
+};
+
+template <>
+struct Canonicalize<List<>> {
+    using type = List<>;
+};
+
+// sorts by inserting one dimension after the other
+template <DimensionIndex d, TExponent e, typename... Dimensions>
+struct Canonicalize<List<Dimension<d, e>, Dimensions...>> {
+    using type = typename Merge<typename Append<List<>, d, e>::type, typename Canonicalize<List<Dimensions...>>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseProduct {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename DimensionsOf<U2>::type>::type>::type;
+};
+
+template <typename U1, typename U2>
+struct SparseQuotient {
+    using type = typename ToUnit<SameSystem<U1, U2>::count(),
+                                 typename Merge<typename DimensionsOf<U1>::type, typename Negate<typename DimensionsOf<U2>::type>::type>::type>::type;
+};
+}
+
+namespace op {
+
+// a SparseUnit with a Unit gives a SparseUnit
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Product<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseProduct<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Product<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseProduct<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Product<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseProduct<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+template <unsigned dimensions, typename... Dimensions, typename U2>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, U2> : sparse::SparseQuotient<SparseUnit<dimensions, Dimensions...>, U2> {};
+
+template <typename U1, unsigned dimensions, typename... Dimensions>
+struct Quotient<U1, SparseUnit<dimensions, Dimensions...>> : sparse::SparseQuotient<U1, SparseUnit<dimensions, Dimensions...>> {};
+
+template <unsigned d1, typename... Ls, unsigned d2, typename... Rs>
+struct Quotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> : sparse::SparseQuotient<SparseUnit<d1, Ls...>, SparseUnit<d2, Rs...>> {};
+
+// and with a RationalUnit a RationalUnit
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Product<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Product<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, 1> {};
+
+template <unsigned dimensions, typename... Dimensions, TExponent d, TExponent... n>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>>
+    : rational::Combined<SparseUnit<dimensions, Dimensions...>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, unsigned dimensions, typename... Dimensions>
+struct Quotient<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>>
+    : rational::Combined<RationalUnit<d, n...>, SparseUnit<dimensions, Dimensions...>, -1> {};
+
+template <unsigned dimensions, typename... Dimensions, typename fract>
+struct Raised<SparseUnit<dimensions, Dimensions...>, fract> {
+    using type = typename sparse::ToUnit<dimensions, typename sparse::Raise<fract, sparse::List<Dimensions...>>::type>::type;
+};
+}
+
+namespace baseunit {
+
+template <unsigned dimensions, typename... Dimensions, DimensionIndex index>
+struct BaseUnitOf<SparseUnit<dimensions, Dimensions...>, index> {
+    using type = SparseUnit<dimensions, Dimension<index, 1>>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <unsigned dimensions, typename... Dimensions>
+struct DenseUnit<SparseUnit<dimensions, Dimensions...>> {
+    using type = typename op::UnitOperator<dimensions - 1, SparseUnit<dimensions, Dimensions...>, std::ratio<1>, op::multiply>::type;
+};
+}
+
+/**
+ * the SparseUnit of the given dimensions in any order, dimensions given twice are added
+ *
+ *     sparse_unit<10, Dimension<8, -1>, Dimension<0, 1>>  // SparseUnit<10, Dimension<0, 1>, Dimension<8, -1>>
+ */
+template <unsigned dimensions, typename... Dimensions>
+using sparse_unit = typename helper::sparse::ToUnit<
+    dimensions, typename helper::sparse::Canonicalize<helper::sparse::List<Dimensions...>>::type>::type;
+
+// like BaseUnit, dimension -1 gives the unit without dimensions
+template <int dimension, int lastDimension>
+using SparseBaseUnit = sparse_unit<lastDimension + 1, Dimension<dimension, dimension < 0 ? 0 : 1>>;
+}
+
+// src/unit/UnitId.h
+namespace unit {
+
+namespace helper {
+
+namespace id {
+
+using TPacked = std::uint64_t;
+
+/**
+ * the dimension count in the lowest 3 bits, then 6 bits per exponent, zigzag encoded so that
+ * small exponents of either sign give small numbers (0, -1, 1, -2 ... as 0, 1, 2, 3 ...) and
+ * the ids of common units have few digits
+ */
+constexpr unsigned maxDimensions() { return 7; }
+constexpr unsigned countBits() { return 3; }
+constexpr unsigned exponentBits() { return 6; }
+
+constexpr unsigned count(TPacked p) { return static_cast<unsigned>(p & ((TPacked{1} << countBits()) - 1)); }
+
+constexpr unsigned shift(unsigned i) { return countBits() + exponentBits() * i; }
+
+constexpr TExponent decode(TExponent z) { return z % 2 == 0 ? z / 2 : -(z + 1) / 2; }
+
+constexpr TExponent exponent(TPacked p, unsigned i) {
+    return decode(static_cast<TExponent>((p >> shift(i)) & ((TPacked{1} << exponentBits()) - 1)));
+}
+
+constexpr TPacked field(TExponent e, unsigned i) { return static_cast<TPacked>(e >= 0 ? 2 * e : -2 * e - 1) << shift(i); }
+
+constexpr bool fits(TExponent e) { return e >= -32 && e <= 31; }
+
+// nothing but exponents below the dimension count
+constexpr bool valid(TPacked p) { return count(p) <= maxDimensions() && p >> shift(count(p)) == 0; }
+
+constexpr TPacked sum(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(exponent(a, i) + sign * exponent(b, i), i) | sum(a, b, sign, i + 1);
+}
+
+constexpr bool sumFits(TPacked a, TPacked b, int sign, unsigned i = 0) {
+    return i == count(a) || (fits(exponent(a, i) + sign * exponent(b, i)) && sumFits(a, b, sign, i + 1));
+}
+
+constexpr TPacked raise(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) ? count(a) : field(static_cast<TExponent>(exponent(a, i) * num / den), i) | raise(a, num, den, i + 1);
+}
+
+constexpr bool divisible(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num % den == 0 && divisible(a, num, den, i + 1));
+}
+
+constexpr bool raiseFits(TPacked a, std::intmax_t num, std::intmax_t den, unsigned i = 0) {
+    return i == count(a) || (exponent(a, i) * num / den >= -32 && exponent(a, i) * num / den <= 31 && raiseFits(a, num, den, i + 1));
+}
+
+template <typename U, unsigned i = 0, bool = (i < U::exponent_count())>
+struct Pack {
+    static_assert(fits(U::template exponent_value<i>()), "exponents of a UnitId are within [-32, 31]");
+    static constexpr TPacked value() { return field(U::template exponent_value<i>(), i) | Pack<U, i + 1>::value(); }
+};
+
+template <typename U, unsigned i>
+struct Pack<U, i, false> {
+    static_assert(U::exponent_count() <= maxDimensions(), "a UnitId has seven dimensions at most");
+    static constexpr TPacked value() { return U::exponent_count(); }
+};
+}
+}
+
+/**
+ * alternative to Unit which is a single integer, for short symbol names and debug info:
+ *
+ *     Quantity<unit_id<u::newton>>  // Quantity<UnitId<99351ull>>
+ *
+ * instead of Quantity<Unit<1, 1, -2, 0, 0, 0, 0>> for seven dimensions. Equal units have the same
+ * id. product_unit, quotient_unit and raised_unit of UnitIds are UnitIds, as well as the result of
+ * combining a UnitId with another representation except RationalUnit, which stays rational.
+ * Quantities of a UnitId and of its Unit convert into each other, add and compare. UnitIds print
+ * like their Unit, eg "N".
+ */
+template <std::uint64_t packed>
+struct UnitId {
+    static_assert(helper::id::valid(packed), "not a packed unit, see unit_id");
+
+    using classtype = UnitId<packed>;
+
+    static constexpr unsigned exponent_count() { return helper::id::count(packed); }
+
+    template <ExponentIndex i>
+    static constexpr TExponent exponent_value() { return helper::id::exponent(packed, i); }
+};
+
+// the UnitId of any unit representation of up to seven dimensions
+template <typename U>
+using unit_id = UnitId<helper::id::Pack<U>::value()>;
+
+namespace helper {
+
+namespace id {
+
+template <typename U1, typename U2, int sign>
+struct Combined {
+    static constexpr TPacked l = Pack<U1>::value();
+    static constexpr TPacked r = Pack<U2>::value();
+    static_assert(count(l) == count(r), "units of different unit systems");
+    static_assert(sumFits(l, r, sign), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<sum(l, r, sign)>;
+};
+
+template <typename U1, typename U2>
+struct IdProduct : Combined<U1, U2, 1> {};
+
+template <typename U1, typename U2>
+struct IdQuotient : Combined<U1, U2, -1> {};
+}
+
+namespace op {
+
+template <std::uint64_t packed, typename U2>
+struct Product<UnitId<packed>, U2> : id::IdProduct<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Product<U1, UnitId<packed>> : id::IdProduct<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Product<UnitId<l>, UnitId<r>> : id::IdProduct<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Product<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdProduct<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Product<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdProduct<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, typename U2>
+struct Quotient<UnitId<packed>, U2> : id::IdQuotient<UnitId<packed>, U2> {};
+
+template <typename U1, std::uint64_t packed>
+struct Quotient<U1, UnitId<packed>> : id::IdQuotient<U1, UnitId<packed>> {};
+
+template <std::uint64_t l, std::uint64_t r>
+struct Quotient<UnitId<l>, UnitId<r>> : id::IdQuotient<UnitId<l>, UnitId<r>> {};
+
+template <unsigned dimensions, typename... Dimensions, std::uint64_t packed>
+struct Quotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> : id::IdQuotient<SparseUnit<dimensions, Dimensions...>, UnitId<packed>> {};
+
+template <std::uint64_t packed, unsigned dimensions, typename... Dimensions>
+struct Quotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> : id::IdQuotient<UnitId<packed>, SparseUnit<dimensions, Dimensions...>> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Product<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, 1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Product<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, 1> {};
+
+template <std::uint64_t packed, TExponent d, TExponent... n>
+struct Quotient<UnitId<packed>, RationalUnit<d, n...>> : rational::Combined<UnitId<packed>, RationalUnit<d, n...>, -1> {};
+
+template <TExponent d, TExponent... n, std::uint64_t packed>
+struct Quotient<RationalUnit<d, n...>, UnitId<packed>> : rational::Combined<RationalUnit<d, n...>, UnitId<packed>, -1> {};
+
+template <std::uint64_t packed, typename fract>
+struct Raised<UnitId<packed>, fract> {
+    static_assert(id::divisible(packed, fract::num, fract::den), "rasing a unit to a fractional-power is not allowed");
+    static_assert(id::raiseFits(packed, fract::num, fract::den), "exponents of a UnitId are within [-32, 31]");
+    using type = UnitId<id::raise(packed, fract::num, fract::den)>;
+};
+}
+
+// raising to the power of one reads every exponent
+template <std::uint64_t packed>
+struct DenseUnit<UnitId<packed>> {
+    using type = typename op::UnitOperator<id::count(packed) - 1, UnitId<packed>, std::ratio<1>, op::multiply>::type;
+};
+
+template <std::uint64_t packed>
+struct PrintedAs<UnitId<packed>> {
+    using type = typename DenseUnit<UnitId<packed>>::type;
+};
+}
+}
 
+#ifndef UNIT_NO_STREAMS
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <ios>
+#include <iostream>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+// src/unit/unitPrinting.h
+namespace unit {
 
 template <typename U>
 constexpr const char* unitSymbol();
 
+template <typename U>
+void print_unit(std::ostream& s);
+
 namespace helper {
-#ifdef UNIT_HAS_STREAMS
+
 namespace print {
 
 template <typename U, DimensionIndex pos>
@@ -325,7 +1640,7 @@ void print_unit_symbol_and_exponent(std::ostream& s) {
     static constexpr TExponent e = helper::exponent<U, pos>();
     if (e == 0)
         return;
-    s << unitSymbol<typename baseunit::BaseUnitGen<U::exponent_count() - 1, pos>::type>();
+    s << unitSymbol<typename baseunit::BaseUnitOf<U, pos>::type>();
     if (e != 1) {
         s << "^" << e;
     }
@@ -343,283 +1658,1002 @@ template <typename U>
 struct DimensionsPrinter<U, 0> {
     static void print_unit(std::ostream& s) { print_unit_symbol_and_exponent<U, 0>(s); }
 };
+
+// fractional exponents in brackets, eg "s^(-1/2)"
+template <typename U, DimensionIndex pos>
+void print_rational_symbol_and_exponent(std::ostream& s) {
+    static constexpr TExponent g = gcd(U::template exponent_numerator<pos>(), U::exponent_denominator());
+    static constexpr TExponent n = g == 0 ? 0 : U::template exponent_numerator<pos>() / g;
+    static constexpr TExponent d = g == 0 ? 1 : U::exponent_denominator() / g;
+    if (n == 0)
+        return;
+    s << unitSymbol<typename baseunit::BaseUnitOf<U, pos>::type>();
+    if (d != 1) {
+        s << "^(" << n << "/" << d << ")";
+    } else if (n != 1) {
+        s << "^" << n;
+    }
 }
-#endif //UNIT_HAS_STREAMS
-}
 
+template <typename U, DimensionIndex pos>
+struct RationalDimensionsPrinter {
+    static void print_unit(std::ostream& s) {
+        RationalDimensionsPrinter<U, pos - 1>::print_unit(s);
+        print_rational_symbol_and_exponent<U, pos>(s);
+    }
+};
+
+template <typename U>
+struct RationalDimensionsPrinter<U, 0> {
+    static void print_unit(std::ostream& s) { print_rational_symbol_and_exponent<U, 0>(s); }
+};
+
+template <typename U, typename Printed = typename PrintedAs<U>::type>
+struct UnitPrinter {
+    static void print(std::ostream& s) { unit::print_unit<Printed>(s); }
+};
+
+template <typename U>
+struct UnitPrinter<U, U> {
+    static void print(std::ostream& s) { DimensionsPrinter<U, U::exponent_count() - 1>::print_unit(s); }
+};
+
+template <TExponent d, TExponent... n>
+struct UnitPrinter<RationalUnit<d, n...>, RationalUnit<d, n...>> {
+    static void print(std::ostream& s) { RationalDimensionsPrinter<RationalUnit<d, n...>, sizeof...(n) - 1>::print_unit(s); }
+};
+}
+}
 
-#ifdef UNIT_HAS_STREAMS
+/**
+ * generic unit printing, can be spezialized for custom unit symbols
+ *
+ * eg prints
+ *
+ * - "m^10kg^11s^12A^13K^14mol^-15cd^16"
+ *     for calling print_unit<Unit<10,11,12,13,14,-15,16>>(cout)
+ * - "mkg"
+ *     for calling print_unit<Unit<1,1,0,0,0,0,0>>(cout);
+ * - "m^2kgs^(-5/2)A^-1"
+ *     for calling print_unit<RationalUnit<2,4,2,-5,-2,0,0,0>>(cout);
+ */
 template <typename U>
 void print_unit(std::ostream& s) {
-    helper::print::DimensionsPrinter<U, U::exponent_count() - 1>::print_unit(s);
+    helper::print::UnitPrinter<U>::print(s);
 }
 
-template <typename Unit>
-std::istream& read_unit(std::istream& s) {
-    std::ostringstream expectedBuff;
-    print_unit<Unit>(expectedBuff);
-
-    for (auto const& expected : expectedBuff.str()) {
-        char found;
-        s >> found;
-        if (!s || found != expected) {
-            s.setstate(std::ios::failbit);
-            return s;
+namespace helper {
+
+namespace print {
+
+// output of print_unit<U>, printed once
+template <typename U>
+std::string const& printed() {
+    static const std::string symbol = [] {
+        std::ostringstream s;
+        unit::print_unit<U>(s);
+        return s.str();
+    }();
+    return symbol;
+}
+}
+}
+}
+
+// src/unit/unitSymbolTable.h
+namespace unit {
+
+namespace helper {
+
+namespace hash {
+
+/**
+ * displacements of size / 2 + 1 buckets that put the keys with the given hashes on distinct slots,
+ * slots[i] is the key on slot i. The largest buckets are placed first while most slots are free.
+ * Returns false if two hashes are equal, such keys cannot be separated.
+ */
+inline bool displace(std::vector<THash> const& hashes, std::vector<THash>& displacements, std::vector<std::size_t>& slots) {
+    const std::size_t size = hashes.size();
+    const std::size_t bucketCount = size / 2 + 1;
+
+    std::vector<std::vector<std::size_t>> buckets(bucketCount);
+    std::size_t largest = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        std::vector<std::size_t>& b = buckets[hashes[i] % bucketCount];
+        for (auto k : b)
+            if (hashes[k] == hashes[i]) return false;
+        b.push_back(i);
+        if (b.size() > largest) largest = b.size();
+    }
+
+    displacements.assign(bucketCount, 0);
+    slots.assign(size, size);
+    std::vector<std::size_t> candidate;
+    for (std::size_t n = largest; n > 0; --n) {
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            if (buckets[b].size() != n) continue;
+
+            for (THash d = 1;; ++d) {
+                if (d == 0) return false;  // no displacement found
+                candidate.clear();
+                for (auto k : buckets[b]) {
+                    const std::size_t s = seeded(hashes[k], d) % size;
+                    bool taken = slots[s] != size;
+                    for (auto c : candidate) taken = taken || c == s;
+                    if (taken) break;
+                    candidate.push_back(s);
+                }
+                if (candidate.size() != n) continue;
+
+                displacements[b] = d;
+                for (std::size_t i = 0; i < n; ++i) slots[candidate[i]] = buckets[b][i];
+                break;
+            }
         }
     }
-    return s;
+    return true;
+}
 }
 
-template <typename Unit, typename TValue>
-std::istream& operator>>(std::istream& s, Quantity<Unit, TValue>& v) {
-    TValue val;
-    s >> val;
-    if (!s)
-        return s;
+namespace symbols {
 
-    if (!read_unit<Unit>(s))
-        return s;
+/**
+ * perfect hash lookup of unit symbols, built at runtime so that including a unit system costs no
+ * compile time search. The names of the entries must outlive the table.
+ */
+template <std::size_t dimensions>
+class SymbolTable {
+   public:
+    using Entry = ConversionEntry<dimensions>;
+
+    explicit SymbolTable(std::vector<Entry> const& entries) : m_maxLength(0) {
+        std::vector<hash::THash> hashes;
+        for (auto const& e : entries) {
+            const std::size_t length = std::strlen(e.name);
+            hashes.push_back(hash::murmur3(e.name, length));
+            if (length > m_maxLength) m_maxLength = length;
+        }
+        std::vector<std::size_t> slots;
+        const bool separated = hash::displace(hashes, m_displacements, slots);
+        assert(separated);  // a symbol is listed twice
+        (void)separated;
+        for (auto i : slots) m_entries.push_back(entries[i]);
+    }
 
-     v = Quantity<Unit, TValue>{val};
-    return s;
+    // nullptr for unknown symbols
+    Entry const* find(char const* symbol, std::size_t length) const {
+        return hash::find(m_entries.data(), m_entries.size(), m_displacements.data(), m_displacements.size(), symbol, length);
+    }
+
+    std::size_t max_length() const { return m_maxLength; }
+
+   private:
+    std::vector<Entry> m_entries;
+    std::vector<hash::THash> m_displacements;
+    std::size_t m_maxLength;
+};
+
+template <std::size_t dimensions>
+void addPrinted(std::vector<ConversionEntry<dimensions>>&, Printed<>) {}
+
+template <std::size_t dimensions, typename U, typename... Rest>
+void addPrinted(std::vector<ConversionEntry<dimensions>>& entries, Printed<U, Rest...>) {
+    entries.push_back(conversion_entry<U>(print::printed<U>().c_str()));
+    addPrinted(entries, Printed<Rest...>{});
 }
 
-template <typename Unit, typename TValue>
-std::ostream& operator<<(std::ostream& s, Quantity<Unit, TValue> const& v) {
-    s << v.magnitude();
-    print_unit<Unit>(s);
-    return s;
+template <std::size_t dimensions>
+std::vector<ConversionEntry<dimensions>> symbolEntries() {
+    std::vector<ConversionEntry<dimensions>> entries;
+    addPrinted(entries, typename UnitSymbols<dimensions>::printed{});
+    ConversionEntry<dimensions> const* spellings = UnitSymbols<dimensions>::spellings();
+    entries.insert(entries.end(), spellings, spellings + UnitSymbols<dimensions>::spelling_count());
+    return entries;
+}
+}
 }
 
-#endif //UNIT_HAS_STREAMS
+/**
+ * the symbols of UnitSymbols<dimensions>, built on first use
+ */
+template <std::size_t dimensions>
+helper::symbols::SymbolTable<dimensions> const& symbol_table() {
+    static const helper::symbols::SymbolTable<dimensions> table{helper::symbols::symbolEntries<dimensions>()};
+    return table;
+}
+}
+
+// src/unit/unitParsing.h
+namespace unit {
+
+/**
+ * unit of a parsed expression: one of it is scale in the coherent unit with the given exponents.
+ * The exponents are numerators over denominator, which is 1 unless there are fractional powers like "Hz^(1/2)".
+ */
+template <std::size_t dimensions>
+struct PackedUnit {
+    std::array<TExponent, dimensions> exponents;
+    double scale;
+    TExponent denominator;
+};
 
 namespace helper {
 
-template <typename ratioIn, typename ratioOut, typename T>
-constexpr T rescale(T const& v) {
-    using r = std::ratio_divide<ratioIn, ratioOut>;
-    return v * T{r::num} / T{r::den};
+namespace parsing {
+
+struct Prefix {
+    char const* symbol;
+    std::size_t length;
+    double scale;
+};
+
+// the prefixes of unitScaling.h, "da" has to be tried before "d"
+inline Prefix const* prefixes(std::size_t& count) {
+    static constexpr Prefix p[] = {
+        {"da", 2, 1e1},  {"f", 1, 1e-15},          {"p", 1, 1e-12},          {"n", 1, 1e-9},
+        {"u", 1, 1e-6},  {"\xc2\xb5", 2, 1e-6},    {"\xce\xbc", 2, 1e-6},    {"m", 1, 1e-3},
+        {"c", 1, 1e-2},  {"d", 1, 1e-1},           {"h", 1, 1e2},            {"k", 1, 1e3},
+        {"M", 1, 1e6},   {"G", 1, 1e9},            {"T", 1, 1e12},           {"P", 1, 1e15},
+    };
+    count = sizeof(p) / sizeof(p[0]);
+    return p;
 }
 
-template <typename ratioIn, typename T>
-constexpr T rescaleTo1(T const& v) {
-    return rescale<ratioIn, std::ratio<1>, T>(v);
+template <std::size_t dimensions>
+PackedUnit<dimensions> one() {
+    PackedUnit<dimensions> r;
+    r.exponents.fill(0);
+    r.scale = 1.0;
+    r.denominator = 1;
+    return r;
 }
+
+template <std::size_t dimensions>
+void reduce(PackedUnit<dimensions>& u) {
+    TExponent g = u.denominator;
+    for (std::size_t i = 0; i < dimensions; ++i) g = gcd(g, u.exponents[i]);
+    for (std::size_t i = 0; i < dimensions; ++i) u.exponents[i] /= g;
+    u.denominator /= g;
 }
 
-template<typename T> constexpr T femto(T const& v) { return helper::rescaleTo1<std::femto>(v); }
-template<typename T> constexpr T pico(T const& v) { return helper::rescaleTo1<std::pico>(v); }
-template<typename T> constexpr T nano(T const& v) { return helper::rescaleTo1<std::nano>(v); }
-template<typename T> constexpr T micro(T const& v) { return helper::rescaleTo1<std::micro>(v); }
-template<typename T> constexpr T milli(T const& v) { return helper::rescaleTo1<std::milli>(v); }
-template<typename T> constexpr T centi(T const& v) { return helper::rescaleTo1<std::centi>(v); }
-template<typename T> constexpr T deci(T const& v) { return helper::rescaleTo1<std::deci>(v); }
-template<typename T> constexpr T deca(T const& v) { return helper::rescaleTo1<std::deca>(v); }
-template<typename T> constexpr T hecto(T const& v) { return helper::rescaleTo1<std::hecto>(v); }
-template<typename T> constexpr T kilo(T const& v) { return helper::rescaleTo1<std::kilo>(v); }
-template<typename T> constexpr T mega(T const& v) { return helper::rescaleTo1<std::mega>(v); }
-template<typename T> constexpr T giga(T const& v) { return helper::rescaleTo1<std::giga>(v); }
-template<typename T> constexpr T tera(T const& v) { return helper::rescaleTo1<std::tera>(v); }
-template<typename T> constexpr T peta(T const& v) { return helper::rescaleTo1<std::peta>(v); }
+// exponents of untrusted input must not overflow
+inline bool fits(long long v) {
+    return v >= std::numeric_limits<TExponent>::min() && v <= std::numeric_limits<TExponent>::max();
+}
 
+// false if an exponent leaves the range of TExponent
+template <std::size_t dimensions>
+bool multiply(PackedUnit<dimensions>& l, PackedUnit<dimensions> const& r, int sign) {
+    const TExponent g = gcd(l.denominator, r.denominator);
+    const long long ls = r.denominator / g;
+    const long long rs = l.denominator / g;
+    for (std::size_t i = 0; i < dimensions; ++i) {
+        const long long e = ls * l.exponents[i] + sign * rs * r.exponents[i];
+        if (!fits(e)) return false;
+        l.exponents[i] = static_cast<TExponent>(e);
+    }
+    if (!fits(ls * l.denominator)) return false;
+    l.denominator = static_cast<TExponent>(ls * l.denominator);
+    if (l.denominator != 1) reduce(l);
+    l.scale = sign > 0 ? l.scale * r.scale : l.scale / r.scale;
+    return true;
+}
 
-namespace u {
+// by squaring, the cost is logarithmic in e
+inline double power(double scale, TExponent e) {
+    double r = 1.0;
+    for (unsigned long long n = e < 0 ? 0ull - static_cast<unsigned long long>(e) : static_cast<unsigned long long>(e); n != 0; n /= 2) {
+        if (n % 2 == 1) r *= scale;
+        scale *= scale;
+    }
+    return e < 0 ? 1.0 / r : r;
+}
 
+/**
+ * recursive descent parser for unit expressions like "kg*m^2/(s^2*A)", "km/h", "N.m", "kg m s^-2", "1/s" or "V/Hz^(1/2)"
+ *
+ *     expression := term (('*' | '.' | '·' | '/' | ' ') term)*
+ *     term       := factor (('^' | '**') exponent)?
+ *     exponent   := integer | '(' integer ('/' integer)? ')'
+ *     factor     := symbol | number | '(' expression ')'
+ *
+ * symbols are looked up in UnitSymbols<dimensions>, with an optional si prefix.
+ * Concatenated parsing reads the output of print_unit instead, like "m^2kgs^-2" or "Nm":
+ * symbols may follow each other without operator and are matched longest first, without prefixes.
+ */
+template <std::size_t dimensions>
+class Parser {
+   public:
+    using result_type = PackedUnit<dimensions>;
 
+    Parser(char const* begin, char const* end, bool concatenated = false)
+        : m_it(begin), m_end(end), m_concatenated(concatenated) {}
 
+    bool parse(result_type& out) {
+        skipSpace();
+        return expression(out) && (skipSpace(), m_it == m_end);
+    }
 
-using unitless = BaseUnit<-1,6>;
+   private:
+    bool expression(result_type& out) {
+        if (!term(out)) return false;
+        for (;;) {
+            const bool space = skipSpace();
+            int sign = 1;
+            if (m_it == m_end || *m_it == ')') return true;
+            if (*m_it == '*' || *m_it == '.') {
+                ++m_it;
+            } else if (*m_it == '/') {
+                ++m_it;
+                sign = -1;
+            } else if (startsWith("\xc2\xb7")) {
+                m_it += 2;
+            } else if (!space && *m_it != '(' && !(m_concatenated && isSymbolChar())) {
+                return false;
+            }
+            skipSpace();
+            result_type r;
+            if (!term(r) || !multiply(out, r, sign)) return false;
+        }
+    }
 
-using meter = BaseUnit<0,6>;
-using kilogram = BaseUnit<1,6>;
-using second = BaseUnit<2,6>;
-using ampere = BaseUnit<3,6>;
-using kelvin = BaseUnit<4,6>;
-using mole = BaseUnit<5,6>;
-using candela = BaseUnit<6,6>;
+    bool term(result_type& out) {
+        if (!factor(out)) return false;
+        char const* afterFactor = m_it;
+        skipSpace();
+        if (startsWith("**")) {
+            m_it += 2;
+        } else if (m_it != m_end && *m_it == '^') {
+            ++m_it;
+        } else {
+            m_it = afterFactor;  // the space may be a multiplication
+            return true;
+        }
+        TExponent e = 0;
+        TExponent d = 1;
+        if (!exponent(e, d)) return false;
+
+        const result_type base = out;
+        for (std::size_t i = 0; i < dimensions; ++i) {
+            const long long n = static_cast<long long>(base.exponents[i]) * e;
+            if (!fits(n)) return false;
+            out.exponents[i] = static_cast<TExponent>(n);
+        }
+        if (!fits(static_cast<long long>(base.denominator) * d)) return false;
+        out.denominator = base.denominator * d;
+        if (out.denominator != 1) reduce(out);
+        out.scale = d == 1 ? power(base.scale, e) : std::pow(base.scale, static_cast<double>(e) / d);
+        return true;
+    }
 
+    // false for numbers outside of TExponent
+    bool digits(TExponent& v) {
+        if (m_it == m_end || !isDigit(*m_it)) return false;
+        long long n = 0;
+        while (m_it != m_end && isDigit(*m_it)) {
+            n = n * 10 + (*m_it++ - '0');
+            if (!fits(n)) return false;
+        }
+        v = static_cast<TExponent>(n);
+        return true;
+    }
 
+    bool exponent(TExponent& e, TExponent& d) {
+        skipSpace();
+        const bool bracket = m_it != m_end && *m_it == '(';
+        if (bracket) ++m_it;
+
+        int sign = 1;
+        if (m_it != m_end && (*m_it == '-' || *m_it == '+')) sign = *m_it++ == '-' ? -1 : 1;
+        if (!digits(e)) return false;
+        e *= sign;
+
+        // "m^2.5" is no decimal exponent but neither m^2 times 5
+        if (!bracket && m_it != m_end && *m_it == '.' && m_it + 1 != m_end && isDigit(m_it[1])) return false;
+
+        if (bracket) {
+            if (m_it != m_end && *m_it == '/') {
+                ++m_it;
+                if (!digits(d) || d == 0) return false;
+            }
+            if (m_it == m_end || *m_it != ')') return false;
+            ++m_it;
+        }
+        return true;
+    }
 
+    bool factor(result_type& out) {
+        if (m_it == m_end) return false;
+        if (*m_it == '(') {
+            ++m_it;
+            skipSpace();
+            if (!expression(out) || m_it == m_end || *m_it != ')') return false;
+            ++m_it;
+            return true;
+        }
+        if (isDigit(*m_it) || *m_it == '.') return number(out);
+        return symbol(out);
+    }
 
-using radian = unitless;
-using steradian = unitless;
-using hertz = quotient_unit< unitless, second>;
-using newton = quotient_unit< product_unit<kilogram, meter>, sqare_unit<second>>;
-using pascal = quotient_unit< newton, sqare_unit<meter>>;
-using joule = quotient_unit< newton, meter>;
-using watt = quotient_unit< joule, second>;
-using coulomb = product_unit< second, ampere>;
-using volt = quotient_unit< watt, ampere>;
-using farad = quotient_unit< coulomb, volt>;
-using ohm = quotient_unit< volt, ampere>;
-using siemens = quotient_unit< ampere, volt>;
-using weber = product_unit< volt, second>;
-using tesla = quotient_unit< weber, sqare_unit<meter>>;
-using henry = quotient_unit< weber, ampere>;
-using lumen = product_unit< candela, steradian>;
-using lux = quotient_unit< lumen, sqare_unit<meter>>;
-using becquerel = hertz;
-using gray = quotient_unit< joule, kilogram>;
-using sievert = gray;
-using katal = quotient_unit< mole, second>;
+    bool number(result_type& out) {
+        // strtod needs a terminated string, numbers in unit expressions are short
+        char buffer[32];
+        std::size_t n = 0;
+        while (m_it + n != m_end && n + 1 < sizeof(buffer) && (isDigit(m_it[n]) || std::strchr(".eE+-", m_it[n]) != nullptr)) {
+            buffer[n] = m_it[n];
+            ++n;
+        }
+        buffer[n] = '\0';
+        char* parsedEnd = nullptr;
+        out = one<dimensions>();
+        out.scale = std::strtod(buffer, &parsedEnd);
+        if (parsedEnd == buffer) return false;
+        m_it += parsedEnd - buffer;
+        return true;
+    }
+
+    bool symbol(result_type& out) {
+        char const* begin = m_it;
+        while (m_it != m_end && isSymbolChar()) ++m_it;
+        const std::size_t length = static_cast<std::size_t>(m_it - begin);
+        if (length == 0) return false;
+
+        if (m_concatenated) {
+            const std::size_t maxLength = symbol_table<dimensions>().max_length();
+            const std::size_t longest = length < maxLength ? length : maxLength;
+            for (std::size_t n = longest; n > 0; --n) {
+                if (assign(out, begin, n, 1.0)) {
+                    m_it = begin + n;
+                    return true;
+                }
+            }
+            return false;
+        }
 
+        if (assign(out, begin, length, 1.0)) return true;
 
+        std::size_t count = 0;
+        Prefix const* p = prefixes(count);
+        for (std::size_t i = 0; i < count; ++i)
+            if (length > p[i].length && std::strncmp(begin, p[i].symbol, p[i].length) == 0 &&
+                assign(out, begin + p[i].length, length - p[i].length, p[i].scale))
+                return true;
+        return false;
+    }
 
-using meter_cubed = product_unit< meter, sqare_unit<meter>>;
-using meter_per_second = quotient_unit< meter, second>;
-using meter_per_second_squared = quotient_unit< meter, sqare_unit<second>>;
+    static bool assign(result_type& out, char const* symbol, std::size_t length, double scale) {
+        ConversionEntry<dimensions> const* e = symbol_table<dimensions>().find(symbol, length);
+        if (e == nullptr) return false;
+        for (std::size_t i = 0; i < dimensions; ++i) out.exponents[i] = e->exponents[i];
+        out.scale = scale * e->factor;
+        out.denominator = 1;
+        return true;
+    }
 
-using mol_inv = quotient_unit< unitless, mole>;
+    bool skipSpace() {
+        char const* begin = m_it;
+        while (m_it != m_end && (*m_it == ' ' || *m_it == '\t')) ++m_it;
+        return m_it != begin;
+    }
+
+    bool startsWith(char const* s) const {
+        const std::size_t n = std::strlen(s);
+        return static_cast<std::size_t>(m_end - m_it) >= n && std::strncmp(m_it, s, n) == 0;
+    }
+
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
 
+    // letters, % and multibyte characters like Ω or µ, but not the operator ·
+    bool isSymbolChar() const {
+        const unsigned char u = static_cast<unsigned char>(*m_it);
+        return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || u == '%' || u == '_' || (u >= 0x80 && !startsWith("\xc2\xb7"));
+    }
+
+    char const* m_it;
+    char const* m_end;
+    bool m_concatenated;
+};
+}
 }
 
-namespace t {
+/**
+ * parses a unit expression without caching, false if it is malformed or contains unknown symbols
+ */
+template <std::size_t dimensions>
+bool parse_unit_uncached(char const* begin, char const* end, PackedUnit<dimensions>& out) {
+    out = helper::parsing::one<dimensions>();
+    return helper::parsing::Parser<dimensions>{begin, end}.parse(out);
+}
 
-    using def = UNIT_BASETYPE;
+/**
+ * parses a unit in the concatenated form of print_unit, eg "N", "mkgs^-2" or "Nm", false for unknown symbols
+ */
+template <std::size_t dimensions>
+bool parse_printed_unit(char const* begin, char const* end, PackedUnit<dimensions>& out) {
+    out = helper::parsing::one<dimensions>();
+    return helper::parsing::Parser<dimensions>{begin, end, true}.parse(out);
+}
 
+/**
+ * parses a unit expression, eg "kg*m^2/(s^2*A)" or "mN.km"
+ *
+ * valid expressions are cached per thread, so repeated expressions only cost a hash lookup.
+ * The cache is meant for the limited set of units of configs and file headers, it is cleared
+ * when it reaches parse_unit_cache_size entries so that arbitrary input cannot grow it.
+ */
+constexpr std::size_t parse_unit_cache_size() { return 1024; }
+
+template <std::size_t dimensions>
+bool parse_unit(std::string const& expression, PackedUnit<dimensions>& out) {
+    using Cache = std::unordered_map<std::string, PackedUnit<dimensions>>;
+    static thread_local Cache cache;
+
+    auto it = cache.find(expression);
+    if (it != cache.end()) {
+        out = it->second;
+        return true;
+    }
+    if (!parse_unit_uncached(expression.data(), expression.data() + expression.size(), out)) return false;
+    if (cache.size() >= parse_unit_cache_size()) cache.clear();
+    cache.emplace(expression, out);
+    return true;
+}
+}
 
-    using unitless = Quantity<u::unitless, def>;
-    using meter = Quantity<u::meter, def>;
-    using kilogram = Quantity<u::kilogram, def>;
-    using second = Quantity<u::second, def>;
-    using ampere = Quantity<u::ampere, def>;
-    using kelvin = Quantity<u::kelvin, def>;
-    using mole = Quantity<u::mole, def>;
-    using candela = Quantity<u::candela, def>;
+// src/unit/unitReading.h
+namespace unit {
 
+namespace helper {
 
-    using radian = Quantity<u::radian, def>;
-    using steradian = Quantity<u::steradian, def>;
-    using hertz = Quantity<u::hertz, def>;
-    using newton = Quantity<u::newton, def>;
-    using pascal = Quantity<u::pascal, def>;
-    using joule = Quantity<u::joule, def>;
-    using watt = Quantity<u::watt, def>;
-    using coulomb = Quantity<u::coulomb, def>;
-    using volt = Quantity<u::volt, def>;
-    using farad = Quantity<u::farad, def>;
-    using ohm = Quantity<u::ohm, def>;
-    using siemens = Quantity<u::siemens, def>;
-    using weber = Quantity<u::weber, def>;
-    using tesla = Quantity<u::tesla, def>;
-    using henry = Quantity<u::henry, def>;
-    using lumen = Quantity<u::lumen, def>;
-    using lux = Quantity<u::lux, def>;
-    using becquerel = Quantity<u::becquerel, def>;
-    using gray = Quantity<u::gray, def>;
-    using sievert = Quantity<u::sievert, def>;
-    using katal = Quantity<u::katal, def>;
+namespace reading {
 
+// characters after which a completely read printed spelling goes on, eg "m" of "mol" or of "m^2"
+inline bool extendsSymbol(int c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80 || c == '%' || c == '^';
+}
 
-    using meter_cubed = Quantity<u::meter_cubed, def>;
+/**
+ * characters of the spellings parse_printed_unit accepts, up to the first one that cannot belong
+ * to the unit: a closing bracket without an open one or a sign not following '^' or '('
+ */
+inline bool continuesUnit(int c, char previous, int& depth) {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c >= 0x80) return true;
+    switch (c) {
+        case '^': case '%': case '_': case '*': case '/':
+            return true;
+        case '(':
+            ++depth;
+            return true;
+        case ')':
+            if (depth == 0) return false;
+            --depth;
+            return true;
+        case '-': case '+':
+            return previous == '^' || previous == '(';
+        default:
+            return false;
+    }
+}
+}
 }
 
+/**
+ * reads the unit U from s, the failbit is set if another unit is found
+ *
+ * Besides the output of print_unit<U> every equivalent spelling made of the symbols of the unit
+ * system is accepted, eg "N", "mkgs^-2" or "kg*m/s^2" for a newton. Symbols with a scale other
+ * than one (like "g" or "h") are rejected, reading never converts. The printed spelling ends the
+ * unit unless a symbol or exponent follows, so "1m)" or "1m*2" read a meter and leave the rest.
+ */
+template <typename Unit>
+std::istream& read_unit(std::istream& s) {
+    static constexpr std::size_t dimensions = Unit::exponent_count();
+
+    // a unit printed as nothing must not swallow the next word
+    std::string const& expected = helper::print::printed<Unit>();
+    if (expected.empty()) return s;
+
+    s >> std::ws;
+    char buffer[64];
+    std::size_t n = 0;
+
+    // the printed spelling needs no look-ahead, what follows it stays in the stream
+    while (n < expected.size() && n < sizeof(buffer) && s.peek() == static_cast<unsigned char>(expected[n]))
+        buffer[n++] = static_cast<char>(s.get());
+    if (n == expected.size() && !helper::reading::extendsSymbol(s.peek())) return s;
+
+    int depth = 0;
+    for (std::size_t i = 0; i < n; ++i) helper::reading::continuesUnit(static_cast<unsigned char>(buffer[i]), i == 0 ? '\0' : buffer[i - 1], depth);
+    while (n < sizeof(buffer) && helper::reading::continuesUnit(s.peek(), n == 0 ? '\0' : buffer[n - 1], depth))
+        buffer[n++] = static_cast<char>(s.get());
+
+    PackedUnit<dimensions> p;
+    if (n == sizeof(buffer) || !parse_printed_unit(buffer, buffer + n, p) || p.scale != 1.0 ||
+        !helper::conversion::Exponents<Unit>::equal(p.exponents.data(), p.denominator))
+        s.setstate(std::ios::failbit);
+    return s;
+}
+}
+
+// src/quantity/quantityReading.h
+namespace unit {
 
-constexpr t::unitless unitless{1};
-constexpr t::unitless number{1};
-constexpr t::meter meter{1};
-constexpr t::kilogram kilogram{1};
-constexpr t::second second{1};
-constexpr t::ampere ampere{1};
-constexpr t::kelvin kelvin{1};
-constexpr t::mole mole{1};
-constexpr t::candela candela{1};
-
-
-constexpr t::radian radian{1};
-constexpr t::steradian steradian{1};
-constexpr t::hertz hertz{1};
-constexpr t::newton newton{1};
-constexpr t::pascal pascal{1};
-constexpr t::joule joule{1};
-constexpr t::watt watt{1};
-constexpr t::coulomb coulomb{1};
-constexpr t::volt volt{1};
-constexpr t::farad farad{1};
-constexpr t::ohm ohm{1};
-constexpr t::siemens siemens{1};
-constexpr t::weber weber{1};
-constexpr t::tesla tesla{1};
-constexpr t::henry henry{1};
-constexpr t::lumen lumen{1};
-constexpr t::lux lux{1};
-constexpr t::becquerel becquerel{1};
-constexpr t::gray gray{1};
-constexpr t::sievert sievert{1};
-constexpr t::katal katal{1};
-
-
-constexpr t::meter inch{centi(2.54)};
-constexpr t::meter food{0.3048};
-constexpr t::meter mile{1609.344};
-constexpr t::meter yard{0.9144};
-constexpr t::kilogram pound{0.45359237};
-constexpr t::kilogram ounce{0.02834952};
-constexpr t::kilogram gram{helper::rescale<std::ratio<1>,std::kilo>(1.0)};
-constexpr t::second minute{60};
-constexpr t::second hour{60*60};
-constexpr t::second day{60*60*24};
-constexpr t::joule calorie{4.184};
-constexpr t::joule watt_hour{3600};
-constexpr t::meter_cubed liter{0.001};
-constexpr t::meter_cubed gallon{3.785412 * 0.001};
-constexpr t::pascal bar{kilo(100)};
-constexpr t::unitless parts_per_million{micro(1.0)};
-constexpr t::unitless percent{centi(1.0)};
-
-
-
-
-
-constexpr t::kelvin celsius ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>(v+273.15)};}
-constexpr t::kelvin fahrenheit ( UNIT_BASETYPE v ){ return t::kelvin {static_cast<UNIT_BASETYPE>((v+459.67)*5.0/9.0)};}
+template <typename Unit, typename TValue>
+std::istream& operator>>(std::istream& s, Quantity<Unit, TValue>& v) {
+    TValue val;
+    s >> val;
+    if (!s)
+        return s;
 
+    if (!read_unit<Unit>(s))
+        return s;
 
-namespace literals {
+     v = Quantity<Unit, TValue>{val};
+    return s;
+}
+}
+
+// src/quantity/quantityFormatting.h
+namespace unit {
+
+namespace helper {
 
-constexpr t::unitless operator"" _unitless ( long double v ) {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
-constexpr t::unitless operator"" _number ( long double v ) {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
-constexpr t::unitless operator"" _n ( long double v ) {return t::unitless {static_cast<UNIT_BASETYPE>(v)};}
-constexpr t::newton operator"" _newton ( long double v ) {return t::newton {static_cast<UNIT_BASETYPE>(v)};}
+namespace formatting {
 
+/**
+ * shortest round trip formatting of floating point magnitudes with Grisu2 (Loitsch, "Printing
+ * floating-point numbers quickly and accurately with integers"). The digits always read back to
+ * the same value, they are the shortest ones for almost all inputs.
+ */
+
+// f * 2^e
+struct DiyFp {
+    std::uint64_t f;
+    int e;
+};
+
+inline DiyFp subtract(DiyFp x, DiyFp y) { return DiyFp{x.f - y.f, x.e}; }
+
+// upper 64 bits of the 128 bit product, rounded
+inline DiyFp multiply(DiyFp x, DiyFp y) {
+    const std::uint64_t lowMask = 0xFFFFFFFFu;
+    const std::uint64_t a = x.f >> 32, b = x.f & lowMask, c = y.f >> 32, d = y.f & lowMask;
+    const std::uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    const std::uint64_t middle = (bd >> 32) + (ad & lowMask) + (bc & lowMask) + (std::uint64_t{1} << 31);
+    return DiyFp{ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64};
 }
 
+inline DiyFp normalize(DiyFp x) {
+    while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        --x.e;
+    }
+    return x;
+}
 
-template<typename U> constexpr const char* unitSymbol();
-template<> inline constexpr const char* unitSymbol< u::meter>(){ return "m";}
-template<> inline constexpr const char* unitSymbol<u::kilogram>(){ return "kg";}
-template<> inline constexpr const char* unitSymbol< u::second>(){ return "s";}
-template<> inline constexpr const char* unitSymbol< u::ampere>(){ return "A";}
-template<> inline constexpr const char* unitSymbol< u::kelvin>(){ return "K";}
-template<> inline constexpr const char* unitSymbol< u::mole>(){ return "mol";}
-template<> inline constexpr const char* unitSymbol< u::candela>(){ return "cd";}
+inline DiyFp normalizeTo(DiyFp x, int e) { return DiyFp{x.f << (x.e - e), e}; }
 
+// v and the boundaries of its rounding interval, v has to be positive and finite
+struct Boundaries {
+    DiyFp v;
+    DiyFp minus;
+    DiyFp plus;
+};
 
-#ifdef UNIT_HAS_STREAMS
-template<typename U> void print_unit(std::ostream& s);
+template <typename T>
+Boundaries boundaries(T value) {
+    static_assert(std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8), "ieee single or double precision");
+    using Bits = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    constexpr int precision = std::numeric_limits<T>::digits;
+    constexpr int bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    constexpr std::uint64_t hiddenBit = std::uint64_t{1} << (precision - 1);
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const std::uint64_t exponent = static_cast<std::uint64_t>(bits) >> (precision - 1);
+    const std::uint64_t fraction = static_cast<std::uint64_t>(bits) & (hiddenBit - 1);
+
+    const DiyFp v = exponent == 0 ? DiyFp{fraction, 1 - bias} : DiyFp{fraction + hiddenBit, static_cast<int>(exponent) - bias};
+    // the next smaller value is closer at powers of two
+    const bool lowerCloser = fraction == 0 && exponent > 1;
+    const DiyFp plus = normalize(DiyFp{2 * v.f + 1, v.e - 1});
+    const DiyFp minus = lowerCloser ? DiyFp{4 * v.f - 1, v.e - 2} : DiyFp{2 * v.f - 1, v.e - 1};
+    return Boundaries{normalize(v), normalizeTo(minus, plus.e), plus};
+}
 
+// f * 2^e ~ 10^k
+struct CachedPower {
+    std::uint64_t f;
+    int e;
+    int k;
+};
+
+// the scaled value has a binary exponent in [alpha, gamma]
+constexpr int alpha = -60;
+constexpr int gamma = -32;
+
+inline CachedPower cachedPower(int e) {
+    static constexpr CachedPower powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300}, {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284}, {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268}, {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252}, {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236}, {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220}, {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204}, {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188}, {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172}, {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156}, {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140}, {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124}, {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108}, {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92}, {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76}, {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60}, {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44}, {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28}, {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12}, {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4}, {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20}, {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36}, {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52}, {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68}, {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84}, {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100}, {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116}, {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132}, {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148}, {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164}, {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180}, {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196}, {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212}, {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228}, {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244}, {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260}, {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276}, {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292}, {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308}, {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324}, {0xEB96BF6EBADF77D9, 1039, 332},
+        {0xAF87023B9BF0EE6B, 1066, 340},
+    };
+    constexpr int firstK = -300;
+    constexpr int kStep = 8;
+
+    // ceil(log10(2) * (alpha - e - 1)), rounded up to the next cached power
+    const int f = alpha - e - 1;
+    const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+    return powers[(-firstK + k + (kStep - 1)) / kStep];
+}
 
-template<> inline void print_unit< u::hertz>(std::ostream& s){ s<<"Hz"; }
-template<> inline void print_unit< u::newton>(std::ostream& s){ s<<"N"; }
-template<> inline void print_unit< u::pascal>(std::ostream& s){ s<<"Pa"; }
-template<> inline void print_unit< u::joule>(std::ostream& s){ s<<"J"; }
-template<> inline void print_unit< u::watt>(std::ostream& s){ s<<"W"; }
-template<> inline void print_unit< u::coulomb>(std::ostream& s){ s<<"C"; }
-template<> inline void print_unit< u::volt>(std::ostream& s){ s<<"V"; }
-template<> inline void print_unit< u::farad>(std::ostream& s){ s<<"F"; }
-template<> inline void print_unit< u::ohm>(std::ostream& s){ s<<"Ohm"; }
-template<> inline void print_unit< u::siemens>(std::ostream& s){ s<<"S"; }
-template<> inline void print_unit< u::weber>(std::ostream& s){ s<<"Wb"; }
-template<> inline void print_unit< u::tesla>(std::ostream& s){ s<<"T"; }
-template<> inline void print_unit< u::henry>(std::ostream& s){ s<<"H"; }
-template<> inline void print_unit< u::lumen>(std::ostream& s){ s<<"lm"; }
-template<> inline void print_unit< u::lux>(std::ostream& s){ s<<"Lx"; }
+inline int largestPow10(std::uint32_t n, std::uint32_t& pow10) {
+    int digits = 10;
+    pow10 = 1000000000;
+    while (digits > 1 && n < pow10) {
+        pow10 /= 10;
+        --digits;
+    }
+    return digits;
+}
 
-template<> inline void print_unit< u::gray>(std::ostream& s){ s<<"Gy"; }
+// moves the last digit towards w while the result stays inside the interval
+inline void round(char* digits, int length, std::uint64_t distance, std::uint64_t delta, std::uint64_t rest, std::uint64_t tenK) {
+    while (rest < distance && delta - rest >= tenK && (rest + tenK < distance || distance - rest > rest + tenK - distance)) {
+        --digits[length - 1];
+        rest += tenK;
+    }
+}
 
-template<> inline void print_unit< u::katal>(std::ostream& s){ s<<"ka"; }
+inline void generateDigits(char* digits, int& length, int& decimalExponent, DiyFp minus, DiyFp w, DiyFp plus) {
+    std::uint64_t delta = subtract(plus, minus).f;
+    std::uint64_t distance = subtract(plus, w).f;
+
+    const DiyFp one{std::uint64_t{1} << -plus.e, plus.e};
+    std::uint32_t integral = static_cast<std::uint32_t>(plus.f >> -one.e);
+    std::uint64_t fractional = plus.f & (one.f - 1);
+
+    std::uint32_t pow10 = 0;
+    for (int n = largestPow10(integral, pow10); n > 0;) {
+        digits[length++] = static_cast<char>('0' + integral / pow10);
+        integral %= pow10;
+        --n;
+        const std::uint64_t rest = (std::uint64_t{integral} << -one.e) + fractional;
+        if (rest <= delta) {
+            decimalExponent += n;
+            round(digits, length, distance, delta, rest, std::uint64_t{pow10} << -one.e);
+            return;
+        }
+        pow10 /= 10;
+    }
 
-#endif
+    int m = 0;
+    for (;;) {
+        fractional *= 10;
+        digits[length++] = static_cast<char>('0' + (fractional >> -one.e));
+        fractional &= one.f - 1;
+        ++m;
+        delta *= 10;
+        distance *= 10;
+        if (fractional <= delta) break;
+    }
+    decimalExponent -= m;
+    round(digits, length, distance, delta, fractional, one.f);
+}
+
+// digits * 10^decimalExponent == value, value positive and finite
+template <typename T>
+void grisu2(T value, char* digits, int& length, int& decimalExponent) {
+    const Boundaries b = boundaries(value);
+    const CachedPower c = cachedPower(b.plus.e);
+    const DiyFp power{c.f, c.e};
+
+    const DiyFp w = multiply(b.v, power);
+    const DiyFp minus = multiply(b.minus, power);
+    const DiyFp plus = multiply(b.plus, power);
+
+    // stay inside the interval despite the rounding of the products
+    length = 0;
+    decimalExponent = -c.k;
+    generateDigits(digits, length, decimalExponent, DiyFp{minus.f + 1, minus.e}, w, DiyFp{plus.f - 1, plus.e});
+}
+
+inline char* writeExponent(char* out, int e) {
+    *out++ = 'e';
+    if (e < 0) {
+        *out++ = '-';
+        e = -e;
+    } else {
+        *out++ = '+';
+    }
+    if (e >= 100) *out++ = static_cast<char>('0' + e / 100);
+    if (e >= 10) *out++ = static_cast<char>('0' + e / 10 % 10);
+    *out++ = static_cast<char>('0' + e % 10);
+    return out;
+}
+
+// enough for sign, 17 digits, point and exponent
+constexpr std::size_t maxLength = 32;
+
+/**
+ * writes the shortest digits that read back to value, without terminating zero, and returns the length.
+ * Fixed notation for decimal exponents in [-5, 21), like "0.001" or "1500", scientific otherwise.
+ */
+template <typename T>
+std::size_t shortest(T value, char* out) {
+    char* begin = out;
+    if (value != value) {
+        std::memcpy(out, "nan", 3);
+        return 3;
+    }
+    if (std::signbit(value)) {
+        *out++ = '-';
+        value = -value;
+    }
+    if (value == std::numeric_limits<T>::infinity()) {
+        std::memcpy(out, "inf", 3);
+        return static_cast<std::size_t>(out - begin) + 3;
+    }
+    if (value == 0) {
+        *out++ = '0';
+        return static_cast<std::size_t>(out - begin);
+    }
+
+    char digits[20];
+    int length = 0;
+    int exponent = 0;
+    grisu2(value, digits, length, exponent);
+    // position of the decimal point relative to the first digit
+    const int point = length + exponent;
+
+    if (length <= point && point <= 21) {
+        // 1500
+        std::memcpy(out, digits, static_cast<std::size_t>(length));
+        out += length;
+        for (int i = length; i < point; ++i) *out++ = '0';
+    } else if (0 < point && point <= 21) {
+        // 1.5
+        std::memcpy(out, digits, static_cast<std::size_t>(point));
+        out += point;
+        *out++ = '.';
+        std::memcpy(out, digits + point, static_cast<std::size_t>(length - point));
+        out += length - point;
+    } else if (-5 < point && point <= 0) {
+        // 0.0015
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = point; i < 0; ++i) *out++ = '0';
+        std::memcpy(out, digits, static_cast<std::size_t>(length));
+        out += length;
+    } else {
+        // 1.5e-20
+        *out++ = digits[0];
+        if (length > 1) {
+            *out++ = '.';
+            std::memcpy(out, digits + 1, static_cast<std::size_t>(length - 1));
+            out += length - 1;
+        }
+        out = writeExponent(out, point - 1);
+    }
+    return static_cast<std::size_t>(out - begin);
+}
+}
+}
 }
 
+// src/quantity/quantityPrinting.h
+namespace unit {
+
+namespace helper {
+
+namespace printing {
+
+inline int roundTripIndex() {
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
+template <typename T>
+void printMagnitude(std::ostream& s, T const& v) {
+    s << v;
+}
+
+template <typename T>
+void printShortest(std::ostream& s, T v) {
+    if (!s.iword(roundTripIndex())) {
+        s << v;
+        return;
+    }
+    char buffer[formatting::maxLength];
+    const std::size_t n = formatting::shortest(v, buffer);
+    if (s.width() == 0)
+        s.write(buffer, static_cast<std::streamsize>(n));
+    else
+        s << std::string(buffer, n);
+}
+
+inline void printMagnitude(std::ostream& s, double v) { printShortest(s, v); }
+inline void printMagnitude(std::ostream& s, float v) { printShortest(s, v); }
+
+// the format of operator<< for std::complex
+template <typename T>
+void printMagnitude(std::ostream& s, std::complex<T> const& v) {
+    if (!s.iword(roundTripIndex())) {
+        s << v;
+        return;
+    }
+    s << '(';
+    printMagnitude(s, v.real());
+    s << ',';
+    printMagnitude(s, v.imag());
+    s << ')';
+}
+}
+}
+
+/**
+ * stream manipulator for printing float and double magnitudes with the shortest digits that read
+ * back to the same value, independent of the precision of the stream:
+ *
+ *     s << round_trip << q;  // "0.1N" or "0.30000000000000004N"
+ *     s >> r;                // r == q
+ *
+ * stream_precision switches back to the formatting of the stream.
+ */
+inline std::ios_base& round_trip(std::ios_base& s) {
+    s.iword(helper::printing::roundTripIndex()) = 1;
+    return s;
+}
+
+inline std::ios_base& stream_precision(std::ios_base& s) {
+    s.iword(helper::printing::roundTripIndex()) = 0;
+    return s;
+}
+
+template <typename Unit, typename TValue>
+std::ostream& operator<<(std::ostream& s, Quantity<Unit, TValue> const& v) {
+    helper::printing::printMagnitude(s, v.magnitude());
+    print_unit<Unit>(s);
+    return s;
+}
+}
 
+#endif // UNIT_NO_STREAMS